@@ -143,7 +143,7 @@ ProgramBinary *readBinary(const std::string &srcPath)
         in.read((char *)&bytes[0], size);
         DE_ASSERT(bytes[0] != 0);
 
-        return new ProgramBinary(vk::PROGRAM_FORMAT_SPIRV, bytes.size(), &bytes[0]);
+        return new ProgramBinary(vk::PROGRAM_FORMAT_SPIRV, std::move(bytes));
     }
 }
 
@@ -474,6 +474,7 @@ void BinaryRegistryWriter::addBinary(uint32_t index, const ProgramBinary &binary
     DE_ASSERT(binary.getFormat() == vk::PROGRAM_FORMAT_SPIRV);
     DE_ASSERT(findBinary(binary) == DE_NULL);
 
+    // Shares the bytes of binary
     ProgramBinary *const binaryClone = new ProgramBinary(binary);
 
     try
@@ -594,7 +595,7 @@ ProgramBinary *BinaryRegistryReader::loadProgram(const ProgramIdentifier &id) co
 
                 progRes->read(&bytes[0], progSize);
 
-                return new ProgramBinary(vk::PROGRAM_FORMAT_SPIRV, bytes.size(), &bytes[0]);
+                return new ProgramBinary(vk::PROGRAM_FORMAT_SPIRV, std::move(bytes));
             }
             catch (const tcu::ResourceError &e)
             {
@@ -30,6 +30,7 @@
 #include "vkRefUtil.hpp"
 #include "vkImageUtil.hpp"
 #include "deInt32.h"
+#include "tcuInstrumentation.hpp"
 
 #include <sstream>
 
@@ -211,6 +212,8 @@ SimpleAllocator::SimpleAllocator(const DeviceInterface &vk, VkDevice device,
 
 MovePtr<Allocation> SimpleAllocator::allocate(const VkMemoryAllocateInfo &allocInfo, VkDeviceSize alignment)
 {
+    const tcu::ScopedPhaseTimer timer(tcu::INSTRUMENTATION_PHASE_MEMORY_ALLOCATION);
+
     // Align the offset to the requirements.
     // Aligning to the non coherent atom size prevents flush and memory invalidation valid usage errors.
     const auto requiredAlignment =
@@ -223,6 +226,9 @@ MovePtr<Allocation> SimpleAllocator::allocate(const VkMemoryAllocateInfo &allocI
     Move<VkDeviceMemory> mem = allocateMemory(m_vk, m_device, &info);
     MovePtr<HostPtr> hostPtr;
 
+    tcu::addInstrumentationCounter(tcu::INSTRUMENTATION_COUNTER_DEVICE_ALLOCATIONS);
+    tcu::addInstrumentationCounter(tcu::INSTRUMENTATION_COUNTER_DEVICE_ALLOCATION_BYTES, info.allocationSize);
+
     if (isHostVisibleMemory(m_memProps, info.memoryTypeIndex))
         hostPtr = MovePtr<HostPtr>(new HostPtr(m_vk, m_device, *mem, offset, info.allocationSize, 0u));
 
@@ -231,6 +237,7 @@ MovePtr<Allocation> SimpleAllocator::allocate(const VkMemoryAllocateInfo &allocI
 
 MovePtr<Allocation> SimpleAllocator::allocate(const VkMemoryRequirements &memReqs, MemoryRequirement requirement)
 {
+    const tcu::ScopedPhaseTimer timer(tcu::INSTRUMENTATION_PHASE_MEMORY_ALLOCATION);
     const auto memoryTypeNdx = selectMatchingMemoryType(m_memProps, memReqs.memoryTypeBits, requirement);
 
     // Align the offset to the requirements.
@@ -265,6 +272,9 @@ MovePtr<Allocation> SimpleAllocator::allocate(const VkMemoryRequirements &memReq
     Move<VkDeviceMemory> mem = allocateMemory(m_vk, m_device, &allocInfo);
     MovePtr<HostPtr> hostPtr;
 
+    tcu::addInstrumentationCounter(tcu::INSTRUMENTATION_COUNTER_DEVICE_ALLOCATIONS);
+    tcu::addInstrumentationCounter(tcu::INSTRUMENTATION_COUNTER_DEVICE_ALLOCATION_BYTES, allocInfo.allocationSize);
+
     if (requirement & MemoryRequirement::HostVisible)
     {
         DE_ASSERT(isHostVisibleMemory(m_memProps, allocInfo.memoryTypeIndex));
@@ -1787,6 +1787,209 @@ void ShaderWrapper::getShaderBinary(void)
 }
 #endif
 
+GraphicsPipelineLibraryCache::GraphicsPipelineLibraryCache(VkDevice device) : m_device(device)
+{
+}
+
+GraphicsPipelineLibraryCache::~GraphicsPipelineLibraryCache(void)
+{
+}
+
+GraphicsPipelineLibraryCache::PartPtr GraphicsPipelineLibraryCache::find(const Key &key) const
+{
+    const de::ScopedLock lock(m_mutex);
+    const auto iter = m_parts.find(key);
+
+    return (iter != m_parts.end()) ? iter->second : PartPtr();
+}
+
+GraphicsPipelineLibraryCache::PartPtr GraphicsPipelineLibraryCache::insert(const Key &key, Move<VkPipeline> part)
+{
+    const de::ScopedLock lock(m_mutex);
+    PartPtr &entry = m_parts[key];
+
+    if (!entry)
+        entry = PartPtr(new Move<VkPipeline>(part));
+
+    return entry;
+}
+
+size_t GraphicsPipelineLibraryCache::getNumParts(void) const
+{
+    const de::ScopedLock lock(m_mutex);
+    return m_parts.size();
+}
+
+#ifndef CTS_USES_VULKANSC
+namespace
+{
+
+// Canonical description of the create info of a pipeline library part. Parts with equal keys are
+// interchangeable. Extension structures are not described, so a part using any is not cacheable.
+class LibraryPartKeyBuilder
+{
+public:
+    LibraryPartKeyBuilder(VkGraphicsPipelineLibraryFlagsEXT partFlag, VkPipelineCreateFlags createFlags)
+        : m_cacheable(true)
+    {
+        const VkPipelineCreateFlags sharableFlags =
+            VK_PIPELINE_CREATE_LIBRARY_BIT_KHR | VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
+
+        // Other flags change how the part is created, which is what the case is looking at.
+        if ((createFlags & ~sharableFlags) != 0u)
+            m_cacheable = false;
+
+        add(partFlag);
+        add(createFlags);
+    }
+
+    bool isCacheable(void) const
+    {
+        return m_cacheable;
+    }
+    const GraphicsPipelineLibraryCache::Key &getKey(void) const
+    {
+        return m_key;
+    }
+
+    void add(uint32_t value)
+    {
+        m_key.push_back(value);
+    }
+    void add(float value)
+    {
+        uint32_t bits;
+        deMemcpy(&bits, &value, sizeof(bits));
+        add(bits);
+    }
+    void addChain(const void *pNext)
+    {
+        if (pNext != nullptr)
+            m_cacheable = false;
+    }
+    // Marks presence of an optional structure, returns true if it needs to be described.
+    bool addPresence(const void *ptr)
+    {
+        add(ptr != nullptr ? 1u : 0u);
+        return ptr != nullptr;
+    }
+
+    void addDynamicStates(const std::vector<VkDynamicState> &states)
+    {
+        add((uint32_t)states.size());
+        for (const auto state : states)
+            add((uint32_t)state);
+    }
+
+    void addVertexInputState(const VkPipelineVertexInputStateCreateInfo *info)
+    {
+        if (!addPresence(info))
+            return;
+
+        addChain(info->pNext);
+        add(info->flags);
+        add(info->vertexBindingDescriptionCount);
+        for (uint32_t ndx = 0u; ndx < info->vertexBindingDescriptionCount; ++ndx)
+        {
+            add(info->pVertexBindingDescriptions[ndx].binding);
+            add(info->pVertexBindingDescriptions[ndx].stride);
+            add((uint32_t)info->pVertexBindingDescriptions[ndx].inputRate);
+        }
+        add(info->vertexAttributeDescriptionCount);
+        for (uint32_t ndx = 0u; ndx < info->vertexAttributeDescriptionCount; ++ndx)
+        {
+            add(info->pVertexAttributeDescriptions[ndx].location);
+            add(info->pVertexAttributeDescriptions[ndx].binding);
+            add((uint32_t)info->pVertexAttributeDescriptions[ndx].format);
+            add(info->pVertexAttributeDescriptions[ndx].offset);
+        }
+    }
+
+    void addInputAssemblyState(const VkPipelineInputAssemblyStateCreateInfo *info)
+    {
+        if (!addPresence(info))
+            return;
+
+        addChain(info->pNext);
+        add(info->flags);
+        add((uint32_t)info->topology);
+        add(info->primitiveRestartEnable);
+    }
+
+    void addColorBlendState(const VkPipelineColorBlendStateCreateInfo *info)
+    {
+        if (!addPresence(info))
+            return;
+
+        addChain(info->pNext);
+        add(info->flags);
+        add(info->logicOpEnable);
+        add((uint32_t)info->logicOp);
+        add(info->attachmentCount);
+        if (addPresence(info->pAttachments))
+        {
+            for (uint32_t ndx = 0u; ndx < info->attachmentCount; ++ndx)
+            {
+                const VkPipelineColorBlendAttachmentState &attachment = info->pAttachments[ndx];
+
+                add(attachment.blendEnable);
+                add((uint32_t)attachment.srcColorBlendFactor);
+                add((uint32_t)attachment.dstColorBlendFactor);
+                add((uint32_t)attachment.colorBlendOp);
+                add((uint32_t)attachment.srcAlphaBlendFactor);
+                add((uint32_t)attachment.dstAlphaBlendFactor);
+                add((uint32_t)attachment.alphaBlendOp);
+                add(attachment.colorWriteMask);
+            }
+        }
+        for (const float blendConstant : info->blendConstants)
+            add(blendConstant);
+    }
+
+    void addMultisampleState(const VkPipelineMultisampleStateCreateInfo *info)
+    {
+        if (!addPresence(info))
+            return;
+
+        addChain(info->pNext);
+        add(info->flags);
+        add((uint32_t)info->rasterizationSamples);
+        add(info->sampleShadingEnable);
+        add(info->minSampleShading);
+        if (addPresence(info->pSampleMask))
+        {
+            for (uint32_t ndx = 0u; ndx < ((uint32_t)info->rasterizationSamples + 31u) / 32u; ++ndx)
+                add(info->pSampleMask[ndx]);
+        }
+        add(info->alphaToCoverageEnable);
+        add(info->alphaToOneEnable);
+    }
+
+    void addRenderingState(const VkPipelineRenderingCreateInfoKHR *info)
+    {
+        if (!addPresence(info))
+            return;
+
+        addChain(info->pNext);
+        add(info->viewMask);
+        add(info->colorAttachmentCount);
+        if (addPresence(info->pColorAttachmentFormats))
+        {
+            for (uint32_t ndx = 0u; ndx < info->colorAttachmentCount; ++ndx)
+                add((uint32_t)info->pColorAttachmentFormats[ndx]);
+        }
+        add((uint32_t)info->depthAttachmentFormat);
+        add((uint32_t)info->stencilAttachmentFormat);
+    }
+
+private:
+    GraphicsPipelineLibraryCache::Key m_key;
+    bool m_cacheable;
+};
+
+} // namespace
+#endif // CTS_USES_VULKANSC
+
 // Structure storing *CreateInfo structures that do not need to exist in memory after pipeline was constructed.
 struct GraphicsPipelineWrapper::InternalData
 {
@@ -1798,6 +2001,7 @@ struct GraphicsPipelineWrapper::InternalData
     const PipelineConstructionType pipelineConstructionType;
     const VkPipelineCreateFlags pipelineFlags;
     PipelineCreateFlags2 pipelineFlags2;
+    GraphicsPipelineLibraryCache *libraryCache;
 
     // attribute used for making sure pipeline is configured in correct order
     int setupState;
@@ -1948,6 +2152,7 @@ struct GraphicsPipelineWrapper::InternalData
         , pipelineConstructionType    (constructionType)
         , pipelineFlags                (pipelineCreateFlags)
         , pipelineFlags2            (0u)
+        , libraryCache                (nullptr)
         , setupState                (PSS_NONE)
         , inputAssemblyState
         {
@@ -2031,6 +2236,8 @@ GraphicsPipelineWrapper::GraphicsPipelineWrapper(GraphicsPipelineWrapper &&pw) n
     , m_internalData(pw.m_internalData)
 {
     std::move(pw.m_pipelineParts, pw.m_pipelineParts + de::arrayLength(pw.m_pipelineParts), m_pipelineParts);
+    std::move(pw.m_sharedPipelineParts, pw.m_sharedPipelineParts + de::arrayLength(pw.m_sharedPipelineParts),
+              m_sharedPipelineParts);
 }
 
 GraphicsPipelineWrapper &GraphicsPipelineWrapper::setMonolithicPipelineLayout(const PipelineLayoutWrapper &layout)
@@ -2074,6 +2281,16 @@ GraphicsPipelineWrapper &GraphicsPipelineWrapper::setPipelineCreateFlags2(Pipeli
     return *this;
 }
 
+GraphicsPipelineWrapper &GraphicsPipelineWrapper::setPipelineLibraryCache(GraphicsPipelineLibraryCache *cache)
+{
+    // make sure states are not yet setup
+    DE_ASSERT(m_internalData && m_internalData->setupState == PSS_NONE);
+    DE_ASSERT(!cache || cache->getDevice() == m_internalData->device);
+
+    m_internalData->libraryCache = cache;
+    return *this;
+}
+
 std::vector<VkDynamicState> getDynamicStates(const VkPipelineDynamicStateCreateInfo *dynamicStateInfo,
                                              uint32_t setupState)
 {
@@ -2443,6 +2660,19 @@ GraphicsPipelineWrapper &GraphicsPipelineWrapper::setupVertexInputState(
         if (m_internalData->pipelineConstructionType == PIPELINE_CONSTRUCTION_TYPE_LINK_TIME_OPTIMIZED_LIBRARY)
             pipelinePartCreateInfo.flags |= VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
 
+        LibraryPartKeyBuilder keyBuilder(VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT,
+                                         pipelinePartCreateInfo.flags);
+        keyBuilder.addVertexInputState(pVertexInputState);
+        keyBuilder.addInputAssemblyState(pInputAssemblyState);
+        keyBuilder.addDynamicStates(states);
+
+        const bool cacheable = m_internalData->libraryCache && keyBuilder.isCacheable() &&
+                               !m_internalData->pipelineFlags2 && partPipelineCache == DE_NULL &&
+                               !partCreationFeedback.ptr;
+
+        if (cacheable && findCachedPipelinePart(0, keyBuilder.getKey()))
+            return *this;
+
         VkPipelineCreateFlags2CreateInfoKHR pipelineFlags2CreateInfo = initVulkanStructure();
         if (m_internalData->pipelineFlags2)
         {
@@ -2452,8 +2682,13 @@ GraphicsPipelineWrapper &GraphicsPipelineWrapper::setupVertexInputState(
             pipelinePartCreateInfo.flags = 0u;
         }
 
-        m_pipelineParts[0] = makeGraphicsPipeline(m_internalData->vk, m_internalData->device, partPipelineCache,
-                                                  &pipelinePartCreateInfo);
+        Move<VkPipeline> part = makeGraphicsPipeline(m_internalData->vk, m_internalData->device, partPipelineCache,
+                                                     &pipelinePartCreateInfo);
+
+        if (cacheable)
+            cachePipelinePart(0, keyBuilder.getKey(), part);
+        else
+            m_pipelineParts[0] = part;
     }
 #endif // CTS_USES_VULKANSC
 
@@ -3137,6 +3372,23 @@ GraphicsPipelineWrapper &GraphicsPipelineWrapper::setupFragmentOutputState(
         if (m_internalData->pipelineConstructionType == PIPELINE_CONSTRUCTION_TYPE_LINK_TIME_OPTIMIZED_LIBRARY)
             pipelinePartCreateInfo.flags |= VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT;
 
+        // Render pass handles can be recycled by the driver, so only parts built for dynamic rendering are shared.
+        LibraryPartKeyBuilder keyBuilder(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT,
+                                         pipelinePartCreateInfo.flags);
+        keyBuilder.addColorBlendState(pColorBlendState);
+        keyBuilder.addMultisampleState(pMultisampleState);
+        keyBuilder.addRenderingState(m_internalData->pRenderingState.ptr);
+        keyBuilder.addDynamicStates(states);
+
+        const bool cacheable = m_internalData->libraryCache && keyBuilder.isCacheable() &&
+                               !m_internalData->pipelineFlags2 && partPipelineCache == DE_NULL &&
+                               !partCreationFeedback.ptr && renderPass == DE_NULL &&
+                               !m_internalData->pFragmentShadingRateState &&
+                               !m_internalData->pRenderingAttachmentLocation.ptr;
+
+        if (cacheable && findCachedPipelinePart(3, keyBuilder.getKey()))
+            return *this;
+
         VkPipelineCreateFlags2CreateInfoKHR pipelineFlags2CreateInfo = initVulkanStructure();
         if (m_internalData->pipelineFlags2)
         {
@@ -3146,8 +3398,13 @@ GraphicsPipelineWrapper &GraphicsPipelineWrapper::setupFragmentOutputState(
             pipelinePartCreateInfo.flags = 0u;
         }
 
-        m_pipelineParts[3] = makeGraphicsPipeline(m_internalData->vk, m_internalData->device, partPipelineCache,
-                                                  &pipelinePartCreateInfo);
+        Move<VkPipeline> part = makeGraphicsPipeline(m_internalData->vk, m_internalData->device, partPipelineCache,
+                                                     &pipelinePartCreateInfo);
+
+        if (cacheable)
+            cachePipelinePart(3, keyBuilder.getKey(), part);
+        else
+            m_pipelineParts[3] = part;
     }
 #endif // CTS_USES_VULKANSC
 
@@ -3913,9 +4170,9 @@ void GraphicsPipelineWrapper::buildPipeline(const VkPipelineCache pipelineCache,
 
         if (isConstructionTypeLibrary(m_internalData->pipelineConstructionType))
         {
-            for (const auto &pipelinePtr : m_pipelineParts)
+            for (size_t partNdx = 0; partNdx < kMaxPipelineParts; ++partNdx)
             {
-                const auto &pipeline = pipelinePtr.get();
+                const auto pipeline = getPipelinePart(partNdx);
                 if (pipeline != DE_NULL)
                     rawPipelines.push_back(pipeline);
             }
@@ -4460,6 +4717,26 @@ void GraphicsPipelineWrapper::bind(vk::VkCommandBuffer cmdBuffer) const
     }
 }
 
+VkPipeline GraphicsPipelineWrapper::getPipelinePart(size_t partNdx) const
+{
+    if (m_sharedPipelineParts[partNdx])
+        return m_sharedPipelineParts[partNdx]->get();
+
+    return m_pipelineParts[partNdx].get();
+}
+
+bool GraphicsPipelineWrapper::findCachedPipelinePart(size_t partNdx, const GraphicsPipelineLibraryCache::Key &key)
+{
+    m_sharedPipelineParts[partNdx] = m_internalData->libraryCache->find(key);
+    return !!m_sharedPipelineParts[partNdx];
+}
+
+void GraphicsPipelineWrapper::cachePipelinePart(size_t partNdx, const GraphicsPipelineLibraryCache::Key &key,
+                                                Move<VkPipeline> part)
+{
+    m_sharedPipelineParts[partNdx] = m_internalData->libraryCache->insert(key, part);
+}
+
 bool GraphicsPipelineWrapper::wasBuild() const
 {
     return !!m_pipelineFinal.get();
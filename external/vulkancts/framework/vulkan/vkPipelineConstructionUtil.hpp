@@ -31,9 +31,11 @@
 #include "vkDefs.hpp"
 #include "tcuDefs.hpp"
 #include "deSharedPtr.hpp"
+#include "deMutex.hpp"
 #include "vkPrograms.hpp"
 #include "vkShaderObjectUtil.hpp"
 #include <vector>
+#include <map>
 #include <stdexcept>
 
 namespace vk
@@ -402,6 +404,40 @@ private:
 #endif
 };
 
+// Opt-in cache of the graphics pipeline library parts that do not depend on shaders or on a render pass
+// object: vertex input interface parts, and fragment output interface parts built for dynamic rendering.
+// GraphicsPipelineWrapper looks parts up by a canonical key of their create info and links the shared
+// part instead of creating a new one. Parts stay alive as long as the cache or any wrapper using them,
+// so the cache must be destroyed before its device.
+class GraphicsPipelineLibraryCache
+{
+public:
+    typedef std::vector<uint32_t> Key;
+    typedef de::SharedPtr<Move<VkPipeline>> PartPtr;
+
+    GraphicsPipelineLibraryCache(VkDevice device);
+    ~GraphicsPipelineLibraryCache(void);
+
+    VkDevice getDevice(void) const
+    {
+        return m_device;
+    }
+
+    // Returns null pointer if there is no part with the given key.
+    PartPtr find(const Key &key) const;
+    // Returns the cached part, which is an earlier one if another thread inserted the same key first.
+    PartPtr insert(const Key &key, Move<VkPipeline> part);
+    size_t getNumParts(void) const;
+
+private:
+    GraphicsPipelineLibraryCache(const GraphicsPipelineLibraryCache &);
+    GraphicsPipelineLibraryCache &operator=(const GraphicsPipelineLibraryCache &);
+
+    const VkDevice m_device;
+    mutable de::Mutex m_mutex;
+    std::map<Key, PartPtr> m_parts;
+};
+
 // Class that can build monolithic pipeline or fully separated pipeline libraries
 // depending on PipelineType specified in the constructor.
 // Rarely needed configuration was extracted to setDefault*/disable* functions while common
@@ -433,6 +469,11 @@ public:
     // Specifying how a pipeline is created using VkPipelineCreateFlags2CreateInfoKHR.
     GraphicsPipelineWrapper &setPipelineCreateFlags2(PipelineCreateFlags2 pipelineFlags2);
 
+    // Reuse cacheable pipeline library parts from the given cache. Parts created with a part pipeline cache,
+    // part creation feedback or flags other than the library ones are never shared, so cases testing library
+    // creation itself are not affected. Must be set before setupVertexInputState.
+    GraphicsPipelineWrapper &setPipelineLibraryCache(GraphicsPipelineLibraryCache *cache);
+
     // Specify topology that is used by default InputAssemblyState in vertex input state. This needs to be
     // specified only when there is no custom InputAssemblyState provided in setupVertexInputState and when
     // topology is diferent then VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST which is used by default.
@@ -631,12 +672,19 @@ protected:
 
     struct InternalData;
 
+    VkPipeline getPipelinePart(size_t partNdx) const;
+    bool findCachedPipelinePart(size_t partNdx, const GraphicsPipelineLibraryCache::Key &key);
+    void cachePipelinePart(size_t partNdx, const GraphicsPipelineLibraryCache::Key &key, Move<VkPipeline> part);
+
 protected:
     static constexpr size_t kMaxPipelineParts = 4u;
 
     // Store partial pipelines when non monolithic construction was used.
     Move<VkPipeline> m_pipelineParts[kMaxPipelineParts];
 
+    // Store partial pipelines shared through GraphicsPipelineLibraryCache, used instead of m_pipelineParts.
+    GraphicsPipelineLibraryCache::PartPtr m_sharedPipelineParts[kMaxPipelineParts];
+
     // Store monolithic pipeline or linked pipeline libraries.
     Move<VkPipeline> m_pipelineFinal;
 
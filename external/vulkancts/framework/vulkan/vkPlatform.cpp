@@ -23,6 +23,7 @@
 
 #include "vkPlatform.hpp"
 #include "tcuFunctionLibrary.hpp"
+#include "vkResourceInterface.hpp"
 #ifdef CTS_USES_VULKANSC
 #include "vkQueryUtil.hpp"
 #include "vkSafetyCriticalUtil.hpp"
@@ -156,6 +157,83 @@ DeviceDriver::~DeviceDriver(void)
 {
 }
 
+#ifndef CTS_USES_VULKANSC
+
+DeviceDriverSharedPipelineCache::DeviceDriverSharedPipelineCache(
+    const PlatformInterface &platformInterface, VkInstance instance, VkDevice device, uint32_t usedApiVersion,
+    const tcu::CommandLine &cmdLine, const VkPhysicalDeviceProperties &physicalDeviceProperties,
+    de::SharedPtr<vk::ResourceInterface> resourceInterface)
+    : DeviceDriver(platformInterface, instance, device, usedApiVersion, cmdLine)
+    , m_device(device)
+    , m_resourceInterface(resourceInterface)
+{
+    m_resourceInterface->initSharedPipelineCache(*this, device, physicalDeviceProperties);
+}
+
+DeviceDriverSharedPipelineCache::~DeviceDriverSharedPipelineCache(void)
+{
+    m_resourceInterface->deinitSharedPipelineCache(m_device);
+}
+
+template <typename CreateInfo>
+VkPipelineCache DeviceDriverSharedPipelineCache::selectPipelineCache(VkDevice device, VkPipelineCache pipelineCache,
+                                                                     uint32_t createInfoCount,
+                                                                     const CreateInfo *pCreateInfos) const
+{
+    VkPipelineCache sharedCache = VK_NULL_HANDLE;
+
+    if (pipelineCache != VK_NULL_HANDLE)
+        return pipelineCache;
+
+    // A single opted-out pipeline keeps the whole batch out of the shared cache.
+    for (uint32_t ndx = 0; ndx < createInfoCount; ndx++)
+    {
+        sharedCache = m_resourceInterface->getSharedPipelineCache(device, pCreateInfos[ndx].flags,
+                                                                  pCreateInfos[ndx].pNext);
+
+        if (sharedCache == VK_NULL_HANDLE)
+            break;
+    }
+
+    return sharedCache;
+}
+
+VkResult DeviceDriverSharedPipelineCache::createGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache,
+                                                                  uint32_t createInfoCount,
+                                                                  const VkGraphicsPipelineCreateInfo *pCreateInfos,
+                                                                  const VkAllocationCallbacks *pAllocator,
+                                                                  VkPipeline *pPipelines) const
+{
+    return DeviceDriver::createGraphicsPipelines(device,
+                                                 selectPipelineCache(device, pipelineCache, createInfoCount,
+                                                                     pCreateInfos),
+                                                 createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+
+VkResult DeviceDriverSharedPipelineCache::createComputePipelines(VkDevice device, VkPipelineCache pipelineCache,
+                                                                 uint32_t createInfoCount,
+                                                                 const VkComputePipelineCreateInfo *pCreateInfos,
+                                                                 const VkAllocationCallbacks *pAllocator,
+                                                                 VkPipeline *pPipelines) const
+{
+    return DeviceDriver::createComputePipelines(device,
+                                                selectPipelineCache(device, pipelineCache, createInfoCount,
+                                                                    pCreateInfos),
+                                                createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+
+VkResult DeviceDriverSharedPipelineCache::createRayTracingPipelinesKHR(
+    VkDevice device, VkDeferredOperationKHR deferredOperation, VkPipelineCache pipelineCache,
+    uint32_t createInfoCount, const VkRayTracingPipelineCreateInfoKHR *pCreateInfos,
+    const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines) const
+{
+    return DeviceDriver::createRayTracingPipelinesKHR(
+        device, deferredOperation, selectPipelineCache(device, pipelineCache, createInfoCount, pCreateInfos),
+        createInfoCount, pCreateInfos, pAllocator, pPipelines);
+}
+
+#endif // CTS_USES_VULKANSC
+
 #ifdef CTS_USES_VULKANSC
 VkResult DeviceDriver::createShaderModule(VkDevice device, const VkShaderModuleCreateInfo *pCreateInfo,
                                           const VkAllocationCallbacks *pAllocator, VkShaderModule *pShaderModule) const
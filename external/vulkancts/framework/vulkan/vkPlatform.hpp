@@ -142,6 +142,43 @@ protected:
     Functions m_vk;
 };
 
+#ifndef CTS_USES_VULKANSC
+
+class ResourceInterface;
+
+// Creates pipelines in the shared pipeline cache of the resource interface when the caller passes no cache.
+class DeviceDriverSharedPipelineCache : public DeviceDriver
+{
+public:
+    DeviceDriverSharedPipelineCache(const PlatformInterface &platformInterface, VkInstance instance, VkDevice device,
+                                    uint32_t usedApiVersion, const tcu::CommandLine &cmdLine,
+                                    const VkPhysicalDeviceProperties &physicalDeviceProperties,
+                                    de::SharedPtr<vk::ResourceInterface> resourceInterface);
+    virtual ~DeviceDriverSharedPipelineCache(void);
+
+    virtual VkResult createGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount,
+                                             const VkGraphicsPipelineCreateInfo *pCreateInfos,
+                                             const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines) const;
+    virtual VkResult createComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount,
+                                            const VkComputePipelineCreateInfo *pCreateInfos,
+                                            const VkAllocationCallbacks *pAllocator, VkPipeline *pPipelines) const;
+    virtual VkResult createRayTracingPipelinesKHR(VkDevice device, VkDeferredOperationKHR deferredOperation,
+                                                  VkPipelineCache pipelineCache, uint32_t createInfoCount,
+                                                  const VkRayTracingPipelineCreateInfoKHR *pCreateInfos,
+                                                  const VkAllocationCallbacks *pAllocator,
+                                                  VkPipeline *pPipelines) const;
+
+protected:
+    template <typename CreateInfo>
+    VkPipelineCache selectPipelineCache(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount,
+                                        const CreateInfo *pCreateInfos) const;
+
+    const VkDevice m_device;
+    de::SharedPtr<vk::ResourceInterface> m_resourceInterface;
+};
+
+#endif // CTS_USES_VULKANSC
+
 #ifdef CTS_USES_VULKANSC
 
 #define DDSTAT_LOCK() std::lock_guard<std::mutex> statLock(m_resourceInterface->getStatMutex())
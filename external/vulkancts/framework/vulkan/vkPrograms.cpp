@@ -37,6 +37,7 @@
 #include "deInt32.h"
 
 #include "tcuCommandLine.hpp"
+#include "tcuInstrumentation.hpp"
 
 #include <map>
 #include <mutex>
@@ -64,9 +65,28 @@ using std::vector;
 
 ProgramBinary::ProgramBinary(ProgramFormat format, size_t binarySize, const uint8_t *binary)
     : m_format(format)
-    , m_binary(binary, binary + binarySize)
+    , m_binary(new std::vector<uint8_t>(binary, binary + binarySize))
     , m_used(false)
 {
+    tcu::addInstrumentationCounter(tcu::INSTRUMENTATION_COUNTER_PROGRAM_BINARY_BYTES, binarySize);
+    tcu::addInstrumentationCounter(tcu::INSTRUMENTATION_COUNTER_PROGRAM_BINARY_COPIED_BYTES, binarySize);
+}
+
+static std::vector<uint8_t> *takeBinary(std::vector<uint8_t> &binary)
+{
+    std::vector<uint8_t> *const storage = new std::vector<uint8_t>();
+
+    storage->swap(binary);
+
+    return storage;
+}
+
+ProgramBinary::ProgramBinary(ProgramFormat format, std::vector<uint8_t> &&binary)
+    : m_format(format)
+    , m_binary(takeBinary(binary))
+    , m_used(false)
+{
+    tcu::addInstrumentationCounter(tcu::INSTRUMENTATION_COUNTER_PROGRAM_BINARY_BYTES, m_binary->size());
 }
 
 // Utils
@@ -502,7 +522,7 @@ vk::ProgramBinary *shadercacheLoad(const std::string &shaderstring, const char *
     int32_t length;
     int32_t sourcelength;
     uint32_t temp;
-    uint8_t *bin    = 0;
+    std::vector<uint8_t> bin;
     char *source    = 0;
     bool ok         = true;
     bool diff       = true;
@@ -533,9 +553,9 @@ vk::ProgramBinary *shadercacheLoad(const std::string &shaderstring, const char *
     if (ok)
         ok = length > 0; // Quick check
     if (ok)
-        bin = new uint8_t[length];
+        bin.resize(length);
     if (ok)
-        ok = fread(bin, 1, length, file) == (size_t)length;
+        ok = fread(&bin[0], 1, length, file) == (size_t)length;
     if (ok)
         ok = fread(&sourcelength, 1, 4, file) == 4;
     if (ok && sourcelength > 0)
@@ -549,7 +569,6 @@ vk::ProgramBinary *shadercacheLoad(const std::string &shaderstring, const char *
     {
         // Mismatch
         delete[] source;
-        delete[] bin;
     }
     else
     {
@@ -557,8 +576,8 @@ vk::ProgramBinary *shadercacheLoad(const std::string &shaderstring, const char *
         if (file)
             fclose(file);
         cacheFileMutex->unlock();
-        vk::ProgramBinary *res = new vk::ProgramBinary((vk::ProgramFormat)format, length, bin);
-        delete[] bin;
+        vk::ProgramBinary *res = new vk::ProgramBinary((vk::ProgramFormat)format, std::move(bin));
+        tcu::addInstrumentationCounter(tcu::INSTRUMENTATION_COUNTER_SHADER_CACHE_HITS);
         return res;
     }
     if (file)
@@ -29,6 +29,7 @@
 #include "vkShaderProgram.hpp"
 
 #include "deUniquePtr.hpp"
+#include "deSharedPtr.hpp"
 #include "deSTLUtil.hpp"
 
 #include <vector>
@@ -44,10 +45,13 @@ enum ProgramFormat
     PROGRAM_FORMAT_LAST
 };
 
+//! Program binary. The bytes are immutable and reference counted; copies of a binary share them.
 class ProgramBinary
 {
 public:
     ProgramBinary(ProgramFormat format, size_t binarySize, const uint8_t *binary);
+    //! Take over the contents of binary without copying.
+    ProgramBinary(ProgramFormat format, std::vector<uint8_t> &&binary);
 
     ProgramFormat getFormat(void) const
     {
@@ -55,11 +59,11 @@ public:
     }
     size_t getSize(void) const
     {
-        return m_binary.size();
+        return m_binary->size();
     }
     const uint8_t *getBinary(void) const
     {
-        return m_binary.empty() ? DE_NULL : &m_binary[0];
+        return m_binary->empty() ? DE_NULL : &(*m_binary)[0];
     }
 
     inline void setUsed(void) const
@@ -73,7 +77,7 @@ public:
 
 private:
     const ProgramFormat m_format;
-    const std::vector<uint8_t> m_binary;
+    const de::SharedPtr<const std::vector<uint8_t>> m_binary;
     mutable bool m_used;
 };
 
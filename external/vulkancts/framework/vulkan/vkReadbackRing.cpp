@@ -0,0 +1,247 @@
+/*-------------------------------------------------------------------------
+ * Vulkan CTS Framework
+ * --------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Batched image readback through persistent staging memory
+ *//*--------------------------------------------------------------------*/
+
+#include "vkReadbackRing.hpp"
+#include "vkBarrierUtil.hpp"
+#include "vkCmdUtil.hpp"
+#include "vkImageUtil.hpp"
+#include "vkObjUtil.hpp"
+#include "vkQueryUtil.hpp"
+#include "vkRefUtil.hpp"
+#include "vkTypeUtil.hpp"
+
+namespace vk
+{
+
+ReadbackRing::ReadbackRing(const DeviceInterface &vkd, VkDevice device, VkQueue queue, uint32_t queueFamilyIndex,
+                           Allocator &allocator, VkDeviceSize initialSize)
+    : m_vkd(vkd)
+    , m_device(device)
+    , m_queue(queue)
+    , m_queueFamilyIndex(queueFamilyIndex)
+    , m_allocator(allocator)
+    , m_initialSize(initialSize)
+    , m_curChunkNdx(0)
+    , m_curOffset(0)
+    , m_recording(false)
+    , m_numFlushed(0)
+{
+}
+
+ReadbackRing::~ReadbackRing(void)
+{
+    discardRecorded();
+}
+
+void ReadbackRing::createCommandObjects(void)
+{
+    m_cmdPool =
+        createCommandPool(m_vkd, m_device, VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT, m_queueFamilyIndex);
+    m_cmdBuffer = allocateCommandBuffer(m_vkd, m_device, *m_cmdPool, VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+    m_fence     = createFence(m_vkd, m_device);
+}
+
+void ReadbackRing::discardRecorded(void)
+{
+    // Copies may still be recorded if a case threw between addImage() and flush().
+    if (m_recording)
+    {
+        endCommandBuffer(m_vkd, *m_cmdBuffer);
+        VK_CHECK(m_vkd.resetCommandBuffer(*m_cmdBuffer, 0u));
+        m_recording = false;
+    }
+}
+
+void ReadbackRing::addChunk(VkDeviceSize size)
+{
+    const VkBufferCreateInfo bufferInfo = makeBufferCreateInfo(size, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+
+    // Allocator keeps host visible memory mapped for the lifetime of the allocation.
+    m_chunks.push_back(
+        ChunkSp(new BufferWithMemory(m_vkd, m_device, m_allocator, bufferInfo, MemoryRequirement::HostVisible)));
+    m_chunkSizes.push_back(size);
+}
+
+void ReadbackRing::allocate(VkDeviceSize size, VkDeviceSize alignment, size_t &chunkNdx, VkDeviceSize &offset)
+{
+    if (m_chunks.empty())
+        addChunk(de::max(m_initialSize, size));
+
+    for (;;)
+    {
+        const VkDeviceSize alignedOffset = de::roundUp(m_curOffset, alignment);
+
+        if (alignedOffset + size <= m_chunkSizes[m_curChunkNdx])
+        {
+            chunkNdx    = m_curChunkNdx;
+            offset      = alignedOffset;
+            m_curOffset = alignedOffset + size;
+            return;
+        }
+
+        // Batch does not fit; continue in the next chunk, which reset() releases again.
+        m_curChunkNdx += 1;
+        m_curOffset = 0;
+
+        if (m_curChunkNdx == m_chunks.size())
+            addChunk(de::max(m_initialSize, size));
+    }
+}
+
+uint32_t ReadbackRing::addImage(VkImage image, const tcu::TextureFormat &bufferFormat, const tcu::UVec2 &size,
+                                VkImageLayout oldLayout, VkAccessFlags srcAccessMask, VkImageAspectFlags barrierAspect,
+                                VkImageAspectFlags copyAspect)
+{
+    const VkDeviceSize pixelSize = (VkDeviceSize)bufferFormat.getPixelSize();
+    const VkDeviceSize dataSize  = pixelSize * size.x() * size.y();
+    // Buffer offsets of copies must be multiples of the texel size and of 4.
+    const VkDeviceSize alignment = de::lcm<VkDeviceSize>(pixelSize, 16u);
+    size_t chunkNdx              = 0;
+    VkDeviceSize offset          = 0;
+
+    allocate(dataSize, alignment, chunkNdx, offset);
+
+    if (!m_recording)
+    {
+        if (!m_cmdBuffer)
+            createCommandObjects();
+
+        beginCommandBuffer(m_vkd, *m_cmdBuffer);
+        m_recording = true;
+    }
+
+    {
+        const VkImageMemoryBarrier imageBarrier =
+            makeImageMemoryBarrier(srcAccessMask, VK_ACCESS_TRANSFER_READ_BIT, oldLayout,
+                                   VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, image,
+                                   makeImageSubresourceRange(barrierAspect, 0u, 1u, 0u, 1u));
+        VkBufferImageCopy region = makeBufferImageCopy(makeExtent3D(size.x(), size.y(), 1u),
+                                                       makeImageSubresourceLayers(copyAspect, 0u, 0u, 1u));
+
+        region.bufferOffset = offset;
+
+        m_vkd.cmdPipelineBarrier(*m_cmdBuffer, VK_PIPELINE_STAGE_ALL_COMMANDS_BIT, VK_PIPELINE_STAGE_TRANSFER_BIT, 0u,
+                                 0u, DE_NULL, 0u, DE_NULL, 1u, &imageBarrier);
+        m_vkd.cmdCopyImageToBuffer(*m_cmdBuffer, image, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+                                   m_chunks[chunkNdx]->get(), 1u, &region);
+    }
+
+    m_results.push_back(Result(bufferFormat, size, chunkNdx, offset));
+
+    return (uint32_t)m_results.size() - 1u;
+}
+
+uint32_t ReadbackRing::addColorImage(VkImage image, VkFormat format, const tcu::UVec2 &size, VkImageLayout oldLayout,
+                                     VkAccessFlags srcAccessMask)
+{
+    return addImage(image, mapVkFormat(format), size, oldLayout, srcAccessMask, VK_IMAGE_ASPECT_COLOR_BIT,
+                    VK_IMAGE_ASPECT_COLOR_BIT);
+}
+
+void ReadbackRing::flush(void)
+{
+    if (!m_recording)
+        return;
+
+    {
+        const VkMemoryBarrier hostBarrier = makeMemoryBarrier(VK_ACCESS_TRANSFER_WRITE_BIT, VK_ACCESS_HOST_READ_BIT);
+        const VkSubmitInfo submitInfo     = {
+            VK_STRUCTURE_TYPE_SUBMIT_INFO, // VkStructureType sType;
+            DE_NULL,                       // const void* pNext;
+            0u,                            // uint32_t waitSemaphoreCount;
+            DE_NULL,                       // const VkSemaphore* pWaitSemaphores;
+            DE_NULL,                       // const VkPipelineStageFlags* pWaitDstStageMask;
+            1u,                            // uint32_t commandBufferCount;
+            &m_cmdBuffer.get(),            // const VkCommandBuffer* pCommandBuffers;
+            0u,                            // uint32_t signalSemaphoreCount;
+            DE_NULL,                       // const VkSemaphore* pSignalSemaphores;
+        };
+
+        cmdPipelineMemoryBarrier(m_vkd, *m_cmdBuffer, VK_PIPELINE_STAGE_TRANSFER_BIT, VK_PIPELINE_STAGE_HOST_BIT,
+                                 &hostBarrier);
+        endCommandBuffer(m_vkd, *m_cmdBuffer);
+        m_recording = false;
+
+        VK_CHECK(m_vkd.queueSubmit(m_queue, 1u, &submitInfo, *m_fence));
+        VK_CHECK(m_vkd.waitForFences(m_device, 1u, &m_fence.get(), VK_TRUE, ~0ull));
+        VK_CHECK(m_vkd.resetFences(m_device, 1u, &m_fence.get()));
+        VK_CHECK(m_vkd.resetCommandBuffer(*m_cmdBuffer, 0u));
+    }
+
+    for (size_t chunkNdx = 0; chunkNdx <= m_curChunkNdx && chunkNdx < m_chunks.size(); chunkNdx++)
+        invalidateAlloc(m_vkd, m_device, m_chunks[chunkNdx]->getAllocation());
+
+    m_numFlushed = (uint32_t)m_results.size();
+}
+
+tcu::ConstPixelBufferAccess ReadbackRing::getResult(uint32_t resultNdx) const
+{
+    DE_ASSERT(resultNdx < m_numFlushed);
+
+    {
+        const Result &result = m_results[resultNdx];
+        const uint8_t *data  = (const uint8_t *)m_chunks[result.chunkNdx]->getAllocation().getHostPtr();
+
+        return tcu::ConstPixelBufferAccess(result.format, (int)result.size.x(), (int)result.size.y(), 1,
+                                           data + result.offset);
+    }
+}
+
+void ReadbackRing::reset(void)
+{
+    discardRecorded();
+
+    // Release staging memory beyond the initial chunk, so large batches do not keep memory allocated for the
+    // rest of the run.
+    if (!m_chunks.empty() && m_chunkSizes[0] > m_initialSize)
+    {
+        m_chunks.clear();
+        m_chunkSizes.clear();
+    }
+    else if (m_chunks.size() > 1)
+    {
+        m_chunks.resize(1);
+        m_chunkSizes.resize(1);
+    }
+
+    m_results.clear();
+    m_curChunkNdx = 0;
+    m_curOffset   = 0;
+    m_numFlushed  = 0;
+}
+
+tcu::ConstPixelBufferAccess ReadbackRing::readColorImage(VkImage image, VkFormat format, const tcu::UVec2 &size,
+                                                         VkImageLayout oldLayout)
+{
+    reset();
+
+    {
+        const uint32_t resultNdx = addColorImage(image, format, size, oldLayout);
+
+        flush();
+
+        return getResult(resultNdx);
+    }
+}
+
+} // namespace vk
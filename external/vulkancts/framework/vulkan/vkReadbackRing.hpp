@@ -0,0 +1,133 @@
+#ifndef _VKREADBACKRING_HPP
+#define _VKREADBACKRING_HPP
+/*-------------------------------------------------------------------------
+ * Vulkan CTS Framework
+ * --------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Batched image readback through persistent staging memory
+ *//*--------------------------------------------------------------------*/
+
+#include "vkDefs.hpp"
+#include "vkBufferWithMemory.hpp"
+#include "vkMemUtil.hpp"
+#include "vkRef.hpp"
+#include "tcuTexture.hpp"
+#include "tcuVector.hpp"
+#include "deSharedPtr.hpp"
+
+#include <vector>
+
+namespace vk
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Batched image readback through persistent staging memory
+ *
+ * Image copies are recorded into one reusable command buffer and
+ * submitted together by flush(), which waits on a reusable fence. The
+ * command buffer and fence are created on first use. Results
+ * are views into persistently mapped staging memory instead of copies and
+ * stay valid until reset().
+ *
+ * Staging space is handed out linearly from the start of the ring after
+ * every reset(). If a batch does not fit, another chunk is added. reset()
+ * releases all staging memory beyond one chunk of the initial size, so
+ * only batches larger than that allocate memory.
+ *//*--------------------------------------------------------------------*/
+class ReadbackRing
+{
+public:
+    ReadbackRing(const DeviceInterface &vkd, VkDevice device, VkQueue queue, uint32_t queueFamilyIndex,
+                 Allocator &allocator, VkDeviceSize initialSize = 4u * 1024u * 1024u);
+    ~ReadbackRing(void);
+
+    //! Record copy of layer 0 of mip level 0. The image is left in VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL.
+    //! \return Index of the result
+    uint32_t addImage(VkImage image, const tcu::TextureFormat &bufferFormat, const tcu::UVec2 &size,
+                      VkImageLayout oldLayout, VkAccessFlags srcAccessMask, VkImageAspectFlags barrierAspect,
+                      VkImageAspectFlags copyAspect);
+
+    uint32_t addColorImage(VkImage image, VkFormat format, const tcu::UVec2 &size,
+                           VkImageLayout oldLayout     = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+                           VkAccessFlags srcAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT);
+
+    //! Submit recorded copies and wait for them to complete.
+    void flush(void);
+
+    //! View of a result. Valid after the flush following addImage() until reset().
+    tcu::ConstPixelBufferAccess getResult(uint32_t resultNdx) const;
+
+    //! Invalidate all results and recycle the staging memory. Copies that were not flushed are discarded.
+    void reset(void);
+
+    //! Read a single color image: reset(), addColorImage() and flush().
+    tcu::ConstPixelBufferAccess readColorImage(VkImage image, VkFormat format, const tcu::UVec2 &size,
+                                               VkImageLayout oldLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+
+private:
+    ReadbackRing(const ReadbackRing &);
+    ReadbackRing &operator=(const ReadbackRing &);
+
+    struct Result
+    {
+        Result(const tcu::TextureFormat &format_, const tcu::UVec2 &size_, size_t chunkNdx_, VkDeviceSize offset_)
+            : format(format_)
+            , size(size_)
+            , chunkNdx(chunkNdx_)
+            , offset(offset_)
+        {
+        }
+
+        tcu::TextureFormat format;
+        tcu::UVec2 size;
+        size_t chunkNdx;
+        VkDeviceSize offset;
+    };
+
+    typedef de::SharedPtr<BufferWithMemory> ChunkSp;
+
+    void createCommandObjects(void);
+    void discardRecorded(void);
+    void allocate(VkDeviceSize size, VkDeviceSize alignment, size_t &chunkNdx, VkDeviceSize &offset);
+    void addChunk(VkDeviceSize size);
+
+    const DeviceInterface &m_vkd;
+    const VkDevice m_device;
+    const VkQueue m_queue;
+    const uint32_t m_queueFamilyIndex;
+    Allocator &m_allocator;
+
+    // Created by the first addImage(), so contexts that never read back do not pay for them.
+    Move<VkCommandPool> m_cmdPool;
+    Move<VkCommandBuffer> m_cmdBuffer;
+    Move<VkFence> m_fence;
+
+    const VkDeviceSize m_initialSize; //!< Staging memory kept over reset().
+    std::vector<ChunkSp> m_chunks;
+    std::vector<VkDeviceSize> m_chunkSizes;
+    size_t m_curChunkNdx;
+    VkDeviceSize m_curOffset;
+    bool m_recording;
+    uint32_t m_numFlushed; //!< Results with index below this are ready.
+    std::vector<Result> m_results;
+};
+
+} // namespace vk
+
+#endif // _VKREADBACKRING_HPP
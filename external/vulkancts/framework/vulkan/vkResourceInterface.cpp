@@ -23,13 +23,20 @@
 
 #include "vkResourceInterface.hpp"
 #include "vkQueryUtil.hpp"
+#include "vkRefUtil.hpp"
+#include "tcuCommandLine.hpp"
+#include "deFile.h"
+#include "deFilePath.hpp"
+#include "deStringUtil.hpp"
+
+#include <cstdio>
+#include <iomanip>
+#include <sstream>
 
 #ifdef CTS_USES_VULKANSC
 #include <functional>
 #include <fstream>
 #include "vkSafetyCriticalUtil.hpp"
-#include "vkRefUtil.hpp"
-#include "tcuCommandLine.hpp"
 #include "vksCacheBuilder.hpp"
 #include "vksSerializer.hpp"
 #include "vkApiVersion.hpp"
@@ -275,10 +282,10 @@ void ResourceInterface::importData(std::vector<uint8_t> &importText) const
     vksc_server::VulkanDataTransmittedFromMainToSubprocess vdtfmtsp =
         vksc_server::Deserialize<vksc_server::VulkanDataTransmittedFromMainToSubprocess>(importText);
 
-    m_pipelineInput                = vdtfmtsp.pipelineCacheInput;
+    m_pipelineInput                = std::move(vdtfmtsp.pipelineCacheInput);
     m_statMax                      = vdtfmtsp.memoryReservation;
-    m_commandPoolMemoryConsumption = vdtfmtsp.commandPoolMemoryConsumption;
-    m_pipelineSizes                = vdtfmtsp.pipelineSizes;
+    m_commandPoolMemoryConsumption = std::move(vdtfmtsp.commandPoolMemoryConsumption);
+    m_pipelineSizes                = std::move(vdtfmtsp.pipelineSizes);
 }
 
 void ResourceInterface::registerObjectHash(uint64_t handle, std::size_t hashValue) const
@@ -456,6 +463,215 @@ void ResourceInterfaceStandard::deinitDevice(VkDevice device)
 #endif // CTS_USES_VULKANSC
 }
 
+#ifndef CTS_USES_VULKANSC
+
+namespace
+{
+
+std::string getSharedPipelineCacheFileName(const VkPhysicalDeviceProperties &properties)
+{
+    std::ostringstream name;
+
+    name << "pipeline_cache_" << std::hex << std::setfill('0') << std::setw(8) << properties.vendorID << "_"
+         << std::setw(8) << properties.deviceID << "_";
+
+    for (uint32_t ndx = 0; ndx < VK_UUID_SIZE; ndx++)
+        name << std::setw(2) << (uint32_t)properties.pipelineCacheUUID[ndx];
+
+    name << ".bin";
+
+    return name.str();
+}
+
+bool isPipelineCacheDataCompatible(const std::vector<uint8_t> &data, const VkPhysicalDeviceProperties &properties)
+{
+    VkPipelineCacheHeaderVersionOne header;
+
+    if (data.size() < sizeof(header))
+        return false;
+
+    deMemcpy(&header, data.data(), sizeof(header));
+
+    return header.headerSize >= sizeof(header) && header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+           header.vendorID == properties.vendorID && header.deviceID == properties.deviceID &&
+           deMemCmp(header.pipelineCacheUUID, properties.pipelineCacheUUID, VK_UUID_SIZE) == 0;
+}
+
+bool readPipelineCacheFile(const std::string &path, std::vector<uint8_t> &dst)
+{
+    FILE *const file = fopen(path.c_str(), "rb");
+    bool ok          = false;
+
+    if (!file)
+        return false;
+
+    if (fseek(file, 0, SEEK_END) == 0)
+    {
+        const long size = ftell(file);
+
+        if (size > 0 && fseek(file, 0, SEEK_SET) == 0)
+        {
+            dst.resize((size_t)size);
+            ok = fread(&dst[0], 1, dst.size(), file) == dst.size();
+        }
+    }
+
+    fclose(file);
+    return ok;
+}
+
+Move<VkPipelineCache> createPipelineCacheWithData(const DeviceInterface &vk, VkDevice device,
+                                                  const std::vector<uint8_t> &data)
+{
+    const VkPipelineCacheCreateInfo createInfo = {
+        VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO, // VkStructureType sType;
+        DE_NULL,                                      // const void* pNext;
+        0u,                                           // VkPipelineCacheCreateFlags flags;
+        data.size(),                                  // uintptr_t initialDataSize;
+        data.empty() ? DE_NULL : data.data()          // const void* pInitialData;
+    };
+
+    return createPipelineCache(vk, device, &createInfo);
+}
+
+std::vector<uint8_t> getPipelineCacheData(const DeviceInterface &vk, VkDevice device, VkPipelineCache cache)
+{
+    std::vector<uint8_t> data;
+    uintptr_t dataSize = 0;
+
+    VK_CHECK(vk.getPipelineCacheData(device, cache, &dataSize, DE_NULL));
+
+    if (dataSize > 0)
+    {
+        data.resize(dataSize);
+        VK_CHECK(vk.getPipelineCacheData(device, cache, &dataSize, data.data()));
+        data.resize(dataSize);
+    }
+
+    return data;
+}
+
+} // namespace
+
+void ResourceInterfaceStandard::initSharedPipelineCache(const DeviceInterface &deviceInterface, VkDevice device,
+                                                        const VkPhysicalDeviceProperties &properties)
+{
+    const std::string cacheDir = m_testCtx.getCommandLine().getPersistentPipelineCacheDir();
+    SharedPipelineCache sharedCache;
+    std::vector<uint8_t> data;
+
+    if (cacheDir.empty())
+        return;
+
+    sharedCache.deviceInterface = &deviceInterface;
+    sharedCache.properties      = properties;
+    sharedCache.filename        = de::FilePath::join(cacheDir, getSharedPipelineCacheFileName(properties)).getPath();
+
+    // Data from another driver build is discarded; drivers should reject it too, but not all of them do.
+    if (!readPipelineCacheFile(sharedCache.filename, data) || !isPipelineCacheDataCompatible(data, properties))
+        data.clear();
+
+    sharedCache.cache = de::SharedPtr<Move<VkPipelineCache>>(
+        new Move<VkPipelineCache>(createPipelineCacheWithData(deviceInterface, device, data)));
+
+    {
+        std::lock_guard<std::mutex> lock(m_sharedPipelineCacheMutex);
+        m_sharedPipelineCaches[device] = sharedCache;
+    }
+}
+
+void ResourceInterfaceStandard::deinitSharedPipelineCache(VkDevice device)
+{
+    SharedPipelineCache sharedCache;
+
+    {
+        std::lock_guard<std::mutex> lock(m_sharedPipelineCacheMutex);
+        const auto cacheIter = m_sharedPipelineCaches.find(device);
+
+        if (cacheIter == m_sharedPipelineCaches.end())
+            return;
+
+        sharedCache = cacheIter->second;
+        m_sharedPipelineCaches.erase(cacheIter);
+    }
+
+    // Failing to persist the cache only costs time in later runs, so it is not reported as a test failure.
+    try
+    {
+        const DeviceInterface &vk = *sharedCache.deviceInterface;
+        std::vector<uint8_t> fileData;
+
+        // Merge pipelines stored by other processes since startup so that parallel runs keep each other's work.
+        if (readPipelineCacheFile(sharedCache.filename, fileData) &&
+            isPipelineCacheDataCompatible(fileData, sharedCache.properties))
+        {
+            const Unique<VkPipelineCache> fileCache(createPipelineCacheWithData(vk, device, fileData));
+            const VkPipelineCache srcCache = *fileCache;
+
+            VK_CHECK(vk.mergePipelineCaches(device, **sharedCache.cache, 1u, &srcCache));
+        }
+
+        {
+            const std::vector<uint8_t> data = getPipelineCacheData(vk, device, **sharedCache.cache);
+
+            if (isPipelineCacheDataCompatible(data, sharedCache.properties))
+                deWriteFileAtomic(sharedCache.filename.c_str(), data.data(), data.size());
+        }
+    }
+    catch (const std::exception &e)
+    {
+        tcu::print("WARNING: Failed to store pipeline cache %s: %s\n", sharedCache.filename.c_str(), e.what());
+    }
+}
+
+VkPipelineCache ResourceInterfaceStandard::getSharedPipelineCache(VkDevice device, VkPipelineCreateFlags flags,
+                                                                  const void *pNext) const
+{
+    // Cases observing cache hits or compile-required results must see only the caches they created themselves.
+    {
+        const VkPipelineCreateFlags2CreateInfoKHR *flags2 = findStructure<VkPipelineCreateFlags2CreateInfoKHR>(pNext);
+
+        if ((flags & VK_PIPELINE_CREATE_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT) != 0 ||
+            (flags2 && (flags2->flags & VK_PIPELINE_CREATE_2_FAIL_ON_PIPELINE_COMPILE_REQUIRED_BIT_KHR) != 0) ||
+            findStructure<VkPipelineCreationFeedbackCreateInfo>(pNext) != DE_NULL)
+            return VK_NULL_HANDLE;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_sharedPipelineCacheMutex);
+        const auto cacheIter = m_sharedPipelineCaches.find(device);
+
+        return cacheIter != m_sharedPipelineCaches.end() ? **cacheIter->second.cache : VK_NULL_HANDLE;
+    }
+}
+
+#else
+
+void ResourceInterfaceStandard::initSharedPipelineCache(const DeviceInterface &deviceInterface, VkDevice device,
+                                                        const VkPhysicalDeviceProperties &properties)
+{
+    // Vulkan SC pipelines always come from the offline pipeline cache.
+    DE_UNREF(deviceInterface);
+    DE_UNREF(device);
+    DE_UNREF(properties);
+}
+
+void ResourceInterfaceStandard::deinitSharedPipelineCache(VkDevice device)
+{
+    DE_UNREF(device);
+}
+
+VkPipelineCache ResourceInterfaceStandard::getSharedPipelineCache(VkDevice device, VkPipelineCreateFlags flags,
+                                                                  const void *pNext) const
+{
+    DE_UNREF(device);
+    DE_UNREF(flags);
+    DE_UNREF(pNext);
+    return VK_NULL_HANDLE;
+}
+
+#endif // CTS_USES_VULKANSC
+
 #ifdef CTS_USES_VULKANSC
 
 void ResourceInterfaceStandard::registerDeviceFeatures(VkDevice device, const VkDeviceCreateInfo *pCreateInfo) const
@@ -26,11 +26,13 @@
 #include "vkDefs.hpp"
 #include "tcuTestLog.hpp"
 #include "tcuTestContext.hpp"
+#include "tcuInstrumentation.hpp"
 #include "vkPrograms.hpp"
 #include "vkBinaryRegistry.hpp"
 #include "deSharedPtr.hpp"
 #include "deDefs.hpp"
 #include <map>
+#include <mutex>
 #ifdef CTS_USES_VULKANSC
 #include "vksClient.hpp"
 #include "tcuMaybe.hpp"
@@ -53,6 +55,13 @@ public:
     virtual void initTestCase(const std::string &casePath);
     const std::string &getCasePath() const;
 
+    // Pipeline cache shared by all pipelines created without one (--deqp-persistent-pipeline-cache-dir)
+    virtual void initSharedPipelineCache(const DeviceInterface &deviceInterface, VkDevice device,
+                                         const VkPhysicalDeviceProperties &properties) = 0;
+    virtual void deinitSharedPipelineCache(VkDevice device)                            = 0;
+    virtual VkPipelineCache getSharedPipelineCache(VkDevice device, VkPipelineCreateFlags flags,
+                                                   const void *pNext) const            = 0;
+
     // buildProgram
     template <typename InfoType, typename IteratorType>
     vk::ProgramBinary *buildProgram(const std::string &casePath, IteratorType iter,
@@ -241,6 +250,12 @@ public:
     void initDevice(DeviceInterface &deviceInterface, VkDevice device) override;
     void deinitDevice(VkDevice device) override;
 
+    void initSharedPipelineCache(const DeviceInterface &deviceInterface, VkDevice device,
+                                 const VkPhysicalDeviceProperties &properties) override;
+    void deinitSharedPipelineCache(VkDevice device) override;
+    VkPipelineCache getSharedPipelineCache(VkDevice device, VkPipelineCreateFlags flags,
+                                           const void *pNext) const override;
+
 #ifdef CTS_USES_VULKANSC
     void registerDeviceFeatures(VkDevice device, const VkDeviceCreateInfo *pCreateInfo) const override;
     void unregisterDeviceFeatures(VkDevice device) const override;
@@ -294,6 +309,17 @@ protected:
     std::map<VkDevice, CreateShaderModuleFunc> m_createShaderModuleFunc;
     std::map<VkDevice, CreateGraphicsPipelinesFunc> m_createGraphicsPipelinesFunc;
     std::map<VkDevice, CreateComputePipelinesFunc> m_createComputePipelinesFunc;
+
+    struct SharedPipelineCache
+    {
+        const DeviceInterface *deviceInterface;
+        VkPhysicalDeviceProperties properties;
+        std::string filename;
+        de::SharedPtr<Move<VkPipelineCache>> cache;
+    };
+
+    std::map<VkDevice, SharedPipelineCache> m_sharedPipelineCaches;
+    mutable std::mutex m_sharedPipelineCacheMutex;
 };
 
 #ifdef CTS_USES_VULKANSC
@@ -347,6 +373,7 @@ vk::ProgramBinary *ResourceInterface::buildProgram(const std::string &casePath,
     tcu::TestLog &log                   = m_testCtx.getLog();
     const tcu::CommandLine &commandLine = m_testCtx.getCommandLine();
     const tcu::ScopedLogSection progSection(log, iter.getName(), "Program: " + iter.getName());
+    const tcu::ScopedPhaseTimer buildTimer(tcu::INSTRUMENTATION_PHASE_BUILD_PROGRAM);
     de::MovePtr<vk::ProgramBinary> binProg;
     InfoType buildInfo;
 
@@ -374,6 +401,8 @@ vk::ProgramBinary *ResourceInterface::buildProgram(const std::string &casePath,
 
     TCU_CHECK_INTERNAL(binProg);
 
+    tcu::addInstrumentationCounter(tcu::INSTRUMENTATION_COUNTER_PROGRAMS_BUILT);
+
     {
         vk::ProgramBinary *const returnBinary = binProg.get();
 
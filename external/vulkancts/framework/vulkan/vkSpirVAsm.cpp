@@ -24,8 +24,12 @@
 #include "vkSpirVAsm.hpp"
 #include "vkSpirVProgram.hpp"
 #include "deClock.h"
+#include "deMutex.hpp"
+#include "deSha1.h"
 
 #include <algorithm>
+#include <map>
+#include <sstream>
 
 #include "spirv-tools/libspirv.h"
 
@@ -172,8 +176,8 @@ void disassembleSpirV(size_t binarySizeInWords, const uint32_t *binary, std::ost
     }
 }
 
-bool validateSpirV(size_t binarySizeInWords, const uint32_t *binary, std::ostream *infoLog,
-                   const SpirvValidatorOptions &val_options)
+static bool validateSpirVUncached(size_t binarySizeInWords, const uint32_t *binary, std::ostream *infoLog,
+                                  const SpirvValidatorOptions &val_options)
 {
     const spv_context context     = spvContextCreate(getSpirvToolsEnvForValidatorOptions(val_options));
     spv_diagnostic diagnostic     = DE_NULL;
@@ -259,4 +263,102 @@ bool validateSpirV(size_t binarySizeInWords, const uint32_t *binary, std::ostrea
     }
 }
 
+namespace
+{
+
+struct ValidationResult
+{
+    bool passed;
+    string log;
+};
+
+// Generated groups build identical binaries for many variants, and validating a large module takes about as long as
+// compiling it. Results only depend on the binary and the validator environment, so they are shared by the process.
+class ValidationCache
+{
+public:
+    static ValidationCache &getInstance(void)
+    {
+        static ValidationCache s_cache;
+        return s_cache;
+    }
+
+    bool find(const string &key, ValidationResult &dst)
+    {
+        const de::ScopedLock lock(m_lock);
+        const std::map<string, ValidationResult>::const_iterator iter = m_results.find(key);
+
+        if (iter == m_results.end())
+            return false;
+
+        dst = iter->second;
+        return true;
+    }
+
+    void insert(const string &key, const ValidationResult &result)
+    {
+        const de::ScopedLock lock(m_lock);
+
+        // Bound memory use; logs of failed validations contain the full disassembly.
+        if (m_results.size() >= MAX_RESULTS)
+            m_results.clear();
+
+        m_results[key] = result;
+    }
+
+private:
+    enum
+    {
+        MAX_RESULTS = 64 * 1024
+    };
+
+    de::Mutex m_lock;
+    std::map<string, ValidationResult> m_results;
+};
+
+string getValidationKey(size_t binarySizeInWords, const uint32_t *binary, const SpirvValidatorOptions &val_options)
+{
+    const uint32_t environment[] = {
+        (uint32_t)getSpirvToolsEnvForValidatorOptions(val_options),
+        val_options.vulkanVersion,
+        (uint32_t)val_options.blockLayout,
+        val_options.supports_VK_KHR_spirv_1_4 ? 1u : 0u,
+        val_options.flags,
+    };
+    deSha1Stream stream;
+    deSha1 hash;
+    char hashStr[40];
+
+    deSha1Stream_init(&stream);
+    deSha1Stream_process(&stream, sizeof(environment), environment);
+    deSha1Stream_process(&stream, binarySizeInWords * sizeof(uint32_t), binary);
+    deSha1Stream_finalize(&stream, &hash);
+    deSha1_render(&hash, hashStr);
+
+    return string(hashStr, hashStr + DE_LENGTH_OF_ARRAY(hashStr));
+}
+
+} // namespace
+
+bool validateSpirV(size_t binarySizeInWords, const uint32_t *binary, std::ostream *infoLog,
+                   const SpirvValidatorOptions &val_options)
+{
+    const string key = getValidationKey(binarySizeInWords, binary, val_options);
+    ValidationResult result;
+
+    if (!ValidationCache::getInstance().find(key, result))
+    {
+        std::ostringstream log;
+
+        result.passed = validateSpirVUncached(binarySizeInWords, binary, &log, val_options);
+        result.log    = log.str();
+
+        ValidationCache::getInstance().insert(key, result);
+    }
+
+    *infoLog << result.log;
+
+    return result.passed;
+}
+
 } // namespace vk
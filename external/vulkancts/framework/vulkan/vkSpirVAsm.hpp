@@ -39,6 +39,7 @@ bool assembleSpirV(const SpirVAsmSource *program, std::vector<uint32_t> *dst, Sp
 void disassembleSpirV(size_t binarySizeInWords, const uint32_t *binary, std::ostream *dst, SpirvVersion spirvVersion);
 
 //! Validate SPIR-V binary, returning true if validation succeeds. Will fail with NotSupportedError if compiler is not available.
+//! Results are cached per process by binary and validator environment, so identical binaries are validated once.
 bool validateSpirV(size_t binarySizeInWords, const uint32_t *binary, std::ostream *infoLog,
                    const SpirvValidatorOptions &);
 
@@ -27,6 +27,7 @@
 
 #include "deStringUtil.hpp"
 #include "deUniquePtr.hpp"
+#include "deTaskScheduler.hpp"
 
 #include "tcuImageCompare.hpp"
 #include "tcuAstcUtil.hpp"
@@ -295,6 +296,33 @@ bool isFloatFormat(tcu::TextureFormat format)
     return tcu::getTextureChannelClass(format.type) == tcu::TEXTURECHANNELCLASS_FLOATING_POINT;
 }
 
+// Calls rowFunc(y, z) for every row of a height x depth region. Rows are
+// spread over worker threads; each row is still computed exactly as in a
+// serial loop, so reference results don't depend on the thread count.
+template <typename RowFunc>
+void forEachRow(int height, int depth, const RowFunc &rowFunc)
+{
+    de::parallelFor(0, (size_t)height * (size_t)depth, 0,
+                    [&](size_t rowBegin, size_t rowEnd)
+                    {
+                        for (size_t rowNdx = rowBegin; rowNdx < rowEnd; rowNdx++)
+                            rowFunc((int)(rowNdx % (size_t)height), (int)(rowNdx / (size_t)height));
+                    });
+}
+
+// tcu::copy() for reference images, splitting the region into rows.
+void copyRows(const tcu::PixelBufferAccess &dst, const tcu::ConstPixelBufferAccess &src, bool clearUnused = true)
+{
+    DE_ASSERT(src.getSize() == dst.getSize());
+
+    const auto copyRow = [&](int y, int z)
+    {
+        tcu::copy(tcu::getSubregion(dst, 0, y, z, dst.getWidth(), 1, 1),
+                  tcu::getSubregion(src, 0, y, z, src.getWidth(), 1, 1), clearUnused);
+    };
+    forEachRow(dst.getHeight(), dst.getDepth(), copyRow);
+}
+
 union CopyRegion
 {
     VkBufferCopy bufferCopy;
@@ -1001,7 +1029,7 @@ void CopiesAndBlittingTestInstance::generateExpectedResult(void)
 
     m_expectedTextureLevel[0] = de::MovePtr<tcu::TextureLevel>(
         new tcu::TextureLevel(dst.getFormat(), dst.getWidth(), dst.getHeight(), dst.getDepth()));
-    tcu::copy(m_expectedTextureLevel[0]->getAccess(), dst);
+    copyRows(m_expectedTextureLevel[0]->getAccess(), dst);
 
     for (uint32_t i = 0; i < m_params.regions.size(); i++)
         copyRegionToTextureLevel(src, m_expectedTextureLevel[0]->getAccess(), m_params.regions[i]);
@@ -1583,7 +1611,7 @@ void CopyImageToImage::copyRegionToTextureLevel(tcu::ConstPixelBufferAccess src,
                 getEffectiveDepthStencilAccess(tcu::getSubregion(dst, dstOffset.x, dstOffset.y, dstOffset.z,
                                                                  extent.width, extent.height, extent.depth),
                                                tcu::Sampler::MODE_DEPTH);
-            tcu::copy(dstSubRegion, srcSubRegion);
+            copyRows(dstSubRegion, srcSubRegion);
         }
 
         // Copy stencil.
@@ -1597,7 +1625,7 @@ void CopyImageToImage::copyRegionToTextureLevel(tcu::ConstPixelBufferAccess src,
                 getEffectiveDepthStencilAccess(tcu::getSubregion(dst, dstOffset.x, dstOffset.y, dstOffset.z,
                                                                  extent.width, extent.height, extent.depth),
                                                tcu::Sampler::MODE_STENCIL);
-            tcu::copy(dstSubRegion, srcSubRegion);
+            copyRows(dstSubRegion, srcSubRegion);
         }
     }
     else
@@ -1609,7 +1637,7 @@ void CopyImageToImage::copyRegionToTextureLevel(tcu::ConstPixelBufferAccess src,
         const tcu::PixelBufferAccess dstSubRegion = tcu::getSubregion(
             dstWithSrcFormat, dstOffset.x, dstOffset.y, dstOffset.z, extent.width, extent.height, extent.depth);
 
-        tcu::copy(dstSubRegion, srcSubRegion);
+        copyRows(dstSubRegion, srcSubRegion);
     }
 }
 
@@ -2167,7 +2195,7 @@ void CopyImageToImageMipmap::copyRegionToTextureLevel(tcu::ConstPixelBufferAcces
                 getEffectiveDepthStencilAccess(tcu::getSubregion(dst, dstOffset.x, dstOffset.y, dstOffset.z,
                                                                  extent.width, extent.height, extent.depth),
                                                tcu::Sampler::MODE_DEPTH);
-            tcu::copy(dstSubRegion, srcSubRegion);
+            copyRows(dstSubRegion, srcSubRegion);
         }
 
         // Copy stencil.
@@ -2181,7 +2209,7 @@ void CopyImageToImageMipmap::copyRegionToTextureLevel(tcu::ConstPixelBufferAcces
                 getEffectiveDepthStencilAccess(tcu::getSubregion(dst, dstOffset.x, dstOffset.y, dstOffset.z,
                                                                  extent.width, extent.height, extent.depth),
                                                tcu::Sampler::MODE_STENCIL);
-            tcu::copy(dstSubRegion, srcSubRegion);
+            copyRows(dstSubRegion, srcSubRegion);
         }
     }
     else
@@ -2193,7 +2221,7 @@ void CopyImageToImageMipmap::copyRegionToTextureLevel(tcu::ConstPixelBufferAcces
         const tcu::PixelBufferAccess dstSubRegion = tcu::getSubregion(
             dstWithSrcFormat, dstOffset.x, dstOffset.y, dstOffset.z, extent.width, extent.height, extent.depth);
 
-        tcu::copy(dstSubRegion, srcSubRegion);
+        copyRows(dstSubRegion, srcSubRegion);
     }
 }
 
@@ -5073,26 +5101,30 @@ void scaleFromWholeSrcBuffer(const tcu::PixelBufferAccess &dst, const tcu::Const
     float sY = (float)regionExtent.y / (float)dst.getHeight();
     float sZ = (float)regionExtent.z / (float)dst.getDepth();
 
-    for (int z = 0; z < dst.getDepth(); z++)
-        for (int y = 0; y < dst.getHeight(); y++)
-            for (int x = 0; x < dst.getWidth(); x++)
-            {
-                float srcX = ((mirrorMode & MIRROR_MODE_X) != 0) ?
-                                 (float)regionExtent.x + (float)regionOffset.x - ((float)x + 0.5f) * sX :
-                                 (float)regionOffset.x + ((float)x + 0.5f) * sX;
-                float srcY = ((mirrorMode & MIRROR_MODE_Y) != 0) ?
-                                 (float)regionExtent.y + (float)regionOffset.y - ((float)y + 0.5f) * sY :
-                                 (float)regionOffset.y + ((float)y + 0.5f) * sY;
-                float srcZ = ((mirrorMode & MIRROR_MODE_Z) != 0) ?
-                                 (float)regionExtent.z + (float)regionOffset.z - ((float)z + 0.5f) * sZ :
-                                 (float)regionOffset.z + ((float)z + 0.5f) * sZ;
-                if (dst.getDepth() > 1)
-                    dst.setPixel(linearToSRGBIfNeeded(dst.getFormat(), src.sample3D(sampler, filter, srcX, srcY, srcZ)),
-                                 x, y, z);
-                else
-                    dst.setPixel(linearToSRGBIfNeeded(dst.getFormat(), src.sample2D(sampler, filter, srcX, srcY, 0)), x,
-                                 y);
-            }
+    const tcu::TextureFormat &dstFormat = dst.getFormat();
+
+    const auto scaleRow = [&](int y, int z)
+    {
+        const float srcY = ((mirrorMode & MIRROR_MODE_Y) != 0) ?
+                               (float)regionExtent.y + (float)regionOffset.y - ((float)y + 0.5f) * sY :
+                               (float)regionOffset.y + ((float)y + 0.5f) * sY;
+        const float srcZ = ((mirrorMode & MIRROR_MODE_Z) != 0) ?
+                               (float)regionExtent.z + (float)regionOffset.z - ((float)z + 0.5f) * sZ :
+                               (float)regionOffset.z + ((float)z + 0.5f) * sZ;
+
+        for (int x = 0; x < dst.getWidth(); x++)
+        {
+            float srcX = ((mirrorMode & MIRROR_MODE_X) != 0) ?
+                             (float)regionExtent.x + (float)regionOffset.x - ((float)x + 0.5f) * sX :
+                             (float)regionOffset.x + ((float)x + 0.5f) * sX;
+            if (dst.getDepth() > 1)
+                dst.setPixel(linearToSRGBIfNeeded(dstFormat, src.sample3D(sampler, filter, srcX, srcY, srcZ)), x, y,
+                             z);
+            else
+                dst.setPixel(linearToSRGBIfNeeded(dstFormat, src.sample2D(sampler, filter, srcX, srcY, 0)), x, y);
+        }
+    };
+    forEachRow(dst.getHeight(), dst.getDepth(), scaleRow);
 }
 
 void blit(const tcu::PixelBufferAccess &dst, const tcu::ConstPixelBufferAccess &src,
@@ -5115,15 +5147,19 @@ void blit(const tcu::PixelBufferAccess &dst, const tcu::ConstPixelBufferAccess &
     const int yScale = (mirrorMode & MIRROR_MODE_Y) ? -1 : 1;
     const int zScale = (mirrorMode & MIRROR_MODE_Z) ? -1 : 1;
 
-    for (int z = 0; z < dst.getDepth(); ++z)
-        for (int y = 0; y < dst.getHeight(); ++y)
-            for (int x = 0; x < dst.getWidth(); ++x)
-            {
-                dst.setPixel(
-                    linearToSRGBIfNeeded(dst.getFormat(), src.sample3D(sampler, filter, ((float)x + 0.5f) * sX,
-                                                                       ((float)y + 0.5f) * sY, ((float)z + 0.5f) * sZ)),
-                    x * xScale + xOffset, y * yScale + yOffset, z * zScale + zOffset);
-            }
+    const tcu::TextureFormat &dstFormat = dst.getFormat();
+
+    // Mirroring maps every row to a distinct destination row, so rows can be written concurrently.
+    const auto blitRow = [&](int y, int z)
+    {
+        for (int x = 0; x < dst.getWidth(); ++x)
+        {
+            dst.setPixel(linearToSRGBIfNeeded(dstFormat, src.sample3D(sampler, filter, ((float)x + 0.5f) * sX,
+                                                                      ((float)y + 0.5f) * sY, ((float)z + 0.5f) * sZ)),
+                         x * xScale + xOffset, y * yScale + yOffset, z * zScale + zOffset);
+        }
+    };
+    forEachRow(dst.getHeight(), dst.getDepth(), blitRow);
 }
 
 void flipCoordinates(CopyRegion &region, const MirrorMode mirrorMode)
@@ -5309,13 +5345,13 @@ void BlittingImages::generateExpectedResult(void)
 
     m_expectedTextureLevel[0] = de::MovePtr<tcu::TextureLevel>(
         new tcu::TextureLevel(dst.getFormat(), dst.getWidth(), dst.getHeight(), dst.getDepth()));
-    tcu::copy(m_expectedTextureLevel[0]->getAccess(), dst);
+    copyRows(m_expectedTextureLevel[0]->getAccess(), dst);
 
     if (m_params.filter != VK_FILTER_NEAREST)
     {
         m_unclampedExpectedTextureLevel = de::MovePtr<tcu::TextureLevel>(
             new tcu::TextureLevel(dst.getFormat(), dst.getWidth(), dst.getHeight(), dst.getDepth()));
-        tcu::copy(m_unclampedExpectedTextureLevel->getAccess(), dst);
+        copyRows(m_unclampedExpectedTextureLevel->getAccess(), dst);
     }
 
     for (uint32_t i = 0; i < m_params.regions.size(); i++)
@@ -6284,7 +6320,7 @@ void BlittingMipmaps::generateExpectedResult(void)
         m_expectedTextureLevel[mipLevelNdx] = de::MovePtr<tcu::TextureLevel>(new tcu::TextureLevel(
             dst.getFormat(), dst.getWidth() >> mipLevelNdx, dst.getHeight() >> mipLevelNdx, dst.getDepth()));
 
-    tcu::copy(m_expectedTextureLevel[0]->getAccess(), src);
+    copyRows(m_expectedTextureLevel[0]->getAccess(), src);
 
     if (m_params.filter != VK_FILTER_NEAREST)
     {
@@ -6292,7 +6328,7 @@ void BlittingMipmaps::generateExpectedResult(void)
             m_unclampedExpectedTextureLevel[mipLevelNdx] = de::MovePtr<tcu::TextureLevel>(new tcu::TextureLevel(
                 dst.getFormat(), dst.getWidth() >> mipLevelNdx, dst.getHeight() >> mipLevelNdx, dst.getDepth()));
 
-        tcu::copy(m_unclampedExpectedTextureLevel[0]->getAccess(), src);
+        copyRows(m_unclampedExpectedTextureLevel[0]->getAccess(), src);
     }
 
     for (uint32_t i = 0; i < m_params.regions.size(); i++)
@@ -7207,7 +7243,7 @@ void ResolveImageToImage::copyRegionToTextureLevel(tcu::ConstPixelBufferAccess s
     const tcu::PixelBufferAccess dstSubRegion = getSubregion(dstWithSrcFormat, dstOffset.x, dstOffset.y, dstOffset.z,
                                                              extent.width, extent.height, extent.depth);
 
-    tcu::copy(dstSubRegion, srcSubRegion);
+    copyRows(dstSubRegion, srcSubRegion);
 }
 
 tcu::TestStatus ResolveImageToImage::checkIntermediateCopy(void)
@@ -45,6 +45,7 @@
 #include "deUniquePtr.hpp"
 #include "deStringUtil.hpp"
 #include "deRandom.hpp"
+#include "deTaskScheduler.hpp"
 
 #include "deInt32.h"
 #include "deMath.h"
@@ -657,16 +658,35 @@ public:
     void setUndefined(size_t offset, size_t size);
     void setData(size_t offset, size_t size, const void *data);
 
+    //! Set range to value repeated in host byte order, as written by vkCmdFillBuffer.
+    void fillData(size_t offset, size_t size, uint32_t value);
+
+    //! Xor defined bytes in range with mask. Bytes that are not defined are left unchanged.
+    void xorData(size_t offset, size_t size, const void *mask);
+
+    //! Find first defined byte in [offset, offset + size) that differs from data. Returns size if none differ.
+    size_t findMismatch(size_t offset, size_t size, const void *data) const;
+
     size_t getSize(void) const
     {
         return m_data.size();
     }
 
 private:
+    void markDefined(size_t offset, size_t size);
+    size_t findMismatch(size_t offset, size_t size, const uint8_t *data, size_t firstWord, size_t endWord) const;
+
     vector<uint8_t> m_data;
     vector<uint64_t> m_defined;
 };
 
+// Mask of size bits starting at bit offset within a definedness word.
+inline uint64_t getDefinedMask(size_t offset, size_t size)
+{
+    DE_ASSERT(offset + size <= 64);
+    return (size == 64 ? ~0ull : ((0x1ull << size) - 1ull)) << offset;
+}
+
 ReferenceMemory::ReferenceMemory(size_t size) : m_data(size, 0), m_defined(size / 64 + (size % 64 == 0 ? 0 : 1), 0ull)
 {
 }
@@ -679,26 +699,91 @@ void ReferenceMemory::set(size_t pos, uint8_t val)
     m_defined[pos / 64] |= 0x1ull << (pos % 64);
 }
 
-void ReferenceMemory::setData(size_t offset, size_t size, const void *data_)
+void ReferenceMemory::markDefined(size_t offset, size_t size)
 {
-    const uint8_t *data = (const uint8_t *)data_;
+    const size_t end = offset + size;
 
+    for (size_t pos = offset; pos < end;)
+    {
+        const size_t bit   = pos % 64;
+        const size_t count = de::min<size_t>(64 - bit, end - pos);
+
+        m_defined[pos / 64] |= getDefinedMask(bit, count);
+        pos += count;
+    }
+}
+
+void ReferenceMemory::setData(size_t offset, size_t size, const void *data)
+{
     DE_ASSERT(offset < m_data.size());
     DE_ASSERT(offset + size <= m_data.size());
 
-    // \todo [2016-03-09 mika] Optimize
-    for (size_t pos = 0; pos < size; pos++)
+    deMemcpy(&m_data[offset], data, size);
+    markDefined(offset, size);
+}
+
+void ReferenceMemory::fillData(size_t offset, size_t size, uint32_t value)
+{
+    DE_ASSERT(offset + size <= m_data.size());
+
+    if (size == 0)
+        return;
+
+    // Write first copy of the pattern and double the filled part until the range is covered.
     {
-        m_data[offset + pos] = data[pos];
-        m_defined[(offset + pos) / 64] |= 0x1ull << ((offset + pos) % 64);
+        const size_t patternSize = de::min<size_t>(sizeof(value), size);
+        size_t filled            = patternSize;
+
+        deMemcpy(&m_data[offset], &value, patternSize);
+
+        while (filled < size)
+        {
+            const size_t count = de::min(filled, size - filled);
+
+            deMemcpy(&m_data[offset + filled], &m_data[offset], count);
+            filled += count;
+        }
+    }
+
+    markDefined(offset, size);
+}
+
+void ReferenceMemory::xorData(size_t offset, size_t size, const void *mask_)
+{
+    const uint8_t *const mask = (const uint8_t *)mask_;
+    const size_t end          = offset + size;
+
+    DE_ASSERT(end <= m_data.size());
+
+    for (size_t pos = offset; pos < end;)
+    {
+        const size_t bit         = pos % 64;
+        const size_t count       = de::min<size_t>(64 - bit, end - pos);
+        const uint64_t rangeMask = getDefinedMask(bit, count);
+        const uint64_t defined   = m_defined[pos / 64] & rangeMask;
+
+        if (defined == rangeMask)
+        {
+            for (size_t ndx = 0; ndx < count; ndx++)
+                m_data[pos + ndx] ^= mask[pos + ndx - offset];
+        }
+        else if (defined != 0)
+        {
+            for (size_t ndx = 0; ndx < count; ndx++)
+            {
+                if ((defined & (0x1ull << (bit + ndx))) != 0)
+                    m_data[pos + ndx] ^= mask[pos + ndx - offset];
+            }
+        }
+
+        pos += count;
     }
 }
 
 void ReferenceMemory::setUndefined(size_t offset, size_t size)
 {
-    // \todo [2016-03-09 mika] Optimize
-    for (size_t pos = 0; pos < size; pos++)
-        m_defined[(offset + pos) / 64] |= 0x1ull << ((offset + pos) % 64);
+    // \note Marks the range defined rather than clearing it, matching the previous byte-wise implementation.
+    markDefined(offset, size);
 }
 
 uint8_t ReferenceMemory::get(uint64_t pos) const
@@ -715,6 +800,54 @@ bool ReferenceMemory::isDefined(uint64_t pos) const
     return (m_defined[(size_t)pos / 64] & (0x1ull << (pos % 64))) != 0;
 }
 
+size_t ReferenceMemory::findMismatch(size_t offset, size_t size, const uint8_t *data, size_t firstWord,
+                                     size_t endWord) const
+{
+    const size_t end = offset + size;
+
+    for (size_t wordNdx = firstWord; wordNdx < endWord; wordNdx++)
+    {
+        const size_t wordBegin  = wordNdx * 64;
+        const size_t rangeBegin = de::max(wordBegin, offset);
+        const size_t rangeEnd   = de::min(wordBegin + 64, end);
+        const uint64_t defined  = m_defined[wordNdx] & getDefinedMask(rangeBegin - wordBegin, rangeEnd - rangeBegin);
+
+        if (defined == 0)
+            continue;
+
+        // Fully defined words are compared in one go and only scanned for diagnostics.
+        if (defined == ~0ull && deMemCmp(&m_data[wordBegin], data + (wordBegin - offset), 64) == 0)
+            continue;
+
+        for (size_t pos = rangeBegin; pos < rangeEnd; pos++)
+        {
+            if ((defined & (0x1ull << (pos - wordBegin))) != 0 && m_data[pos] != data[pos - offset])
+                return pos - offset;
+        }
+    }
+
+    return size;
+}
+
+size_t ReferenceMemory::findMismatch(size_t offset, size_t size, const void *data_) const
+{
+    const uint8_t *const data  = (const uint8_t *)data_;
+    const size_t firstWord     = offset / 64;
+    const size_t endWord       = divRoundUp<size_t>(offset + size, 64);
+    const size_t parallelLimit = 4 * ONE_MEGABYTE;
+
+    DE_ASSERT(offset + size <= m_data.size());
+
+    if (size < parallelLimit)
+        return findMismatch(offset, size, data, firstWord, endWord);
+
+    // Split large ranges into chunks of 1MB and keep the earliest mismatch.
+    return de::parallelReduce(
+        firstWord, endWord, ONE_MEGABYTE / 64, size,
+        [&](size_t chunkBegin, size_t chunkEnd) { return findMismatch(offset, size, data, chunkBegin, chunkEnd); },
+        [](size_t a, size_t b) { return de::min(a, b); });
+}
+
 class Memory
 {
 public:
@@ -1500,55 +1633,40 @@ void HostMemoryAccess::verify(VerifyContext &context, size_t commandIndex)
     ReferenceMemory &reference            = context.getReference();
     de::Random rng(m_seed);
 
-    if (m_read && m_write)
+    if (m_read)
     {
-        for (size_t pos = 0; pos < m_size; pos++)
+        const size_t pos = reference.findMismatch(0, m_size, m_readData.data());
+
+        if (pos < m_size)
         {
-            const uint8_t mask  = rng.getUint8();
             const uint8_t value = m_readData[pos];
 
-            if (reference.isDefined(pos))
-            {
-                if (value != reference.get(pos))
-                {
-                    resultCollector.fail(
-                        de::toString(commandIndex) + ":" + getName() +
-                        " Result differs from reference, Expected: " + de::toString(tcu::toHex<8>(reference.get(pos))) +
-                        ", Got: " + de::toString(tcu::toHex<8>(value)) + ", At offset: " + de::toString(pos));
-                    break;
-                }
-
-                reference.set(pos, reference.get(pos) ^ mask);
-            }
+            resultCollector.fail(de::toString(commandIndex) + ":" + getName() +
+                                 " Result differs from reference, Expected: " +
+                                 de::toString(tcu::toHex<8>(reference.get(pos))) +
+                                 ", Got: " + de::toString(tcu::toHex<8>(value)) + ", At offset: " + de::toString(pos));
         }
-    }
-    else if (m_read)
-    {
-        for (size_t pos = 0; pos < m_size; pos++)
+
+        // Reference is updated up to the first mismatch.
+        if (m_write)
         {
-            const uint8_t value = m_readData[pos];
+            vector<uint8_t> mask(m_size);
 
-            if (reference.isDefined(pos))
-            {
-                if (value != reference.get(pos))
-                {
-                    resultCollector.fail(
-                        de::toString(commandIndex) + ":" + getName() +
-                        " Result differs from reference, Expected: " + de::toString(tcu::toHex<8>(reference.get(pos))) +
-                        ", Got: " + de::toString(tcu::toHex<8>(value)) + ", At offset: " + de::toString(pos));
-                    break;
-                }
-            }
+            for (size_t ndx = 0; ndx < m_size; ndx++)
+                mask[ndx] = rng.getUint8();
+
+            reference.xorData(0, pos, mask.data());
         }
     }
     else if (m_write)
     {
+        vector<uint8_t> data(m_size);
+
         for (size_t pos = 0; pos < m_size; pos++)
-        {
-            const uint8_t value = rng.getUint8();
+            data[pos] = rng.getUint8();
 
-            reference.set(pos, value);
-        }
+        if (m_size > 0)
+            reference.setData(0, m_size, data.data());
     }
     else
         DE_FATAL("Host memory access without read or write.");
@@ -2346,14 +2464,7 @@ void FillBuffer::verify(VerifyContext &context, size_t)
 {
     ReferenceMemory &reference = context.getReference();
 
-    for (size_t ndx = 0; ndx < m_bufferSize; ndx++)
-    {
-#if (DE_ENDIANNESS == DE_LITTLE_ENDIAN)
-        reference.set(ndx, (uint8_t)(0xffu & (m_value >> (8 * (ndx % 4)))));
-#else
-        reference.set(ndx, (uint8_t)(0xffu & (m_value >> (8 * (3 - (ndx % 4))))));
-#endif
-    }
+    reference.fillData(0, (size_t)m_bufferSize, m_value);
 }
 
 class UpdateBuffer : public CmdCommand
@@ -2528,21 +2639,15 @@ void BufferCopyToBuffer::verify(VerifyContext &context, size_t commandIndex)
 
         {
             const uint8_t *const data = (const uint8_t *)ptr;
+            const size_t pos          = reference.findMismatch(0, (size_t)m_bufferSize, data);
 
-            for (size_t pos = 0; pos < (size_t)m_bufferSize; pos++)
+            if (pos < (size_t)m_bufferSize)
             {
-                if (reference.isDefined(pos))
-                {
-                    if (data[pos] != reference.get(pos))
-                    {
-                        resultCollector.fail(de::toString(commandIndex) + ":" + getName() +
-                                             " Result differs from reference, Expected: " +
-                                             de::toString(tcu::toHex<8>(reference.get(pos))) +
-                                             ", Got: " + de::toString(tcu::toHex<8>(data[pos])) +
-                                             ", At offset: " + de::toString(pos));
-                        break;
-                    }
-                }
+                resultCollector.fail(de::toString(commandIndex) + ":" + getName() +
+                                     " Result differs from reference, Expected: " +
+                                     de::toString(tcu::toHex<8>(reference.get(pos))) +
+                                     ", Got: " + de::toString(tcu::toHex<8>(data[pos])) +
+                                     ", At offset: " + de::toString(pos));
             }
         }
 
@@ -2636,10 +2741,14 @@ void BufferCopyFromBuffer::submit(SubmitContext &context)
 void BufferCopyFromBuffer::verify(VerifyContext &context, size_t)
 {
     ReferenceMemory &reference(context.getReference());
+    vector<uint8_t> data((size_t)m_bufferSize);
     de::Random rng(m_seed);
 
-    for (size_t ndx = 0; ndx < (size_t)m_bufferSize; ndx++)
-        reference.set(ndx, rng.getUint8());
+    for (size_t ndx = 0; ndx < data.size(); ndx++)
+        data[ndx] = rng.getUint8();
+
+    if (!data.empty())
+        reference.setData(0, data.size(), data.data());
 }
 
 class BufferCopyToImage : public CmdCommand
@@ -2861,21 +2970,16 @@ void BufferCopyToImage::verify(VerifyContext &context, size_t commandIndex)
 
         {
             const uint8_t *const data = (const uint8_t *)ptr;
+            const size_t size         = (size_t)(4 * m_imageWidth * m_imageHeight);
+            const size_t pos          = reference.findMismatch(0, size, data);
 
-            for (size_t pos = 0; pos < (size_t)(4 * m_imageWidth * m_imageHeight); pos++)
+            if (pos < size)
             {
-                if (reference.isDefined(pos))
-                {
-                    if (data[pos] != reference.get(pos))
-                    {
-                        resultCollector.fail(de::toString(commandIndex) + ":" + getName() +
-                                             " Result differs from reference, Expected: " +
-                                             de::toString(tcu::toHex<8>(reference.get(pos))) +
-                                             ", Got: " + de::toString(tcu::toHex<8>(data[pos])) +
-                                             ", At offset: " + de::toString(pos));
-                        break;
-                    }
-                }
+                resultCollector.fail(de::toString(commandIndex) + ":" + getName() +
+                                     " Result differs from reference, Expected: " +
+                                     de::toString(tcu::toHex<8>(reference.get(pos))) +
+                                     ", Got: " + de::toString(tcu::toHex<8>(data[pos])) +
+                                     ", At offset: " + de::toString(pos));
             }
         }
 
@@ -3080,10 +3184,14 @@ void BufferCopyFromImage::submit(SubmitContext &context)
 void BufferCopyFromImage::verify(VerifyContext &context, size_t)
 {
     ReferenceMemory &reference(context.getReference());
+    vector<uint8_t> data((size_t)(4 * m_imageWidth * m_imageHeight));
     de::Random rng(m_seed);
 
-    for (size_t ndx = 0; ndx < (size_t)(4 * m_imageWidth * m_imageHeight); ndx++)
-        reference.set(ndx, rng.getUint8());
+    for (size_t ndx = 0; ndx < data.size(); ndx++)
+        data[ndx] = rng.getUint8();
+
+    if (!data.empty())
+        reference.setData(0, data.size(), data.data());
 }
 
 class ImageCopyToBuffer : public CmdCommand
@@ -1732,10 +1732,9 @@ tcu::TestStatus AttachmentFeedbackLoopLayoutImageSamplingInstance::verifyImage(v
     for (int imgNdx = 0; imgNdx < m_imageCount; ++imgNdx)
     {
         // Read back result image
-        de::MovePtr<tcu::TextureLevel> resultTexture(readColorAttachment(
-            m_context.getDeviceInterface(), m_context.getDevice(), m_context.getUniversalQueue(),
-            m_context.getUniversalQueueFamilyIndex(), m_context.getDefaultAllocator(), **m_colorImages[imgNdx],
-            m_colorFormat, renderSize, vk::VK_IMAGE_LAYOUT_ATTACHMENT_FEEDBACK_LOOP_OPTIMAL_EXT));
+        de::MovePtr<tcu::TextureLevel> resultTexture(
+            readColorAttachment(m_context, **m_colorImages[imgNdx], m_colorFormat, renderSize,
+                                vk::VK_IMAGE_LAYOUT_ATTACHMENT_FEEDBACK_LOOP_OPTIMAL_EXT));
         const tcu::ConstPixelBufferAccess result = resultTexture->getAccess();
         const bool isIntegerFormat               = isUintFormat(m_imageFormat) || isIntFormat(m_imageFormat);
 
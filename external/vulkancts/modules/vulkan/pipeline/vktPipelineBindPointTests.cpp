@@ -828,8 +828,8 @@ tcu::TestStatus BindPointInstance::iterate(void)
     // Verify color attachment.
     if (hasGraphics)
     {
-        const auto textureLevel = readColorAttachment(vkd, device, queue, qIndex, alloc, colorAttachment->get(),
-                                                      imageFormat, tcu::UVec2(imageExtent.width, imageExtent.height));
+        const auto textureLevel = readColorAttachment(m_context, colorAttachment->get(), imageFormat,
+                                                      tcu::UVec2(imageExtent.width, imageExtent.height));
         const auto pixelBuffer  = textureLevel->getAccess();
         const auto iWidth       = static_cast<int>(imageExtent.width);
         const auto iHeight      = static_cast<int>(imageExtent.height);
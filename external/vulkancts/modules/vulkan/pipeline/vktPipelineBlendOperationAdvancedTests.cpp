@@ -1393,12 +1393,7 @@ tcu::TestStatus BlendOperationAdvancedTestInstance::iterate(void)
 
 bool BlendOperationAdvancedTestInstance::verifyTestResult()
 {
-    bool compareOk                  = true;
-    const DeviceInterface &vk       = m_context.getDeviceInterface();
-    const VkDevice vkDevice         = m_context.getDevice();
-    const VkQueue queue             = m_context.getUniversalQueue();
-    const uint32_t queueFamilyIndex = m_context.getUniversalQueueFamilyIndex();
-    Allocator &allocator            = m_context.getDefaultAllocator();
+    bool compareOk = true;
     std::vector<tcu::TextureLevel> referenceImages;
 
     for (uint32_t colorAtt = 0; colorAtt < m_param.colorAttachmentsCount; colorAtt++)
@@ -1476,8 +1471,8 @@ bool BlendOperationAdvancedTestInstance::verifyTestResult()
     for (uint32_t colorAtt = 0; colorAtt < m_param.colorAttachmentsCount; colorAtt++)
     {
         // Compare image
-        de::MovePtr<tcu::TextureLevel> result = vkt::pipeline::readColorAttachment(
-            vk, vkDevice, queue, queueFamilyIndex, allocator, *m_colorImages[colorAtt], m_colorFormat, m_renderSize);
+        de::MovePtr<tcu::TextureLevel> result =
+            vkt::pipeline::readColorAttachment(m_context, *m_colorImages[colorAtt], m_colorFormat, m_renderSize);
         std::ostringstream name;
         name << "Image comparison. Color attachment: " << colorAtt
              << ". Depth op: " << de::toLower(getBlendOpStr(m_param.blendOps[colorAtt]).toString().substr(3));
@@ -2088,12 +2083,7 @@ tcu::TestStatus BlendOperationAdvancedTestCoherentInstance::iterate(void)
 
 tcu::TestStatus BlendOperationAdvancedTestCoherentInstance::verifyTestResult(void)
 {
-    bool compareOk                  = true;
-    const DeviceInterface &vk       = m_context.getDeviceInterface();
-    const VkDevice vkDevice         = m_context.getDevice();
-    const VkQueue queue             = m_context.getUniversalQueue();
-    const uint32_t queueFamilyIndex = m_context.getUniversalQueueFamilyIndex();
-    Allocator &allocator            = m_context.getDefaultAllocator();
+    bool compareOk = true;
     tcu::TextureLevel refImage(vk::mapVkFormat(m_colorFormat), 32, 32);
 
     tcu::clear(refImage.getAccess(), clearColorVec4);
@@ -2145,8 +2135,8 @@ tcu::TestStatus BlendOperationAdvancedTestCoherentInstance::verifyTestResult(voi
         tcu::clear(tcu::getSubregion(refImage.getAccess(), x, y, 1u, 1u), rectColor);
     }
 
-    de::MovePtr<tcu::TextureLevel> result = vkt::pipeline::readColorAttachment(
-        vk, vkDevice, queue, queueFamilyIndex, allocator, *m_colorImage, m_colorFormat, m_renderSize);
+    de::MovePtr<tcu::TextureLevel> result =
+        vkt::pipeline::readColorAttachment(m_context, *m_colorImage, m_colorFormat, m_renderSize);
     std::ostringstream name;
     name << "Image comparison. Depth ops: " << de::toLower(getBlendOpStr(m_param.blendOps[0]).toString().substr(3))
          << " and " << de::toLower(getBlendOpStr(m_param.blendOps[1]).toString().substr(3));
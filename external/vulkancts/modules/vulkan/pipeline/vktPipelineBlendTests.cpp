@@ -758,6 +758,7 @@ BlendTestInstance::BlendTestInstance(Context &context, const PipelineConstructio
             colorBlendStateParams.pAttachments    = &m_blendStates[quadNdx];
 
             m_graphicsPipelines[quadNdx]
+                .setPipelineLibraryCache(&m_context.getPipelineLibraryCache())
                 .setDefaultMultisampleState()
                 .setDefaultDepthStencilState()
                 .setDefaultRasterizationState()
@@ -1126,16 +1127,8 @@ tcu::TestStatus BlendTestInstance::verifyImage(void)
 
     // Compare result with reference image
     {
-        const DeviceInterface &vk       = m_context.getDeviceInterface();
-        const VkDevice vkDevice         = m_context.getDevice();
-        const VkQueue queue             = m_context.getUniversalQueue();
-        const uint32_t queueFamilyIndex = m_context.getUniversalQueueFamilyIndex();
-        SimpleAllocator allocator(
-            vk, vkDevice,
-            getPhysicalDeviceMemoryProperties(m_context.getInstanceInterface(), m_context.getPhysicalDevice()));
-        de::UniquePtr<tcu::TextureLevel> result(readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, allocator,
-                                                                    *m_colorImage, m_colorFormat, m_renderSize)
-                                                    .release());
+        de::UniquePtr<tcu::TextureLevel> result(
+            readColorAttachment(m_context, *m_colorImage, m_colorFormat, m_renderSize).release());
         const tcu::Vec4 threshold(getFormatThreshold(tcuColorFormat));
         tcu::TextureLevel refLevel;
 
@@ -1349,6 +1342,7 @@ DualSourceBlendTestInstance::DualSourceBlendTestInstance(
             colorBlendStateParams.pAttachments    = &m_blendStates[quadNdx];
 
             m_graphicsPipelines[quadNdx]
+                .setPipelineLibraryCache(&m_context.getPipelineLibraryCache())
                 .setDefaultRasterizationState()
                 .setDefaultDepthStencilState()
                 .setDefaultMultisampleState()
@@ -1557,16 +1551,8 @@ tcu::TestStatus DualSourceBlendTestInstance::verifyImage(void)
 
     // Compare result with reference image
     {
-        const DeviceInterface &vk       = m_context.getDeviceInterface();
-        const VkDevice vkDevice         = m_context.getDevice();
-        const VkQueue queue             = m_context.getUniversalQueue();
-        const uint32_t queueFamilyIndex = m_context.getUniversalQueueFamilyIndex();
-        SimpleAllocator allocator(
-            vk, vkDevice,
-            getPhysicalDeviceMemoryProperties(m_context.getInstanceInterface(), m_context.getPhysicalDevice()));
-        de::UniquePtr<tcu::TextureLevel> result(readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, allocator,
-                                                                    *m_colorImage, m_colorFormat, m_renderSize)
-                                                    .release());
+        de::UniquePtr<tcu::TextureLevel> result(
+            readColorAttachment(m_context, *m_colorImage, m_colorFormat, m_renderSize).release());
         tcu::Vec4 threshold(getFormatThreshold(tcuColorFormat));
         tcu::TextureLevel refLevel;
 
@@ -1961,9 +1947,8 @@ tcu::TestStatus ClampTestInstance::iterate(void)
 
     // Compare result with reference color
     const tcu::UVec2 renderSizeUV2(renderSize.width, renderSize.height);
-    de::UniquePtr<tcu::TextureLevel> result(readColorAttachment(vkd, device, queue, queueFamilyIndex, allocator,
-                                                                colorImage.get(), m_params.colorFormat, renderSizeUV2)
-                                                .release());
+    de::UniquePtr<tcu::TextureLevel> result(
+        readColorAttachment(m_context, colorImage.get(), m_params.colorFormat, renderSizeUV2).release());
     const tcu::Vec4 threshold(getFormatThreshold(tcuColorFormat));
     const tcu::ConstPixelBufferAccess pixelBufferAccess = result->getAccess();
 
@@ -812,21 +812,19 @@ void GraphicsCacheTestInstance::prepareCommandBuffer(void)
 
 tcu::TestStatus GraphicsCacheTestInstance::verifyTestResult(void)
 {
-    const DeviceInterface &vk       = m_context.getDeviceInterface();
-    const VkDevice vkDevice         = m_context.getDevice();
-    const uint32_t queueFamilyIndex = m_context.getUniversalQueueFamilyIndex();
+    // Both attachments are read back in a single submission.
+    ReadbackRing &readback    = m_context.getReadbackRing();
+    const uint32_t noCacheNdx =
+        readback.addColorImage(*m_colorImage[PIPELINE_CACHE_NDX_NO_CACHE], m_colorFormat, m_renderSize);
+    const uint32_t cacheNdx =
+        readback.addColorImage(*m_colorImage[PIPELINE_CACHE_NDX_CACHED], m_colorFormat, m_renderSize);
 
-    const VkQueue queue = m_context.getUniversalQueue();
-    de::MovePtr<tcu::TextureLevel> resultNoCache =
-        readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, m_context.getDefaultAllocator(),
-                            *m_colorImage[PIPELINE_CACHE_NDX_NO_CACHE], m_colorFormat, m_renderSize);
-    de::MovePtr<tcu::TextureLevel> resultCache =
-        readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, m_context.getDefaultAllocator(),
-                            *m_colorImage[PIPELINE_CACHE_NDX_CACHED], m_colorFormat, m_renderSize);
+    readback.flush();
 
     bool compareOk = tcu::intThresholdCompare(m_context.getTestContext().getLog(), "IntImageCompare",
-                                              "Image comparison", resultNoCache->getAccess(), resultCache->getAccess(),
-                                              tcu::UVec4(1, 1, 1, 1), tcu::COMPARE_LOG_RESULT);
+                                              "Image comparison", readback.getResult(noCacheNdx),
+                                              readback.getResult(cacheNdx), tcu::UVec4(1, 1, 1, 1),
+                                              tcu::COMPARE_LOG_RESULT);
 
     if (compareOk)
         return tcu::TestStatus::pass("Render images w/o cached pipeline match.");
@@ -913,8 +913,8 @@ tcu::TestStatus ColorWriteEnableInstance::iterate(void)
     for (uint32_t attachmentIndex = 0u; attachmentIndex < kNumColorAttachments;
          ++attachmentIndex, ++nextAttachmentImage)
     {
-        const auto colorBuffer = readColorAttachment(vkd, device, queue, queueIndex, allocator,
-                                                     (*nextAttachmentImage)->get(), kColorFormat, renderSize);
+        const auto colorBuffer =
+            readColorAttachment(m_context, (*nextAttachmentImage)->get(), kColorFormat, renderSize);
         const auto colorAccess = colorBuffer->getAccess();
 
         tcu::TextureLevel colorError(errorFormat, kWidth, kHeight);
@@ -1633,9 +1633,8 @@ TestStatus ColorWriteEnable2Instance::iterate(void)
     for (uint32_t i = 0; i < attachmentCount; ++i)
         for (uint32_t a = 0; a < (i + 1); ++a)
         {
-            const auto colorBuffer = readColorAttachment(m_vkd, m_device, queue, queueIndex, m_allocator,
-                                                         **framebuffers.at(i).attachments.at(a).image, m_params.format,
-                                                         UVec2(m_params.width, m_params.height));
+            const auto colorBuffer = readColorAttachment(m_context, **framebuffers.at(i).attachments.at(a).image,
+                                                         m_params.format, UVec2(m_params.width, m_params.height));
             tcu::TestStatus status =
                 verifyAttachment(a, (i + 1), colorBuffer->getAccess(), writeEnables, background, blendComp);
             if (status.isFail())
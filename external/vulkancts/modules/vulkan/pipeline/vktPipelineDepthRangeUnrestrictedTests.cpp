@@ -921,8 +921,8 @@ tcu::TestStatus DepthRangeUnrestrictedTestInstance::verifyTestResult(void)
 
     // Check the rendered image
     {
-        de::MovePtr<tcu::TextureLevel> result = vkt::pipeline::readColorAttachment(
-            vk, vkDevice, queue, queueFamilyIndex, allocator, *m_colorImage, m_colorFormat, m_renderSize);
+        de::MovePtr<tcu::TextureLevel> result =
+            vkt::pipeline::readColorAttachment(m_context, *m_colorImage, m_colorFormat, m_renderSize);
 
         compareOk = tcu::intThresholdPositionDeviationCompare(
             m_context.getTestContext().getLog(), "IntImageCompare", "Image comparison", refImage.getAccess(),
@@ -1234,8 +1234,8 @@ tcu::TestStatus DepthBoundsRangeUnrestrictedTestInstance::verifyTestResult(bool
 
     // Check the rendered image
     {
-        de::MovePtr<tcu::TextureLevel> result = vkt::pipeline::readColorAttachment(
-            vk, vkDevice, queue, queueFamilyIndex, allocator, *m_colorImage, m_colorFormat, m_renderSize);
+        de::MovePtr<tcu::TextureLevel> result =
+            vkt::pipeline::readColorAttachment(m_context, *m_colorImage, m_colorFormat, m_renderSize);
         std::string description = "Image comparison draw ";
         description += (firstDraw ? "1" : "2");
 
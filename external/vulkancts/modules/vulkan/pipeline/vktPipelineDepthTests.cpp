@@ -1024,15 +1024,8 @@ tcu::TestStatus DepthTestInstance::verifyImage(void)
     // Compare color result with reference image
     if (m_colorAttachmentEnable)
     {
-        const DeviceInterface &vk       = m_context.getDeviceInterface();
-        const VkDevice vkDevice         = m_context.getDevice();
-        const VkQueue queue             = m_context.getUniversalQueue();
-        const uint32_t queueFamilyIndex = m_context.getUniversalQueueFamilyIndex();
-        SimpleAllocator allocator(
-            vk, vkDevice,
-            getPhysicalDeviceMemoryProperties(m_context.getInstanceInterface(), m_context.getPhysicalDevice()));
-        de::MovePtr<tcu::TextureLevel> result = readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, allocator,
-                                                                    *m_colorImage, m_colorFormat, m_renderSize);
+        de::MovePtr<tcu::TextureLevel> result =
+            readColorAttachment(m_context, *m_colorImage, m_colorFormat, m_renderSize);
 
         colorCompareOk = tcu::intThresholdPositionDeviationCompare(
             m_context.getTestContext().getLog(), "IntImageCompare", "Image comparison", refRenderer.getAccess(),
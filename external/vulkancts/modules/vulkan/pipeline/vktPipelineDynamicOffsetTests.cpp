@@ -720,9 +720,8 @@ tcu::TestStatus DynamicOffsetGraphicsTestInstance::verifyImage(void)
 
     // Compare result with reference image
     {
-        de::MovePtr<tcu::TextureLevel> result = readColorAttachment(
-            m_context.getDeviceInterface(), m_context.getDevice(), m_context.getUniversalQueue(),
-            m_context.getUniversalQueueFamilyIndex(), m_memAlloc, *m_colorImage, m_colorFormat, m_renderSize);
+        de::MovePtr<tcu::TextureLevel> result =
+            readColorAttachment(m_context, *m_colorImage, m_colorFormat, m_renderSize);
 
         compareOk = tcu::intThresholdPositionDeviationCompare(
             m_context.getTestContext().getLog(), "IntImageCompare", "Image comparison", refRenderer.getAccess(),
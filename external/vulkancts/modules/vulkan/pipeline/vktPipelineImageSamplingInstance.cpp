@@ -1631,10 +1631,8 @@ tcu::TestStatus ImageSamplingInstance::verifyImage(void)
         for (int imgNdx = 0; imgNdx < m_imageCount; ++imgNdx)
         {
             // Read back result image
-            UniquePtr<tcu::TextureLevel> result(readColorAttachment(
-                m_context.getDeviceInterface(), m_context.getDevice(), m_context.getUniversalQueue(),
-                m_context.getUniversalQueueFamilyIndex(), m_context.getDefaultAllocator(), **m_colorImages[imgNdx],
-                m_colorFormat, m_renderSize));
+            UniquePtr<tcu::TextureLevel> result(
+                readColorAttachment(m_context, **m_colorImages[imgNdx], m_colorFormat, m_renderSize));
             const tcu::ConstPixelBufferAccess resultAccess = result->getAccess();
             bool compareOk =
                 validateResultImage(*texture, m_imageViewType, subresource, sampler, m_componentMapping, coordAccess,
@@ -29,6 +29,7 @@
 #include "vkRefUtil.hpp"
 #include "vkCmdUtil.hpp"
 #include "vkTypeUtil.hpp"
+#include "vkReadbackRing.hpp"
 #include "tcuTextureUtil.hpp"
 #include "tcuAstcUtil.hpp"
 #include "deRandom.hpp"
@@ -247,54 +248,37 @@ de::MovePtr<tcu::TextureLevel> readColorAttachment(const vk::DeviceInterface &vk
                                                    vk::Allocator &allocator, vk::VkImage image, vk::VkFormat format,
                                                    const tcu::UVec2 &renderSize, vk::VkImageLayout oldLayout)
 {
-    Move<VkBuffer> buffer;
-    de::MovePtr<Allocation> bufferAlloc;
-    Move<VkCommandPool> cmdPool;
-    Move<VkCommandBuffer> cmdBuffer;
-    Move<VkFence> fence;
     const tcu::TextureFormat tcuFormat = mapVkFormat(format);
     const VkDeviceSize pixelDataSize   = renderSize.x() * renderSize.y() * tcuFormat.getPixelSize();
     de::MovePtr<tcu::TextureLevel> resultLevel(new tcu::TextureLevel(tcuFormat, renderSize.x(), renderSize.y()));
 
-    // Create destination buffer
-    {
-        const VkBufferCreateInfo bufferParams = {
-            VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO, // VkStructureType sType;
-            DE_NULL,                              // const void* pNext;
-            0u,                                   // VkBufferCreateFlags flags;
-            pixelDataSize,                        // VkDeviceSize size;
-            VK_BUFFER_USAGE_TRANSFER_DST_BIT,     // VkBufferUsageFlags usage;
-            VK_SHARING_MODE_EXCLUSIVE,            // VkSharingMode sharingMode;
-            0u,                                   // uint32_t queueFamilyIndexCount;
-            DE_NULL                               // const uint32_t* pQueueFamilyIndices;
-        };
-
-        buffer = createBuffer(vk, device, &bufferParams);
-        bufferAlloc =
-            allocator.allocate(getBufferMemoryRequirements(vk, device, *buffer), MemoryRequirement::HostVisible);
-        VK_CHECK(vk.bindBufferMemory(device, *buffer, bufferAlloc->getMemory(), bufferAlloc->getOffset()));
-    }
-
-    // Create command pool and buffer
-    cmdPool   = createCommandPool(vk, device, VK_COMMAND_POOL_CREATE_TRANSIENT_BIT, queueFamilyIndex);
-    cmdBuffer = allocateCommandBuffer(vk, device, *cmdPool, VK_COMMAND_BUFFER_LEVEL_PRIMARY);
+    // Staging memory of a ring that is not kept only needs to hold this image.
+    ReadbackRing readback(vk, device, queue, queueFamilyIndex, allocator, pixelDataSize);
 
-    // Create fence
-    fence = createFence(vk, device);
+    tcu::copy(*resultLevel, readback.readColorImage(image, format, renderSize, oldLayout));
 
-    beginCommandBuffer(vk, *cmdBuffer);
-    copyImageToBuffer(vk, *cmdBuffer, image, *buffer, tcu::IVec2(renderSize.x(), renderSize.y()),
-                      VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, oldLayout);
-    endCommandBuffer(vk, *cmdBuffer);
+    return resultLevel;
+}
 
-    submitCommandsAndWait(vk, device, queue, cmdBuffer.get());
+de::MovePtr<tcu::TextureLevel> readColorAttachment(Context &context, vk::VkImage image, vk::VkFormat format,
+                                                   const tcu::UVec2 &renderSize, vk::VkImageLayout oldLayout)
+{
+#ifndef CTS_USES_VULKANSC
+    const tcu::TextureFormat tcuFormat = mapVkFormat(format);
+    de::MovePtr<tcu::TextureLevel> resultLevel(new tcu::TextureLevel(tcuFormat, renderSize.x(), renderSize.y()));
+    ReadbackRing &readback   = context.getReadbackRing();
+    const uint32_t resultNdx = readback.addColorImage(image, format, renderSize, oldLayout);
 
-    // Read buffer data
-    invalidateAlloc(vk, device, *bufferAlloc);
-    tcu::copy(*resultLevel,
-              tcu::ConstPixelBufferAccess(resultLevel->getFormat(), resultLevel->getSize(), bufferAlloc->getHostPtr()));
+    // The ring is not reset, so results the caller added to it earlier stay valid.
+    readback.flush();
+    tcu::copy(*resultLevel, readback.getResult(resultNdx));
 
     return resultLevel;
+#else
+    return readColorAttachment(context.getDeviceInterface(), context.getDevice(), context.getUniversalQueue(),
+                               context.getUniversalQueueFamilyIndex(), context.getDefaultAllocator(), image, format,
+                               renderSize, oldLayout);
+#endif // CTS_USES_VULKANSC
 }
 
 de::MovePtr<tcu::TextureLevel> readDepthAttachment(const vk::DeviceInterface &vk, vk::VkDevice device,
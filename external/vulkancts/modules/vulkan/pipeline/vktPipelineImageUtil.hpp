@@ -33,6 +33,7 @@
 #include "tcuTexture.hpp"
 #include "tcuCompressedTexture.hpp"
 #include "deSharedPtr.hpp"
+#include "vktTestCase.hpp"
 
 namespace vkt
 {
@@ -79,6 +80,15 @@ de::MovePtr<tcu::TextureLevel> readColorAttachment(
     vk::Allocator &allocator, vk::VkImage image, vk::VkFormat format, const tcu::UVec2 &renderSize,
     vk::VkImageLayout oldLayout = vk::VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
 
+/*--------------------------------------------------------------------*//*!
+ * Same as above for an image of the default device. The copy goes
+ * through the readback ring of the context instead of staging memory
+ * allocated for each call.
+ *//*--------------------------------------------------------------------*/
+de::MovePtr<tcu::TextureLevel> readColorAttachment(
+    Context &context, vk::VkImage image, vk::VkFormat format, const tcu::UVec2 &renderSize,
+    vk::VkImageLayout oldLayout = vk::VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+
 /*--------------------------------------------------------------------*//*!
  * Gets a tcu::TextureLevel initialized with data from a VK depth
  * attachment.
@@ -448,16 +448,9 @@ tcu::TestStatus LogicOpTestInstance::iterate(void)
 
 tcu::TestStatus LogicOpTestInstance::verifyImage(void)
 {
-    const DeviceInterface &vk       = m_context.getDeviceInterface();
-    const VkDevice vkDevice         = m_context.getDevice();
-    const VkQueue queue             = m_context.getUniversalQueue();
-    const uint32_t queueFamilyIndex = m_context.getUniversalQueueFamilyIndex();
-    Allocator &allocator            = m_context.getDefaultAllocator();
-    auto &log                       = m_context.getTestContext().getLog();
-
-    const auto result = readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, allocator, m_colorImage->get(),
-                                            m_params.format, m_renderSize)
-                            .release();
+    auto &log = m_context.getTestContext().getLog();
+
+    const auto result = readColorAttachment(m_context, m_colorImage->get(), m_params.format, m_renderSize).release();
     const auto resultAccess = result->getAccess();
     const int iWidth        = static_cast<int>(m_renderSize.x());
     const int iHeight       = static_cast<int>(m_renderSize.y());
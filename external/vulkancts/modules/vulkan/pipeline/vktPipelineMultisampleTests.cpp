@@ -4441,10 +4441,9 @@ MultisampleRenderer::~MultisampleRenderer(void)
 
 de::MovePtr<tcu::TextureLevel> MultisampleRenderer::render(void)
 {
-    const DeviceInterface &vk       = m_context.getDeviceInterface();
-    const VkDevice vkDevice         = m_context.getDevice();
-    const VkQueue queue             = m_context.getUniversalQueue();
-    const uint32_t queueFamilyIndex = m_context.getUniversalQueueFamilyIndex();
+    const DeviceInterface &vk = m_context.getDeviceInterface();
+    const VkDevice vkDevice   = m_context.getDevice();
+    const VkQueue queue       = m_context.getUniversalQueue();
 
     if (m_backingMode == IMAGE_BACKING_MODE_SPARSE)
     {
@@ -4459,13 +4458,11 @@ de::MovePtr<tcu::TextureLevel> MultisampleRenderer::render(void)
     if (m_renderType == RENDER_TYPE_RESOLVE || m_renderType == RENDER_TYPE_DEPTHSTENCIL_ONLY ||
         m_renderType == RENDER_TYPE_UNUSED_ATTACHMENT)
     {
-        return readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, m_context.getDefaultAllocator(),
-                                   *m_resolveImage, m_colorFormat, m_renderSize.cast<uint32_t>());
+        return readColorAttachment(m_context, *m_resolveImage, m_colorFormat, m_renderSize.cast<uint32_t>());
     }
     else if (m_renderType == RENDER_TYPE_SINGLE_SAMPLE)
     {
-        return readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, m_context.getDefaultAllocator(),
-                                   *m_colorImage, m_colorFormat, m_renderSize.cast<uint32_t>());
+        return readColorAttachment(m_context, *m_colorImage, m_colorFormat, m_renderSize.cast<uint32_t>());
     }
     else
     {
@@ -4475,9 +4472,8 @@ de::MovePtr<tcu::TextureLevel> MultisampleRenderer::render(void)
 
 de::MovePtr<tcu::TextureLevel> MultisampleRenderer::getSingleSampledImage(uint32_t sampleId)
 {
-    return readColorAttachment(m_context.getDeviceInterface(), m_context.getDevice(), m_context.getUniversalQueue(),
-                               m_context.getUniversalQueueFamilyIndex(), m_context.getDefaultAllocator(),
-                               *m_perSampleImages[sampleId]->m_image, m_colorFormat, m_renderSize.cast<uint32_t>());
+    return readColorAttachment(m_context, *m_perSampleImages[sampleId]->m_image, m_colorFormat,
+                               m_renderSize.cast<uint32_t>());
 }
 
 de::MovePtr<tcu::TextureLevel> MultisampleRenderer::renderReusingDepth()
@@ -4643,8 +4639,7 @@ de::MovePtr<tcu::TextureLevel> MultisampleRenderer::renderReusingDepth()
     endCommandBuffer(ctx.vkd, cmdBuffer);
     submitCommandsAndWait(ctx.vkd, ctx.device, ctx.queue, cmdBuffer);
 
-    return readColorAttachment(ctx.vkd, ctx.device, ctx.queue, ctx.qfIndex, ctx.allocator,
-                               secondResolveBuffer.getImage(), m_colorFormat, renderSize);
+    return readColorAttachment(m_context, secondResolveBuffer.getImage(), m_colorFormat, renderSize);
 }
 
 // Multisample tests with subpasses using no attachments.
@@ -5869,8 +5864,7 @@ tcu::TestStatus ZExportIterate(Context &context, const ZExportParams params)
     submitCommandsAndWait(ctx.vkd, ctx.device, ctx.queue, cmdBuffer);
 
     const tcu::UVec2 renderSize(fbExtent.width, fbExtent.height);
-    const auto colorLevel = readColorAttachment(ctx.vkd, ctx.device, ctx.queue, ctx.qfIndex, ctx.allocator,
-                                                colorResolveAttachment.get(), colorFormat, renderSize);
+    const auto colorLevel = readColorAttachment(context, colorResolveAttachment.get(), colorFormat, renderSize);
     const auto depthLevel = readDepthAttachment(ctx.vkd, ctx.device, ctx.queue, ctx.qfIndex, ctx.allocator,
                                                 dsResolveAttachment.get(), dsFormat, renderSize);
     const auto stencilLevel =
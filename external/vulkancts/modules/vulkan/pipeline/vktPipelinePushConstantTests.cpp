@@ -718,15 +718,8 @@ tcu::TestStatus PushConstantGraphicsTestInstance::verifyImage(void)
 
     // Compare result with reference image
     {
-        const DeviceInterface &vk       = m_context.getDeviceInterface();
-        const VkDevice vkDevice         = m_context.getDevice();
-        const VkQueue queue             = m_context.getUniversalQueue();
-        const uint32_t queueFamilyIndex = m_context.getUniversalQueueFamilyIndex();
-        SimpleAllocator allocator(
-            vk, vkDevice,
-            getPhysicalDeviceMemoryProperties(m_context.getInstanceInterface(), m_context.getPhysicalDevice()));
-        de::MovePtr<tcu::TextureLevel> result = readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, allocator,
-                                                                    *m_colorImage, m_colorFormat, m_renderSize);
+        de::MovePtr<tcu::TextureLevel> result =
+            readColorAttachment(m_context, *m_colorImage, m_colorFormat, m_renderSize);
 
         compareOk = tcu::intThresholdPositionDeviationCompare(
             m_context.getTestContext().getLog(), "IntImageCompare", "Image comparison", refRenderer.getAccess(),
@@ -2738,13 +2731,8 @@ tcu::TestStatus PushConstantLifetimeTestInstance::verify(bool verifyGraphics, bo
             refRenderer.draw(renderState, rr::PRIMITIVETYPE_TRIANGLES, m_vertices);
         }
 
-        const VkQueue queue             = m_context.getUniversalQueue();
-        const uint32_t queueFamilyIndex = m_context.getUniversalQueueFamilyIndex();
-        SimpleAllocator allocator(
-            vk, vkDevice,
-            getPhysicalDeviceMemoryProperties(m_context.getInstanceInterface(), m_context.getPhysicalDevice()));
-        de::MovePtr<tcu::TextureLevel> result = readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, allocator,
-                                                                    *m_colorImage, m_colorFormat, m_renderSize);
+        de::MovePtr<tcu::TextureLevel> result =
+            readColorAttachment(m_context, *m_colorImage, m_colorFormat, m_renderSize);
 
         graphicsOk = tcu::intThresholdPositionDeviationCompare(
             m_context.getTestContext().getLog(), "IntImageCompare", "Image comparison", refRenderer.getAccess(),
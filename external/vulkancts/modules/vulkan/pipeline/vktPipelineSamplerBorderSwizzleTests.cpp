@@ -1083,8 +1083,8 @@ tcu::TestStatus BorderSwizzleInstance::iterate(void)
 
     // Verify color buffer.
     const auto renderSize           = tcu::UVec2(extent.width, extent.height);
-    const auto colorAttachmentLevel = readColorAttachment(vkd, device, queue, qIndex, alloc, colorAttachment.get(),
-                                                          colorAttachmentFormat, renderSize);
+    const auto colorAttachmentLevel =
+        readColorAttachment(m_context, colorAttachment.get(), colorAttachmentFormat, renderSize);
     const auto colorPixels          = colorAttachmentLevel->getAccess();
     const auto tcuTextureFormat     = mapVkFormat(m_params.textureFormat);
     const auto borderColor          = getBorderClearColorValue(m_params);
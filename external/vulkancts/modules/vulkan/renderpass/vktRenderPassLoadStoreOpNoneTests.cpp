@@ -1488,8 +1488,8 @@ tcu::TestStatus LoadStoreOpNoneTestInstance::iterate(void)
                     layout = (m_testParams.attachments[i].usage & ATTACHMENT_USAGE_INPUT) ?
                                  VK_IMAGE_LAYOUT_RENDERING_LOCAL_READ_KHR :
                                  VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-                textureLevelResult = pipeline::readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, allocator,
-                                                                   *attachmentImages[i], format, m_imageSize, layout);
+                textureLevelResult =
+                    pipeline::readColorAttachment(m_context, *attachmentImages[i], format, m_imageSize, layout);
                 transitioned       = true;
             }
 
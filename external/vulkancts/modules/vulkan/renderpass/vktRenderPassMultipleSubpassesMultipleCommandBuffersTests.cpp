@@ -781,13 +781,9 @@ void MultipleSubpassesMultipleCommandBuffersTestInstance::createCommandBuffer(co
 
 tcu::TestStatus MultipleSubpassesMultipleCommandBuffersTestInstance::iterate(void)
 {
-    const DeviceInterface &vk       = m_context.getDeviceInterface();
-    const VkDevice vkDevice         = m_context.getDevice();
-    const VkQueue queue             = m_context.getUniversalQueue();
-    const uint32_t queueFamilyIndex = m_context.getUniversalQueueFamilyIndex();
-    SimpleAllocator allocator(
-        vk, vkDevice,
-        getPhysicalDeviceMemoryProperties(m_context.getInstanceInterface(), m_context.getPhysicalDevice()));
+    const DeviceInterface &vk = m_context.getDeviceInterface();
+    const VkDevice vkDevice   = m_context.getDevice();
+    const VkQueue queue       = m_context.getUniversalQueue();
 
     {
         const Unique<VkFence> fence(createFence(vk, vkDevice));
@@ -820,11 +816,9 @@ tcu::TestStatus MultipleSubpassesMultipleCommandBuffersTestInstance::iterate(voi
 
         // Read result images.
         de::MovePtr<tcu::TextureLevel> imagePixelsA =
-            pipeline::readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, allocator, *m_colorImageA,
-                                          VK_FORMAT_R32G32B32A32_SFLOAT, m_renderSize);
+            pipeline::readColorAttachment(m_context, *m_colorImageA, VK_FORMAT_R32G32B32A32_SFLOAT, m_renderSize);
         de::MovePtr<tcu::TextureLevel> imagePixelsB =
-            pipeline::readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, allocator, *m_colorImageB,
-                                          VK_FORMAT_R32G32B32A32_SFLOAT, m_renderSize);
+            pipeline::readColorAttachment(m_context, *m_colorImageB, VK_FORMAT_R32G32B32A32_SFLOAT, m_renderSize);
 
         // Verify pixel colors match.
         const tcu::ConstPixelBufferAccess &imageAccessA = imagePixelsA->getAccess();
@@ -1126,22 +1126,11 @@ tcu::TestStatus UnusedAttachmentTestInstance::iterate(void)
 
 tcu::TestStatus UnusedAttachmentTestInstance::verifyImage(void)
 {
-    const DeviceInterface &vk       = m_context.getDeviceInterface();
-    const VkDevice vkDevice         = m_context.getDevice();
-    const VkQueue queue             = m_context.getUniversalQueue();
-    const uint32_t queueFamilyIndex = m_context.getUniversalQueueFamilyIndex();
-    SimpleAllocator allocator(
-        vk, vkDevice,
-        getPhysicalDeviceMemoryProperties(m_context.getInstanceInterface(), m_context.getPhysicalDevice()));
     de::UniquePtr<tcu::TextureLevel> textureLevelResult(
-        pipeline::readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, allocator, *m_colorImage,
-                                      VK_FORMAT_R8G8B8A8_UNORM, m_renderSize)
-            .release());
+        pipeline::readColorAttachment(m_context, *m_colorImage, VK_FORMAT_R8G8B8A8_UNORM, m_renderSize).release());
     const tcu::ConstPixelBufferAccess &resultAccess = textureLevelResult->getAccess();
     de::UniquePtr<tcu::TextureLevel> textureLevelUnused(
-        pipeline::readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, allocator, *m_unusedImage,
-                                      VK_FORMAT_R8G8B8A8_UNORM, m_renderSize)
-            .release());
+        pipeline::readColorAttachment(m_context, *m_unusedImage, VK_FORMAT_R8G8B8A8_UNORM, m_renderSize).release());
     const tcu::ConstPixelBufferAccess &unusedAccess = textureLevelUnused->getAccess();
     tcu::TestLog &log                               = m_context.getTestContext().getLog();
     tcu::Vec4 refColor(0.1f, 0.2f, 0.3f, 0.4f);
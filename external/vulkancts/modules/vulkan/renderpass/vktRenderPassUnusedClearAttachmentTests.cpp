@@ -1128,9 +1128,8 @@ tcu::TestStatus UnusedClearAttachmentTestInstance::iterate(void)
     // Read result images.
     std::vector<de::MovePtr<tcu::TextureLevel>> imagePixels;
     for (size_t i = 0; i < m_testParams.colorUsed.size(); ++i)
-        imagePixels.emplace_back(pipeline::readColorAttachment(vk, vkDevice, queue, queueFamilyIndex, allocator,
-                                                               *m_colorImages[i], FORMAT_COLOR, m_renderSize)
-                                     .release());
+        imagePixels.emplace_back(
+            pipeline::readColorAttachment(m_context, *m_colorImages[i], FORMAT_COLOR, m_renderSize).release());
 
     // Verify pixel colors match.
     for (size_t i = 0; i < imagePixels.size(); ++i)
@@ -1505,11 +1505,466 @@ void generateWriteSrc(std::ostream &src, const ShaderInterface &interface, const
     }
 }
 
+// Reference buffer verification.
+//
+// Instead of embedding every value as an immediate, expected and written values are
+// packed into a separate reference buffer (one 32-bit word per component, matrices in
+// column-major order) and the shader walks each buffer variable with loops that mirror
+// its type. Buffer variables are still accessed through the declared blocks, so layout
+// coverage is the same, but the shader size no longer depends on the number of values.
+
+const char *const s_refValuesName = "ref_values";
+
+int getRefValueCount(const VarType &type, int unsizedArraySize)
+{
+    if (type.isArrayType())
+    {
+        const int arraySize =
+            type.getArraySize() == VarType::UNSIZED_ARRAY ? unsizedArraySize : type.getArraySize();
+
+        return arraySize * getRefValueCount(type.getElementType(), unsizedArraySize);
+    }
+    else if (type.isStructType())
+    {
+        int numValues = 0;
+
+        for (const auto &member : *type.getStructPtr())
+            numValues += getRefValueCount(member.getType(), unsizedArraySize);
+
+        return numValues;
+    }
+    else
+    {
+        DE_ASSERT(type.isBasicType());
+        return glu::getDataTypeScalarSize(type.getBasicType());
+    }
+}
+
+void appendRefValue(vector<uint32_t> &dst, glu::DataType basicType, int matrixStride, bool isRowMajor,
+                    const void *valuePtr)
+{
+    if (glu::isDataTypeMatrix(basicType))
+    {
+        const int compSize = sizeof(uint32_t);
+        const int numRows  = glu::getDataTypeMatrixNumRows(basicType);
+        const int numCols  = glu::getDataTypeMatrixNumColumns(basicType);
+
+        for (int colNdx = 0; colNdx < numCols; colNdx++)
+        {
+            for (int rowNdx = 0; rowNdx < numRows; rowNdx++)
+            {
+                const uint8_t *compPtr =
+                    (const uint8_t *)valuePtr + (isRowMajor ? rowNdx * matrixStride + colNdx * compSize :
+                                                              colNdx * matrixStride + rowNdx * compSize);
+
+                dst.push_back(*((const uint32_t *)compPtr));
+            }
+        }
+    }
+    else
+    {
+        const glu::DataType scalarType = glu::getDataTypeScalarType(basicType);
+        const int scalarSize           = glu::getDataTypeScalarSize(basicType);
+        const size_t compSize          = getDataTypeByteSize(scalarType);
+
+        for (int scalarNdx = 0; scalarNdx < scalarSize; scalarNdx++)
+        {
+            const uint8_t *compPtr = (const uint8_t *)valuePtr + scalarNdx * compSize;
+
+            switch (scalarType)
+            {
+            case glu::TYPE_FLOAT16:
+            {
+                const float value = tcu::Float16(*((const tcu::float16_t *)compPtr)).asFloat();
+                uint32_t bits;
+
+                deMemcpy(&bits, &value, sizeof(bits));
+                dst.push_back(bits);
+                break;
+            }
+            case glu::TYPE_FLOAT:
+            case glu::TYPE_INT:
+            case glu::TYPE_UINT:
+                dst.push_back(*((const uint32_t *)compPtr));
+                break;
+            case glu::TYPE_INT8:
+                dst.push_back((uint32_t)(int32_t) * ((const int8_t *)compPtr));
+                break;
+            case glu::TYPE_INT16:
+                dst.push_back((uint32_t)(int32_t) * ((const int16_t *)compPtr));
+                break;
+            case glu::TYPE_UINT8:
+                dst.push_back((uint32_t) * ((const uint8_t *)compPtr));
+                break;
+            case glu::TYPE_UINT16:
+                dst.push_back((uint32_t) * ((const uint16_t *)compPtr));
+                break;
+            case glu::TYPE_BOOL:
+                dst.push_back(*((const uint32_t *)compPtr) != 0u ? 1u : 0u);
+                break;
+            default:
+                DE_ASSERT(false);
+            }
+        }
+    }
+}
+
+void generateRefValues(vector<uint32_t> &dst, const BufferLayout &bufferLayout, const BufferBlock &block,
+                       int instanceNdx, const BlockDataPtr &blockPtr, const BufferVar &bufVar,
+                       const glu::SubTypeAccess &accessPath)
+{
+    const VarType curType = accessPath.getType();
+
+    if (curType.isArrayType())
+    {
+        const int arraySize = curType.getArraySize() == VarType::UNSIZED_ARRAY ?
+                                  block.getLastUnsizedArraySize(instanceNdx) :
+                                  curType.getArraySize();
+
+        for (int elemNdx = 0; elemNdx < arraySize; elemNdx++)
+            generateRefValues(dst, bufferLayout, block, instanceNdx, blockPtr, bufVar, accessPath.element(elemNdx));
+    }
+    else if (curType.isStructType())
+    {
+        const int numMembers = curType.getStructPtr()->getNumMembers();
+
+        for (int memberNdx = 0; memberNdx < numMembers; memberNdx++)
+            generateRefValues(dst, bufferLayout, block, instanceNdx, blockPtr, bufVar, accessPath.member(memberNdx));
+    }
+    else
+    {
+        DE_ASSERT(curType.isBasicType());
+
+        const string apiName = getAPIName(block, bufVar, accessPath.getPath());
+        const int varNdx     = bufferLayout.getVariableIndex(apiName);
+
+        DE_ASSERT(varNdx >= 0);
+        {
+            const BufferVarLayoutEntry &varLayout = bufferLayout.bufferVars[varNdx];
+            const void *valuePtr = (const uint8_t *)blockPtr.ptr + computeOffset(varLayout, accessPath.getPath());
+
+            appendRefValue(dst, curType.getBasicType(), varLayout.matrixStride, varLayout.isRowMajor, valuePtr);
+        }
+    }
+}
+
+//! Pack values of all buffer variables having accessFlag set, in the order the shader visits them.
+void generateRefValues(vector<uint32_t> &dst, const ShaderInterface &interface, const BufferLayout &layout,
+                       const vector<BlockDataPtr> &blockPointers, uint32_t accessFlag)
+{
+    for (int declNdx = 0; declNdx < interface.getNumBlocks(); declNdx++)
+    {
+        const BufferBlock &block = interface.getBlock(declNdx);
+        const bool isArray       = block.isArray();
+        const int numInstances   = isArray ? block.getArraySize() : 1;
+
+        for (int instanceNdx = 0; instanceNdx < numInstances; instanceNdx++)
+        {
+            const string instanceName =
+                block.getBlockName() + (isArray ? "[" + de::toString(instanceNdx) + "]" : string(""));
+            const int blockNdx           = layout.getBlockIndex(instanceName);
+            const BlockDataPtr &blockPtr = blockPointers[blockNdx];
+
+            for (BufferBlock::const_iterator varIter = block.begin(); varIter != block.end(); varIter++)
+            {
+                const BufferVar &bufVar = *varIter;
+
+                if ((bufVar.getFlags() & accessFlag) == 0)
+                    continue;
+
+                generateRefValues(dst, layout, block, instanceNdx, blockPtr, bufVar,
+                                  glu::SubTypeAccess(bufVar.getType()));
+            }
+        }
+    }
+}
+
+void generateRefAccessFunc(std::ostream &src, glu::DataType type)
+{
+    const glu::DataType scalarType = glu::getDataTypeScalarType(type);
+    const char *const typeName     = glu::getDataTypeName(type);
+
+    src << typeName << " ref_" << typeName << " (int ndx) { return " << typeName << "(";
+
+    if (glu::isDataTypeMatrix(type))
+    {
+        const int numRows             = glu::getDataTypeMatrixNumRows(type);
+        const int numCols             = glu::getDataTypeMatrixNumColumns(type);
+        const char *const colTypeName = glu::getDataTypeName(glu::getDataTypeMatrixColumnType(type));
+
+        for (int colNdx = 0; colNdx < numCols; colNdx++)
+            src << (colNdx > 0 ? ", " : "") << "ref_" << colTypeName << "(ndx + " << colNdx * numRows << ")";
+    }
+    else
+    {
+        const int scalarSize = glu::getDataTypeScalarSize(type);
+
+        for (int compNdx = 0; compNdx < scalarSize; compNdx++)
+        {
+            const string word = string(s_refValuesName) + "[ndx + " + de::toString(compNdx) + "]";
+
+            if (compNdx > 0)
+                src << ", ";
+
+            switch (scalarType)
+            {
+            case glu::TYPE_FLOAT:
+                src << "uintBitsToFloat(" << word << ")";
+                break;
+            case glu::TYPE_INT:
+                src << "int(" << word << ")";
+                break;
+            case glu::TYPE_UINT:
+                src << word;
+                break;
+            case glu::TYPE_BOOL:
+                src << "(" << word << " != 0u)";
+                break;
+            default:
+                DE_ASSERT(false);
+            }
+        }
+    }
+
+    src << "); }\n";
+}
+
+void generateRefAccessFuncs(std::ostream &src, const ShaderInterface &interface)
+{
+    std::set<glu::DataType> types;
+    std::set<glu::DataType> accessFuncs;
+
+    collectUniqueBasicTypes(types, interface);
+
+    // Matrices are assembled from columns and may also be accessed per component.
+    for (std::set<glu::DataType>::const_iterator iter = types.begin(); iter != types.end(); ++iter)
+    {
+        const glu::DataType promoteType = vkt::typecomputil::getPromoteType(*iter);
+
+        if (glu::isDataTypeMatrix(promoteType))
+        {
+            accessFuncs.insert(glu::TYPE_FLOAT);
+            accessFuncs.insert(glu::getDataTypeMatrixColumnType(promoteType));
+        }
+        accessFuncs.insert(promoteType);
+    }
+
+    // Declared in type order, so column types precede matrix types.
+    for (std::set<glu::DataType>::const_iterator iter = accessFuncs.begin(); iter != accessFuncs.end(); ++iter)
+        generateRefAccessFunc(src, *iter);
+}
+
+string getRefIndexSrc(int baseNdx, const string &loopOffset)
+{
+    return de::toString(baseNdx) + loopOffset;
+}
+
+string getLoopOffsetSrc(const string &loopOffset, const string &loopVar, int elemSize)
+{
+    return loopOffset + " + " + loopVar + (elemSize != 1 ? " * " + de::toString(elemSize) : string(""));
+}
+
+void generateForLoopSrc(std::ostream &src, int indentLevel, const string &loopVar, int arraySize)
+{
+    src << Indent(indentLevel) << "for (int " << loopVar << " = 0; " << loopVar << " < " << arraySize << "; "
+        << loopVar << "++)\n"
+        << Indent(indentLevel) << "{\n";
+}
+
+void generateRefCompareSrc(std::ostream &src, int indentLevel, const char *resultVar, const BufferBlock &block,
+                           int instanceNdx, const VarType &curType, const string &shaderName, int baseNdx,
+                           const string &loopOffset, MatrixLoadFlags matrixLoadFlag)
+{
+    if (curType.isArrayType())
+    {
+        const int arraySize = curType.getArraySize() == VarType::UNSIZED_ARRAY ?
+                                  block.getLastUnsizedArraySize(instanceNdx) :
+                                  curType.getArraySize();
+        const VarType &elemType = curType.getElementType();
+        const int elemSize      = getRefValueCount(elemType, 0);
+        const string loopVar    = "i" + de::toString(indentLevel);
+
+        if (arraySize == 0)
+            return;
+
+        generateForLoopSrc(src, indentLevel, loopVar, arraySize);
+        generateRefCompareSrc(src, indentLevel + 1, resultVar, block, instanceNdx, elemType,
+                              shaderName + "[" + loopVar + "]", baseNdx,
+                              getLoopOffsetSrc(loopOffset, loopVar, elemSize), LOAD_FULL_MATRIX);
+        src << Indent(indentLevel) << "}\n";
+    }
+    else if (curType.isStructType())
+    {
+        const StructType *structPtr = curType.getStructPtr();
+        int memberNdx               = baseNdx;
+
+        for (StructType::ConstIterator memberIter = structPtr->begin(); memberIter != structPtr->end(); memberIter++)
+        {
+            generateRefCompareSrc(src, indentLevel, resultVar, block, instanceNdx, memberIter->getType(),
+                                  shaderName + "." + memberIter->getName(), memberNdx, loopOffset, LOAD_FULL_MATRIX);
+            memberNdx += getRefValueCount(memberIter->getType(), 0);
+        }
+    }
+    else
+    {
+        DE_ASSERT(curType.isBasicType());
+
+        const glu::DataType basicType   = curType.getBasicType();
+        const glu::DataType promoteType = vkt::typecomputil::getPromoteType(basicType);
+        const char *typeName            = glu::getDataTypeName(basicType);
+
+        if (glu::isDataTypeMatrix(basicType) && matrixLoadFlag == LOAD_MATRIX_COMPONENTS)
+        {
+            const int numRows             = glu::getDataTypeMatrixNumRows(basicType);
+            const int numCols             = glu::getDataTypeMatrixNumColumns(basicType);
+            const char *const colTypeName = glu::getDataTypeName(glu::getDataTypeMatrixColumnType(basicType));
+
+            for (int colNdx = 0; colNdx < numCols; colNdx++)
+            {
+                for (int rowNdx = 0; rowNdx < numRows; rowNdx++)
+                    src << Indent(indentLevel) << resultVar << " = compare_float(" << shaderName << "[" << colNdx
+                        << "][" << rowNdx << "], ref_float("
+                        << getRefIndexSrc(baseNdx + colNdx * numRows + rowNdx, loopOffset) << ")) && " << resultVar
+                        << ";\n";
+            }
+
+            for (int colNdx = 0; colNdx < numCols; colNdx++)
+                src << Indent(indentLevel) << resultVar << " = compare_" << colTypeName << "(" << shaderName << "["
+                    << colNdx << "], ref_" << colTypeName << "("
+                    << getRefIndexSrc(baseNdx + colNdx * numRows, loopOffset) << ")) && " << resultVar << ";\n";
+        }
+        else
+        {
+            const char *castName = basicType != promoteType ? glu::getDataTypeName(promoteType) : "";
+
+            src << Indent(indentLevel) << resultVar << " = compare_" << typeName << "(" << castName << "(" << shaderName
+                << "), ref_" << glu::getDataTypeName(promoteType) << "(" << getRefIndexSrc(baseNdx, loopOffset)
+                << ")) && " << resultVar << ";\n";
+        }
+    }
+}
+
+void generateRefCompareSrc(std::ostream &src, const char *resultVar, const ShaderInterface &interface,
+                           MatrixLoadFlags matrixLoadFlag, int &refNdx)
+{
+    for (int declNdx = 0; declNdx < interface.getNumBlocks(); declNdx++)
+    {
+        const BufferBlock &block = interface.getBlock(declNdx);
+        const bool isArray       = block.isArray();
+        const int numInstances   = isArray ? block.getArraySize() : 1;
+
+        for (int instanceNdx = 0; instanceNdx < numInstances; instanceNdx++)
+        {
+            for (BufferBlock::const_iterator varIter = block.begin(); varIter != block.end(); varIter++)
+            {
+                const BufferVar &bufVar = *varIter;
+
+                if ((bufVar.getFlags() & ACCESS_READ) == 0)
+                    continue; // Don't read from that variable.
+
+                generateRefCompareSrc(src, 1, resultVar, block, instanceNdx, bufVar.getType(),
+                                      getShaderName(block, instanceNdx, bufVar, glu::TypeComponentVector()), refNdx,
+                                      "", matrixLoadFlag);
+                refNdx += getRefValueCount(bufVar.getType(), block.getLastUnsizedArraySize(instanceNdx));
+            }
+        }
+    }
+}
+
+void generateRefWriteSrc(std::ostream &src, int indentLevel, const BufferBlock &block, int instanceNdx,
+                         const VarType &curType, const string &shaderName, int baseNdx, const string &loopOffset,
+                         MatrixStoreFlags matrixStoreFlag)
+{
+    if (curType.isArrayType())
+    {
+        const int arraySize = curType.getArraySize() == VarType::UNSIZED_ARRAY ?
+                                  block.getLastUnsizedArraySize(instanceNdx) :
+                                  curType.getArraySize();
+        const VarType &elemType = curType.getElementType();
+        const int elemSize      = getRefValueCount(elemType, 0);
+        const string loopVar    = "i" + de::toString(indentLevel);
+
+        if (arraySize == 0)
+            return;
+
+        generateForLoopSrc(src, indentLevel, loopVar, arraySize);
+        generateRefWriteSrc(src, indentLevel + 1, block, instanceNdx, elemType, shaderName + "[" + loopVar + "]",
+                            baseNdx, getLoopOffsetSrc(loopOffset, loopVar, elemSize), matrixStoreFlag);
+        src << Indent(indentLevel) << "}\n";
+    }
+    else if (curType.isStructType())
+    {
+        const StructType *structPtr = curType.getStructPtr();
+        int memberNdx               = baseNdx;
+
+        for (StructType::ConstIterator memberIter = structPtr->begin(); memberIter != structPtr->end(); memberIter++)
+        {
+            generateRefWriteSrc(src, indentLevel, block, instanceNdx, memberIter->getType(),
+                                shaderName + "." + memberIter->getName(), memberNdx, loopOffset, matrixStoreFlag);
+            memberNdx += getRefValueCount(memberIter->getType(), 0);
+        }
+    }
+    else
+    {
+        DE_ASSERT(curType.isBasicType());
+
+        const glu::DataType basicType   = curType.getBasicType();
+        const glu::DataType promoteType = vkt::typecomputil::getPromoteType(basicType);
+        const bool isMatrix             = glu::isDataTypeMatrix(basicType);
+
+        if (isMatrix && matrixStoreFlag == STORE_MATRIX_COLUMNS)
+        {
+            const int numRows             = glu::getDataTypeMatrixNumRows(basicType);
+            const int numCols             = glu::getDataTypeMatrixNumColumns(basicType);
+            const char *const colTypeName = glu::getDataTypeName(glu::getDataTypeMatrixColumnType(basicType));
+
+            for (int colNdx = 0; colNdx < numCols; colNdx++)
+                src << Indent(indentLevel) << shaderName << "[" << colNdx << "] = ref_" << colTypeName << "("
+                    << getRefIndexSrc(baseNdx + colNdx * numRows, loopOffset) << ");\n";
+        }
+        else
+        {
+            const char *castName = basicType != promoteType ? glu::getDataTypeName(basicType) : "";
+
+            src << Indent(indentLevel) << shaderName << " = " << castName << "(ref_"
+                << glu::getDataTypeName(promoteType) << "(" << getRefIndexSrc(baseNdx, loopOffset) << "));\n";
+        }
+    }
+}
+
+void generateRefWriteSrc(std::ostream &src, const ShaderInterface &interface, MatrixStoreFlags matrixStoreFlag,
+                         int &refNdx)
+{
+    for (int declNdx = 0; declNdx < interface.getNumBlocks(); declNdx++)
+    {
+        const BufferBlock &block = interface.getBlock(declNdx);
+        const bool isArray       = block.isArray();
+        const int numInstances   = isArray ? block.getArraySize() : 1;
+
+        for (int instanceNdx = 0; instanceNdx < numInstances; instanceNdx++)
+        {
+            for (BufferBlock::const_iterator varIter = block.begin(); varIter != block.end(); varIter++)
+            {
+                const BufferVar &bufVar = *varIter;
+
+                if ((bufVar.getFlags() & ACCESS_WRITE) == 0)
+                    continue; // Don't write to that variable.
+
+                generateRefWriteSrc(src, 1, block, instanceNdx, bufVar.getType(),
+                                    getShaderName(block, instanceNdx, bufVar, glu::TypeComponentVector()), refNdx, "",
+                                    matrixStoreFlag);
+                refNdx += getRefValueCount(bufVar.getType(), block.getLastUnsizedArraySize(instanceNdx));
+            }
+        }
+    }
+}
+
 string generateComputeShader(const ShaderInterface &interface, const BufferLayout &layout,
                              const vector<BlockDataPtr> &comparePtrs, const vector<BlockDataPtr> &writePtrs,
                              MatrixLoadFlags matrixLoadFlag, MatrixStoreFlags matrixStoreFlag,
-                             bool usePhysStorageBuffer)
+                             bool usePhysStorageBuffer, SSBOLayoutCase::VerifyMode verifyMode)
 {
+    const bool useRefBuffer = verifyMode == SSBOLayoutCase::VERIFYMODE_REFERENCE_BUFFER;
     std::ostringstream src;
 
     if (uses16BitStorage(interface) || uses8BitStorage(interface) || usesRelaxedLayout(interface) ||
@@ -1560,26 +2015,52 @@ string generateComputeShader(const ShaderInterface &interface, const BufferLayou
             }
             src << "};\n";
         }
+
+        if (useRefBuffer)
+            src << "layout(std430, binding = " << 1 + interface.getNumBlocks()
+                << ") readonly buffer RefValueBlock { highp uint " << s_refValuesName << "[]; };\n";
     }
 
     // Comparison utilities.
     src << "\n";
     generateCompareFuncs(src, interface);
 
+    if (useRefBuffer)
+    {
+        src << "\n";
+        generateRefAccessFuncs(src, interface);
+    }
+
     src << "\n"
            "void main (void)\n"
            "{\n"
            "    bool allOk = true;\n";
 
-    // Value compare.
-    generateCompareSrc(src, "allOk", interface, layout, comparePtrs, matrixLoadFlag);
+    if (useRefBuffer)
+    {
+        int refNdx = 0;
 
-    src << "    if (allOk)\n"
-        << "        ac_numPassed++;\n"
-        << "\n";
+        // Compared values are followed by written values in the reference buffer.
+        generateRefCompareSrc(src, "allOk", interface, matrixLoadFlag, refNdx);
 
-    // Value write.
-    generateWriteSrc(src, interface, layout, writePtrs, matrixStoreFlag);
+        src << "    if (allOk)\n"
+            << "        ac_numPassed++;\n"
+            << "\n";
+
+        generateRefWriteSrc(src, interface, matrixStoreFlag, refNdx);
+    }
+    else
+    {
+        // Value compare.
+        generateCompareSrc(src, "allOk", interface, layout, comparePtrs, matrixLoadFlag);
+
+        src << "    if (allOk)\n"
+            << "        ac_numPassed++;\n"
+            << "\n";
+
+        // Value write.
+        generateWriteSrc(src, interface, layout, writePtrs, matrixStoreFlag);
+    }
 
     src << "}\n";
 
@@ -2174,7 +2655,8 @@ class SSBOLayoutCaseInstance : public TestInstance
 public:
     SSBOLayoutCaseInstance(Context &context, SSBOLayoutCase::BufferMode bufferMode, const ShaderInterface &interface,
                            const BufferLayout &refLayout, const RefDataStorage &initialData,
-                           const RefDataStorage &writeData, bool usePhysStorageBuffer);
+                           const RefDataStorage &writeData, bool usePhysStorageBuffer,
+                           SSBOLayoutCase::VerifyMode verifyMode, const vector<uint32_t> &refValues);
     virtual ~SSBOLayoutCaseInstance(void);
     virtual tcu::TestStatus iterate(void);
 
@@ -2185,6 +2667,8 @@ private:
     const RefDataStorage &m_initialData; // Initial data stored in buffer.
     const RefDataStorage &m_writeData;   // Data written by compute shader.
     const bool m_usePhysStorageBuffer;
+    const SSBOLayoutCase::VerifyMode m_verifyMode;
+    const vector<uint32_t> &m_refValues; // Reference buffer contents, if used.
 
     typedef de::SharedPtr<vk::Unique<vk::VkBuffer>> VkBufferSp;
     typedef de::SharedPtr<vk::Allocation> AllocationSp;
@@ -2196,7 +2680,8 @@ private:
 SSBOLayoutCaseInstance::SSBOLayoutCaseInstance(Context &context, SSBOLayoutCase::BufferMode bufferMode,
                                                const ShaderInterface &interface, const BufferLayout &refLayout,
                                                const RefDataStorage &initialData, const RefDataStorage &writeData,
-                                               bool usePhysStorageBuffer)
+                                               bool usePhysStorageBuffer, SSBOLayoutCase::VerifyMode verifyMode,
+                                               const vector<uint32_t> &refValues)
     : TestInstance(context)
     , m_bufferMode(bufferMode)
     , m_interface(interface)
@@ -2204,6 +2689,8 @@ SSBOLayoutCaseInstance::SSBOLayoutCaseInstance(Context &context, SSBOLayoutCase:
     , m_initialData(initialData)
     , m_writeData(writeData)
     , m_usePhysStorageBuffer(usePhysStorageBuffer)
+    , m_verifyMode(verifyMode)
+    , m_refValues(refValues)
 {
 }
 
@@ -2251,7 +2738,11 @@ tcu::TestStatus SSBOLayoutCaseInstance::iterate(void)
         }
     }
 
-    poolBuilder.addType(vk::VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, (uint32_t)(1 + numBlocks));
+    const bool useRefBuffer = m_verifyMode == SSBOLayoutCase::VERIFYMODE_REFERENCE_BUFFER;
+    if (useRefBuffer)
+        setLayoutBuilder.addSingleBinding(vk::VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, vk::VK_SHADER_STAGE_COMPUTE_BIT);
+
+    poolBuilder.addType(vk::VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, (uint32_t)(1 + numBlocks + (useRefBuffer ? 1 : 0)));
 
     const vk::Unique<vk::VkDescriptorSetLayout> descriptorSetLayout(setLayoutBuilder.build(vk, device));
     const vk::Unique<vk::VkDescriptorPool> descriptorPool(
@@ -2270,6 +2761,29 @@ tcu::TestStatus SSBOLayoutCaseInstance::iterate(void)
     setUpdateBuilder.writeSingle(*descriptorSet, vk::DescriptorSetUpdateBuilder::Location::binding(0u),
                                  vk::VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, &descriptorInfo);
 
+    // Expected and written values read by the shader in reference buffer mode
+    vk::Move<vk::VkBuffer> refBuffer;
+    de::MovePtr<vk::Allocation> refBufferAlloc;
+    vk::VkDescriptorBufferInfo refDescriptorInfo;
+
+    if (useRefBuffer)
+    {
+        const vk::VkDeviceSize refBufferSize = de::max<size_t>(m_refValues.size(), 1u) * sizeof(uint32_t);
+
+        refBuffer      = createBuffer(m_context, refBufferSize, vk::VK_BUFFER_USAGE_STORAGE_BUFFER_BIT);
+        refBufferAlloc = allocateAndBindMemory(m_context, *refBuffer, vk::MemoryRequirement::HostVisible);
+
+        deMemset(refBufferAlloc->getHostPtr(), 0, (size_t)refBufferSize);
+        if (!m_refValues.empty())
+            deMemcpy(refBufferAlloc->getHostPtr(), &m_refValues[0], m_refValues.size() * sizeof(uint32_t));
+        flushAlloc(vk, device, *refBufferAlloc);
+
+        refDescriptorInfo = makeDescriptorBufferInfo(*refBuffer, 0ull, refBufferSize);
+        setUpdateBuilder.writeSingle(*descriptorSet,
+                                     vk::DescriptorSetUpdateBuilder::Location::binding((uint32_t)numBindings + 1u),
+                                     vk::VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, &refDescriptorInfo);
+    }
+
     vector<BlockDataPtr> mappedBlockPtrs;
 
     vk::VkFlags usageFlags   = vk::VK_BUFFER_USAGE_STORAGE_BUFFER_BIT;
@@ -2570,6 +3084,7 @@ SSBOLayoutCase::SSBOLayoutCase(tcu::TestContext &testCtx, const char *name, Buff
     , m_matrixLoadFlag(matrixLoadFlag)
     , m_matrixStoreFlag(matrixStoreFlag)
     , m_usePhysStorageBuffer(usePhysStorageBuffer)
+    , m_verifyMode(VERIFYMODE_IMMEDIATE)
 {
 }
 
@@ -2603,7 +3118,7 @@ void SSBOLayoutCase::initPrograms(vk::SourceCollections &programCollection) cons
 TestInstance *SSBOLayoutCase::createInstance(Context &context) const
 {
     return new SSBOLayoutCaseInstance(context, m_bufferMode, m_interface, m_refLayout, m_initialData, m_writeData,
-                                      m_usePhysStorageBuffer);
+                                      m_usePhysStorageBuffer, m_verifyMode, m_refValues);
 }
 
 void SSBOLayoutCase::checkSupport(Context &context) const
@@ -2625,7 +3140,8 @@ void SSBOLayoutCase::checkSupport(Context &context) const
 
     const vk::VkPhysicalDeviceProperties &properties = context.getDeviceProperties();
     // Shader defines N+1 storage buffers: N to operate and one more to store the number of cases passed.
-    uint32_t blockCount = 1u;
+    // Reference buffer mode adds one more for the reference values.
+    uint32_t blockCount = m_verifyMode == VERIFYMODE_REFERENCE_BUFFER ? 2u : 1u;
     for (int32_t blockIdx = 0u; blockIdx < m_interface.getNumBlocks(); blockIdx++)
     {
         blockCount +=
@@ -2647,7 +3163,15 @@ void SSBOLayoutCase::delayedInit(void)
     copyNonWrittenData(m_interface, m_refLayout, m_initialData.pointers, m_writeData.pointers);
 
     m_computeShaderSrc = generateComputeShader(m_interface, m_refLayout, m_initialData.pointers, m_writeData.pointers,
-                                               m_matrixLoadFlag, m_matrixStoreFlag, m_usePhysStorageBuffer);
+                                               m_matrixLoadFlag, m_matrixStoreFlag, m_usePhysStorageBuffer,
+                                               m_verifyMode);
+
+    if (m_verifyMode == VERIFYMODE_REFERENCE_BUFFER)
+    {
+        // Same order as the shader: values compared against initial data, then values written.
+        generateRefValues(m_refValues, m_interface, m_refLayout, m_initialData.pointers, ACCESS_READ);
+        generateRefValues(m_refValues, m_interface, m_refLayout, m_writeData.pointers, ACCESS_WRITE);
+    }
 }
 
 } // namespace ssbo
@@ -300,6 +300,14 @@ public:
         BUFFERMODE_LAST
     };
 
+    enum VerifyMode
+    {
+        VERIFYMODE_IMMEDIATE = 0,    //!< Expected and written values are immediates in the shader.
+        VERIFYMODE_REFERENCE_BUFFER, //!< Values are read from a reference buffer by loops over each variable.
+
+        VERIFYMODE_LAST
+    };
+
     SSBOLayoutCase(tcu::TestContext &testCtx, const char *name, BufferMode bufferMode, MatrixLoadFlags matrixLoadFlag,
                    MatrixStoreFlags matrixStoreFlag, bool usePhysStorageBuffer);
     virtual ~SSBOLayoutCase(void);
@@ -316,6 +324,7 @@ protected:
     MatrixStoreFlags m_matrixStoreFlag;
     std::string m_computeShaderSrc;
     bool m_usePhysStorageBuffer;
+    VerifyMode m_verifyMode; //!< Set before init() to select how the shader gets its values.
 
 private:
     SSBOLayoutCase(const SSBOLayoutCase &);
@@ -324,6 +333,7 @@ private:
     BufferLayout m_refLayout;
     RefDataStorage m_initialData; // Initial data stored in buffer.
     RefDataStorage m_writeData;   // Data written by compute shader.
+    std::vector<uint32_t> m_refValues;
 };
 
 } // namespace ssbo
@@ -82,6 +82,7 @@ enum FeatureBits
     FEATURE_8BIT_STORAGE        = (1 << 15),
     FEATURE_SCALAR_LAYOUT       = (1 << 16),
     FEATURE_DESCRIPTOR_INDEXING = (1 << 17),
+    FEATURE_REFERENCE_BUFFER    = (1 << 18), //!< Check values through a reference buffer instead of immediates.
 };
 
 class RandomSSBOLayoutCase : public SSBOLayoutCase
@@ -133,6 +134,9 @@ RandomSSBOLayoutCase::RandomSSBOLayoutCase(tcu::TestContext &testCtx, const char
     for (int ndx = 0; ndx < numBlocks; ndx++)
         generateBlock(rnd, 0);
 
+    if (m_features & FEATURE_REFERENCE_BUFFER)
+        m_verifyMode = VERIFYMODE_REFERENCE_BUFFER;
+
     init();
 }
 
@@ -479,6 +483,9 @@ static void createRandomCaseGroup(tcu::TestCaseGroup *parentGroup, tcu::TestCont
 
     baseSeed += (uint32_t)testCtx.getCommandLine().getBaseSeed();
 
+    // Random interfaces hold too many values to embed them all in the shader.
+    features |= FEATURE_REFERENCE_BUFFER;
+
     for (int ndx = 0; ndx < numCases; ndx++)
         group->addChild(new RandomSSBOLayoutCase(testCtx, de::toString(ndx).c_str(), bufferMode, features,
                                                  (uint32_t)ndx + baseSeed, usePhysStorageBuffer));
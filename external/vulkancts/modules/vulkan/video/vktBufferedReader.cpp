@@ -0,0 +1,233 @@
+/*------------------------------------------------------------------------
+ * Vulkan Conformance Tests
+ * ------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+/*!
+ * \file
+ * \brief Memory-mapped elementary stream reader
+ */
+/*--------------------------------------------------------------------*/
+
+#include "vktBufferedReader.hpp"
+
+#include "deMemory.h"
+
+#include <fstream>
+#include <iterator>
+
+#if (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_OSX) || (DE_OS == DE_OS_ANDROID) || (DE_OS == DE_OS_QNX) || \
+    (DE_OS == DE_OS_FUCHSIA)
+#define VKT_VIDEO_USE_POSIX_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#elif (DE_OS == DE_OS_WIN32)
+#define VKT_VIDEO_USE_WIN32_MMAP 1
+#define VC_EXTRALEAN
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+namespace vkt
+{
+namespace video
+{
+
+// Read-only mapping of a whole file. isMapped() is false if the platform
+// does not support mapping or the file could not be mapped, in which case
+// the caller falls back to reading the file.
+class MappedFile
+{
+public:
+    MappedFile(const char *path);
+    ~MappedFile();
+
+    bool isMapped() const
+    {
+        return m_ptr != nullptr;
+    }
+    const uint8_t *getPtr() const
+    {
+        return static_cast<const uint8_t *>(m_ptr);
+    }
+    size_t getSize() const
+    {
+        return m_size;
+    }
+
+private:
+    MappedFile(const MappedFile &)            = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    void *m_ptr{nullptr};
+    size_t m_size{0};
+#if defined(VKT_VIDEO_USE_WIN32_MMAP)
+    HANDLE m_file{INVALID_HANDLE_VALUE};
+    HANDLE m_mapping{nullptr};
+#endif
+};
+
+#if defined(VKT_VIDEO_USE_POSIX_MMAP)
+
+MappedFile::MappedFile(const char *path)
+{
+    const int fd = open(path, O_RDONLY);
+    struct stat st;
+
+    if (fd < 0)
+        return;
+
+    if (fstat(fd, &st) == 0 && st.st_size > 0)
+    {
+        void *const ptr = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (ptr != MAP_FAILED)
+        {
+            // Demuxers walk the clip front to back.
+            madvise(ptr, (size_t)st.st_size, MADV_SEQUENTIAL);
+            m_ptr  = ptr;
+            m_size = (size_t)st.st_size;
+        }
+    }
+
+    // Mapping stays valid after closing the descriptor.
+    close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_ptr)
+        munmap(m_ptr, m_size);
+}
+
+#elif defined(VKT_VIDEO_USE_WIN32_MMAP)
+
+MappedFile::MappedFile(const char *path)
+{
+    LARGE_INTEGER size;
+
+    m_file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN,
+                         nullptr);
+    if (m_file == INVALID_HANDLE_VALUE)
+        return;
+
+    if (!GetFileSizeEx(m_file, &size) || size.QuadPart <= 0)
+        return;
+
+    m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!m_mapping)
+        return;
+
+    m_ptr = MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+    if (m_ptr)
+        m_size = (size_t)size.QuadPart;
+}
+
+MappedFile::~MappedFile()
+{
+    if (m_ptr)
+        UnmapViewOfFile(m_ptr);
+    if (m_mapping)
+        CloseHandle(m_mapping);
+    if (m_file != INVALID_HANDLE_VALUE)
+        CloseHandle(m_file);
+}
+
+#else
+
+MappedFile::MappedFile(const char *)
+{
+}
+
+MappedFile::~MappedFile()
+{
+}
+
+#endif
+
+BufferedReader::BufferedReader(const std::string &filename)
+{
+    const std::string path = resourceRelativePath(filename).getPath();
+
+    m_file.reset(new MappedFile(path.c_str()));
+
+    if (m_file->isMapped())
+    {
+        m_data = m_file->getPtr();
+        m_size = m_file->getSize();
+    }
+    else
+    {
+        std::ifstream stream(path, std::ios_base::binary);
+
+        if (!stream.good())
+            throw tcu::ResourceError(std::string("failed to open input"));
+
+        m_copy.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+        m_data = m_copy.data();
+        m_size = m_copy.size();
+    }
+}
+
+BufferedReader::BufferedReader(const char *bytes, size_t length)
+    : m_copy(reinterpret_cast<const uint8_t *>(bytes), reinterpret_cast<const uint8_t *>(bytes) + length)
+{
+    m_data = m_copy.data();
+    m_size = m_copy.size();
+}
+
+BufferedReader::~BufferedReader()
+{
+}
+
+void BufferedReader::read(uint8_t *out, size_t n)
+{
+    const size_t numAvailable = m_size - m_pos;
+    const size_t numRead      = n < numAvailable ? n : numAvailable;
+
+    if (numRead > 0)
+        deMemcpy(out, m_data + m_pos, numRead);
+    m_pos += numRead;
+
+    if (numRead < n)
+    {
+        m_eof   = true;
+        m_error = true;
+    }
+}
+
+const uint8_t *BufferedReader::readView(size_t n)
+{
+    const uint8_t *const view = m_data + m_pos;
+
+    if (n > m_size - m_pos)
+    {
+        m_pos   = m_size;
+        m_eof   = true;
+        m_error = true;
+        return nullptr;
+    }
+
+    m_pos += n;
+    return view;
+}
+
+} // namespace video
+} // namespace vkt
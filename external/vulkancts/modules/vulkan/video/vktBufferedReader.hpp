@@ -20,10 +20,9 @@
  * limitations under the License.
  *
  */
-#include <fstream>
 #include <vector>
 #include <memory>
-#include <sstream>
+#include <string>
 
 #include "deFilePath.hpp"
 
@@ -34,35 +33,30 @@ namespace vkt
 namespace video
 {
 
+class MappedFile;
+
+// Reader over the whole elementary stream held in contiguous memory.
+// Files are memory-mapped where the platform allows it, so demuxers can
+// hand out packets that point directly into the stream data instead of
+// copying them. Error and EOF reporting mimics std::istream: a read past
+// the end of the data sets both the EOF and the error flag.
 class BufferedReader
 {
 public:
     // Open and read from filename
-    BufferedReader(const std::string &filename)
-        : m_istream(std::make_unique<std::ifstream>(resourceRelativePath(filename).getPath(), std::ios_base::binary))
-    {
-        if (!m_istream->good())
-        {
-            throw tcu::ResourceError(std::string("failed to open input"));
-        }
-    }
+    BufferedReader(const std::string &filename);
 
     // Read from in-memory stream.
-    BufferedReader(const char *bytes, size_t length)
-    {
-        std::string asString(bytes, length);
-        m_istream.reset(new std::istringstream(asString, std::ios::binary));
-    }
+    BufferedReader(const char *bytes, size_t length);
+
+    ~BufferedReader();
 
     void read(std::vector<uint8_t> &buffer)
     {
-        m_istream->read(reinterpret_cast<char *>(buffer.data()), buffer.size());
+        read(buffer.data(), buffer.size());
     }
 
-    void read(uint8_t *out, size_t n)
-    {
-        m_istream->read(reinterpret_cast<char *>(out), n);
-    }
+    void read(uint8_t *out, size_t n);
 
     void readChecked(uint8_t *out, size_t n, const char *msg)
     {
@@ -73,25 +67,51 @@ public:
 
     uint8_t readByteChecked(const char *msg)
     {
-        uint8_t v{};
-        read(&v, 1);
-        if (isEof())
-            return 0;
-        if (isError())
-            TCU_THROW(InternalError, msg);
-        return v;
+        if (m_pos < m_size)
+            return m_data[m_pos++];
+
+        // Running out of data is reported through isEof(), like a short read from a stream.
+        DE_UNREF(msg);
+        m_eof   = true;
+        m_error = true;
+        return 0;
     }
 
+    // Consume n bytes and return a pointer to them, or null if fewer than n bytes remain.
+    const uint8_t *readView(size_t n);
+
     bool isError() const
     {
-        return m_istream->bad() || m_istream->fail();
+        return m_error;
     }
     bool isEof() const
     {
-        return m_istream->eof();
+        return m_eof;
+    }
+
+    // Direct access to the whole stream for scanning demuxers.
+    const uint8_t *data() const
+    {
+        return m_data;
+    }
+    size_t size() const
+    {
+        return m_size;
+    }
+    size_t tell() const
+    {
+        return m_pos;
+    }
+    void seek(size_t pos)
+    {
+        DE_ASSERT(pos <= m_size);
+        m_pos = pos;
     }
 
 private:
+    BufferedReader(const BufferedReader &)            = delete;
+    BufferedReader &operator=(const BufferedReader &) = delete;
+
     const de::FilePath resourceRelativePath(const std::string filename) const
     {
         std::vector<std::string> resourcePathComponents = {"vulkan", "video", filename};
@@ -99,7 +119,13 @@ private:
         return resourcePath;
     }
 
-    std::unique_ptr<std::istream> m_istream;
+    std::unique_ptr<MappedFile> m_file;
+    std::vector<uint8_t> m_copy; // Backing store for in-memory streams and unmappable files.
+    const uint8_t *m_data{nullptr};
+    size_t m_size{0};
+    size_t m_pos{0};
+    bool m_eof{false};
+    bool m_error{false};
 };
 
 } // namespace video
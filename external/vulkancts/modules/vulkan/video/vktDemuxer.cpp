@@ -19,6 +19,7 @@
  *
  */
 #include "deMemory.h"
+#include "tcuBitstreamUtil.hpp"
 
 #include "vktVideoTestUtils.hpp"
 #include "vktDemuxer.hpp"
@@ -62,64 +63,45 @@ Demuxer::Demuxer(Params &&params) : m_params(std::move(params))
 
 H26XAnnexBDemuxer::H26XAnnexBDemuxer(Params &&params) : Demuxer(std::move(params))
 {
-    readToNextStartCode(nullptr);
+    auto &reader           = m_params.data;
+    const size_t startCode = tcu::findH26XStartCode(reader->data(), 0, reader->size());
+
+    // Skip everything up to and including the first start code.
+    if (startCode == reader->size())
+        m_eos = true;
+    else
+        reader->seek(startCode + 1);
 }
 
-std::vector<uint8_t> H26XAnnexBDemuxer::nextPacket()
+// Packets span from a four byte start code up to the next one. The start
+// code is included in the packet since the parser expects it, while any
+// zero bytes leading up to the next start code or the end of the stream
+// are dropped. Packets are not copied, they point into the stream data.
+DemuxedPacket H26XAnnexBDemuxer::nextPacket()
 {
-    std::vector<uint8_t> packet;
-    readToNextStartCode(&packet);
-    return packet;
-}
+    auto &reader = m_params.data;
 
-// Very inefficient but simple algorithm, which is fine for the CTS
-// since it can expect never to have to deal with inputs larger than a
-// couple of megabytes.  A ~20x time boost would be mapping the
-// bitstreams into memory and using the std::boyer_moore algorithm to
-// find the start codes, at the cost of extra complexity handling
-// corner cases in file mapping and low-memory environments.
-void H26XAnnexBDemuxer::readToNextStartCode(std::vector<uint8_t> *payload)
-{
-    int zeroRunCount = 0;
-    auto &reader     = m_params.data;
-    uint8_t byte;
+    if (m_eos)
+        return DemuxedPacket();
 
-    if (reader->isEof() || reader->isError())
-        return;
+    const uint8_t *data       = reader->data();
+    const size_t payloadBegin = reader->tell();
+    const size_t startCode    = tcu::findH26XStartCode(data, payloadBegin, reader->size());
+    size_t payloadEnd         = startCode == reader->size() ? startCode : startCode - 3;
 
-    if (payload)
-    {
-        // TODO: Fix the sample parser's interface
-        payload->push_back(0x0);
-        payload->push_back(0x0);
-        payload->push_back(0x0);
-        payload->push_back(0x1);
-    }
+    while (payloadEnd > payloadBegin && data[payloadEnd - 1] == 0x00)
+        payloadEnd--;
 
-    while (true)
+    if (startCode == reader->size())
     {
-        byte = reader->readByteChecked("failure looking for H26X start code");
-        if (reader->isEof() || reader->isError())
-            return;
-
-        if (byte == 0x01 && zeroRunCount >= 3)
-        {
-            return;
-        }
-        else if (byte == 0x00)
-        {
-            zeroRunCount++;
-        }
-        else
-        {
-            while (zeroRunCount > 0)
-            {
-                zeroRunCount--;
-                payload->push_back(0x0);
-            }
-            payload->push_back(byte);
-        }
+        reader->seek(reader->size());
+        m_eos = true;
     }
+    else
+        reader->seek(startCode + 1);
+
+    DE_ASSERT(payloadBegin >= 4);
+    return DemuxedPacket(data + payloadBegin - 4, payloadEnd - payloadBegin + 4);
 }
 
 DuckIVFDemuxer::DuckIVFDemuxer(Params &&params) : Demuxer(std::move(params)), m_frameNumber(0)
@@ -132,21 +114,22 @@ DE_PACKED(DuckIVFFrameHeader {
     uint64_t presentationTimestamp; // bytes 4-11    64-bit presentation timestamp
 } DuckIVFFrameHeader);
 
-std::vector<uint8_t> DuckIVFDemuxer::nextPacket()
+DemuxedPacket DuckIVFDemuxer::nextPacket()
 {
     auto &reader = m_params.data;
 
     DuckIVFFrameHeader frameHdr;
     reader->readChecked((uint8_t *)&frameHdr, sizeof(DuckIVFFrameHeader), "error reading Duck IVF frame header");
 
-    std::vector<uint8_t> packet(frameHdr.sizeOfFrame);
-    reader->readChecked(packet.data(), frameHdr.sizeOfFrame, "error reading Duck IVF frame");
+    const uint8_t *frameData = reader->readView(frameHdr.sizeOfFrame);
+    if (!frameData)
+        TCU_THROW(InternalError, "error reading Duck IVF frame");
 
     m_frameNumber++;
 
-    DE_ASSERT(packet.size() > 0);
+    DE_ASSERT(frameHdr.sizeOfFrame > 0);
 
-    return packet;
+    return DemuxedPacket(frameData, frameHdr.sizeOfFrame);
 }
 
 void DuckIVFDemuxer::readHeader()
@@ -168,14 +151,13 @@ AV1AnnexBDemuxer::AV1AnnexBDemuxer(Params &&params) : Demuxer(std::move(params))
 {
 }
 
-std::vector<uint8_t> AV1AnnexBDemuxer::nextPacket()
+DemuxedPacket AV1AnnexBDemuxer::nextPacket()
 {
-    std::vector<uint8_t> packet;
     auto &reader = m_params.data;
 
     DE_ASSERT(!reader->isError());
     if (reader->isEof())
-        return packet;
+        return DemuxedPacket();
 
     if (m_remainingBytesInTemporalUnit == 0)
     {
@@ -187,15 +169,17 @@ std::vector<uint8_t> AV1AnnexBDemuxer::nextPacket()
     uint32_t frameUlebSize = 0;
     uint32_t frameSize     = getUleb128(&frameUlebSize);
 
-    packet.resize(frameSize);
-    reader->read(packet);
+    // Truncated frame is treated as the end of the stream.
+    const uint8_t *frameData = reader->readView(frameSize);
+    if (!frameData)
+        return DemuxedPacket();
 
     DE_ASSERT((frameSize + frameUlebSize) <= m_remainingBytesInTemporalUnit);
     m_remainingBytesInTemporalUnit -= (frameSize + frameUlebSize);
 
     m_frameNumber++;
 
-    return packet;
+    return DemuxedPacket(frameData, frameSize);
 }
 
 uint32_t AV1AnnexBDemuxer::getUleb128(uint32_t *numBytes)
@@ -48,6 +48,37 @@ enum class ElementaryStreamFraming
     UNKNOWN
 };
 
+// Demuxed packet. Points directly into the elementary stream data owned by
+// the demuxer and stays valid until the demuxer is destroyed. An empty
+// packet marks the end of the stream.
+class DemuxedPacket
+{
+public:
+    DemuxedPacket() : m_data(nullptr), m_size(0)
+    {
+    }
+    DemuxedPacket(const uint8_t *data, size_t size) : m_data(data), m_size(size)
+    {
+    }
+
+    const uint8_t *data() const
+    {
+        return m_data;
+    }
+    size_t size() const
+    {
+        return m_size;
+    }
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+private:
+    const uint8_t *m_data;
+    size_t m_size;
+};
+
 class Demuxer
 {
 public:
@@ -73,7 +104,7 @@ public:
         return m_params.framing;
     }
 
-    virtual std::vector<uint8_t> nextPacket() = 0;
+    virtual DemuxedPacket nextPacket() = 0;
 
 protected:
     Demuxer(Params &&params);
@@ -85,17 +116,17 @@ class H26XAnnexBDemuxer final : public Demuxer
 public:
     H26XAnnexBDemuxer(Params &&params);
 
-    virtual std::vector<uint8_t> nextPacket() override;
+    virtual DemuxedPacket nextPacket() override;
 
 private:
-    void readToNextStartCode(std::vector<uint8_t> *payload);
+    bool m_eos{false};
 };
 
 class DuckIVFDemuxer final : public Demuxer
 {
 public:
     DuckIVFDemuxer(Params &&params);
-    virtual std::vector<uint8_t> nextPacket() override;
+    virtual DemuxedPacket nextPacket() override;
 
     DE_PACKED(Header {
         uint32_t signature;           // bytes 0-3    signature: 'DKIF'
@@ -124,7 +155,7 @@ class AV1AnnexBDemuxer final : public Demuxer
 public:
     AV1AnnexBDemuxer(Params &&params);
 
-    virtual std::vector<uint8_t> nextPacket() override;
+    virtual DemuxedPacket nextPacket() override;
 
 private:
     size_t m_remainingBytesInTemporalUnit{0};
@@ -86,7 +86,7 @@ FrameProcessor::FrameProcessor(std::shared_ptr<Demuxer> &&demuxer, std::shared_p
 
 void FrameProcessor::parseNextChunk()
 {
-    std::vector<uint8_t> demuxedPacket = m_demuxer->nextPacket();
+    const DemuxedPacket demuxedPacket = m_demuxer->nextPacket();
 
     VkParserBitstreamPacket pkt;
     pkt.pByteStream     = demuxedPacket.data();
@@ -36,6 +36,7 @@
 #include "deCommandLine.hpp"
 #include "deSharedPtr.hpp"
 #include "deThread.hpp"
+#include "deSemaphore.hpp"
 #include "deThreadSafeRingBuffer.hpp"
 #include "dePoolArray.hpp"
 
@@ -118,8 +119,9 @@ TaskExecutor::TaskExecutor(uint32_t numThreads) : m_threads(numThreads), m_tasks
 
 TaskExecutor::~TaskExecutor(void)
 {
-    for (size_t ndx = 0; ndx < m_threads.size(); ++ndx)
-        m_tasks.pushFront(DE_NULL);
+    const std::vector<Task *> endTasks(m_threads.size(), DE_NULL);
+
+    m_tasks.pushFront(&endTasks[0], endTasks.size());
 
     for (size_t ndx = 0; ndx < m_threads.size(); ++ndx)
         m_threads[ndx]->join();
@@ -219,6 +221,21 @@ struct Program
     }
 };
 
+// Binaries are validated by the worker that built them, so validation overlaps with building the following programs.
+void validateBinary(Program *program)
+{
+    DE_ASSERT(program->buildStatus == Program::STATUS_PASSED);
+    DE_ASSERT(program->binary->getFormat() == vk::PROGRAM_FORMAT_SPIRV);
+
+    std::ostringstream validationLogStream;
+
+    if (vk::validateProgram(*program->binary, &validationLogStream, program->validatorOptions))
+        program->validationStatus = Program::STATUS_PASSED;
+    else
+        program->validationStatus = Program::STATUS_FAILED;
+    program->validationLog = validationLogStream.str();
+}
+
 void writeBuildLogs(const glu::ShaderProgramInfo &buildInfo, std::ostream &dst)
 {
     for (size_t shaderNdx = 0; shaderNdx < buildInfo.shaders.size(); shaderNdx++)
@@ -246,14 +263,15 @@ template <typename Source>
 class BuildHighLevelShaderTask : public Task
 {
 public:
-    BuildHighLevelShaderTask(const Source &source, Program *program)
+    BuildHighLevelShaderTask(const Source &source, Program *program, bool validate)
         : m_source(source)
         , m_program(program)
         , m_commandLine(0)
+        , m_validate(validate)
     {
     }
 
-    BuildHighLevelShaderTask(void) : m_program(DE_NULL)
+    BuildHighLevelShaderTask(void) : m_program(DE_NULL), m_validate(false)
     {
     }
 
@@ -283,12 +301,16 @@ public:
             m_program->buildStatus = Program::STATUS_FAILED;
             m_program->buildLog    = log.str();
         }
+
+        if (m_validate && m_program->buildStatus == Program::STATUS_PASSED)
+            validateBinary(m_program);
     }
 
 private:
     Source m_source;
     Program *m_program;
     const tcu::CommandLine *m_commandLine;
+    bool m_validate;
 };
 
 void writeBuildLogs(const vk::SpirVProgramInfo &buildInfo, std::ostream &dst)
@@ -304,14 +326,15 @@ void writeBuildLogs(const vk::SpirVProgramInfo &buildInfo, std::ostream &dst)
 class BuildSpirVAsmTask : public Task
 {
 public:
-    BuildSpirVAsmTask(const vk::SpirVAsmSource &source, Program *program)
+    BuildSpirVAsmTask(const vk::SpirVAsmSource &source, Program *program, bool validate)
         : m_source(source)
         , m_program(program)
         , m_commandLine(0)
+        , m_validate(validate)
     {
     }
 
-    BuildSpirVAsmTask(void) : m_program(DE_NULL), m_commandLine(0)
+    BuildSpirVAsmTask(void) : m_program(DE_NULL), m_commandLine(0), m_validate(false)
     {
     }
 
@@ -340,37 +363,16 @@ public:
             m_program->buildStatus = Program::STATUS_FAILED;
             m_program->buildLog    = log.str();
         }
+
+        if (m_validate && m_program->buildStatus == Program::STATUS_PASSED)
+            validateBinary(m_program);
     }
 
 private:
     vk::SpirVAsmSource m_source;
     Program *m_program;
     const tcu::CommandLine *m_commandLine;
-};
-
-class ValidateBinaryTask : public Task
-{
-public:
-    ValidateBinaryTask(Program *program) : m_program(program)
-    {
-    }
-
-    void execute(void)
-    {
-        DE_ASSERT(m_program->buildStatus == Program::STATUS_PASSED);
-        DE_ASSERT(m_program->binary->getFormat() == vk::PROGRAM_FORMAT_SPIRV);
-
-        std::ostringstream validationLogStream;
-
-        if (vk::validateProgram(*m_program->binary, &validationLogStream, m_program->validatorOptions))
-            m_program->validationStatus = Program::STATUS_PASSED;
-        else
-            m_program->validationStatus = Program::STATUS_FAILED;
-        m_program->validationLog = validationLogStream.str();
-    }
-
-private:
-    Program *m_program;
+    bool m_validate;
 };
 
 tcu::TestPackageRoot *createRoot(tcu::TestContext &testCtx)
@@ -462,8 +464,8 @@ BuildStats buildPrograms(tcu::TestContext &testCtx, const std::string &dstPath,
 
                     programs.pushBack(Program(vk::ProgramIdentifier(casePath, progIter.getName()),
                                               progIter.getProgram().buildOptions.getSpirvValidatorOptions()));
-                    buildGlslTasks.pushBack(
-                        BuildHighLevelShaderTask<vk::GlslSource>(progIter.getProgram(), &programs.back()));
+                    buildGlslTasks.pushBack(BuildHighLevelShaderTask<vk::GlslSource>(
+                        progIter.getProgram(), &programs.back(), validateBinaries));
                     buildGlslTasks.back().setCommandline(testCtx.getCommandLine());
                     executor.submit(&buildGlslTasks.back());
                 }
@@ -480,8 +482,8 @@ BuildStats buildPrograms(tcu::TestContext &testCtx, const std::string &dstPath,
 
                     programs.pushBack(Program(vk::ProgramIdentifier(casePath, progIter.getName()),
                                               progIter.getProgram().buildOptions.getSpirvValidatorOptions()));
-                    buildHlslTasks.pushBack(
-                        BuildHighLevelShaderTask<vk::HlslSource>(progIter.getProgram(), &programs.back()));
+                    buildHlslTasks.pushBack(BuildHighLevelShaderTask<vk::HlslSource>(
+                        progIter.getProgram(), &programs.back(), validateBinaries));
                     buildHlslTasks.back().setCommandline(testCtx.getCommandLine());
                     executor.submit(&buildHlslTasks.back());
                 }
@@ -498,7 +500,8 @@ BuildStats buildPrograms(tcu::TestContext &testCtx, const std::string &dstPath,
 
                     programs.pushBack(Program(vk::ProgramIdentifier(casePath, progIter.getName()),
                                               progIter.getProgram().buildOptions.getSpirvValidatorOptions()));
-                    buildSpirvAsmTasks.pushBack(BuildSpirVAsmTask(progIter.getProgram(), &programs.back()));
+                    buildSpirvAsmTasks.pushBack(
+                        BuildSpirVAsmTask(progIter.getProgram(), &programs.back(), validateBinaries));
                     buildSpirvAsmTasks.back().setCommandline(testCtx.getCommandLine());
                     executor.submit(&buildSpirvAsmTasks.back());
                 }
@@ -510,24 +513,6 @@ BuildStats buildPrograms(tcu::TestContext &testCtx, const std::string &dstPath,
         // Need to wait until tasks completed before freeing task memory
         executor.waitForComplete();
 
-        if (validateBinaries)
-        {
-            std::vector<ValidateBinaryTask> validationTasks;
-
-            validationTasks.reserve(programs.size());
-
-            for (de::PoolArray<Program>::iterator progIter = programs.begin(); progIter != programs.end(); ++progIter)
-            {
-                if (progIter->buildStatus == Program::STATUS_PASSED)
-                {
-                    validationTasks.push_back(ValidateBinaryTask(&*progIter));
-                    executor.submit(&validationTasks.back());
-                }
-            }
-
-            executor.waitForComplete();
-        }
-
         {
             vk::BinaryRegistryWriter registryWriter(dstPath);
 
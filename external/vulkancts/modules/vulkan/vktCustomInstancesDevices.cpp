@@ -28,6 +28,7 @@
 #include "vkDebugReportUtil.hpp"
 #include "vkMemUtil.hpp"
 #include "tcuCommandLine.hpp"
+#include "tcuInstrumentation.hpp"
 #include "vktCustomInstancesDevices.hpp"
 
 #include <algorithm>
@@ -530,6 +531,7 @@ vk::Move<vk::VkDevice> createCustomDevice(bool validationEnabled, const vk::Plat
                                           const vk::VkDeviceCreateInfo *pCreateInfo,
                                           const vk::VkAllocationCallbacks *pAllocator)
 {
+    const tcu::ScopedPhaseTimer timer(tcu::INSTRUMENTATION_PHASE_DEVICE_CREATION);
     vector<const char *> enabledLayers;
     vk::VkDeviceCreateInfo createInfo = *pCreateInfo;
 
@@ -1799,8 +1799,8 @@ public:
 
     void init(void)
     {
-        ShaderCaseFactory caseFactory(m_testCtx);
-        const vector<tcu::TestNode *> children = glu::sl::parseFile(m_testCtx.getArchive(), m_filename, &caseFactory);
+        const de::SharedPtr<glu::sl::ShaderCaseFactory> caseFactory(new ShaderCaseFactory(m_testCtx));
+        const vector<tcu::TestNode *> children = glu::sl::loadFile(m_testCtx, m_filename, caseFactory);
 
         for (size_t ndx = 0; ndx < children.size(); ndx++)
         {
@@ -655,6 +655,18 @@ uint32_t sanitizeApiVersion(uint32_t v)
 }
 
 #ifndef CTS_USES_VULKANSC
+de::MovePtr<DeviceDriver> createDefaultDeviceDriver(const PlatformInterface &vkp, VkInstance instance, VkDevice device,
+                                                    uint32_t usedApiVersion, const tcu::CommandLine &cmdLine,
+                                                    const VkPhysicalDeviceProperties &properties,
+                                                    de::SharedPtr<vk::ResourceInterface> resourceInterface)
+{
+    if (*cmdLine.getPersistentPipelineCacheDir() != 0)
+        return de::MovePtr<DeviceDriver>(new DeviceDriverSharedPipelineCache(vkp, instance, device, usedApiVersion,
+                                                                             cmdLine, properties, resourceInterface));
+    else
+        return de::MovePtr<DeviceDriver>(new DeviceDriver(vkp, instance, device, usedApiVersion, cmdLine));
+}
+
 de::MovePtr<vk::DebugReportRecorder> createDebugReportRecorder(const vk::PlatformInterface &vkp,
                                                                bool printValidationErrors)
 {
@@ -763,17 +775,15 @@ DefaultDevice::DefaultDevice(const PlatformInterface &vkPlatform, const tcu::Com
                                    m_transferQueueFamilyIndex, m_deviceFeatures.getCoreFeatures2(),
                                    m_creationExtensions, cmdLine, resourceInterface))
 #ifndef CTS_USES_VULKANSC
-    , m_deviceInterface(
-          de::MovePtr<DeviceDriver>(new DeviceDriver(vkPlatform, *m_instance, *m_device, m_usedApiVersion, cmdLine)))
+    , m_deviceInterface(createDefaultDeviceDriver(vkPlatform, *m_instance, *m_device, m_usedApiVersion, cmdLine,
+                                                  m_deviceProperties.getCoreProperties2().properties,
+                                                  resourceInterface))
 #else
     , m_deviceInterface(de::MovePtr<DeviceDriverSC>(
           new DeviceDriverSC(vkPlatform, *m_instance, *m_device, cmdLine, resourceInterface,
                              getDeviceVulkanSC10Properties(), getDeviceProperties(), m_usedApiVersion)))
 #endif // CTS_USES_VULKANSC
 {
-#ifndef CTS_USES_VULKANSC
-    DE_UNREF(resourceInterface);
-#endif
     DE_ASSERT(m_deviceVersions.first == m_deviceVersion);
 }
 
@@ -836,6 +846,12 @@ Context::Context(tcu::TestContext &testCtx, const vk::PlatformInterface &platfor
     , m_resourceInterface(resourceInterface)
     , m_device(new DefaultDevice(m_platformInterface, testCtx.getCommandLine(), resourceInterface))
     , m_allocator(createAllocator(m_device.get()))
+    , m_pipelineLibraryCache(new vk::GraphicsPipelineLibraryCache(m_device->getDevice()))
+#ifndef CTS_USES_VULKANSC
+    , m_readbackRing(new vk::ReadbackRing(m_device->getDeviceInterface(), m_device->getDevice(),
+                                          m_device->getUniversalQueue(), m_device->getUniversalQueueFamilyIndex(),
+                                          *m_allocator))
+#endif // CTS_USES_VULKANSC
     , m_resultSetOnValidation(false)
 {
 }
@@ -1093,6 +1109,17 @@ vk::Allocator &Context::getDefaultAllocator(void) const
 {
     return *m_allocator;
 }
+
+vk::GraphicsPipelineLibraryCache &Context::getPipelineLibraryCache(void) const
+{
+    return *m_pipelineLibraryCache;
+}
+#ifndef CTS_USES_VULKANSC
+vk::ReadbackRing &Context::getReadbackRing(void) const
+{
+    return *m_readbackRing;
+}
+#endif // CTS_USES_VULKANSC
 uint32_t Context::getUsedApiVersion(void) const
 {
     return m_device->getUsedApiVersion();
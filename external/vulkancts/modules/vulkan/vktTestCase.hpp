@@ -36,6 +36,7 @@
 #include "vkResourceInterface.hpp"
 #include "vktTestCaseDefs.hpp"
 #include "vkPipelineConstructionUtil.hpp"
+#include "vkReadbackRing.hpp"
 #include <vector>
 #include <string>
 #ifdef CTS_USES_VULKANSC
@@ -145,6 +146,12 @@ public:
 
     de::SharedPtr<vk::ResourceInterface> getResourceInterface(void) const;
     vk::Allocator &getDefaultAllocator(void) const;
+    // Pipeline library parts shared between cases that opt in, see GraphicsPipelineWrapper::setPipelineLibraryCache.
+    vk::GraphicsPipelineLibraryCache &getPipelineLibraryCache(void) const;
+#ifndef CTS_USES_VULKANSC
+    // Image readback on the universal queue through persistent staging memory. Reset after every case.
+    vk::ReadbackRing &getReadbackRing(void) const;
+#endif // CTS_USES_VULKANSC
     bool contextSupports(const uint32_t variantNum, const uint32_t majorNum, const uint32_t minorNum,
                          const uint32_t patchNum) const;
     bool contextSupports(const vk::ApiVersion version) const;
@@ -195,6 +202,10 @@ protected:
     de::SharedPtr<vk::ResourceInterface> m_resourceInterface;
     const de::UniquePtr<DefaultDevice> m_device;
     const de::UniquePtr<vk::Allocator> m_allocator;
+    const de::UniquePtr<vk::GraphicsPipelineLibraryCache> m_pipelineLibraryCache;
+#ifndef CTS_USES_VULKANSC
+    const de::UniquePtr<vk::ReadbackRing> m_readbackRing;
+#endif // CTS_USES_VULKANSC
 
     bool m_resultSetOnValidation;
 
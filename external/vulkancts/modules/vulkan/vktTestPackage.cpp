@@ -33,6 +33,7 @@
 #include "tcuTestLog.hpp"
 #include "tcuCommandLine.hpp"
 #include "tcuWaiverUtil.hpp"
+#include "tcuInstrumentation.hpp"
 
 #include "vkPlatform.hpp"
 #include "vkPrograms.hpp"
@@ -458,12 +459,19 @@ void TestCaseExecutor::init(tcu::TestCase *testCase, const std::string &casePath
     if (m_waiverMechanism.isOnWaiverList(casePath))
         throw tcu::TestException("Waived test", QP_TEST_RESULT_WAIVER);
 
-    vktCase->checkSupport(*m_context);
+    {
+        tcu::ScopedPhaseTimer timer(tcu::INSTRUMENTATION_PHASE_CHECK_SUPPORT);
+        vktCase->checkSupport(*m_context);
+    }
 
     vktCase->delayedInit();
 
     m_progCollection.clear();
-    vktCase->initPrograms(sourceProgs);
+
+    {
+        tcu::ScopedPhaseTimer timer(tcu::INSTRUMENTATION_PHASE_INIT_PROGRAMS);
+        vktCase->initPrograms(sourceProgs);
+    }
 
     for (vk::GlslSourceCollection::Iterator progIter = sourceProgs.glslSources.begin();
          progIter != sourceProgs.glslSources.end(); ++progIter)
@@ -533,7 +541,10 @@ void TestCaseExecutor::init(tcu::TestCase *testCase, const std::string &casePath
         m_renderDoc->startFrame(m_context->getInstance());
 
     DE_ASSERT(!m_instance);
-    m_instance = vktCase->createInstance(*m_context);
+    {
+        tcu::ScopedPhaseTimer timer(tcu::INSTRUMENTATION_PHASE_CREATE_INSTANCE);
+        m_instance = vktCase->createInstance(*m_context);
+    }
     m_context->resultSetOnValidation(false);
 }
 
@@ -545,6 +556,11 @@ void TestCaseExecutor::deinit(tcu::TestCase *testCase)
     if (m_renderDoc)
         m_renderDoc->endFrame(m_context->getInstance());
 
+#ifndef CTS_USES_VULKANSC
+    // Results of the case are no longer referenced, so staging memory can be recycled.
+    m_context->getReadbackRing().reset();
+#endif // CTS_USES_VULKANSC
+
         // Collect and report any debug messages
 #ifndef CTS_USES_VULKANSC
     if (m_context->hasDebugReportRecorder())
@@ -37,8 +37,10 @@
 
 #include "deSTLUtil.hpp"
 #include "deUniquePtr.hpp"
+#include "deTaskScheduler.hpp"
 
 #include <limits>
+#include <unordered_map>
 
 namespace vkt
 {
@@ -1400,12 +1402,44 @@ tcu::Interval calculateAB(const uint32_t subTexelPrecisionBits, const tcu::Inter
     return rounded;
 }
 
-tcu::Interval lookupWrapped(const ChannelAccess &access, const tcu::FloatFormat &conversionFormat,
-                            vk::VkSamplerAddressMode addressModeU, vk::VkSamplerAddressMode addressModeV,
-                            const tcu::IVec2 &coord)
+// Channel with every texel converted to an interval in the conversion
+// format up front. Nearby sample coordinates fetch largely the same texels,
+// so this avoids repeating the conversion for every fetch.
+class ConvertedChannel
 {
-    return access.getChannel(conversionFormat, tcu::IVec3(wrap(addressModeU, coord.x(), access.getSize().x()),
-                                                          wrap(addressModeV, coord.y(), access.getSize().y()), 0));
+public:
+    ConvertedChannel(const ChannelAccess &access, const tcu::FloatFormat &conversionFormat,
+                     vk::VkSamplerAddressMode addressModeU, vk::VkSamplerAddressMode addressModeV);
+
+    tcu::Interval lookupWrapped(const tcu::IVec2 &coord) const
+    {
+        const int x = wrap(m_addressModeU, coord.x(), m_size.x());
+        const int y = wrap(m_addressModeV, coord.y(), m_size.y());
+
+        return m_values[y * m_size.x() + x];
+    }
+
+private:
+    const tcu::IVec2 m_size;
+    const vk::VkSamplerAddressMode m_addressModeU;
+    const vk::VkSamplerAddressMode m_addressModeV;
+    std::vector<tcu::Interval> m_values;
+};
+
+ConvertedChannel::ConvertedChannel(const ChannelAccess &access, const tcu::FloatFormat &conversionFormat,
+                                   vk::VkSamplerAddressMode addressModeU, vk::VkSamplerAddressMode addressModeV)
+    : m_size(access.getSize().swizzle(0, 1))
+    , m_addressModeU(addressModeU)
+    , m_addressModeV(addressModeV)
+    , m_values(m_size.x() * m_size.y())
+{
+    de::parallelFor(0, (size_t)m_size.y(), 0,
+                    [&](size_t rowBegin, size_t rowEnd)
+                    {
+                        for (int y = (int)rowBegin; y < (int)rowEnd; y++)
+                            for (int x = 0; x < m_size.x(); x++)
+                                m_values[y * m_size.x() + x] = access.getChannel(conversionFormat, tcu::IVec3(x, y, 0));
+                    });
 }
 
 tcu::Interval linearInterpolate(const tcu::FloatFormat &filteringFormat, const tcu::Interval &a, const tcu::Interval &b,
@@ -1436,42 +1470,30 @@ tcu::Interval calculateImplicitChromaUV(const tcu::FloatFormat &coordFormat, vk:
         return coordFormat.roundOut(0.5 * uv, false);
 }
 
-tcu::Interval linearSample(const ChannelAccess &access, const tcu::FloatFormat &conversionFormat,
-                           const tcu::FloatFormat &filteringFormat, vk::VkSamplerAddressMode addressModeU,
-                           vk::VkSamplerAddressMode addressModeV, const tcu::IVec2 &coord, const tcu::Interval &a,
-                           const tcu::Interval &b)
-{
-    return linearInterpolate(
-        filteringFormat, a, b,
-        lookupWrapped(access, conversionFormat, addressModeU, addressModeV, coord + tcu::IVec2(0, 0)),
-        lookupWrapped(access, conversionFormat, addressModeU, addressModeV, coord + tcu::IVec2(1, 0)),
-        lookupWrapped(access, conversionFormat, addressModeU, addressModeV, coord + tcu::IVec2(0, 1)),
-        lookupWrapped(access, conversionFormat, addressModeU, addressModeV, coord + tcu::IVec2(1, 1)));
+tcu::Interval linearSample(const ConvertedChannel &channel, const tcu::FloatFormat &filteringFormat,
+                           const tcu::IVec2 &coord, const tcu::Interval &a, const tcu::Interval &b)
+{
+    return linearInterpolate(filteringFormat, a, b, channel.lookupWrapped(coord + tcu::IVec2(0, 0)),
+                             channel.lookupWrapped(coord + tcu::IVec2(1, 0)),
+                             channel.lookupWrapped(coord + tcu::IVec2(0, 1)),
+                             channel.lookupWrapped(coord + tcu::IVec2(1, 1)));
 }
 
-tcu::Interval reconstructLinearXChromaSample(const tcu::FloatFormat &filteringFormat,
-                                             const tcu::FloatFormat &conversionFormat, vk::VkChromaLocation offset,
-                                             vk::VkSamplerAddressMode addressModeU,
-                                             vk::VkSamplerAddressMode addressModeV, const ChannelAccess &access, int i,
-                                             int j)
+tcu::Interval reconstructLinearXChromaSample(const tcu::FloatFormat &filteringFormat, vk::VkChromaLocation offset,
+                                             const ConvertedChannel &channel, int i, int j)
 {
     const int subI = offset == vk::VK_CHROMA_LOCATION_COSITED_EVEN ? divFloor(i, 2) :
                                                                      (i % 2 == 0 ? divFloor(i, 2) - 1 : divFloor(i, 2));
     const double a =
         offset == vk::VK_CHROMA_LOCATION_COSITED_EVEN ? (i % 2 == 0 ? 0.0 : 0.5) : (i % 2 == 0 ? 0.25 : 0.75);
 
-    const tcu::Interval A(filteringFormat.roundOut(
-        a * lookupWrapped(access, conversionFormat, addressModeU, addressModeV, tcu::IVec2(subI, j)), false));
-    const tcu::Interval B(filteringFormat.roundOut(
-        (1.0 - a) * lookupWrapped(access, conversionFormat, addressModeU, addressModeV, tcu::IVec2(subI + 1, j)),
-        false));
+    const tcu::Interval A(filteringFormat.roundOut(a * channel.lookupWrapped(tcu::IVec2(subI, j)), false));
+    const tcu::Interval B(filteringFormat.roundOut((1.0 - a) * channel.lookupWrapped(tcu::IVec2(subI + 1, j)), false));
     return filteringFormat.roundOut(A + B, false);
 }
 
-tcu::Interval reconstructLinearXYChromaSample(const tcu::FloatFormat &filteringFormat,
-                                              const tcu::FloatFormat &conversionFormat, vk::VkChromaLocation xOffset,
-                                              vk::VkChromaLocation yOffset, vk::VkSamplerAddressMode addressModeU,
-                                              vk::VkSamplerAddressMode addressModeV, const ChannelAccess &access, int i,
+tcu::Interval reconstructLinearXYChromaSample(const tcu::FloatFormat &filteringFormat, vk::VkChromaLocation xOffset,
+                                              vk::VkChromaLocation yOffset, const ConvertedChannel &channel, int i,
                                               int j)
 {
     const int subI = xOffset == vk::VK_CHROMA_LOCATION_COSITED_EVEN ?
@@ -1486,10 +1508,50 @@ tcu::Interval reconstructLinearXYChromaSample(const tcu::FloatFormat &filteringF
     const double b =
         yOffset == vk::VK_CHROMA_LOCATION_COSITED_EVEN ? (j % 2 == 0 ? 0.0 : 0.5) : (j % 2 == 0 ? 0.25 : 0.75);
 
-    return linearSample(access, conversionFormat, filteringFormat, addressModeU, addressModeV, tcu::IVec2(subI, subJ),
-                        a, b);
+    return linearSample(channel, filteringFormat, tcu::IVec2(subI, subJ), a, b);
 }
 
+// Explicitly reconstructed chroma samples by luma texel coordinate. Luma
+// neighbourhoods of nearby sample coordinates overlap, so each chroma
+// sample is reconstructed only once per batch of coordinates.
+class ReconstructedChroma
+{
+public:
+    ReconstructedChroma(const tcu::FloatFormat &filteringFormat, const ConvertedChannel &channel,
+                        vk::VkChromaLocation xOffset, vk::VkChromaLocation yOffset, bool subsampledY)
+        : m_filteringFormat(filteringFormat)
+        , m_channel(channel)
+        , m_xOffset(xOffset)
+        , m_yOffset(yOffset)
+        , m_subsampledY(subsampledY)
+    {
+    }
+
+    tcu::Interval get(int i, int j)
+    {
+        const int64_t key = (int64_t)(((uint64_t)(uint32_t)i << 32) | (uint32_t)j);
+        const auto iter   = m_samples.find(key);
+
+        if (iter != m_samples.end())
+            return iter->second;
+
+        const tcu::Interval sample =
+            m_subsampledY ? reconstructLinearXYChromaSample(m_filteringFormat, m_xOffset, m_yOffset, m_channel, i, j) :
+                            reconstructLinearXChromaSample(m_filteringFormat, m_xOffset, m_channel, i, j);
+
+        m_samples[key] = sample;
+        return sample;
+    }
+
+private:
+    const tcu::FloatFormat &m_filteringFormat;
+    const ConvertedChannel &m_channel;
+    const vk::VkChromaLocation m_xOffset;
+    const vk::VkChromaLocation m_yOffset;
+    const bool m_subsampledY;
+    std::unordered_map<int64_t, tcu::Interval> m_samples;
+};
+
 const ChannelAccess &swizzle(vk::VkComponentSwizzle swizzle, const ChannelAccess &identityPlane,
                              const ChannelAccess &rPlane, const ChannelAccess &gPlane, const ChannelAccess &bPlane,
                              const ChannelAccess &aPlane)
@@ -1591,294 +1653,226 @@ void calculateBounds(const ChannelAccess &rPlane, const ChannelAccess &gPlane, c
     DE_ASSERT(chromaFilter == vk::VK_FILTER_NEAREST || chromaFilter == vk::VK_FILTER_LINEAR);
     DE_ASSERT(subsampledX || !subsampledY);
 
-    for (size_t ndx = 0; ndx < sts.size(); ndx++)
+    // Implicit nearest chroma reconstruction with linear filtering reads chroma in luma and alpha precision
+    const bool implicitChromaLumaPrecision = filter == vk::VK_FILTER_LINEAR && !explicitReconstruction &&
+                                             (subsampledX || subsampledY) && chromaFilter == vk::VK_FILTER_NEAREST;
+
+    const ConvertedChannel rChannel(rAccess, conversionFormat[0], addressModeU, addressModeV);
+    const ConvertedChannel gChannel(gAccess, conversionFormat[1], addressModeU, addressModeV);
+    const ConvertedChannel bChannel(bAccess, conversionFormat[2], addressModeU, addressModeV);
+    const ConvertedChannel aChannel(aAccess, conversionFormat[3], addressModeU, addressModeV);
+    const de::UniquePtr<ConvertedChannel> rLumaPrecisionChannel(
+        implicitChromaLumaPrecision ? new ConvertedChannel(rAccess, conversionFormat[1], addressModeU, addressModeV) :
+                                      nullptr);
+    const de::UniquePtr<ConvertedChannel> bLumaPrecisionChannel(
+        implicitChromaLumaPrecision ? new ConvertedChannel(bAccess, conversionFormat[3], addressModeU, addressModeV) :
+                                      nullptr);
+
+    // Every sample coordinate is independent, batches of them are processed in parallel.
+    const auto calculateBatchBounds = [&](size_t batchBegin, size_t batchEnd)
     {
-        const Vec2 st(sts[ndx]);
-        Interval bounds[4];
+        ReconstructedChroma rReconstructed(filteringFormat[0], rChannel, xChromaOffset, yChromaOffset, subsampledY);
+        ReconstructedChroma bReconstructed(filteringFormat[2], bChannel, xChromaOffset, yChromaOffset, subsampledY);
+
+        for (size_t ndx = batchBegin; ndx < batchEnd; ndx++)
+        {
+            const Vec2 st(sts[ndx]);
+            Interval bounds[4];
 
-        const Interval u(calculateUV(coordFormat, st[0], gAccess.getSize().x()));
-        const Interval v(calculateUV(coordFormat, st[1], gAccess.getSize().y()));
+            const Interval u(calculateUV(coordFormat, st[0], gAccess.getSize().x()));
+            const Interval v(calculateUV(coordFormat, st[1], gAccess.getSize().y()));
 
-        uvBounds[ndx][0] = (float)u.lo();
-        uvBounds[ndx][1] = (float)u.hi();
+            uvBounds[ndx][0] = (float)u.lo();
+            uvBounds[ndx][1] = (float)u.hi();
 
-        uvBounds[ndx][2] = (float)v.lo();
-        uvBounds[ndx][3] = (float)v.hi();
+            uvBounds[ndx][2] = (float)v.lo();
+            uvBounds[ndx][3] = (float)v.hi();
 
-        const IVec2 iRange(calculateIJRange(filter, coordFormat, u));
-        const IVec2 jRange(calculateIJRange(filter, coordFormat, v));
+            const IVec2 iRange(calculateIJRange(filter, coordFormat, u));
+            const IVec2 jRange(calculateIJRange(filter, coordFormat, v));
 
-        ijBounds[ndx][0] = iRange[0];
-        ijBounds[ndx][1] = iRange[1];
+            ijBounds[ndx][0] = iRange[0];
+            ijBounds[ndx][1] = iRange[1];
 
-        ijBounds[ndx][2] = jRange[0];
-        ijBounds[ndx][3] = jRange[1];
+            ijBounds[ndx][2] = jRange[0];
+            ijBounds[ndx][3] = jRange[1];
 
-        for (int j = jRange.x(); j <= jRange.y(); j++)
-            for (int i = iRange.x(); i <= iRange.y(); i++)
-            {
-                if (filter == vk::VK_FILTER_NEAREST)
+            for (int j = jRange.x(); j <= jRange.y(); j++)
+                for (int i = iRange.x(); i <= iRange.y(); i++)
                 {
-                    const Interval gValue(
-                        lookupWrapped(gAccess, conversionFormat[1], addressModeU, addressModeV, IVec2(i, j)));
-                    const Interval aValue(
-                        lookupWrapped(aAccess, conversionFormat[3], addressModeU, addressModeV, IVec2(i, j)));
-
-                    if (explicitReconstruction || !(subsampledX || subsampledY))
+                    if (filter == vk::VK_FILTER_NEAREST)
                     {
-                        Interval rValue, bValue;
-                        if (chromaFilter == vk::VK_FILTER_NEAREST || !subsampledX)
-                        {
-                            // Reconstruct using nearest if needed, otherwise, just take what's already there.
-                            const int subI = subsampledX ? i / 2 : i;
-                            const int subJ = subsampledY ? j / 2 : j;
-                            rValue         = lookupWrapped(rAccess, conversionFormat[0], addressModeU, addressModeV,
-                                                           IVec2(subI, subJ));
-                            bValue         = lookupWrapped(bAccess, conversionFormat[2], addressModeU, addressModeV,
-                                                           IVec2(subI, subJ));
-                        }
-                        else // vk::VK_FILTER_LINEAR
+                        const Interval gValue(gChannel.lookupWrapped(IVec2(i, j)));
+                        const Interval aValue(aChannel.lookupWrapped(IVec2(i, j)));
+
+                        if (explicitReconstruction || !(subsampledX || subsampledY))
                         {
-                            if (subsampledY)
+                            Interval rValue, bValue;
+                            if (chromaFilter == vk::VK_FILTER_NEAREST || !subsampledX)
                             {
-                                rValue = reconstructLinearXYChromaSample(filteringFormat[0], conversionFormat[0],
-                                                                         xChromaOffset, yChromaOffset, addressModeU,
-                                                                         addressModeV, rAccess, i, j);
-                                bValue = reconstructLinearXYChromaSample(filteringFormat[2], conversionFormat[2],
-                                                                         xChromaOffset, yChromaOffset, addressModeU,
-                                                                         addressModeV, bAccess, i, j);
+                                // Reconstruct using nearest if needed, otherwise, just take what's already there.
+                                const int subI = subsampledX ? i / 2 : i;
+                                const int subJ = subsampledY ? j / 2 : j;
+                                rValue         = rChannel.lookupWrapped(IVec2(subI, subJ));
+                                bValue         = bChannel.lookupWrapped(IVec2(subI, subJ));
                             }
-                            else
+                            else // vk::VK_FILTER_LINEAR
                             {
-                                rValue = reconstructLinearXChromaSample(filteringFormat[0], conversionFormat[0],
-                                                                        xChromaOffset, addressModeU, addressModeV,
-                                                                        rAccess, i, j);
-                                bValue = reconstructLinearXChromaSample(filteringFormat[2], conversionFormat[2],
-                                                                        xChromaOffset, addressModeU, addressModeV,
-                                                                        bAccess, i, j);
+                                rValue = rReconstructed.get(i, j);
+                                bValue = bReconstructed.get(i, j);
                             }
-                        }
-
-                        const Interval srcColor[] = {rValue, gValue, bValue, aValue};
-                        Interval dstColor[4];
 
-                        convertColor(colorModel, range, conversionFormat, bitDepth, srcColor, dstColor);
+                            const Interval srcColor[] = {rValue, gValue, bValue, aValue};
+                            Interval dstColor[4];
 
-                        for (size_t compNdx = 0; compNdx < 4; compNdx++)
-                            bounds[compNdx] |= highp.roundOut(dstColor[compNdx], false);
-                    }
-                    else
-                    {
-                        const Interval chromaU(subsampledX ? calculateImplicitChromaUV(coordFormat, xChromaOffset, u) :
-                                                             u);
-                        const Interval chromaV(subsampledY ? calculateImplicitChromaUV(coordFormat, yChromaOffset, v) :
-                                                             v);
-
-                        // Reconstructed chroma samples with implicit filtering
-                        const IVec2 chromaIRange(subsampledX ? calculateIJRange(chromaFilter, coordFormat, chromaU) :
-                                                               IVec2(i, i));
-                        const IVec2 chromaJRange(subsampledY ? calculateIJRange(chromaFilter, coordFormat, chromaV) :
-                                                               IVec2(j, j));
-
-                        for (int chromaJ = chromaJRange.x(); chromaJ <= chromaJRange.y(); chromaJ++)
-                            for (int chromaI = chromaIRange.x(); chromaI <= chromaIRange.y(); chromaI++)
-                            {
-                                Interval rValue, bValue;
+                            convertColor(colorModel, range, conversionFormat, bitDepth, srcColor, dstColor);
 
-                                if (chromaFilter == vk::VK_FILTER_NEAREST)
-                                {
-                                    rValue = lookupWrapped(rAccess, conversionFormat[0], addressModeU, addressModeV,
-                                                           IVec2(chromaI, chromaJ));
-                                    bValue = lookupWrapped(bAccess, conversionFormat[2], addressModeU, addressModeV,
-                                                           IVec2(chromaI, chromaJ));
-                                }
-                                else // vk::VK_FILTER_LINEAR
+                            for (size_t compNdx = 0; compNdx < 4; compNdx++)
+                                bounds[compNdx] |= highp.roundOut(dstColor[compNdx], false);
+                        }
+                        else
+                        {
+                            const Interval chromaU(
+                                subsampledX ? calculateImplicitChromaUV(coordFormat, xChromaOffset, u) : u);
+                            const Interval chromaV(
+                                subsampledY ? calculateImplicitChromaUV(coordFormat, yChromaOffset, v) : v);
+
+                            // Reconstructed chroma samples with implicit filtering
+                            const IVec2 chromaIRange(
+                                subsampledX ? calculateIJRange(chromaFilter, coordFormat, chromaU) : IVec2(i, i));
+                            const IVec2 chromaJRange(
+                                subsampledY ? calculateIJRange(chromaFilter, coordFormat, chromaV) : IVec2(j, j));
+
+                            for (int chromaJ = chromaJRange.x(); chromaJ <= chromaJRange.y(); chromaJ++)
+                                for (int chromaI = chromaIRange.x(); chromaI <= chromaIRange.y(); chromaI++)
                                 {
-                                    const Interval chromaA(calculateAB(subTexelPrecisionBits, chromaU, chromaI));
-                                    const Interval chromaB(calculateAB(subTexelPrecisionBits, chromaV, chromaJ));
-
-                                    rValue =
-                                        linearSample(rAccess, conversionFormat[0], filteringFormat[0], addressModeU,
-                                                     addressModeV, IVec2(chromaI, chromaJ), chromaA, chromaB);
-                                    bValue =
-                                        linearSample(bAccess, conversionFormat[2], filteringFormat[2], addressModeU,
-                                                     addressModeV, IVec2(chromaI, chromaJ), chromaA, chromaB);
+                                    Interval rValue, bValue;
+
+                                    if (chromaFilter == vk::VK_FILTER_NEAREST)
+                                    {
+                                        rValue = rChannel.lookupWrapped(IVec2(chromaI, chromaJ));
+                                        bValue = bChannel.lookupWrapped(IVec2(chromaI, chromaJ));
+                                    }
+                                    else // vk::VK_FILTER_LINEAR
+                                    {
+                                        const Interval chromaA(calculateAB(subTexelPrecisionBits, chromaU, chromaI));
+                                        const Interval chromaB(calculateAB(subTexelPrecisionBits, chromaV, chromaJ));
+
+                                        rValue = linearSample(rChannel, filteringFormat[0], IVec2(chromaI, chromaJ),
+                                                              chromaA, chromaB);
+                                        bValue = linearSample(bChannel, filteringFormat[2], IVec2(chromaI, chromaJ),
+                                                              chromaA, chromaB);
+                                    }
+
+                                    const Interval srcColor[] = {rValue, gValue, bValue, aValue};
+
+                                    Interval dstColor[4];
+                                    convertColor(colorModel, range, conversionFormat, bitDepth, srcColor, dstColor);
+
+                                    for (size_t compNdx = 0; compNdx < 4; compNdx++)
+                                        bounds[compNdx] |= highp.roundOut(dstColor[compNdx], false);
                                 }
-
-                                const Interval srcColor[] = {rValue, gValue, bValue, aValue};
-
-                                Interval dstColor[4];
-                                convertColor(colorModel, range, conversionFormat, bitDepth, srcColor, dstColor);
-
-                                for (size_t compNdx = 0; compNdx < 4; compNdx++)
-                                    bounds[compNdx] |= highp.roundOut(dstColor[compNdx], false);
-                            }
+                        }
                     }
-                }
-                else // filter == vk::VK_FILTER_LINEAR
-                {
-                    const Interval lumaA(calculateAB(subTexelPrecisionBits, u, i));
-                    const Interval lumaB(calculateAB(subTexelPrecisionBits, v, j));
+                    else // filter == vk::VK_FILTER_LINEAR
+                    {
+                        const Interval lumaA(calculateAB(subTexelPrecisionBits, u, i));
+                        const Interval lumaB(calculateAB(subTexelPrecisionBits, v, j));
 
-                    const Interval gValue(linearSample(gAccess, conversionFormat[1], filteringFormat[1], addressModeU,
-                                                       addressModeV, IVec2(i, j), lumaA, lumaB));
-                    const Interval aValue(linearSample(aAccess, conversionFormat[3], filteringFormat[3], addressModeU,
-                                                       addressModeV, IVec2(i, j), lumaA, lumaB));
+                        const Interval gValue(linearSample(gChannel, filteringFormat[1], IVec2(i, j), lumaA, lumaB));
+                        const Interval aValue(linearSample(aChannel, filteringFormat[3], IVec2(i, j), lumaA, lumaB));
 
-                    if (explicitReconstruction || !(subsampledX || subsampledY))
-                    {
-                        Interval rValue, bValue;
-                        if (chromaFilter == vk::VK_FILTER_NEAREST || !subsampledX)
+                        if (explicitReconstruction || !(subsampledX || subsampledY))
                         {
-                            rValue = linearInterpolate(
-                                filteringFormat[0], lumaA, lumaB,
-                                lookupWrapped(rAccess, conversionFormat[0], addressModeU, addressModeV,
-                                              IVec2(i / (subsampledX ? 2 : 1), j / (subsampledY ? 2 : 1))),
-                                lookupWrapped(rAccess, conversionFormat[0], addressModeU, addressModeV,
-                                              IVec2((i + 1) / (subsampledX ? 2 : 1), j / (subsampledY ? 2 : 1))),
-                                lookupWrapped(rAccess, conversionFormat[0], addressModeU, addressModeV,
-                                              IVec2(i / (subsampledX ? 2 : 1), (j + 1) / (subsampledY ? 2 : 1))),
-                                lookupWrapped(rAccess, conversionFormat[0], addressModeU, addressModeV,
-                                              IVec2((i + 1) / (subsampledX ? 2 : 1), (j + 1) / (subsampledY ? 2 : 1))));
-                            bValue = linearInterpolate(
-                                filteringFormat[2], lumaA, lumaB,
-                                lookupWrapped(bAccess, conversionFormat[2], addressModeU, addressModeV,
-                                              IVec2(i / (subsampledX ? 2 : 1), j / (subsampledY ? 2 : 1))),
-                                lookupWrapped(bAccess, conversionFormat[2], addressModeU, addressModeV,
-                                              IVec2((i + 1) / (subsampledX ? 2 : 1), j / (subsampledY ? 2 : 1))),
-                                lookupWrapped(bAccess, conversionFormat[2], addressModeU, addressModeV,
-                                              IVec2(i / (subsampledX ? 2 : 1), (j + 1) / (subsampledY ? 2 : 1))),
-                                lookupWrapped(bAccess, conversionFormat[2], addressModeU, addressModeV,
-                                              IVec2((i + 1) / (subsampledX ? 2 : 1), (j + 1) / (subsampledY ? 2 : 1))));
-                        }
-                        else // vk::VK_FILTER_LINEAR
-                        {
-                            if (subsampledY)
+                            Interval rValue, bValue;
+                            if (chromaFilter == vk::VK_FILTER_NEAREST || !subsampledX)
                             {
-                                // Linear, Reconstructed xx chroma samples with explicit linear filtering
-                                rValue = linearInterpolate(
-                                    filteringFormat[0], lumaA, lumaB,
-                                    reconstructLinearXYChromaSample(filteringFormat[0], conversionFormat[0],
-                                                                    xChromaOffset, yChromaOffset, addressModeU,
-                                                                    addressModeV, rAccess, i, j),
-                                    reconstructLinearXYChromaSample(filteringFormat[0], conversionFormat[0],
-                                                                    xChromaOffset, yChromaOffset, addressModeU,
-                                                                    addressModeV, rAccess, i + 1, j),
-                                    reconstructLinearXYChromaSample(filteringFormat[0], conversionFormat[0],
-                                                                    xChromaOffset, yChromaOffset, addressModeU,
-                                                                    addressModeV, rAccess, i, j + 1),
-                                    reconstructLinearXYChromaSample(filteringFormat[0], conversionFormat[0],
-                                                                    xChromaOffset, yChromaOffset, addressModeU,
-                                                                    addressModeV, rAccess, i + 1, j + 1));
-                                bValue = linearInterpolate(
-                                    filteringFormat[2], lumaA, lumaB,
-                                    reconstructLinearXYChromaSample(filteringFormat[2], conversionFormat[2],
-                                                                    xChromaOffset, yChromaOffset, addressModeU,
-                                                                    addressModeV, bAccess, i, j),
-                                    reconstructLinearXYChromaSample(filteringFormat[2], conversionFormat[2],
-                                                                    xChromaOffset, yChromaOffset, addressModeU,
-                                                                    addressModeV, bAccess, i + 1, j),
-                                    reconstructLinearXYChromaSample(filteringFormat[2], conversionFormat[2],
-                                                                    xChromaOffset, yChromaOffset, addressModeU,
-                                                                    addressModeV, bAccess, i, j + 1),
-                                    reconstructLinearXYChromaSample(filteringFormat[2], conversionFormat[2],
-                                                                    xChromaOffset, yChromaOffset, addressModeU,
-                                                                    addressModeV, bAccess, i + 1, j + 1));
+                                const int subI0 = i / (subsampledX ? 2 : 1);
+                                const int subI1 = (i + 1) / (subsampledX ? 2 : 1);
+                                const int subJ0 = j / (subsampledY ? 2 : 1);
+                                const int subJ1 = (j + 1) / (subsampledY ? 2 : 1);
+
+                                rValue = linearInterpolate(filteringFormat[0], lumaA, lumaB,
+                                                           rChannel.lookupWrapped(IVec2(subI0, subJ0)),
+                                                           rChannel.lookupWrapped(IVec2(subI1, subJ0)),
+                                                           rChannel.lookupWrapped(IVec2(subI0, subJ1)),
+                                                           rChannel.lookupWrapped(IVec2(subI1, subJ1)));
+                                bValue = linearInterpolate(filteringFormat[2], lumaA, lumaB,
+                                                           bChannel.lookupWrapped(IVec2(subI0, subJ0)),
+                                                           bChannel.lookupWrapped(IVec2(subI1, subJ0)),
+                                                           bChannel.lookupWrapped(IVec2(subI0, subJ1)),
+                                                           bChannel.lookupWrapped(IVec2(subI1, subJ1)));
                             }
-                            else
+                            else // vk::VK_FILTER_LINEAR
                             {
-                                // Linear, Reconstructed x chroma samples with explicit linear filtering
-                                rValue = linearInterpolate(
-                                    filteringFormat[0], lumaA, lumaB,
-                                    reconstructLinearXChromaSample(filteringFormat[0], conversionFormat[0],
-                                                                   xChromaOffset, addressModeU, addressModeV, rAccess,
-                                                                   i, j),
-                                    reconstructLinearXChromaSample(filteringFormat[0], conversionFormat[0],
-                                                                   xChromaOffset, addressModeU, addressModeV, rAccess,
-                                                                   i + 1, j),
-                                    reconstructLinearXChromaSample(filteringFormat[0], conversionFormat[0],
-                                                                   xChromaOffset, addressModeU, addressModeV, rAccess,
-                                                                   i, j + 1),
-                                    reconstructLinearXChromaSample(filteringFormat[0], conversionFormat[0],
-                                                                   xChromaOffset, addressModeU, addressModeV, rAccess,
-                                                                   i + 1, j + 1));
-                                bValue = linearInterpolate(
-                                    filteringFormat[2], lumaA, lumaB,
-                                    reconstructLinearXChromaSample(filteringFormat[2], conversionFormat[2],
-                                                                   xChromaOffset, addressModeU, addressModeV, bAccess,
-                                                                   i, j),
-                                    reconstructLinearXChromaSample(filteringFormat[2], conversionFormat[2],
-                                                                   xChromaOffset, addressModeU, addressModeV, bAccess,
-                                                                   i + 1, j),
-                                    reconstructLinearXChromaSample(filteringFormat[2], conversionFormat[2],
-                                                                   xChromaOffset, addressModeU, addressModeV, bAccess,
-                                                                   i, j + 1),
-                                    reconstructLinearXChromaSample(filteringFormat[2], conversionFormat[2],
-                                                                   xChromaOffset, addressModeU, addressModeV, bAccess,
-                                                                   i + 1, j + 1));
+                                // Linear, Reconstructed chroma samples with explicit linear filtering
+                                rValue = linearInterpolate(filteringFormat[0], lumaA, lumaB, rReconstructed.get(i, j),
+                                                           rReconstructed.get(i + 1, j), rReconstructed.get(i, j + 1),
+                                                           rReconstructed.get(i + 1, j + 1));
+                                bValue = linearInterpolate(filteringFormat[2], lumaA, lumaB, bReconstructed.get(i, j),
+                                                           bReconstructed.get(i + 1, j), bReconstructed.get(i, j + 1),
+                                                           bReconstructed.get(i + 1, j + 1));
                             }
-                        }
 
-                        const Interval srcColor[] = {rValue, gValue, bValue, aValue};
-                        Interval dstColor[4];
+                            const Interval srcColor[] = {rValue, gValue, bValue, aValue};
+                            Interval dstColor[4];
 
-                        convertColor(colorModel, range, conversionFormat, bitDepth, srcColor, dstColor);
+                            convertColor(colorModel, range, conversionFormat, bitDepth, srcColor, dstColor);
 
-                        for (size_t compNdx = 0; compNdx < 4; compNdx++)
-                            bounds[compNdx] |= highp.roundOut(dstColor[compNdx], false);
-                    }
-                    else
-                    {
-                        const Interval chromaU(subsampledX ? calculateImplicitChromaUV(coordFormat, xChromaOffset, u) :
-                                                             u);
-                        const Interval chromaV(subsampledY ? calculateImplicitChromaUV(coordFormat, yChromaOffset, v) :
-                                                             v);
-
-                        // TODO: It looks incorrect to ignore the chroma filter here. Is it?
-                        const IVec2 chromaIRange(calculateNearestIJRange(coordFormat, chromaU));
-                        const IVec2 chromaJRange(calculateNearestIJRange(coordFormat, chromaV));
+                            for (size_t compNdx = 0; compNdx < 4; compNdx++)
+                                bounds[compNdx] |= highp.roundOut(dstColor[compNdx], false);
+                        }
+                        else
+                        {
+                            const Interval chromaU(
+                                subsampledX ? calculateImplicitChromaUV(coordFormat, xChromaOffset, u) : u);
+                            const Interval chromaV(
+                                subsampledY ? calculateImplicitChromaUV(coordFormat, yChromaOffset, v) : v);
 
-                        for (int chromaJ = chromaJRange.x(); chromaJ <= chromaJRange.y(); chromaJ++)
-                            for (int chromaI = chromaIRange.x(); chromaI <= chromaIRange.y(); chromaI++)
-                            {
-                                Interval rValue, bValue;
+                            // TODO: It looks incorrect to ignore the chroma filter here. Is it?
+                            const IVec2 chromaIRange(calculateNearestIJRange(coordFormat, chromaU));
+                            const IVec2 chromaJRange(calculateNearestIJRange(coordFormat, chromaV));
 
-                                if (chromaFilter == vk::VK_FILTER_NEAREST)
-                                {
-                                    rValue = lookupWrapped(rAccess, conversionFormat[1], addressModeU, addressModeV,
-                                                           IVec2(chromaI, chromaJ));
-                                    bValue = lookupWrapped(bAccess, conversionFormat[3], addressModeU, addressModeV,
-                                                           IVec2(chromaI, chromaJ));
-                                }
-                                else // vk::VK_FILTER_LINEAR
+                            for (int chromaJ = chromaJRange.x(); chromaJ <= chromaJRange.y(); chromaJ++)
+                                for (int chromaI = chromaIRange.x(); chromaI <= chromaIRange.y(); chromaI++)
                                 {
-                                    const Interval chromaA(calculateAB(subTexelPrecisionBits, chromaU, chromaI));
-                                    const Interval chromaB(calculateAB(subTexelPrecisionBits, chromaV, chromaJ));
-
-                                    rValue =
-                                        linearSample(rAccess, conversionFormat[0], filteringFormat[0], addressModeU,
-                                                     addressModeV, IVec2(chromaI, chromaJ), chromaA, chromaB);
-                                    bValue =
-                                        linearSample(bAccess, conversionFormat[2], filteringFormat[2], addressModeU,
-                                                     addressModeV, IVec2(chromaI, chromaJ), chromaA, chromaB);
+                                    Interval rValue, bValue;
+
+                                    if (chromaFilter == vk::VK_FILTER_NEAREST)
+                                    {
+                                        rValue = rLumaPrecisionChannel->lookupWrapped(IVec2(chromaI, chromaJ));
+                                        bValue = bLumaPrecisionChannel->lookupWrapped(IVec2(chromaI, chromaJ));
+                                    }
+                                    else // vk::VK_FILTER_LINEAR
+                                    {
+                                        const Interval chromaA(calculateAB(subTexelPrecisionBits, chromaU, chromaI));
+                                        const Interval chromaB(calculateAB(subTexelPrecisionBits, chromaV, chromaJ));
+
+                                        rValue = linearSample(rChannel, filteringFormat[0], IVec2(chromaI, chromaJ),
+                                                              chromaA, chromaB);
+                                        bValue = linearSample(bChannel, filteringFormat[2], IVec2(chromaI, chromaJ),
+                                                              chromaA, chromaB);
+                                    }
+
+                                    const Interval srcColor[] = {rValue, gValue, bValue, aValue};
+                                    Interval dstColor[4];
+                                    convertColor(colorModel, range, conversionFormat, bitDepth, srcColor, dstColor);
+
+                                    for (size_t compNdx = 0; compNdx < 4; compNdx++)
+                                        bounds[compNdx] |= highp.roundOut(dstColor[compNdx], false);
                                 }
-
-                                const Interval srcColor[] = {rValue, gValue, bValue, aValue};
-                                Interval dstColor[4];
-                                convertColor(colorModel, range, conversionFormat, bitDepth, srcColor, dstColor);
-
-                                for (size_t compNdx = 0; compNdx < 4; compNdx++)
-                                    bounds[compNdx] |= highp.roundOut(dstColor[compNdx], false);
-                            }
+                        }
                     }
                 }
-            }
 
-        minBounds[ndx] =
-            Vec4((float)bounds[0].lo(), (float)bounds[1].lo(), (float)bounds[2].lo(), (float)bounds[3].lo());
-        maxBounds[ndx] =
-            Vec4((float)bounds[0].hi(), (float)bounds[1].hi(), (float)bounds[2].hi(), (float)bounds[3].hi());
-    }
+            minBounds[ndx] =
+                Vec4((float)bounds[0].lo(), (float)bounds[1].lo(), (float)bounds[2].lo(), (float)bounds[3].lo());
+            maxBounds[ndx] =
+                Vec4((float)bounds[0].hi(), (float)bounds[1].hi(), (float)bounds[2].hi(), (float)bounds[3].hi());
+        }
+    };
+
+    de::parallelFor(0, sts.size(), 0, calculateBatchBounds);
 }
 
 } // namespace ycbcr
@@ -30,6 +30,7 @@
 
 #include "deSocket.hpp"
 #include "deCommandLine.hpp"
+#include "deTaskScheduler.hpp"
 
 using namespace vksc_server;
 
@@ -43,6 +44,7 @@ DE_DECLARE_COMMAND_LINE_OPT(PipelineCompilerDataDir, std::string);
 DE_DECLARE_COMMAND_LINE_OPT(PipelineCompilerOutputFile, std::string);
 DE_DECLARE_COMMAND_LINE_OPT(PipelineCompilerLogFile, std::string);
 DE_DECLARE_COMMAND_LINE_OPT(PipelineCompilerArgs, std::string);
+DE_DECLARE_COMMAND_LINE_OPT(CompileCacheDir, std::string);
 
 const auto DefaultPortStr = std::to_string(DefaultPort);
 
@@ -58,6 +60,7 @@ void registerOptions(de::cmdline::Parser &parser)
     parser << Option<PipelineCompilerOutputFile>(DE_NULL, "pipeline-file", "Output file with pipeline cache", "");
     parser << Option<PipelineCompilerLogFile>(DE_NULL, "pipeline-log", "Compiler log file", "compiler.log");
     parser << Option<PipelineCompilerArgs>(DE_NULL, "pipeline-args", "Additional compiler parameters", "");
+    parser << Option<CompileCacheDir>(DE_NULL, "compile-cache-dir", "Directory for persistent shader binary cache", "");
 }
 
 } // namespace opt
@@ -121,6 +124,8 @@ int main(int argc, char **argv)
 
     std::atomic<bool> appActive{true};
 
+    SetCompileCacheDirectory(cmdLine.getOption<opt::CompileCacheDir>());
+
     try
     {
         de::SocketAddress addr;
@@ -159,22 +164,23 @@ int main(int argc, char **argv)
     return EXIT_SUCCESS;
 }
 
+struct Response
+{
+    u32 type;
+    vector<u8> payload;
+};
+
 template <typename T>
-void SendResponse(Client &c, T &data)
+Response MakeResponse(T &data)
 {
-    SendPayloadWithHeader(c.socket.get(), T::Type(), Serialize(data));
+    return Response{T::Type(), Serialize(data)};
 }
 
-void ProcessPacketsOnServer(Client &client, u32 type, vector<u8> packet)
+// Process request that is answered with a response. Safe to call concurrently for one client.
+Response ProcessRequest(const Client &client, u32 type, vector<u8> &packet)
 {
     switch (type)
     {
-    case LogRequest::Type():
-    {
-        auto req = Deserialize<LogRequest>(packet);
-        std::cout << req.message;
-    }
-    break;
     case CompileShaderRequest::Type():
     {
         auto req = Deserialize<CompileShaderRequest>(packet);
@@ -185,9 +191,8 @@ void ProcessPacketsOnServer(Client &client, u32 type, vector<u8> packet)
         CompileShaderResponse res;
         res.status = ok;
         res.binary = std::move(result);
-        SendResponse(client, res);
+        return MakeResponse(res);
     }
-    break;
     case StoreContentRequest::Type():
     {
         auto req = Deserialize<StoreContentRequest>(packet);
@@ -195,9 +200,8 @@ void ProcessPacketsOnServer(Client &client, u32 type, vector<u8> packet)
 
         StoreContentResponse res;
         res.status = ok;
-        SendResponse(client, res);
+        return MakeResponse(res);
     }
-    break;
     case GetContentRequest::Type():
     {
         auto req = Deserialize<GetContentRequest>(packet);
@@ -208,18 +212,8 @@ void ProcessPacketsOnServer(Client &client, u32 type, vector<u8> packet)
         GetContentResponse res;
         res.status = ok;
         res.data   = std::move(content);
-        SendResponse(client, res);
+        return MakeResponse(res);
     }
-    break;
-    case AppendRequest::Type():
-    {
-        auto req = Deserialize<AppendRequest>(packet);
-
-        bool result = AppendFile(req.fileName, req.data, req.clear);
-        if (!result)
-            Log("[WARNING] Can't append file", req.fileName);
-    }
-    break;
     case CreateCacheRequest::Type():
     {
         auto req = Deserialize<CreateCacheRequest>(packet);
@@ -240,15 +234,93 @@ void ProcessPacketsOnServer(Client &client, u32 type, vector<u8> packet)
         CreateCacheResponse res;
         res.status = ok;
         res.binary = std::move(binary);
-        SendResponse(client, res);
+        return MakeResponse(res);
     }
-    break;
 
     default:
         throw std::runtime_error("communication error");
     }
 }
 
+// Requests from a batch are processed by the process-wide task scheduler, which is shared
+// by all clients. Responses are sent in request order as soon as each of them is ready, so
+// the client can start consuming results while later requests are still being processed.
+void ProcessBatch(Client &client, BatchRequest &batch)
+{
+    const msize count = batch.requests.size();
+
+    if (batch.types.size() != count)
+        throw std::runtime_error("communication error");
+
+    vector<std::promise<Response>> promises(count);
+    vector<std::future<Response>> responses;
+
+    for (auto &promise : promises)
+        responses.push_back(promise.get_future());
+
+    {
+        // Pending tasks are waited for when leaving this scope, also if sending fails
+        de::TaskGroup group(de::TaskScheduler::getInstance());
+
+        for (msize i{}; i < count; ++i)
+        {
+            group.run(
+                [&, i]()
+                {
+                    try
+                    {
+                        promises[i].set_value(ProcessRequest(client, batch.types[i], batch.requests[i]));
+                    }
+                    catch (...)
+                    {
+                        promises[i].set_exception(std::current_exception());
+                    }
+                });
+        }
+
+        for (auto &response : responses)
+        {
+            Response res = response.get();
+            SendPayloadWithHeader(client.socket.get(), res.type, res.payload);
+        }
+    }
+}
+
+void ProcessPacketsOnServer(Client &client, u32 type, vector<u8> packet)
+{
+    switch (type)
+    {
+    case LogRequest::Type():
+    {
+        auto req = Deserialize<LogRequest>(packet);
+        std::cout << req.message;
+    }
+    break;
+    case AppendRequest::Type():
+    {
+        auto req = Deserialize<AppendRequest>(packet);
+
+        bool result = AppendFile(req.fileName, req.data, req.clear);
+        if (!result)
+            Log("[WARNING] Can't append file", req.fileName);
+    }
+    break;
+    case BatchRequest::Type():
+    {
+        auto req = Deserialize<BatchRequest>(packet);
+        ProcessBatch(client, req);
+    }
+    break;
+
+    default:
+    {
+        Response res = ProcessRequest(client, type, packet);
+        SendPayloadWithHeader(client.socket.get(), res.type, res.payload);
+    }
+    break;
+    }
+}
+
 struct PacketsLoop
 {
     Client client;
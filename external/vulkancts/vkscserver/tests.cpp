@@ -182,11 +182,47 @@ void RunCompileShaderTests(Server &server)
     }
 }
 
+void RunBatchTests(Server &server)
+{
+    {
+        vector<StoreContentRequest> requests(4);
+        for (msize i{}; i < requests.size(); ++i)
+        {
+            requests[i].name = "@batch" + std::to_string(i);
+            requests[i].data = {static_cast<u8>(i), static_cast<u8>(i + 1)};
+        }
+        vector<StoreContentResponse> responses;
+        server.SendRequests(requests, responses);
+
+        Except("responses.size()", responses.size(), requests.size(),
+               "After sending a batch of requests we should receive one response per request");
+        for (auto &response : responses)
+            Except("StoreContentResponse::status", response.status, true,
+                   "Every request from a batch should be processed successfully");
+    }
+
+    {
+        vector<GetContentRequest> requests(4);
+        for (msize i{}; i < requests.size(); ++i)
+        {
+            requests[i].path        = "@batch" + std::to_string(i);
+            requests[i].removeAfter = true;
+        }
+        vector<GetContentResponse> responses;
+        server.SendRequests(requests, responses);
+
+        for (msize i{}; i < responses.size(); ++i)
+            Except("GetContentResponse::data", responses[i].data, {static_cast<u8>(i), static_cast<u8>(i + 1)},
+                   "Responses from a batch must come back in request order");
+    }
+}
+
 void RunTests(Server &server)
 {
     RunStoreContentTests(server);
     RunGetContentTests(server);
     RunCompileShaderTests(server);
+    RunBatchTests(server);
 
     std::cout << "All tests passed" << std::endl;
 }
@@ -65,6 +65,28 @@ public:
         std::lock_guard<std::mutex> lock(mutex);
         SendPayloadWithHeader(&socket, REQUEST::Type(), Serialize(request));
     }
+
+    // Send all requests in one batch and collect responses as the server streams them back
+    template <typename REQUEST, typename RESPONSE>
+    void SendRequests(vector<REQUEST> &requests, vector<RESPONSE> &responses)
+    {
+        BatchRequest batch;
+        for (auto &request : requests)
+        {
+            batch.types.push_back(REQUEST::Type());
+            batch.requests.push_back(Serialize(request));
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        SendPayloadWithHeader(&socket, BatchRequest::Type(), Serialize(batch));
+
+        responses.clear();
+        for (msize i{}; i < requests.size(); ++i)
+        {
+            vector<u8> packet = RecvPacket(&socket, recvb, RESPONSE::Type());
+            responses.push_back(Deserialize<RESPONSE>(packet));
+        }
+    }
 };
 
 inline std::unique_ptr<Server> &StandardOutputServerSingleton()
@@ -107,18 +107,20 @@ vector<u8> RecvPacket(de::Socket *socket, vector<u8> &recvb, u32 type)
     bool result = false;
     vector<u8> packet;
 
-    while (socket->isConnected() && !result)
+    auto interpret = [&](u32 classHash, vector<u8> bufferData)
     {
-        RecvSome(socket, recvb);
+        if (classHash != type)
+            throw std::runtime_error("Unexpected packet type received");
+        packet = std::move(bufferData);
+        result = true;
+    };
 
-        auto interpret = [&](u32 classHash, vector<u8> bufferData)
-        {
-            if (classHash != type)
-                throw std::runtime_error("Unexpected packet type received");
-            packet = std::move(bufferData);
-            result = true;
-        };
+    // Pipelined responses may have already arrived with the previous packet
+    ProccessNetworkData(recvb, interpret);
 
+    while (socket->isConnected() && !result)
+    {
+        RecvSome(socket, recvb);
         ProccessNetworkData(recvb, interpret);
     }
 
@@ -198,6 +198,25 @@ struct LogRequest
     }
 };
 
+// Several serialized requests sent in one packet. Server processes them concurrently
+// and sends back one ordinary response packet per request, in request order.
+struct BatchRequest
+{
+    vector<u32> types;
+    vector<vector<u8>> requests;
+
+    static constexpr u32 Type()
+    {
+        return 10;
+    }
+
+    template <typename TYPE>
+    void Serialize(Serializer<TYPE> &archive)
+    {
+        archive.Serialize(types, requests);
+    }
+};
+
 } // namespace vksc_server
 
 #endif // _VKSPROTOCOL_HPP
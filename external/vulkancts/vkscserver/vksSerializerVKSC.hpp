@@ -124,18 +124,25 @@ inline void SerializeItem(Serializer<ToWrite> &serializer, vk::VkDeviceObjectRes
     serializer.Serialize(output);
 }
 
+// Pipeline identifiers are transmitted with every captured pipeline and pipeline size,
+// so they are written field by field instead of as JSON. pNext is not transmitted.
 inline void SerializeItem(Serializer<ToRead> &serializer, vk::VkPipelineOfflineCreateInfo &v)
 {
-    string input;
-    serializer.Serialize(input);
-    json::Context ctx;
-    json::readJSON_VkPipelineOfflineCreateInfo(ctx, input, v);
+    u32 matchControl;
+
+    v.sType = vk::VK_STRUCTURE_TYPE_PIPELINE_OFFLINE_CREATE_INFO;
+    v.pNext = DE_NULL;
+    serializer.SerializeRawData(v.pipelineIdentifier, VK_UUID_SIZE);
+    serializer.Serialize(matchControl, v.poolEntrySize);
+    v.matchControl = static_cast<vk::VkPipelineMatchControl>(matchControl);
 }
 
 inline void SerializeItem(Serializer<ToWrite> &serializer, vk::VkPipelineOfflineCreateInfo &v)
 {
-    string output = json::writeJSON_VkPipelineOfflineCreateInfo(v);
-    serializer.Serialize(output);
+    u32 matchControl = static_cast<u32>(v.matchControl);
+
+    serializer.SerializeRawData(v.pipelineIdentifier, VK_UUID_SIZE);
+    serializer.Serialize(matchControl, v.poolEntrySize);
 }
 
 inline void SerializeItem(Serializer<ToRead> &serializer, vk::VkPhysicalDeviceFeatures2 &v)
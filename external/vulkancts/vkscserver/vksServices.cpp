@@ -23,12 +23,18 @@
 #include "vksCacheBuilder.hpp"
 #include "vksStore.hpp"
 
+#include <deque>
 #include <map>
 #include <mutex>
+#include <future>
 #include <fstream>
 #include <iostream>
 
 #include "deUniquePtr.hpp"
+#include "deFile.h"
+#include "deMemory.h"
+#include "deSha1.h"
+#include "qpInfo.h"
 #include "vkPrograms.hpp"
 #include "vkPlatform.hpp"
 #include "vkDeviceUtil.hpp"
@@ -120,7 +126,7 @@ void CreateVulkanSCCache(const VulkanPipelineCacheInput &input, int caseFraction
     }
 }
 
-bool CompileShader(const SourceVariant &source, const string &commandLine, vector<u8> &binary)
+bool CompileShaderUncached(const SourceVariant &source, const string &commandLine, vector<u8> &binary)
 {
     glu::ShaderProgramInfo programInfo;
     vk::SpirVProgramInfo programInfoSpirv;
@@ -152,6 +158,177 @@ bool CompileShader(const SourceVariant &source, const string &commandLine, vecto
     return true;
 }
 
+// Content-addressed cache of compiled shaders. Binaries are keyed by SHA-1 of the serialized
+// source (including build options), command line, server build and compiler versions, so identical
+// requests coming from different subprocesses are compiled only once. Requests for a binary that is
+// still being compiled wait for that compilation. Failed compilations are not cached, and the oldest
+// binaries are dropped from memory when their total size exceeds MaxMemorySize. When a directory is
+// set, binaries are also persisted there between server runs.
+class CompileCache
+{
+public:
+    void SetDirectory(const string &directory)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        cacheDirectory = directory;
+    }
+
+    bool Compile(const SourceVariant &source, const string &commandLine, vector<u8> &binary);
+
+private:
+    struct Result
+    {
+        bool status{};
+        vector<u8> binary;
+    };
+
+    static const size_t MaxMemorySize = 256u * 1024u * 1024u;
+
+    static string ComputeKey(const SourceVariant &source, const string &commandLine);
+    static bool LoadBinary(const string &path, vector<u8> &binary);
+
+    void Complete(const string &key, const Result *result);
+
+    std::mutex mutex;
+    string cacheDirectory;
+    std::map<string, std::shared_future<Result>> entries;
+    std::deque<std::pair<string, size_t>> completed; //!< Cached binaries and their sizes, oldest first.
+    size_t completedSize{};
+};
+
+string CompileCache::ComputeKey(const SourceVariant &source, const string &commandLine)
+{
+    vector<u8> data;
+    Serializer<ToWrite> serializer{data};
+
+    // Writing does not modify the source
+    serializer.SerializeObject(const_cast<SourceVariant &>(source));
+    serializer.Serialize(commandLine);
+
+    // Binaries persisted by another server build or with other compiler versions must not be reused
+    serializer.Serialize(string(qpGetReleaseName()));
+    serializer.Serialize(qpGetReleaseId());
+    serializer.Serialize(string(qpGetReleaseGlslName()));
+    serializer.Serialize(string(qpGetReleaseSpirvToolsName()));
+    serializer.Serialize(string(qpGetReleaseSpirvHeadersName()));
+
+    deSha1 hash;
+    char text[40];
+    deSha1_compute(&hash, data.size(), data.data());
+    deSha1_render(&hash, text);
+
+    return string(text, sizeof(text));
+}
+
+bool CompileCache::LoadBinary(const string &path, vector<u8> &binary)
+{
+    const u32 spirvMagic = 0x07230203u;
+    u32 magic            = 0;
+
+    if (!LoadPhysicalFile(path, binary))
+        return false;
+
+    // Anything that does not look like SPIR-V is recompiled and overwritten
+    if (binary.size() < sizeof(magic) || binary.size() % sizeof(u32) != 0)
+        return false;
+
+    deMemcpy(&magic, binary.data(), sizeof(magic));
+    return magic == spirvMagic;
+}
+
+bool CompileCache::Compile(const SourceVariant &source, const string &commandLine, vector<u8> &binary)
+{
+    const string key = ComputeKey(source, commandLine);
+    std::promise<Result> promise;
+    std::shared_future<Result> future;
+    string directory;
+    bool compileHere = false;
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        auto it = entries.find(key);
+        if (it != entries.end())
+        {
+            future = it->second;
+        }
+        else
+        {
+            future = promise.get_future().share();
+            entries.emplace(key, future);
+            directory   = cacheDirectory;
+            compileHere = true;
+        }
+    }
+
+    if (compileHere)
+    {
+        try
+        {
+            const string path = directory.empty() ? string() : directory + "/" + key + ".spv";
+            Result result;
+
+            if (!path.empty() && LoadBinary(path, result.binary))
+            {
+                result.status = true;
+            }
+            else
+            {
+                result.binary.clear();
+                result.status = CompileShaderUncached(source, commandLine, result.binary);
+                if (result.status && !path.empty())
+                    deWriteFileAtomic(path.c_str(), result.binary.data(), result.binary.size());
+            }
+
+            promise.set_value(std::move(result));
+            Complete(key, &future.get());
+        }
+        catch (...)
+        {
+            promise.set_exception(std::current_exception());
+            Complete(key, nullptr);
+        }
+    }
+
+    const Result &result = future.get();
+    binary               = result.binary;
+    return result.status;
+}
+
+void CompileCache::Complete(const string &key, const Result *result)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // Failures are retried by later requests; waiting requests still hold the future.
+    if (result == nullptr || !result->status)
+    {
+        entries.erase(key);
+        return;
+    }
+
+    completed.emplace_back(key, result->binary.size());
+    completedSize += result->binary.size();
+
+    while (completedSize > MaxMemorySize && !completed.empty())
+    {
+        entries.erase(completed.front().first);
+        completedSize -= completed.front().second;
+        completed.pop_front();
+    }
+}
+
+CompileCache ServiceCompileCache;
+
+void SetCompileCacheDirectory(const string &directory)
+{
+    ServiceCompileCache.SetDirectory(directory);
+}
+
+bool CompileShader(const SourceVariant &source, const string &commandLine, vector<u8> &binary)
+{
+    return ServiceCompileCache.Compile(source, commandLine, binary);
+}
+
 } // namespace vksc_server
 
 VkscServer *createServerVKSC(const std::string &logFile)
@@ -34,6 +34,9 @@ void CreateVulkanSCCache(const VulkanPipelineCacheInput &input, int caseFraction
                          const CmdLineParams &cmdLineParams, const std::string &logFile);
 bool CompileShader(const SourceVariant &source, const string &commandLine, vector<u8> &binary);
 
+// Persist compiled shader binaries in directory (empty = in-memory cache only)
+void SetCompileCacheDirectory(const string &directory);
+
 } // namespace vksc_server
 
 #endif // _VKSSERVICES_HPP
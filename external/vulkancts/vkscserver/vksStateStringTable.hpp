@@ -0,0 +1,92 @@
+#ifndef _VKSSTATESTRINGTABLE_HPP
+#define _VKSSTATESTRINGTABLE_HPP
+
+/*-------------------------------------------------------------------------
+ * Vulkan CTS Framework
+ * --------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *-------------------------------------------------------------------------*/
+
+#include "vksSerializer.hpp"
+
+#include <map>
+#include <unordered_map>
+
+namespace vksc_server
+{
+
+// Captured states are JSON texts that repeat a lot: most pipelines share the same device
+// features and tests create identical shader modules, render passes and layouts over and
+// over. VulkanPipelineCacheInput is therefore serialized as a table of unique texts
+// followed by the objects, which refer to their texts by index into the table.
+//
+// The table only keeps pointers to the added strings, which must outlive it.
+class StateStringTable
+{
+public:
+    u32 add(const string &str)
+    {
+        const size_t hash = std::hash<string>{}(str);
+        auto range        = m_indices.equal_range(hash);
+
+        for (auto it = range.first; it != range.second; ++it)
+            if (*m_strings[it->second] == str)
+                return it->second;
+
+        const u32 index = static_cast<u32>(m_strings.size());
+        m_strings.push_back(&str);
+        m_indices.insert({hash, index});
+        return index;
+    }
+
+    template <typename K>
+    std::map<K, u32> add(const std::map<K, string> &objects)
+    {
+        std::map<K, u32> result;
+        for (auto &&object : objects)
+            result.insert(result.end(), {object.first, add(object.second)});
+        return result;
+    }
+
+    void write(Serializer<ToWrite> &serializer) const
+    {
+        SerializeSize(serializer, m_strings.size());
+        for (auto &&str : m_strings)
+            SerializeItem(serializer, *str);
+    }
+
+private:
+    vector<const string *> m_strings;
+    std::unordered_multimap<size_t, u32> m_indices;
+};
+
+template <typename K>
+inline void ResolveStateStrings(const vector<string> &table, const std::map<K, u32> &indices,
+                                std::map<K, string> &objects)
+{
+    objects.clear();
+    for (auto &&index : indices)
+    {
+        if (index.second >= table.size())
+            throw std::runtime_error("ResolveStateStrings() invalid string index");
+        objects.insert(objects.end(), {index.first, table[index.second]});
+    }
+}
+
+} // namespace vksc_server
+
+#endif // _VKSSTATESTRINGTABLE_HPP
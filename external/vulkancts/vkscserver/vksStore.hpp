@@ -29,19 +29,22 @@
 namespace vksc_server
 {
 
+// File map split into independently locked shards, so that concurrent
+// clients storing or fetching different files do not serialize on one mutex.
 struct Store
 {
     bool Get(const string &path, vector<u8> &content, bool removeAfter)
     {
-        std::lock_guard<std::mutex> lock(FileMapMutex);
+        Shard &shard = GetShard(path);
+        std::lock_guard<std::mutex> lock(shard.FileMapMutex);
 
-        auto it = FileMap.find(path);
-        if (it != FileMap.end())
+        auto it = shard.FileMap.find(path);
+        if (it != shard.FileMap.end())
         {
             if (removeAfter)
             {
                 content = std::move(it->second);
-                FileMap.erase(it);
+                shard.FileMap.erase(it);
             }
             else
             {
@@ -54,14 +57,27 @@ struct Store
 
     bool Set(const string &uniqueFilename, const vector<u8> &content)
     {
-        std::lock_guard<std::mutex> lock(FileMapMutex);
-        FileMap[uniqueFilename] = std::move(content);
+        Shard &shard = GetShard(uniqueFilename);
+        std::lock_guard<std::mutex> lock(shard.FileMapMutex);
+        shard.FileMap[uniqueFilename] = content;
         return true;
     }
 
 private:
-    std::map<string, vector<u8>> FileMap;
-    std::mutex FileMapMutex;
+    static constexpr msize NumShards = 16;
+
+    struct Shard
+    {
+        std::map<string, vector<u8>> FileMap;
+        std::mutex FileMapMutex;
+    };
+
+    Shard &GetShard(const string &name)
+    {
+        return Shards[std::hash<string>{}(name) % NumShards];
+    }
+
+    Shard Shards[NumShards];
 };
 
 } // namespace vksc_server
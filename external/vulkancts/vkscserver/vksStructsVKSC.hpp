@@ -22,6 +22,7 @@
  *-------------------------------------------------------------------------*/
 
 #include "vksSerializerVKSC.hpp"
+#include "vksStateStringTable.hpp"
 
 namespace vksc_server
 {
@@ -155,21 +156,76 @@ struct VulkanPipelineCacheInput
     template <typename TYPE>
     void Serialize(Serializer<TYPE> &archive)
     {
-        archive.Serialize(samplerYcbcrConversions, samplers, shaderModules, renderPasses, pipelineLayouts,
-                          descriptorSetLayouts, pipelines);
+        SerializeItem(archive, *this);
     }
 };
 
 inline void SerializeItem(Serializer<ToRead> &serializer, VulkanPipelineCacheInput &v)
 {
-    serializer.Serialize(v.samplerYcbcrConversions, v.samplers, v.shaderModules, v.renderPasses, v.pipelineLayouts,
-                         v.descriptorSetLayouts, v.pipelines);
+    vector<string> table;
+    std::map<vk::VkSamplerYcbcrConversion, u32> samplerYcbcrConversions;
+    std::map<vk::VkSampler, u32> samplers;
+    std::map<vk::VkShaderModule, u32> shaderModules;
+    std::map<vk::VkRenderPass, u32> renderPasses;
+    std::map<vk::VkPipelineLayout, u32> pipelineLayouts;
+    std::map<vk::VkDescriptorSetLayout, u32> descriptorSetLayouts;
+    vector<u32> pipelineContents;
+    vector<u32> deviceFeatures;
+
+    serializer.Serialize(table, samplerYcbcrConversions, samplers, shaderModules, renderPasses, pipelineLayouts,
+                         descriptorSetLayouts, pipelineContents, deviceFeatures);
+
+    ResolveStateStrings(table, samplerYcbcrConversions, v.samplerYcbcrConversions);
+    ResolveStateStrings(table, samplers, v.samplers);
+    ResolveStateStrings(table, shaderModules, v.shaderModules);
+    ResolveStateStrings(table, renderPasses, v.renderPasses);
+    ResolveStateStrings(table, pipelineLayouts, v.pipelineLayouts);
+    ResolveStateStrings(table, descriptorSetLayouts, v.descriptorSetLayouts);
+
+    if (pipelineContents.size() != deviceFeatures.size())
+        throw std::runtime_error("SerializeItem(VulkanPipelineCacheInput) invalid pipeline count");
+
+    v.pipelines.clear();
+    v.pipelines.resize(pipelineContents.size());
+    for (msize i{}; i < v.pipelines.size(); ++i)
+    {
+        VulkanJsonPipelineDescription &pipeline = v.pipelines[i];
+
+        if (pipelineContents[i] >= table.size() || deviceFeatures[i] >= table.size())
+            throw std::runtime_error("SerializeItem(VulkanPipelineCacheInput) invalid string index");
+
+        pipeline.pipelineContents = table[pipelineContents[i]];
+        pipeline.deviceFeatures   = table[deviceFeatures[i]];
+        serializer.Serialize(pipeline.id, pipeline.deviceExtensions, pipeline.currentCount, pipeline.maxCount,
+                             pipeline.allCount, pipeline.tests);
+    }
 }
 
 inline void SerializeItem(Serializer<ToWrite> &serializer, VulkanPipelineCacheInput &v)
 {
-    serializer.Serialize(v.samplerYcbcrConversions, v.samplers, v.shaderModules, v.renderPasses, v.pipelineLayouts,
-                         v.descriptorSetLayouts, v.pipelines);
+    StateStringTable table;
+    auto samplerYcbcrConversions = table.add(v.samplerYcbcrConversions);
+    auto samplers                = table.add(v.samplers);
+    auto shaderModules           = table.add(v.shaderModules);
+    auto renderPasses            = table.add(v.renderPasses);
+    auto pipelineLayouts         = table.add(v.pipelineLayouts);
+    auto descriptorSetLayouts    = table.add(v.descriptorSetLayouts);
+    vector<u32> pipelineContents;
+    vector<u32> deviceFeatures;
+
+    for (auto &&pipeline : v.pipelines)
+    {
+        pipelineContents.push_back(table.add(pipeline.pipelineContents));
+        deviceFeatures.push_back(table.add(pipeline.deviceFeatures));
+    }
+
+    table.write(serializer);
+    serializer.Serialize(samplerYcbcrConversions, samplers, shaderModules, renderPasses, pipelineLayouts,
+                         descriptorSetLayouts, pipelineContents, deviceFeatures);
+
+    for (auto &&pipeline : v.pipelines)
+        serializer.Serialize(pipeline.id, pipeline.deviceExtensions, pipeline.currentCount, pipeline.maxCount,
+                             pipeline.allCount, pipeline.tests);
 }
 
 struct VulkanCommandMemoryConsumption
@@ -33,6 +33,7 @@
 #include "qpDebugOut.h"
 
 #include "deMath.h"
+#include "deTaskScheduler.hpp"
 
 #include <iostream>
 
@@ -156,6 +157,9 @@ App::App(Platform &platform, Archive &archive, TestLog &log, const CommandLine &
         if (cmdLine.isCrashHandlingEnabled())
             TCU_CHECK_INTERNAL(m_crashHandler = qpCrashHandler_create(onCrash, this));
 
+        // Configure shared task scheduler before anything uses it
+        de::TaskScheduler::setNumThreads(cmdLine.getWorkerThreadCount());
+
         // Create test context
         m_testCtx = new TestContext(m_platform, archive, log, cmdLine, m_watchDog);
 
@@ -0,0 +1,656 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Benchmark engine for performance cases.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuBenchmark.hpp"
+
+#include "tcuCPUWarmup.hpp"
+
+#include "deClock.h"
+#include "deMath.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_OSX) || (DE_OS == DE_OS_ANDROID) || (DE_OS == DE_OS_FUCHSIA)
+#define TCU_BENCHMARK_USE_POSIX_THREAD_TIME 1
+#include <time.h>
+#elif (DE_OS == DE_OS_WIN32)
+#define TCU_BENCHMARK_USE_WIN32_THREAD_TIME 1
+#define VC_EXTRALEAN
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+using std::vector;
+
+namespace tcu
+{
+
+namespace
+{
+
+uint64_t getThreadTimeUs(void)
+{
+#if defined(TCU_BENCHMARK_USE_POSIX_THREAD_TIME)
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+        throw InternalError("clock_gettime(CLOCK_THREAD_CPUTIME_ID) failed");
+
+    return (uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u;
+#elif defined(TCU_BENCHMARK_USE_WIN32_THREAD_TIME)
+    FILETIME creationTime;
+    FILETIME exitTime;
+    FILETIME kernelTime;
+    FILETIME userTime;
+
+    if (!GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime))
+        throw InternalError("GetThreadTimes() failed");
+
+    // FILETIME is in 100ns units.
+    return ((((uint64_t)kernelTime.dwHighDateTime << 32) | kernelTime.dwLowDateTime) +
+            (((uint64_t)userTime.dwHighDateTime << 32) | userTime.dwLowDateTime)) /
+           10u;
+#else
+    throw NotSupportedError("Thread CPU time is not supported on this platform");
+#endif
+}
+
+// Inverse of the standard normal CDF, by bisection.
+double getNormalQuantile(double p)
+{
+    double lower = -10.0;
+    double upper = 10.0;
+
+    DE_ASSERT(p > 0.0 && p < 1.0);
+
+    for (int stepNdx = 0; stepNdx < 64; stepNdx++)
+    {
+        const double mid = 0.5 * (lower + upper);
+
+        if (0.5 * std::erfc(-mid / std::sqrt(2.0)) < p)
+            lower = mid;
+        else
+            upper = mid;
+    }
+
+    return 0.5 * (lower + upper);
+}
+
+// Sample sorted values with linear interpolation at position in range [0, 1]
+float getPercentile(const vector<float> &sortedValues, float position)
+{
+    const int maxNdx     = (int)sortedValues.size() - 1;
+    const float floatNdx = (float)maxNdx * de::clamp(position, 0.0f, 1.0f);
+    const int lowerNdx   = (int)deFloatFloor(floatNdx);
+    const int higherNdx  = de::min(lowerNdx + 1, maxNdx);
+
+    DE_ASSERT(!sortedValues.empty());
+
+    return sortedValues[lowerNdx] + (sortedValues[higherNdx] - sortedValues[lowerNdx]) * (floatNdx - (float)lowerNdx);
+}
+
+// Distribution-free confidence interval of the median from order statistics.
+void getMedianConfidenceInterval(const vector<float> &sortedValues, float confidence, float &lower, float &upper)
+{
+    const int numValues   = (int)sortedValues.size();
+    const double z        = getNormalQuantile(0.5 + 0.5 * (double)confidence);
+    const double halfSize = 0.5 * z * std::sqrt((double)numValues);
+    const int lowerNdx    = de::max(0, (int)std::floor(0.5 * numValues - halfSize) - 1);
+    const int upperNdx    = de::min(numValues - 1, (int)std::ceil(1.0 + 0.5 * numValues + halfSize) - 1);
+
+    DE_ASSERT(numValues > 0);
+
+    lower = sortedValues[lowerNdx];
+    upper = sortedValues[upperNdx];
+}
+
+float getMedian(vector<float> values)
+{
+    std::sort(values.begin(), values.end());
+    return getPercentile(values, 0.5f);
+}
+
+vector<float> getSortedIterationTimes(const vector<BenchmarkSample> &samples)
+{
+    vector<float> times;
+
+    times.reserve(samples.size());
+
+    for (size_t sampleNdx = 0; sampleNdx < samples.size(); sampleNdx++)
+        times.push_back((float)samples[sampleNdx].durationUs / (float)samples[sampleNdx].numIterations);
+
+    std::sort(times.begin(), times.end());
+
+    return times;
+}
+
+} // namespace
+
+// WallClockTimingSource
+
+WallClockTimingSource::WallClockTimingSource(void) : m_beginUs(0)
+{
+}
+
+void WallClockTimingSource::begin(void)
+{
+    m_beginUs = deGetMicroseconds();
+}
+
+bool WallClockTimingSource::end(uint64_t &elapsedUs)
+{
+    elapsedUs = deGetMicroseconds() - m_beginUs;
+    return true;
+}
+
+// ThreadTimeTimingSource
+
+ThreadTimeTimingSource::ThreadTimeTimingSource(void) : m_beginUs(0)
+{
+    if (!isSupported())
+        throw NotSupportedError("Thread CPU time is not supported on this platform");
+}
+
+bool ThreadTimeTimingSource::isSupported(void)
+{
+#if defined(TCU_BENCHMARK_USE_POSIX_THREAD_TIME) || defined(TCU_BENCHMARK_USE_WIN32_THREAD_TIME)
+    return true;
+#else
+    return false;
+#endif
+}
+
+void ThreadTimeTimingSource::begin(void)
+{
+    m_beginUs = getThreadTimeUs();
+}
+
+bool ThreadTimeTimingSource::end(uint64_t &elapsedUs)
+{
+    elapsedUs = getThreadTimeUs() - m_beginUs;
+    return true;
+}
+
+// BenchmarkParameters
+
+BenchmarkParameters::BenchmarkParameters(void)
+    : initialIterations(1)
+    , maxIterations(1 << 16)
+    , targetSampleTimeUs(2000.0f)
+    , minWarmupSamples(5)
+    , maxWarmupSamples(50)
+    , steadyStateWindow(5)
+    , steadyStateThreshold(0.05f)
+    , minSamples(10)
+    , maxSamples(200)
+    , maxMeasureTimeUs(5000000.0f)
+    , targetRelativeCI(0.02f)
+    , confidence(0.95f)
+{
+}
+
+// BenchmarkEngine
+
+BenchmarkEngine::BenchmarkEngine(TimingSource &timingSource, const BenchmarkParameters &params)
+    : m_timingSource(timingSource)
+    , m_params(params)
+    , m_state(STATE_WARMUP)
+    , m_sampleStarted(false)
+    , m_iterationCount(params.initialIterations)
+    , m_numWarmupSamples(0)
+    , m_steadyStateReached(false)
+    , m_measureTimeUs(0)
+{
+    DE_ASSERT(params.initialIterations > 0 && params.initialIterations <= params.maxIterations);
+    DE_ASSERT(params.steadyStateWindow > 0);
+    DE_ASSERT(params.minSamples > 0 && params.minSamples <= params.maxSamples);
+}
+
+BenchmarkEngine::~BenchmarkEngine(void)
+{
+}
+
+int BenchmarkEngine::getIterationCount(void) const
+{
+    // Spread measured samples over 1x-2x of the calibrated count so that the per-iteration cost can be
+    // separated from the fixed per-sample overhead.
+    if (m_state == STATE_MEASURE && m_params.targetSampleTimeUs > 0.0f)
+        return m_iterationCount + (m_iterationCount * (int)(m_samples.size() % 4)) / 3;
+    else
+        return m_iterationCount;
+}
+
+void BenchmarkEngine::beginSample(void)
+{
+    DE_ASSERT(m_state != STATE_FINISHED);
+    DE_ASSERT(!m_sampleStarted);
+
+    if (m_state == STATE_WARMUP && m_numWarmupSamples == 0)
+        warmupCPU();
+
+    m_sampleStarted = true;
+    m_timingSource.begin();
+}
+
+void BenchmarkEngine::endSample(void)
+{
+    const int numIterations = getIterationCount();
+    uint64_t durationUs     = 0;
+
+    DE_ASSERT(m_sampleStarted);
+
+    m_sampleStarted = false;
+
+    if (!m_timingSource.end(durationUs))
+        return;
+
+    if (m_state == STATE_WARMUP)
+        recordWarmupSample(numIterations, durationUs);
+    else
+        recordMeasureSample(numIterations, durationUs);
+}
+
+void BenchmarkEngine::recordWarmupSample(int numIterations, uint64_t durationUs)
+{
+    const int windowSize = m_params.steadyStateWindow;
+
+    m_numWarmupSamples += 1;
+
+    if (m_numWarmupSamples >= m_params.maxWarmupSamples)
+    {
+        startMeasuring(false);
+        return;
+    }
+
+    // Grow the sample until it is long enough compared to the timer resolution. Times of shorter samples are
+    // not comparable, so steady state detection starts over.
+    if ((float)durationUs < m_params.targetSampleTimeUs && m_iterationCount < m_params.maxIterations)
+    {
+        const double scale = (double)m_params.targetSampleTimeUs / (double)de::max<uint64_t>(durationUs, 1u);
+
+        m_iterationCount = (int)de::clamp<double>(std::ceil((double)numIterations * scale), numIterations + 1,
+                                                  de::min(numIterations * 8.0, (double)m_params.maxIterations));
+        m_warmupTimes.clear();
+        return;
+    }
+
+    m_warmupTimes.push_back((float)durationUs / (float)numIterations);
+
+    if ((int)m_warmupTimes.size() > 2 * windowSize)
+        m_warmupTimes.erase(m_warmupTimes.begin());
+
+    if (m_numWarmupSamples >= m_params.minWarmupSamples && (int)m_warmupTimes.size() == 2 * windowSize)
+    {
+        const float previous = getMedian(vector<float>(m_warmupTimes.begin(), m_warmupTimes.begin() + windowSize));
+        const float current  = getMedian(vector<float>(m_warmupTimes.begin() + windowSize, m_warmupTimes.end()));
+
+        if (de::abs(current - previous) <= m_params.steadyStateThreshold * de::max(current, previous))
+            startMeasuring(true);
+    }
+}
+
+void BenchmarkEngine::startMeasuring(bool steadyStateReached)
+{
+    m_state              = STATE_MEASURE;
+    m_steadyStateReached = steadyStateReached;
+    m_warmupTimes.clear();
+}
+
+void BenchmarkEngine::recordMeasureSample(int numIterations, uint64_t durationUs)
+{
+    m_samples.push_back(BenchmarkSample(numIterations, durationUs));
+    m_measureTimeUs += durationUs;
+
+    if ((int)m_samples.size() >= m_params.maxSamples || (float)m_measureTimeUs >= m_params.maxMeasureTimeUs)
+        m_state = STATE_FINISHED;
+    else if ((int)m_samples.size() >= m_params.minSamples)
+    {
+        const vector<float> times = getSortedIterationTimes(m_samples);
+        const float median        = getPercentile(times, 0.5f);
+        float lower               = 0.0f;
+        float upper               = 0.0f;
+
+        getMedianConfidenceInterval(times, m_params.confidence, lower, upper);
+
+        if (upper - lower <= m_params.targetRelativeCI * median)
+            m_state = STATE_FINISHED;
+    }
+}
+
+BenchmarkStatistics BenchmarkEngine::computeStatistics(void) const
+{
+    const vector<float> times = getSortedIterationTimes(m_samples);
+    BenchmarkStatistics stats;
+    double sum      = 0.0;
+    double variance = 0.0;
+
+    DE_ASSERT(!m_samples.empty());
+
+    for (size_t ndx = 0; ndx < times.size(); ndx++)
+        sum += times[ndx];
+
+    stats.numSamples = (int)times.size();
+    stats.mean       = (float)(sum / (double)times.size());
+
+    for (size_t ndx = 0; ndx < times.size(); ndx++)
+        variance += ((double)times[ndx] - stats.mean) * ((double)times[ndx] - stats.mean);
+
+    stats.stdDev       = (float)std::sqrt(variance / (double)times.size());
+    stats.median       = getPercentile(times, 0.5f);
+    stats.min          = times.front();
+    stats.max          = times.back();
+    stats.percentile10 = getPercentile(times, 0.10f);
+    stats.percentile25 = getPercentile(times, 0.25f);
+    stats.percentile75 = getPercentile(times, 0.75f);
+    stats.percentile90 = getPercentile(times, 0.90f);
+    stats.confidence   = m_params.confidence;
+
+    getMedianConfidenceInterval(times, m_params.confidence, stats.medianConfidenceLower, stats.medianConfidenceUpper);
+
+    // Theil-Sen needs at least two different iteration counts.
+    stats.hasRegression = false;
+    stats.regression    = LineParametersWithConfidence();
+
+    for (size_t sampleNdx = 1; sampleNdx < m_samples.size(); sampleNdx++)
+    {
+        if (m_samples[sampleNdx].numIterations != m_samples[0].numIterations)
+        {
+            stats.hasRegression = true;
+            break;
+        }
+    }
+
+    if (stats.hasRegression)
+    {
+        vector<Vec2> dataPoints;
+
+        dataPoints.reserve(m_samples.size());
+
+        for (size_t sampleNdx = 0; sampleNdx < m_samples.size(); sampleNdx++)
+            dataPoints.push_back(
+                Vec2((float)m_samples[sampleNdx].numIterations, (float)m_samples[sampleNdx].durationUs));
+
+        stats.regression = theilSenSiegelLinearRegression(dataPoints, m_params.confidence);
+    }
+
+    return stats;
+}
+
+void logBenchmarkResult(TestLog &log, const std::string &name, const std::string &description,
+                        const BenchmarkEngine &engine)
+{
+    const vector<BenchmarkSample> &samples = engine.getSamples();
+    const BenchmarkStatistics stats        = engine.computeStatistics();
+
+    log << TestLog::Section(name, description);
+
+    log << TestLog::Message << "Timing source: " << engine.getTimingSource().getName() << ", "
+        << engine.getNumWarmupSamples() << " warm-up samples, steady state "
+        << (engine.isSteadyStateReached() ? "reached" : "not reached") << TestLog::EndMessage;
+
+    log << TestLog::SampleList("Samples", "Benchmark samples") << TestLog::SampleInfo
+        << TestLog::ValueInfo("Iterations", "Number of iterations", "", QP_SAMPLE_VALUE_TAG_PREDICTOR)
+        << TestLog::ValueInfo("Duration", "Duration of sample", "us", QP_SAMPLE_VALUE_TAG_RESPONSE)
+        << TestLog::EndSampleInfo;
+
+    for (size_t sampleNdx = 0; sampleNdx < samples.size(); sampleNdx++)
+        log << TestLog::Sample << samples[sampleNdx].numIterations << (int64_t)samples[sampleNdx].durationUs
+            << TestLog::EndSample;
+
+    log << TestLog::EndSampleList;
+
+    log << TestLog::Integer("NumSamples", "Number of samples", "", QP_KEY_TAG_NONE, stats.numSamples)
+        << TestLog::Float("MedianTime", "Median time per iteration", "us", QP_KEY_TAG_TIME, stats.median)
+        << TestLog::Float("MedianTimeLower", "Median time confidence interval lower bound", "us", QP_KEY_TAG_TIME,
+                          stats.medianConfidenceLower)
+        << TestLog::Float("MedianTimeUpper", "Median time confidence interval upper bound", "us", QP_KEY_TAG_TIME,
+                          stats.medianConfidenceUpper)
+        << TestLog::Float("MeanTime", "Mean time per iteration", "us", QP_KEY_TAG_TIME, stats.mean)
+        << TestLog::Float("StdDevTime", "Standard deviation of time per iteration", "us", QP_KEY_TAG_TIME,
+                          stats.stdDev)
+        << TestLog::Float("MinTime", "Minimum time per iteration", "us", QP_KEY_TAG_TIME, stats.min)
+        << TestLog::Float("Percentile10Time", "10th percentile of time per iteration", "us", QP_KEY_TAG_TIME,
+                          stats.percentile10)
+        << TestLog::Float("Percentile25Time", "25th percentile of time per iteration", "us", QP_KEY_TAG_TIME,
+                          stats.percentile25)
+        << TestLog::Float("Percentile75Time", "75th percentile of time per iteration", "us", QP_KEY_TAG_TIME,
+                          stats.percentile75)
+        << TestLog::Float("Percentile90Time", "90th percentile of time per iteration", "us", QP_KEY_TAG_TIME,
+                          stats.percentile90)
+        << TestLog::Float("MaxTime", "Maximum time per iteration", "us", QP_KEY_TAG_TIME, stats.max)
+        << TestLog::Float("Confidence", "Confidence level of the intervals", "", QP_KEY_TAG_NONE, stats.confidence);
+
+    if (stats.hasRegression)
+    {
+        log << TestLog::Float("SlopeTime", "Theil-Sen slope, time per iteration", "us", QP_KEY_TAG_TIME,
+                              stats.regression.coefficient)
+            << TestLog::Float("SlopeTimeLower", "Slope confidence interval lower bound", "us", QP_KEY_TAG_TIME,
+                              stats.regression.coefficientConfidenceLower)
+            << TestLog::Float("SlopeTimeUpper", "Slope confidence interval upper bound", "us", QP_KEY_TAG_TIME,
+                              stats.regression.coefficientConfidenceUpper)
+            << TestLog::Float("OffsetTime", "Theil-Sen offset, fixed time per sample", "us", QP_KEY_TAG_TIME,
+                              stats.regression.offset);
+    }
+
+    log << TestLog::EndSection;
+}
+
+namespace
+{
+
+// Reports scripted durations instead of measuring.
+class FixedTimingSource : public TimingSource
+{
+public:
+    FixedTimingSource(void) : m_durationUs(0)
+    {
+    }
+
+    const char *getName(void) const
+    {
+        return "Fixed";
+    }
+
+    void setDuration(uint64_t durationUs)
+    {
+        m_durationUs = durationUs;
+    }
+
+    void begin(void)
+    {
+    }
+
+    bool end(uint64_t &elapsedUs)
+    {
+        elapsedUs = m_durationUs;
+        return true;
+    }
+
+private:
+    uint64_t m_durationUs;
+};
+
+// Runs the engine until it leaves the given state, each sample taking offsetUs + iterationUs * iterations.
+void runBenchmarkUntilNot(BenchmarkEngine &engine, FixedTimingSource &timingSource, BenchmarkEngine::State state,
+                          double offsetUs, double iterationUs, double iterationUsScale)
+{
+    for (int sampleNdx = 0; engine.getState() == state; sampleNdx++)
+    {
+        TCU_CHECK(sampleNdx < 1000);
+
+        timingSource.setDuration((uint64_t)(offsetUs + iterationUs * engine.getIterationCount()));
+        engine.beginSample();
+        engine.endSample();
+
+        iterationUs *= iterationUsScale;
+    }
+}
+
+bool isNear(float value, float expected, float threshold)
+{
+    return de::abs(value - expected) <= threshold;
+}
+
+} // namespace
+
+void BenchmarkEngine_selfTest(void)
+{
+    // Percentiles interpolate linearly between sorted values.
+    {
+        const float values[] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f};
+        const vector<float> sorted(DE_ARRAY_BEGIN(values), DE_ARRAY_END(values));
+
+        TCU_CHECK(getPercentile(sorted, 0.0f) == 1.0f);
+        TCU_CHECK(getPercentile(sorted, 0.25f) == 2.0f);
+        TCU_CHECK(getPercentile(sorted, 0.5f) == 3.0f);
+        TCU_CHECK(getPercentile(sorted, 1.0f) == 5.0f);
+        TCU_CHECK(isNear(getPercentile(sorted, 0.1f), 1.4f, 1e-5f));
+        TCU_CHECK(isNear(getPercentile(sorted, 0.9f), 4.6f, 1e-5f));
+        TCU_CHECK(getPercentile(sorted, -1.0f) == 1.0f);
+        TCU_CHECK(getPercentile(sorted, 2.0f) == 5.0f);
+        TCU_CHECK(getPercentile(vector<float>(1, 7.0f), 0.5f) == 7.0f);
+        TCU_CHECK(getMedian(vector<float>(DE_ARRAY_BEGIN(values), DE_ARRAY_END(values))) == 3.0f);
+    }
+
+    // Median confidence interval uses the order statistics of the binomial approximation.
+    {
+        vector<float> sorted;
+        float lower = 0.0f;
+        float upper = 0.0f;
+
+        TCU_CHECK(isNear((float)getNormalQuantile(0.975), 1.95996f, 1e-4f));
+        TCU_CHECK(isNear((float)getNormalQuantile(0.5), 0.0f, 1e-6f));
+
+        for (int ndx = 0; ndx < 100; ndx++)
+            sorted.push_back((float)ndx);
+
+        // Ranks 40 and 61 for 100 values at 95%.
+        getMedianConfidenceInterval(sorted, 0.95f, lower, upper);
+        TCU_CHECK(lower == 39.0f && upper == 60.0f);
+
+        {
+            float wideLower = 0.0f;
+            float wideUpper = 0.0f;
+
+            getMedianConfidenceInterval(sorted, 0.99f, wideLower, wideUpper);
+            TCU_CHECK(wideLower < lower && wideUpper > upper);
+        }
+
+        // Interval is clamped to the values.
+        sorted.resize(3);
+        getMedianConfidenceInterval(sorted, 0.95f, lower, upper);
+        TCU_CHECK(lower == 0.0f && upper == 2.0f);
+
+        sorted.resize(1);
+        getMedianConfidenceInterval(sorted, 0.95f, lower, upper);
+        TCU_CHECK(lower == 0.0f && upper == 0.0f);
+    }
+
+    // Stable samples reach steady state after two full windows and finish when the interval is narrow.
+    {
+        FixedTimingSource timingSource;
+        BenchmarkParameters params;
+
+        params.targetSampleTimeUs = 0.0f;
+
+        {
+            BenchmarkEngine engine(timingSource, params);
+
+            runBenchmarkUntilNot(engine, timingSource, BenchmarkEngine::STATE_WARMUP, 0.0, 1000.0, 1.0);
+            TCU_CHECK(engine.getState() == BenchmarkEngine::STATE_MEASURE);
+            TCU_CHECK(engine.isSteadyStateReached());
+            TCU_CHECK(engine.getNumWarmupSamples() == 2 * params.steadyStateWindow);
+
+            runBenchmarkUntilNot(engine, timingSource, BenchmarkEngine::STATE_MEASURE, 0.0, 1000.0, 1.0);
+            TCU_CHECK(engine.isFinished());
+            TCU_CHECK((int)engine.getSamples().size() == params.minSamples);
+
+            {
+                const BenchmarkStatistics stats = engine.computeStatistics();
+
+                TCU_CHECK(stats.median == 1000.0f && stats.mean == 1000.0f && stats.stdDev == 0.0f);
+                TCU_CHECK(stats.medianConfidenceLower == 1000.0f && stats.medianConfidenceUpper == 1000.0f);
+                TCU_CHECK(!stats.hasRegression);
+            }
+        }
+
+        // Samples that keep getting faster never reach steady state.
+        {
+            BenchmarkEngine engine(timingSource, params);
+
+            runBenchmarkUntilNot(engine, timingSource, BenchmarkEngine::STATE_WARMUP, 0.0, 100000.0, 0.97);
+            TCU_CHECK(engine.getState() == BenchmarkEngine::STATE_MEASURE);
+            TCU_CHECK(!engine.isSteadyStateReached());
+            TCU_CHECK(engine.getNumWarmupSamples() == params.maxWarmupSamples);
+        }
+
+        // Noisy samples stop at the sample limit.
+        {
+            BenchmarkEngine engine(timingSource, params);
+            int sampleNdx = 0;
+
+            runBenchmarkUntilNot(engine, timingSource, BenchmarkEngine::STATE_WARMUP, 0.0, 1000.0, 1.0);
+
+            for (; !engine.isFinished(); sampleNdx++)
+            {
+                timingSource.setDuration((sampleNdx % 2) == 0 ? 1000u : 2000u);
+                engine.beginSample();
+                engine.endSample();
+            }
+
+            TCU_CHECK((int)engine.getSamples().size() == params.maxSamples);
+        }
+    }
+
+    // Iteration count grows to the target sample time, and the Theil-Sen fit separates the per-sample
+    // overhead from the time per iteration.
+    {
+        FixedTimingSource timingSource;
+        BenchmarkParameters params;
+
+        BenchmarkEngine engine(timingSource, params);
+
+        runBenchmarkUntilNot(engine, timingSource, BenchmarkEngine::STATE_WARMUP, 50.0, 10.0, 1.0);
+        TCU_CHECK(engine.isSteadyStateReached());
+        TCU_CHECK(50.0f + 10.0f * (float)engine.getIterationCount() >= params.targetSampleTimeUs);
+
+        runBenchmarkUntilNot(engine, timingSource, BenchmarkEngine::STATE_MEASURE, 50.0, 10.0, 1.0);
+        TCU_CHECK(engine.isFinished());
+
+        {
+            const BenchmarkStatistics stats = engine.computeStatistics();
+
+            TCU_CHECK(stats.hasRegression);
+            TCU_CHECK(isNear(stats.regression.coefficient, 10.0f, 1e-3f));
+            TCU_CHECK(isNear(stats.regression.offset, 50.0f, 1e-1f));
+            TCU_CHECK(stats.regression.coefficientConfidenceLower <= stats.regression.coefficient &&
+                      stats.regression.coefficient <= stats.regression.coefficientConfidenceUpper);
+            // Time per iteration includes the overhead share, so it is above the slope.
+            TCU_CHECK(stats.median > stats.regression.coefficient);
+        }
+    }
+}
+
+} // namespace tcu
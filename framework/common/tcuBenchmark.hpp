@@ -0,0 +1,231 @@
+#ifndef _TCUBENCHMARK_HPP
+#define _TCUBENCHMARK_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Benchmark engine for performance cases.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "tcuTestLog.hpp"
+#include "tcuLinearRegression.hpp"
+
+#include <string>
+#include <vector>
+
+namespace tcu
+{
+
+// Measures the duration of one sample.
+class TimingSource
+{
+public:
+    virtual ~TimingSource(void)
+    {
+    }
+
+    virtual const char *getName(void) const = 0;
+
+    virtual void begin(void) = 0;
+    //! Returns false if the interval was not measured reliably and the sample must be discarded.
+    virtual bool end(uint64_t &elapsedUs) = 0;
+};
+
+// Wall clock time. Includes everything, so GPU work must be waited for before end().
+class WallClockTimingSource : public TimingSource
+{
+public:
+    WallClockTimingSource(void);
+
+    const char *getName(void) const
+    {
+        return "WallClock";
+    }
+
+    void begin(void);
+    bool end(uint64_t &elapsedUs);
+
+private:
+    uint64_t m_beginUs;
+};
+
+// CPU time consumed by the calling thread. Not affected by preemption or by waiting for the GPU.
+class ThreadTimeTimingSource : public TimingSource
+{
+public:
+    ThreadTimeTimingSource(void);
+
+    static bool isSupported(void);
+
+    const char *getName(void) const
+    {
+        return "ThreadTime";
+    }
+
+    void begin(void);
+    bool end(uint64_t &elapsedUs);
+
+private:
+    uint64_t m_beginUs;
+};
+
+struct BenchmarkParameters
+{
+    BenchmarkParameters(void);
+
+    int initialIterations;      //!< Iterations per sample at start.
+    int maxIterations;          //!< Upper limit for the adaptive iteration count.
+    float targetSampleTimeUs;   //!< Iteration count is grown until one sample takes this long. Zero keeps it fixed.
+    int minWarmupSamples;       //!< Samples discarded before steady state is looked for.
+    int maxWarmupSamples;       //!< Measuring starts after this many warm-up samples even without steady state.
+    int steadyStateWindow;      //!< Number of samples in each of the two compared windows.
+    float steadyStateThreshold; //!< Maximum relative difference of the window medians in steady state.
+    int minSamples;             //!< Measured samples taken before the confidence interval is checked.
+    int maxSamples;             //!< Measuring stops after this many samples.
+    float maxMeasureTimeUs;     //!< Measuring stops after the samples have taken this long in total.
+    float targetRelativeCI;     //!< Measuring stops when the median CI width divided by the median is below this.
+    float confidence;           //!< Confidence level of the reported intervals.
+};
+
+struct BenchmarkSample
+{
+    BenchmarkSample(int numIterations_, uint64_t durationUs_) : numIterations(numIterations_), durationUs(durationUs_)
+    {
+    }
+
+    int numIterations;
+    uint64_t durationUs;
+};
+
+// Statistics of the time per iteration, in microseconds.
+struct BenchmarkStatistics
+{
+    int numSamples;
+
+    float median;
+    float mean;
+    float stdDev;
+    float min;
+    float max;
+    float percentile10;
+    float percentile25;
+    float percentile75;
+    float percentile90;
+
+    float medianConfidenceLower;
+    float medianConfidenceUpper;
+    float confidence;
+
+    bool hasRegression; //!< Set when samples were taken with different iteration counts.
+    LineParametersWithConfidence regression;
+};
+
+// Drives warm-up, iteration count calibration and sampling of one measured operation. The caller owns the
+// loop so that long measurements can be split over several iterate() calls:
+//
+//     while (!engine.isFinished())
+//     {
+//         engine.beginSample();
+//         run(engine.getIterationCount());
+//         engine.endSample();
+//     }
+class BenchmarkEngine
+{
+public:
+    enum State
+    {
+        STATE_WARMUP = 0,
+        STATE_MEASURE,
+        STATE_FINISHED,
+
+        STATE_LAST
+    };
+
+    BenchmarkEngine(TimingSource &timingSource, const BenchmarkParameters &params = BenchmarkParameters());
+    ~BenchmarkEngine(void);
+
+    State getState(void) const
+    {
+        return m_state;
+    }
+    bool isFinished(void) const
+    {
+        return m_state == STATE_FINISHED;
+    }
+
+    //! Number of iterations the next sample must run.
+    int getIterationCount(void) const;
+
+    void beginSample(void);
+    void endSample(void);
+
+    const BenchmarkParameters &getParameters(void) const
+    {
+        return m_params;
+    }
+    const TimingSource &getTimingSource(void) const
+    {
+        return m_timingSource;
+    }
+    int getNumWarmupSamples(void) const
+    {
+        return m_numWarmupSamples;
+    }
+    bool isSteadyStateReached(void) const
+    {
+        return m_steadyStateReached;
+    }
+    const std::vector<BenchmarkSample> &getSamples(void) const
+    {
+        return m_samples;
+    }
+
+    BenchmarkStatistics computeStatistics(void) const;
+
+private:
+    BenchmarkEngine(const BenchmarkEngine &);
+    BenchmarkEngine &operator=(const BenchmarkEngine &);
+
+    void recordWarmupSample(int numIterations, uint64_t durationUs);
+    void recordMeasureSample(int numIterations, uint64_t durationUs);
+    void startMeasuring(bool steadyStateReached);
+
+    TimingSource &m_timingSource;
+    const BenchmarkParameters m_params;
+
+    State m_state;
+    bool m_sampleStarted;
+    int m_iterationCount;
+    int m_numWarmupSamples;
+    bool m_steadyStateReached;
+    std::vector<float> m_warmupTimes;
+    std::vector<BenchmarkSample> m_samples;
+    uint64_t m_measureTimeUs;
+};
+
+//! Logs samples and statistics in a section of the given name.
+void logBenchmarkResult(TestLog &log, const std::string &name, const std::string &description,
+                        const BenchmarkEngine &engine);
+
+void BenchmarkEngine_selfTest(void);
+
+} // namespace tcu
+
+#endif // _TCUBENCHMARK_HPP
@@ -0,0 +1,141 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Elementary stream bitstream utilities.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuBitstreamUtil.hpp"
+#include "deInt32.h"
+#include "deRandom.hpp"
+
+#include <vector>
+
+#if (DE_CPU == DE_CPU_X86_64)
+#include <emmintrin.h>
+#elif (DE_CPU == DE_CPU_ARM_64)
+#include <arm_neon.h>
+#endif
+
+namespace tcu
+{
+
+size_t findH26XStartCode(const uint8_t *data, size_t begin, size_t end)
+{
+    // Candidate position of the 01 byte, the three zero bytes come before it.
+    size_t ndx = begin + 3;
+
+#if (DE_CPU == DE_CPU_X86_64)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i one  = _mm_set1_epi8(1);
+
+    for (; ndx + 16 <= end; ndx += 16)
+    {
+        const __m128i b0    = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + ndx));
+        const __m128i b1    = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + ndx - 1));
+        const __m128i b2    = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + ndx - 2));
+        const __m128i b3    = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + ndx - 3));
+        const __m128i zeros = _mm_and_si128(_mm_cmpeq_epi8(b1, zero),
+                                            _mm_and_si128(_mm_cmpeq_epi8(b2, zero), _mm_cmpeq_epi8(b3, zero)));
+        const int mask      = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(b0, one), zeros));
+
+        if (mask != 0)
+            return ndx + deCtz32((uint32_t)mask);
+    }
+#elif (DE_CPU == DE_CPU_ARM_64)
+    const uint8x16_t zero = vdupq_n_u8(0);
+    const uint8x16_t one  = vdupq_n_u8(1);
+
+    for (; ndx + 16 <= end; ndx += 16)
+    {
+        const uint8x16_t zeros = vandq_u8(vceqq_u8(vld1q_u8(data + ndx - 1), zero),
+                                          vandq_u8(vceqq_u8(vld1q_u8(data + ndx - 2), zero),
+                                                   vceqq_u8(vld1q_u8(data + ndx - 3), zero)));
+        const uint8x16_t match = vandq_u8(vceqq_u8(vld1q_u8(data + ndx), one), zeros);
+
+        // Leave locating the exact byte to the scalar loop below.
+        if (vmaxvq_u8(match) != 0)
+            break;
+    }
+#endif
+
+    for (; ndx < end; ndx++)
+    {
+        if (data[ndx] == 0x01 && data[ndx - 1] == 0x00 && data[ndx - 2] == 0x00 && data[ndx - 3] == 0x00)
+            return ndx;
+    }
+
+    return end;
+}
+
+namespace
+{
+
+// Byte by byte scan that the vectorized findH26XStartCode() must agree with.
+size_t findH26XStartCodeReference(const uint8_t *data, size_t begin, size_t end)
+{
+    for (size_t ndx = begin + 3; ndx < end; ndx++)
+    {
+        if (data[ndx] == 0x01 && data[ndx - 1] == 0x00 && data[ndx - 2] == 0x00 && data[ndx - 3] == 0x00)
+            return ndx;
+    }
+
+    return end;
+}
+
+} // namespace
+
+void BitstreamUtil_selfTest(void)
+{
+    // Start codes at every position relative to the scanned range and to the 16 byte vector blocks, in filler
+    // without zeros, in filler of near misses and in all zero filler. Ranges end before, inside and after each
+    // start code.
+    const size_t bufferSize = 96;
+    const size_t maxBegin   = 17;
+    de::Random rnd(0x26c0de);
+    std::vector<uint8_t> storage(bufferSize + 3);
+
+    for (size_t baseOffset = 0; baseOffset < 4; baseOffset++)
+        for (int fillNdx = 0; fillNdx < 3; fillNdx++)
+            for (size_t codeNdx = 0; codeNdx < bufferSize; codeNdx++)
+            {
+                uint8_t *const data = storage.data() + baseOffset;
+
+                for (size_t ndx = 0; ndx < bufferSize; ndx++)
+                {
+                    if (fillNdx == 0)
+                        data[ndx] = (uint8_t)rnd.getInt(1, 255);
+                    else if (fillNdx == 1)
+                        data[ndx] = (uint8_t)rnd.getInt(0, 2);
+                    else
+                        data[ndx] = 0;
+                }
+
+                for (size_t ndx = (codeNdx < 3 ? 0 : codeNdx - 3); ndx < codeNdx; ndx++)
+                    data[ndx] = 0x00;
+                data[codeNdx] = 0x01;
+
+                for (size_t begin = 0; begin <= de::min(codeNdx, maxBegin); begin++)
+                    for (size_t end = begin; end <= bufferSize; end++)
+                        TCU_CHECK(findH26XStartCode(data, begin, end) ==
+                                  findH26XStartCodeReference(data, begin, end));
+            }
+}
+
+} // namespace tcu
@@ -0,0 +1,39 @@
+#ifndef _TCUBITSTREAMUTIL_HPP
+#define _TCUBITSTREAMUTIL_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Elementary stream bitstream utilities.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+
+namespace tcu
+{
+
+// Find the first four byte start code 00 00 00 01 lying entirely in
+// data[begin, end). Returns the offset of its 01 byte, or end if none.
+size_t findH26XStartCode(const uint8_t *data, size_t begin, size_t end);
+
+void BitstreamUtil_selfTest(void);
+
+} // namespace tcu
+
+#endif // _TCUBITSTREAMUTIL_HPP
@@ -102,6 +102,12 @@ DE_DECLARE_COMMAND_LINE_OPT(Optimization, int);
 DE_DECLARE_COMMAND_LINE_OPT(OptimizeSpirv, bool);
 DE_DECLARE_COMMAND_LINE_OPT(ShaderCacheTruncate, bool);
 DE_DECLARE_COMMAND_LINE_OPT(ShaderCacheIPC, bool);
+DE_DECLARE_COMMAND_LINE_OPT(ShaderLibraryCacheDir, std::string);
+DE_DECLARE_COMMAND_LINE_OPT(PersistentPipelineCacheDir, std::string);
+DE_DECLARE_COMMAND_LINE_OPT(ReferenceCacheDir, std::string);
+DE_DECLARE_COMMAND_LINE_OPT(ReferenceCacheSize, int);
+DE_DECLARE_COMMAND_LINE_OPT(TestTreeManifestFile, std::string);
+DE_DECLARE_COMMAND_LINE_OPT(WorkerThreads, int);
 DE_DECLARE_COMMAND_LINE_OPT(RenderDoc, bool);
 DE_DECLARE_COMMAND_LINE_OPT(CaseFraction, std::vector<int>);
 DE_DECLARE_COMMAND_LINE_OPT(CaseFractionMandatoryTests, std::string);
@@ -109,6 +115,7 @@ DE_DECLARE_COMMAND_LINE_OPT(WaiverFile, std::string);
 DE_DECLARE_COMMAND_LINE_OPT(RunnerType, tcu::TestRunnerType);
 DE_DECLARE_COMMAND_LINE_OPT(TerminateOnFail, bool);
 DE_DECLARE_COMMAND_LINE_OPT(TerminateOnDeviceLost, bool);
+DE_DECLARE_COMMAND_LINE_OPT(Instrumentation, bool);
 DE_DECLARE_COMMAND_LINE_OPT(SubProcess, bool);
 DE_DECLARE_COMMAND_LINE_OPT(SubprocessTestCount, int);
 DE_DECLARE_COMMAND_LINE_OPT(SubprocessConfigFile, std::string);
@@ -244,6 +251,19 @@ void registerOptions(de::cmdline::Parser &parser)
                                        "Truncate shader cache before running tests", s_enableNames, "enable")
         << Option<ShaderCacheIPC>(DE_NULL, "deqp-shadercache-ipc", "Should shader cache use inter process comms",
                                   s_enableNames, "disable")
+        << Option<ShaderLibraryCacheDir>(DE_NULL, "deqp-shader-library-cache-dir",
+                                         "Cache parsed shader library (.test) files in given directory", "")
+        << Option<PersistentPipelineCacheDir>(
+               DE_NULL, "deqp-persistent-pipeline-cache-dir",
+               "Share a pipeline cache between test cases and persist it in given directory (Vulkan only)", "")
+        << Option<ReferenceCacheDir>(DE_NULL, "deqp-reference-cache-dir",
+                                     "Store deterministic reference results in given directory", "")
+        << Option<ReferenceCacheSize>(DE_NULL, "deqp-reference-cache-size",
+                                      "Maximum size of the reference result cache in megabytes", "1024")
+        << Option<TestTreeManifestFile>(DE_NULL, "deqp-test-tree-manifest-file",
+                                        "Cache test hierarchy manifest in given file for fast case enumeration", "")
+        << Option<WorkerThreads>(DE_NULL, "deqp-worker-threads",
+                                 "Number of threads for parallel framework work (0 = number of cores)", "1")
         << Option<RenderDoc>(DE_NULL, "deqp-renderdoc", "Enable RenderDoc frame markers", s_enableNames, "disable")
         << Option<CaseFraction>(DE_NULL, "deqp-fraction",
                                 "Run a fraction of the test cases (e.g. N,M means run group%M==N)", parseIntList, "")
@@ -255,6 +275,8 @@ void registerOptions(de::cmdline::Parser &parser)
                                    s_enableNames, "disable")
         << Option<TerminateOnDeviceLost>(DE_NULL, "deqp-terminate-on-device-lost",
                                          "Terminate the run on a device lost error", s_enableNames, "disable")
+        << Option<Instrumentation>(DE_NULL, "deqp-instrumentation",
+                                   "Log per-case phase timings and resource usage", s_enableNames, "disable")
         << Option<SubProcess>(DE_NULL, "deqp-subprocess",
                               "Inform app that it works as subprocess (Vulkan SC only, do not use manually)",
                               s_enableNames, "disable")
@@ -1234,6 +1256,30 @@ bool CommandLine::isShaderCacheIPCEnabled(void) const
 {
     return m_cmdLine.getOption<opt::ShaderCacheIPC>();
 }
+const char *CommandLine::getShaderLibraryCacheDir(void) const
+{
+    return m_cmdLine.getOption<opt::ShaderLibraryCacheDir>().c_str();
+}
+const char *CommandLine::getPersistentPipelineCacheDir(void) const
+{
+    return m_cmdLine.getOption<opt::PersistentPipelineCacheDir>().c_str();
+}
+const char *CommandLine::getReferenceCacheDir(void) const
+{
+    return m_cmdLine.getOption<opt::ReferenceCacheDir>().c_str();
+}
+int CommandLine::getReferenceCacheSize(void) const
+{
+    return m_cmdLine.getOption<opt::ReferenceCacheSize>();
+}
+const char *CommandLine::getTestTreeManifestFile(void) const
+{
+    return m_cmdLine.getOption<opt::TestTreeManifestFile>().c_str();
+}
+int CommandLine::getWorkerThreadCount(void) const
+{
+    return m_cmdLine.getOption<opt::WorkerThreads>();
+}
 int CommandLine::getOptimizationRecipe(void) const
 {
     return m_cmdLine.getOption<opt::Optimization>();
@@ -1274,6 +1320,10 @@ bool CommandLine::isTerminateOnDeviceLostEnabled(void) const
 {
     return m_cmdLine.getOption<opt::TerminateOnDeviceLost>();
 }
+bool CommandLine::isInstrumentationEnabled(void) const
+{
+    return m_cmdLine.getOption<opt::Instrumentation>();
+}
 bool CommandLine::isSubProcess(void) const
 {
     return m_cmdLine.getOption<opt::SubProcess>();
@@ -1490,6 +1540,12 @@ bool CaseListFilter::checkCaseFraction(int i, const std::string &testCaseName) c
            (m_caseFractionMandatoryTests.get() != DE_NULL && m_caseFractionMandatoryTests->matches(testCaseName));
 }
 
+bool CaseListFilter::isRestrictive(void) const
+{
+    return m_caseTree != DE_NULL || m_casePaths.get() != DE_NULL || m_caseFraction.size() == 2 ||
+           m_runnerType != RUNNERTYPE_ANY;
+}
+
 CaseListFilter::CaseListFilter(void) : m_caseTree(DE_NULL), m_runnerType(tcu::RUNNERTYPE_ANY)
 {
 }
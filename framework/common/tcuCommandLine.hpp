@@ -119,6 +119,9 @@ public:
         return ((m_runnerType & type) == m_runnerType);
     }
 
+    //! Check if filter can reject any test case.
+    bool isRestrictive(void) const;
+
 private:
     CaseListFilter(const CaseListFilter &);            // not allowed!
     CaseListFilter &operator=(const CaseListFilter &); // not allowed!
@@ -256,6 +259,24 @@ public:
     //! Should the shader cache use inter process communication (IPC) (--deqp-shadercache-ipc)
     bool isShaderCacheIPCEnabled(void) const;
 
+    //! Get the directory for cached binary form of shader library files (--deqp-shader-library-cache-dir)
+    const char *getShaderLibraryCacheDir(void) const;
+
+    //! Get the directory for the persistent pipeline cache (--deqp-persistent-pipeline-cache-dir)
+    const char *getPersistentPipelineCacheDir(void) const;
+
+    //! Get the directory for cached reference results (--deqp-reference-cache-dir)
+    const char *getReferenceCacheDir(void) const;
+
+    //! Get the maximum size of the reference result cache in megabytes (--deqp-reference-cache-size)
+    int getReferenceCacheSize(void) const;
+
+    //! Get the file for cached test hierarchy manifest (--deqp-test-tree-manifest-file)
+    const char *getTestTreeManifestFile(void) const;
+
+    //! Get the number of threads for parallel framework work (--deqp-worker-threads)
+    int getWorkerThreadCount(void) const;
+
     //! Get shader optimization recipe (--deqp-optimization-recipe)
     int getOptimizationRecipe(void) const;
 
@@ -286,6 +307,9 @@ public:
     //! Should the run be terminated on first device lost (--deqp-terminate-on-device-lost)
     bool isTerminateOnDeviceLostEnabled(void) const;
 
+    //! Should per-case phase timings and resource usage be logged (--deqp-instrumentation)
+    bool isInstrumentationEnabled(void) const;
+
     //! Start as subprocess ( Vulkan SC )
     bool isSubProcess(void) const;
 
@@ -32,6 +32,7 @@
 #include "tcuTexture.hpp"
 #include "tcuTextureUtil.hpp"
 #include "tcuFloat.hpp"
+#include "tcuInstrumentation.hpp"
 
 #include <string.h>
 #include <cmath>
@@ -231,6 +232,8 @@ bool fuzzyCompare(TestLog &log, const char *imageSetName, const char *imageSetDe
                   const ConstPixelBufferAccess &reference, const ConstPixelBufferAccess &result, float threshold,
                   CompareLogMode logMode)
 {
+    const ScopedPhaseTimer timer(INSTRUMENTATION_PHASE_IMAGE_COMPARE);
+
     FuzzyCompareParams params; // Use defaults.
     TextureLevel errorMask(TextureFormat(TextureFormat::RGB, TextureFormat::UNORM_INT8), reference.getWidth(),
                            reference.getHeight());
@@ -295,6 +298,8 @@ bool bitwiseCompare(TestLog &log, const char *imageSetName, const char *imageSet
                     const ConstPixelBufferAccess &reference, const ConstPixelBufferAccess &result,
                     CompareLogMode logMode)
 {
+    const ScopedPhaseTimer timer(INSTRUMENTATION_PHASE_IMAGE_COMPARE);
+
     int width  = reference.getWidth();
     int height = reference.getHeight();
     int depth  = reference.getDepth();
@@ -408,6 +413,8 @@ bool fuzzyCompareMaxError(TestLog &log, const char *imageSetName, const char *im
                           const ConstPixelBufferAccess &reference, const ConstPixelBufferAccess &result,
                           float threshold, CompareLogMode logMode)
 {
+    const ScopedPhaseTimer timer(INSTRUMENTATION_PHASE_IMAGE_COMPARE);
+
     FuzzyCompareParams params(8, true);
     TextureLevel errorMask(TextureFormat(TextureFormat::RGB, TextureFormat::UNORM_INT8), reference.getWidth(),
                            reference.getHeight());
@@ -576,6 +583,8 @@ int measurePixelDiffAccuracy(TestLog &log, const char *imageSetName, const char
                              const ConstPixelBufferAccess &reference, const ConstPixelBufferAccess &result,
                              int bestScoreDiff, int worstScoreDiff, CompareLogMode logMode)
 {
+    const ScopedPhaseTimer timer(INSTRUMENTATION_PHASE_IMAGE_COMPARE);
+
     TextureLevel diffMask(TextureFormat(TextureFormat::RGB, TextureFormat::UNORM_INT8), reference.getWidth(),
                           reference.getHeight());
     int diffFactor     = 8;
@@ -734,6 +743,8 @@ bool floatUlpThresholdCompare(TestLog &log, const char *imageSetName, const char
                               const ConstPixelBufferAccess &reference, const ConstPixelBufferAccess &result,
                               const UVec4 &threshold, CompareLogMode logMode)
 {
+    const ScopedPhaseTimer timer(INSTRUMENTATION_PHASE_IMAGE_COMPARE);
+
     int width  = reference.getWidth();
     int height = reference.getHeight();
     int depth  = reference.getDepth();
@@ -822,6 +833,8 @@ bool floatThresholdCompare(TestLog &log, const char *imageSetName, const char *i
                            const ConstPixelBufferAccess &reference, const ConstPixelBufferAccess &result,
                            const Vec4 &threshold, CompareLogMode logMode)
 {
+    const ScopedPhaseTimer timer(INSTRUMENTATION_PHASE_IMAGE_COMPARE);
+
     int width  = reference.getWidth();
     int height = reference.getHeight();
     int depth  = reference.getDepth();
@@ -914,6 +927,8 @@ bool floatThresholdCompare(TestLog &log, const char *imageSetName, const char *i
                            const ConstPixelBufferAccess &reference, const ConstPixelBufferAccess &result,
                            const Vec4 &ignorekey, const Vec4 &threshold, CompareLogMode logMode)
 {
+    const ScopedPhaseTimer timer(INSTRUMENTATION_PHASE_IMAGE_COMPARE);
+
     int width  = reference.getWidth();
     int height = reference.getHeight();
     int depth  = reference.getDepth();
@@ -1006,6 +1021,8 @@ bool floatThresholdCompare(TestLog &log, const char *imageSetName, const char *i
 bool floatThresholdCompare(TestLog &log, const char *imageSetName, const char *imageSetDesc, const Vec4 &reference,
                            const ConstPixelBufferAccess &result, const Vec4 &threshold, CompareLogMode logMode)
 {
+    const ScopedPhaseTimer timer(INSTRUMENTATION_PHASE_IMAGE_COMPARE);
+
     const int width  = result.getWidth();
     const int height = result.getHeight();
     const int depth  = result.getDepth();
@@ -1094,6 +1111,8 @@ bool intThresholdCompare(TestLog &log, const char *imageSetName, const char *ima
                          const ConstPixelBufferAccess &reference, const ConstPixelBufferAccess &result,
                          const UVec4 &threshold, CompareLogMode logMode, bool use64Bits)
 {
+    const ScopedPhaseTimer timer(INSTRUMENTATION_PHASE_IMAGE_COMPARE);
+
     int width  = reference.getWidth();
     int height = reference.getHeight();
     int depth  = reference.getDepth();
@@ -1212,6 +1231,8 @@ bool dsThresholdCompare(TestLog &log, const char *imageSetName, const char *imag
                         const ConstPixelBufferAccess &reference, const ConstPixelBufferAccess &result,
                         const float threshold, CompareLogMode logMode)
 {
+    const ScopedPhaseTimer timer(INSTRUMENTATION_PHASE_IMAGE_COMPARE);
+
     int width  = reference.getWidth();
     int height = reference.getHeight();
     int depth  = reference.getDepth();
@@ -1380,6 +1401,8 @@ bool intThresholdPositionDeviationCompare(TestLog &log, const char *imageSetName
                                           const UVec4 &threshold, const tcu::IVec3 &maxPositionDeviation,
                                           bool acceptOutOfBoundsAsAnyValue, CompareLogMode logMode)
 {
+    const ScopedPhaseTimer timer(INSTRUMENTATION_PHASE_IMAGE_COMPARE);
+
     const int width  = reference.getWidth();
     const int height = reference.getHeight();
     const int depth  = reference.getDepth();
@@ -1460,6 +1483,8 @@ bool intThresholdPositionDeviationErrorThresholdCompare(
     const ConstPixelBufferAccess &result, const UVec4 &threshold, const tcu::IVec3 &maxPositionDeviation,
     bool acceptOutOfBoundsAsAnyValue, int maxAllowedFailingPixels, CompareLogMode logMode)
 {
+    const ScopedPhaseTimer timer(INSTRUMENTATION_PHASE_IMAGE_COMPARE);
+
     const int width  = reference.getWidth();
     const int height = reference.getHeight();
     const int depth  = reference.getDepth();
@@ -1553,6 +1578,8 @@ bool bilinearCompare(TestLog &log, const char *imageSetName, const char *imageSe
                      const ConstPixelBufferAccess &reference, const ConstPixelBufferAccess &result,
                      const RGBA threshold, CompareLogMode logMode)
 {
+    const ScopedPhaseTimer timer(INSTRUMENTATION_PHASE_IMAGE_COMPARE);
+
     TextureLevel errorMask(TextureFormat(TextureFormat::RGB, TextureFormat::UNORM_INT8), reference.getWidth(),
                            reference.getHeight());
     bool isOk = bilinearCompare(reference, result, errorMask, threshold);
@@ -0,0 +1,338 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Per-case phase timing and resource usage instrumentation.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuInstrumentation.hpp"
+#include "tcuTestLog.hpp"
+
+#include "deClock.h"
+#include "deResourceUsage.h"
+#include "deMutex.hpp"
+#include "deArrayUtil.hpp"
+#include "deMemory.h"
+#include "deStringUtil.hpp"
+
+#include <utility>
+#include <vector>
+
+namespace tcu
+{
+
+using std::string;
+
+namespace
+{
+
+enum
+{
+    NUM_SLOWEST_CASES = 10
+};
+
+struct PhaseStats
+{
+    uint64_t wallTime;
+    uint64_t cpuTime;
+    uint64_t count;
+};
+
+struct Statistics
+{
+    PhaseStats phases[INSTRUMENTATION_PHASE_LAST];
+    uint64_t counters[INSTRUMENTATION_COUNTER_LAST];
+    uint64_t wallTime;
+    uint64_t cpuTime;
+
+    void reset(void)
+    {
+        deMemset(this, 0, sizeof(*this));
+    }
+
+    void accumulate(const Statistics &other)
+    {
+        for (int phaseNdx = 0; phaseNdx < INSTRUMENTATION_PHASE_LAST; phaseNdx++)
+        {
+            phases[phaseNdx].wallTime += other.phases[phaseNdx].wallTime;
+            phases[phaseNdx].cpuTime += other.phases[phaseNdx].cpuTime;
+            phases[phaseNdx].count += other.phases[phaseNdx].count;
+        }
+
+        for (int counterNdx = 0; counterNdx < INSTRUMENTATION_COUNTER_LAST; counterNdx++)
+            counters[counterNdx] += other.counters[counterNdx];
+
+        wallTime += other.wallTime;
+        cpuTime += other.cpuTime;
+    }
+};
+
+// Active phase timers of one thread. Only the outermost timer of each phase is measured.
+struct PhaseStack
+{
+    int depth[INSTRUMENTATION_PHASE_LAST];
+    uint64_t startWallTime[INSTRUMENTATION_PHASE_LAST];
+    uint64_t startCpuTime[INSTRUMENTATION_PHASE_LAST];
+};
+
+// Zero-initialized for every thread.
+thread_local PhaseStack s_phaseStack;
+
+struct InstrumentationState
+{
+    bool enabled;
+    de::Mutex lock;
+
+    uint64_t caseStartWallTime;
+    uint64_t caseStartCpuTime;
+    Statistics caseStats;
+
+    Statistics sessionStats;
+    uint64_t numCases;
+    std::vector<std::pair<uint64_t, string>> slowestCases; // Sorted by descending wall time
+
+    InstrumentationState(void) : enabled(false), caseStartWallTime(0), caseStartCpuTime(0), numCases(0)
+    {
+        caseStats.reset();
+        sessionStats.reset();
+    }
+};
+
+InstrumentationState &getState(void)
+{
+    static InstrumentationState state;
+    return state;
+}
+
+bool isByteCounter(InstrumentationCounter counter)
+{
+    return counter == INSTRUMENTATION_COUNTER_DEVICE_ALLOCATION_BYTES ||
+           counter == INSTRUMENTATION_COUNTER_PROGRAM_BINARY_BYTES ||
+           counter == INSTRUMENTATION_COUNTER_PROGRAM_BINARY_COPIED_BYTES;
+}
+
+void logStatistics(TestLog &log, const Statistics &stats)
+{
+    for (int phaseNdx = 0; phaseNdx < INSTRUMENTATION_PHASE_LAST; phaseNdx++)
+    {
+        const PhaseStats &phase = stats.phases[phaseNdx];
+        const string name       = getInstrumentationPhaseName((InstrumentationPhase)phaseNdx);
+
+        if (phase.count == 0)
+            continue;
+
+        log << TestLog::Integer(name + "WallTime", "Wall time spent in " + name, "us", QP_KEY_TAG_TIME,
+                                (int64_t)phase.wallTime)
+            << TestLog::Integer(name + "CpuTime", "Process CPU time spent in " + name, "us", QP_KEY_TAG_TIME,
+                                (int64_t)phase.cpuTime)
+            << TestLog::Integer(name + "Count", "Number of times " + name + " was entered", "", QP_KEY_TAG_NONE,
+                                (int64_t)phase.count);
+    }
+
+    for (int counterNdx = 0; counterNdx < INSTRUMENTATION_COUNTER_LAST; counterNdx++)
+    {
+        static const char *const s_descriptions[] = {
+            "Number of shader programs built",
+            "Number of shader binaries loaded from shader cache",
+            "Number of device memory allocations",
+            "Total size of device memory allocations",
+            "Total size of program binaries created",
+            "Total size of program binaries created by copying",
+        };
+        const InstrumentationCounter counter = (InstrumentationCounter)counterNdx;
+
+        if (stats.counters[counterNdx] == 0)
+            continue;
+
+        log << TestLog::Integer(getInstrumentationCounterName(counter),
+                                de::getSizedArrayElement<INSTRUMENTATION_COUNTER_LAST>(s_descriptions, counter),
+                                isByteCounter(counter) ? "bytes" : "", QP_KEY_TAG_NONE,
+                                (int64_t)stats.counters[counterNdx]);
+    }
+}
+
+} // namespace
+
+const char *getInstrumentationPhaseName(InstrumentationPhase phase)
+{
+    static const char *const s_names[] = {
+        "CheckSupport",
+        "InitPrograms",
+        "BuildProgram",
+        "CreateInstance",
+        "Init",
+        "Iterate",
+        "ImageCompare",
+        "LogImage",
+        "DeviceCreation",
+        "MemoryAllocation",
+    };
+
+    return de::getSizedArrayElement<INSTRUMENTATION_PHASE_LAST>(s_names, phase);
+}
+
+const char *getInstrumentationCounterName(InstrumentationCounter counter)
+{
+    static const char *const s_names[] = {
+        "ProgramsBuilt",
+        "ShaderCacheHits",
+        "DeviceAllocations",
+        "DeviceAllocationBytes",
+        "ProgramBinaryBytes",
+        "ProgramBinaryCopiedBytes",
+    };
+
+    return de::getSizedArrayElement<INSTRUMENTATION_COUNTER_LAST>(s_names, counter);
+}
+
+void setInstrumentationEnabled(bool enabled)
+{
+    getState().enabled = enabled;
+}
+
+bool isInstrumentationEnabled(void)
+{
+    return getState().enabled;
+}
+
+void addInstrumentationCounter(InstrumentationCounter counter, uint64_t value)
+{
+    InstrumentationState &state = getState();
+
+    if (!state.enabled)
+        return;
+
+    de::ScopedLock lock(state.lock);
+    state.caseStats.counters[counter] += value;
+}
+
+void beginInstrumentedCase(void)
+{
+    InstrumentationState &state = getState();
+
+    if (!state.enabled)
+        return;
+
+    de::ScopedLock lock(state.lock);
+    state.caseStats.reset();
+    state.caseStartWallTime = deGetMicroseconds();
+    state.caseStartCpuTime  = deGetProcessCpuTimeMicroseconds();
+}
+
+void endInstrumentedCase(TestLog &log, const string &casePath)
+{
+    InstrumentationState &state = getState();
+
+    if (!state.enabled)
+        return;
+
+    Statistics caseStats;
+
+    {
+        de::ScopedLock lock(state.lock);
+
+        state.caseStats.wallTime = deGetMicroseconds() - state.caseStartWallTime;
+        state.caseStats.cpuTime  = deGetProcessCpuTimeMicroseconds() - state.caseStartCpuTime;
+        caseStats                = state.caseStats;
+
+        state.sessionStats.accumulate(caseStats);
+        state.numCases += 1;
+
+        if (state.slowestCases.size() < NUM_SLOWEST_CASES || caseStats.wallTime > state.slowestCases.back().first)
+        {
+            std::vector<std::pair<uint64_t, string>>::iterator pos = state.slowestCases.begin();
+
+            while (pos != state.slowestCases.end() && pos->first >= caseStats.wallTime)
+                ++pos;
+
+            state.slowestCases.insert(pos, std::make_pair(caseStats.wallTime, casePath));
+
+            if (state.slowestCases.size() > NUM_SLOWEST_CASES)
+                state.slowestCases.pop_back();
+        }
+    }
+
+    log << TestLog::Section("Instrumentation", "Phase timings and resource usage")
+        << TestLog::Integer("CaseCpuTime", "Process CPU time used by test case", "us", QP_KEY_TAG_TIME,
+                            (int64_t)caseStats.cpuTime)
+        << TestLog::Integer("PeakResidentMemory", "Peak resident memory size of process", "bytes", QP_KEY_TAG_NONE,
+                            (int64_t)deGetPeakResidentMemorySize());
+    logStatistics(log, caseStats);
+    log << TestLog::EndSection;
+}
+
+void logInstrumentationSummary(TestLog &log)
+{
+    InstrumentationState &state = getState();
+
+    if (!state.enabled)
+        return;
+
+    de::ScopedLock lock(state.lock);
+
+    log << TestLog::Section("InstrumentationSummary", "Phase timings and resource usage of all test cases")
+        << TestLog::Integer("NumCases", "Number of instrumented test cases", "", QP_KEY_TAG_NONE,
+                            (int64_t)state.numCases)
+        << TestLog::Integer("TotalWallTime", "Total wall time of test cases", "us", QP_KEY_TAG_TIME,
+                            (int64_t)state.sessionStats.wallTime)
+        << TestLog::Integer("TotalCpuTime", "Total process CPU time of test cases", "us", QP_KEY_TAG_TIME,
+                            (int64_t)state.sessionStats.cpuTime)
+        << TestLog::Integer("PeakResidentMemory", "Peak resident memory size of process", "bytes", QP_KEY_TAG_NONE,
+                            (int64_t)deGetPeakResidentMemorySize());
+    logStatistics(log, state.sessionStats);
+
+    log << TestLog::Section("SlowestCases", "Test cases with longest wall time");
+    // Case path is stored as description to keep group duration parsers from mistaking these for groups.
+    for (size_t caseNdx = 0; caseNdx < state.slowestCases.size(); caseNdx++)
+        log << TestLog::Integer("SlowestCase" + de::toString(caseNdx), state.slowestCases[caseNdx].second, "us",
+                                QP_KEY_TAG_TIME, (int64_t)state.slowestCases[caseNdx].first);
+    log << TestLog::EndSection << TestLog::EndSection;
+}
+
+ScopedPhaseTimer::ScopedPhaseTimer(InstrumentationPhase phase) : m_phase(phase), m_active(isInstrumentationEnabled())
+{
+    if (m_active && s_phaseStack.depth[m_phase]++ == 0)
+    {
+        s_phaseStack.startWallTime[m_phase] = deGetMicroseconds();
+        s_phaseStack.startCpuTime[m_phase]  = deGetProcessCpuTimeMicroseconds();
+    }
+}
+
+ScopedPhaseTimer::~ScopedPhaseTimer(void)
+{
+    if (!m_active)
+        return;
+
+    DE_ASSERT(s_phaseStack.depth[m_phase] > 0);
+
+    if (--s_phaseStack.depth[m_phase] == 0)
+    {
+        const uint64_t wallTime     = deGetMicroseconds() - s_phaseStack.startWallTime[m_phase];
+        const uint64_t cpuTime      = deGetProcessCpuTimeMicroseconds() - s_phaseStack.startCpuTime[m_phase];
+        InstrumentationState &state = getState();
+        de::ScopedLock lock(state.lock);
+        PhaseStats &stats = state.caseStats.phases[m_phase];
+
+        stats.wallTime += wallTime;
+        stats.cpuTime += cpuTime;
+        stats.count += 1;
+    }
+}
+
+} // namespace tcu
@@ -0,0 +1,108 @@
+#ifndef _TCUINSTRUMENTATION_HPP
+#define _TCUINSTRUMENTATION_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Per-case phase timing and resource usage instrumentation.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+
+#include <string>
+
+namespace tcu
+{
+
+class TestLog;
+
+enum InstrumentationPhase
+{
+    INSTRUMENTATION_PHASE_CHECK_SUPPORT = 0,
+    INSTRUMENTATION_PHASE_INIT_PROGRAMS,
+    INSTRUMENTATION_PHASE_BUILD_PROGRAM,
+    INSTRUMENTATION_PHASE_CREATE_INSTANCE,
+    INSTRUMENTATION_PHASE_INIT,
+    INSTRUMENTATION_PHASE_ITERATE,
+    INSTRUMENTATION_PHASE_IMAGE_COMPARE,
+    INSTRUMENTATION_PHASE_LOG_IMAGE,
+    INSTRUMENTATION_PHASE_DEVICE_CREATION,
+    INSTRUMENTATION_PHASE_MEMORY_ALLOCATION,
+
+    INSTRUMENTATION_PHASE_LAST
+};
+
+enum InstrumentationCounter
+{
+    INSTRUMENTATION_COUNTER_PROGRAMS_BUILT = 0,
+    INSTRUMENTATION_COUNTER_SHADER_CACHE_HITS,
+    INSTRUMENTATION_COUNTER_DEVICE_ALLOCATIONS,
+    INSTRUMENTATION_COUNTER_DEVICE_ALLOCATION_BYTES,
+    INSTRUMENTATION_COUNTER_PROGRAM_BINARY_BYTES,
+    INSTRUMENTATION_COUNTER_PROGRAM_BINARY_COPIED_BYTES,
+
+    INSTRUMENTATION_COUNTER_LAST
+};
+
+const char *getInstrumentationPhaseName(InstrumentationPhase phase);
+const char *getInstrumentationCounterName(InstrumentationCounter counter);
+
+//! Enable or disable instrumentation (--deqp-instrumentation). Disabled by default.
+void setInstrumentationEnabled(bool enabled);
+bool isInstrumentationEnabled(void);
+
+//! Add value to counter of currently executing case. No-op when disabled.
+void addInstrumentationCounter(InstrumentationCounter counter, uint64_t value = 1);
+
+//! Reset per-case statistics. Called by TestSessionExecutor when entering a case.
+void beginInstrumentedCase(void);
+
+//! Write per-case statistics to log and accumulate them to session totals.
+void endInstrumentedCase(TestLog &log, const std::string &casePath);
+
+//! Write session totals and slowest cases to log.
+void logInstrumentationSummary(TestLog &log);
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Measure wall and CPU time spent in a phase
+ *
+ * Times are inclusive: nested timers of the same phase are only counted
+ * once, but a phase that calls into another phase (e.g. image compare
+ * logging result images) contributes to both. Nesting is tracked per
+ * thread, so timers running concurrently on worker threads are each
+ * counted. CPU time is process-wide.
+ * When instrumentation is disabled the timer does nothing.
+ *//*--------------------------------------------------------------------*/
+class ScopedPhaseTimer
+{
+public:
+    ScopedPhaseTimer(InstrumentationPhase phase);
+    ~ScopedPhaseTimer(void);
+
+private:
+    ScopedPhaseTimer(const ScopedPhaseTimer &);            // Not allowed!
+    ScopedPhaseTimer &operator=(const ScopedPhaseTimer &); // Not allowed!
+
+    const InstrumentationPhase m_phase;
+    const bool m_active;
+};
+
+} // namespace tcu
+
+#endif // _TCUINSTRUMENTATION_HPP
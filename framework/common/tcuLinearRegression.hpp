@@ -0,0 +1,68 @@
+#ifndef _TCULINEARREGRESSION_HPP
+#define _TCULINEARREGRESSION_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright 2014 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Robust linear regression estimates.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "tcuVector.hpp"
+
+#include <vector>
+
+namespace tcu
+{
+
+struct LineParameters
+{
+    float offset;
+    float coefficient;
+
+    LineParameters(float offset_, float coefficient_) : offset(offset_), coefficient(coefficient_)
+    {
+    }
+};
+
+// Basic Theil-Sen linear estimate. Calculates median of all possible slope coefficients through two of the data points
+// and median of offsets corresponding with the median slope
+LineParameters theilSenLinearRegression(const std::vector<tcu::Vec2> &dataPoints);
+
+struct LineParametersWithConfidence
+{
+    float offset;
+    float offsetConfidenceUpper;
+    float offsetConfidenceLower;
+
+    float coefficient;
+    float coefficientConfidenceUpper;
+    float coefficientConfidenceLower;
+
+    float confidence;
+};
+
+// Median-of-medians version of Theil-Sen estimate. Calculates median of medians of slopes through a point and all other points.
+// Confidence interval is given as the range that contains the given fraction of all slopes/offsets
+LineParametersWithConfidence theilSenSiegelLinearRegression(const std::vector<tcu::Vec2> &dataPoints,
+                                                            float reportedConfidence);
+
+} // namespace tcu
+
+#endif // _TCULINEARREGRESSION_HPP
@@ -30,10 +30,13 @@
 #include "tcuFloat.hpp"
 
 #include "deMath.h"
+#include "deRandom.hpp"
 #include "deStringUtil.hpp"
+#include "deTaskScheduler.hpp"
 
 #include "rrRasterizer.hpp"
 
+#include <algorithm>
 #include <limits>
 
 namespace tcu
@@ -215,6 +218,106 @@ tcu::IVec4 getTriangleAABB(const TriangleSceneSpec::SceneTriangle &triangle, con
     return aabb;
 }
 
+bool isFinite(float value)
+{
+    const tcu::Float32 f(value);
+
+    return !f.isInf() && !f.isNaN();
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Screen-space grid of scene triangles
+ *
+ * Finds the triangles that may cover a pixel without testing every
+ * triangle in the scene. calculateTriangleCoverage() returns COVERAGE_NONE
+ * for pixels more than one pixel outside the bounding box of a triangle,
+ * so skipping the triangles rejected by mayCover() does not change any
+ * coverage result.
+ *//*--------------------------------------------------------------------*/
+class TriangleGrid
+{
+public:
+    TriangleGrid(const TriangleSceneSpec &scene, const tcu::IVec2 &viewportSize);
+
+    //! Triangles that may cover a pixel in the viewport, in increasing index order.
+    const std::vector<int> &getCandidates(const tcu::IVec2 &pixel) const
+    {
+        return m_cells[(pixel.y() / CELL_SIZE) * m_numCells.x() + pixel.x() / CELL_SIZE];
+    }
+
+    bool mayCover(int triNdx, const tcu::IVec2 &pixel) const
+    {
+        const tcu::IVec4 &bounds = m_bounds[triNdx];
+
+        return pixel.x() >= bounds.x() && pixel.y() >= bounds.y() && pixel.x() <= bounds.z() &&
+               pixel.y() <= bounds.w();
+    }
+
+private:
+    enum
+    {
+        CELL_SIZE = 16
+    };
+
+    tcu::IVec2 m_numCells;
+    std::vector<tcu::IVec4> m_bounds; //!< Inclusive pixel bounds, clamped to one pixel outside the viewport
+    std::vector<std::vector<int>> m_cells;
+};
+
+TriangleGrid::TriangleGrid(const TriangleSceneSpec &scene, const tcu::IVec2 &viewportSize)
+    : m_numCells(deDivRoundUp32(viewportSize.x(), CELL_SIZE), deDivRoundUp32(viewportSize.y(), CELL_SIZE))
+    , m_bounds(scene.triangles.size())
+    , m_cells(m_numCells.x() * m_numCells.y())
+{
+    const tcu::Vec2 viewportSizeF = viewportSize.cast<float>();
+    const tcu::Vec2 lowerLimit    = tcu::Vec2(-1.0f);
+    const tcu::Vec2 upperLimit    = viewportSizeF;
+
+    for (int triNdx = 0; triNdx < (int)scene.triangles.size(); ++triNdx)
+    {
+        const tcu::Vec4 *const positions = scene.triangles[triNdx].positions;
+        tcu::Vec2 minPos                 = upperLimit;
+        tcu::Vec2 maxPos                 = lowerLimit;
+        bool finite                      = true;
+
+        // Same screen-space positions as in calculateTriangleCoverage()
+        for (int vtxNdx = 0; vtxNdx < 3; ++vtxNdx)
+        {
+            const tcu::Vec2 normalizedDeviceSpace = tcu::Vec2(positions[vtxNdx].x() / positions[vtxNdx].w(),
+                                                              positions[vtxNdx].y() / positions[vtxNdx].w());
+            const tcu::Vec2 screenSpace = (normalizedDeviceSpace + tcu::Vec2(1.0f, 1.0f)) * 0.5f * viewportSizeF;
+
+            finite = finite && isFinite(screenSpace.x()) && isFinite(screenSpace.y());
+            minPos = (vtxNdx == 0) ? screenSpace : tcu::min(minPos, screenSpace);
+            maxPos = (vtxNdx == 0) ? screenSpace : tcu::max(maxPos, screenSpace);
+        }
+
+        // Bounding box test of calculateTriangleCoverage() cannot reject anything for non-finite positions
+        if (!finite)
+        {
+            minPos = lowerLimit;
+            maxPos = upperLimit;
+        }
+
+        {
+            const tcu::Vec2 minBound = tcu::clamp(tcu::floor(minPos) - 1.0f, lowerLimit, upperLimit);
+            const tcu::Vec2 maxBound = tcu::clamp(tcu::ceil(maxPos) + 1.0f, lowerLimit, upperLimit);
+            const tcu::IVec4 bounds((int)minBound.x(), (int)minBound.y(), (int)maxBound.x(), (int)maxBound.y());
+
+            m_bounds[triNdx] = bounds;
+
+            if (bounds.z() < 0 || bounds.w() < 0 || bounds.x() >= viewportSize.x() || bounds.y() >= viewportSize.y())
+                continue;
+
+            for (int cellY = de::max(0, bounds.y()) / CELL_SIZE;
+                 cellY <= de::min(bounds.w(), viewportSize.y() - 1) / CELL_SIZE; ++cellY)
+                for (int cellX = de::max(0, bounds.x()) / CELL_SIZE;
+                     cellX <= de::min(bounds.z(), viewportSize.x() - 1) / CELL_SIZE; ++cellX)
+                    m_cells[cellY * m_numCells.x() + cellX].push_back(triNdx);
+        }
+    }
+}
+
 float getExponentEpsilonFromULP(int valueExponent, uint32_t ulp)
 {
     DE_ASSERT(ulp < (1u << 10));
@@ -773,18 +876,26 @@ bool verifyTriangleGroupInterpolationWithInterpolator(const tcu::Surface &surfac
 
     // check pixels
 
+    const TriangleGrid grid(scene, viewportSize);
+
     for (int y = 0; y < surface.getHeight(); ++y)
         for (int x = 0; x < surface.getWidth(); ++x)
         {
-            const tcu::RGBA color = surface.getPixel(x, y);
-            bool stackBottomFound = false;
-            int stackSize         = 0;
+            const tcu::RGBA color              = surface.getPixel(x, y);
+            const std::vector<int> &candidates = grid.getCandidates(tcu::IVec2(x, y));
+            bool stackBottomFound              = false;
+            int stackSize                      = 0;
             tcu::Vec4 colorStackMin;
             tcu::Vec4 colorStackMax;
 
             // Iterate triangle coverage front to back, find the stack of pontentially contributing fragments
-            for (int triNdx = (int)scene.triangles.size() - 1; triNdx >= 0; --triNdx)
+            for (int candidateNdx = (int)candidates.size() - 1; candidateNdx >= 0; --candidateNdx)
             {
+                const int triNdx = candidates[candidateNdx];
+
+                if (!grid.mayCover(triNdx, tcu::IVec2(x, y)))
+                    continue;
+
                 const CoverageType coverage = calculateTriangleCoverage(
                     scene.triangles[triNdx].positions[0], scene.triangles[triNdx].positions[1],
                     scene.triangles[triNdx].positions[2], tcu::IVec2(x, y), viewportSize, subPixelBits, multisampled);
@@ -2924,59 +3035,35 @@ static void logTriangleGroupRasterizationStash(const tcu::Surface &surface, tcu:
     }
 }
 
-bool verifyTriangleGroupRasterization(const tcu::Surface &surface, const TriangleSceneSpec &scene,
-                                      const RasterizationArguments &args, tcu::TestLog &log, VerificationMode mode,
-                                      VerifyTriangleGroupRasterizationLogStash *logStash, const bool vulkanLinesTest)
+namespace
 {
-    DE_ASSERT(mode < VERIFICATIONMODE_LAST);
 
-    const tcu::RGBA backGroundColor       = tcu::RGBA(0, 0, 0, 255);
-    const tcu::RGBA triangleColor         = tcu::RGBA(255, 255, 255, 255);
-    const tcu::RGBA missingPixelColor     = tcu::RGBA(255, 0, 255, 255);
-    const tcu::RGBA unexpectedPixelColor  = tcu::RGBA(255, 0, 0, 255);
-    const tcu::RGBA partialPixelColor     = tcu::RGBA(255, 255, 0, 255);
-    const tcu::RGBA primitivePixelColor   = tcu::RGBA(30, 30, 30, 255);
-    const int weakVerificationThreshold   = 10;
-    const int weakerVerificationThreshold = 25;
-    const bool multisampled               = (args.numSamples != 0);
-    const tcu::IVec2 viewportSize         = tcu::IVec2(surface.getWidth(), surface.getHeight());
-    int missingPixels                     = 0;
-    int unexpectedPixels                  = 0;
-    int subPixelBits                      = args.subpixelBits;
-    tcu::TextureLevel coverageMap(tcu::TextureFormat(tcu::TextureFormat::R, tcu::TextureFormat::UNSIGNED_INT8),
-                                  surface.getWidth(), surface.getHeight());
-    tcu::Surface errorMask(surface.getWidth(), surface.getHeight());
-    bool result = false;
-
-    // subpixel bits in a valid range?
-
-    if (subPixelBits < 0)
-    {
-        log << tcu::TestLog::Message << "Invalid subpixel count (" << subPixelBits << "), assuming 0"
-            << tcu::TestLog::EndMessage;
-        subPixelBits = 0;
-    }
-    else if (subPixelBits > 16)
-    {
-        // At high subpixel bit counts we might overflow. Checking at lower bit count is ok, but is less strict
-        log << tcu::TestLog::Message << "Subpixel count is greater than 16 (" << subPixelBits
-            << "). Checking results using less strict 16 bit requirements. This may produce false positives."
-            << tcu::TestLog::EndMessage;
-        subPixelBits = 16;
-    }
-
-    // generate coverage map
+// Coverage map of a triangle scene. Friend triangles of partially covered pixels are looked up in a TriangleGrid.
+void generateTriangleCoverageMap(const tcu::PixelBufferAccess &coverageMap, const TriangleSceneSpec &scene,
+                                 const tcu::IVec2 &viewportSize, int subPixelBits, bool multisampled)
+{
+    tcu::clear(coverageMap, tcu::IVec4(COVERAGE_NONE, 0, 0, 0));
 
-    tcu::clear(coverageMap.getAccess(), tcu::IVec4(COVERAGE_NONE, 0, 0, 0));
+    const TriangleGrid grid(scene, viewportSize);
+    std::vector<tcu::IVec4> aabbs(scene.triangles.size());
 
     for (int triNdx = 0; triNdx < (int)scene.triangles.size(); ++triNdx)
+        aabbs[triNdx] = getTriangleAABB(scene.triangles[triNdx], viewportSize);
+
+    // Rows are independent. Within a row, triangles are visited in the same order as in a loop over triangles,
+    // so the coverage map does not depend on the number of threads.
+    const auto generateRow = [&](int y)
     {
-        const tcu::IVec4 aabb = getTriangleAABB(scene.triangles[triNdx], viewportSize);
+        for (int triNdx = 0; triNdx < (int)scene.triangles.size(); ++triNdx)
+        {
+            const tcu::IVec4 &aabb = aabbs[triNdx];
+
+            if (y < aabb.y() || y > aabb.w())
+                continue;
 
-        for (int y = de::max(0, aabb.y()); y <= de::min(aabb.w(), coverageMap.getHeight() - 1); ++y)
             for (int x = de::max(0, aabb.x()); x <= de::min(aabb.z(), coverageMap.getWidth() - 1); ++x)
             {
-                if (coverageMap.getAccess().getPixelUint(x, y).x() == COVERAGE_FULL)
+                if (coverageMap.getPixelUint(x, y).x() == COVERAGE_FULL)
                     continue;
 
                 const CoverageType coverage = calculateTriangleCoverage(
@@ -2985,7 +3072,7 @@ bool verifyTriangleGroupRasterization(const tcu::Surface &surface, const Triangl
 
                 if (coverage == COVERAGE_FULL)
                 {
-                    coverageMap.getAccess().setPixel(tcu::IVec4(COVERAGE_FULL, 0, 0, 0), x, y);
+                    coverageMap.setPixel(tcu::IVec4(COVERAGE_FULL, 0, 0, 0), x, y);
                 }
                 else if (coverage == COVERAGE_PARTIAL)
                 {
@@ -2997,10 +3084,14 @@ bool verifyTriangleGroupRasterization(const tcu::Surface &surface, const Triangl
                     // Assume full coverage if the pixel is only on a shared edge in shared triangle too.
                     if (pixelOnlyOnASharedEdge(tcu::IVec2(x, y), scene.triangles[triNdx], viewportSize))
                     {
-                        bool friendFound = false;
-                        for (int friendTriNdx = 0; friendTriNdx < (int)scene.triangles.size(); ++friendTriNdx)
+                        const std::vector<int> &candidates = grid.getCandidates(tcu::IVec2(x, y));
+                        bool friendFound                   = false;
+
+                        for (size_t candidateNdx = 0; candidateNdx < candidates.size(); ++candidateNdx)
                         {
-                            if (friendTriNdx == triNdx)
+                            const int friendTriNdx = candidates[candidateNdx];
+
+                            if (friendTriNdx == triNdx || !grid.mayCover(friendTriNdx, tcu::IVec2(x, y)))
                                 continue;
 
                             const CoverageType friendCoverage = calculateTriangleCoverage(
@@ -3020,11 +3111,67 @@ bool verifyTriangleGroupRasterization(const tcu::Surface &surface, const Triangl
                             resultCoverage = COVERAGE_FULL;
                     }
 
-                    coverageMap.getAccess().setPixel(tcu::IVec4(resultCoverage, 0, 0, 0), x, y);
+                    coverageMap.setPixel(tcu::IVec4(resultCoverage, 0, 0, 0), x, y);
                 }
             }
+        }
+    };
+
+    de::parallelFor(0, (size_t)coverageMap.getHeight(), 0,
+                    [&generateRow](size_t rowBegin, size_t rowEnd)
+                    {
+                        for (size_t y = rowBegin; y < rowEnd; ++y)
+                            generateRow((int)y);
+                    });
+}
+
+} // namespace
+
+bool verifyTriangleGroupRasterization(const tcu::Surface &surface, const TriangleSceneSpec &scene,
+                                      const RasterizationArguments &args, tcu::TestLog &log, VerificationMode mode,
+                                      VerifyTriangleGroupRasterizationLogStash *logStash, const bool vulkanLinesTest)
+{
+    DE_ASSERT(mode < VERIFICATIONMODE_LAST);
+
+    const tcu::RGBA backGroundColor       = tcu::RGBA(0, 0, 0, 255);
+    const tcu::RGBA triangleColor         = tcu::RGBA(255, 255, 255, 255);
+    const tcu::RGBA missingPixelColor     = tcu::RGBA(255, 0, 255, 255);
+    const tcu::RGBA unexpectedPixelColor  = tcu::RGBA(255, 0, 0, 255);
+    const tcu::RGBA partialPixelColor     = tcu::RGBA(255, 255, 0, 255);
+    const tcu::RGBA primitivePixelColor   = tcu::RGBA(30, 30, 30, 255);
+    const int weakVerificationThreshold   = 10;
+    const int weakerVerificationThreshold = 25;
+    const bool multisampled               = (args.numSamples != 0);
+    const tcu::IVec2 viewportSize         = tcu::IVec2(surface.getWidth(), surface.getHeight());
+    int missingPixels                     = 0;
+    int unexpectedPixels                  = 0;
+    int subPixelBits                      = args.subpixelBits;
+    tcu::TextureLevel coverageMap(tcu::TextureFormat(tcu::TextureFormat::R, tcu::TextureFormat::UNSIGNED_INT8),
+                                  surface.getWidth(), surface.getHeight());
+    tcu::Surface errorMask(surface.getWidth(), surface.getHeight());
+    bool result = false;
+
+    // subpixel bits in a valid range?
+
+    if (subPixelBits < 0)
+    {
+        log << tcu::TestLog::Message << "Invalid subpixel count (" << subPixelBits << "), assuming 0"
+            << tcu::TestLog::EndMessage;
+        subPixelBits = 0;
+    }
+    else if (subPixelBits > 16)
+    {
+        // At high subpixel bit counts we might overflow. Checking at lower bit count is ok, but is less strict
+        log << tcu::TestLog::Message << "Subpixel count is greater than 16 (" << subPixelBits
+            << "). Checking results using less strict 16 bit requirements. This may produce false positives."
+            << tcu::TestLog::EndMessage;
+        subPixelBits = 16;
     }
 
+    // generate coverage map
+
+    generateTriangleCoverageMap(coverageMap.getAccess(), scene, viewportSize, subPixelBits, multisampled);
+
     // check pixels
 
     tcu::clear(errorMask.getAccess(), tcu::Vec4(0.0f, 0.0f, 0.0f, 1.0f));
@@ -3286,4 +3433,214 @@ bool verifyTriangulatedLineGroupInterpolation(const tcu::Surface &surface, const
                                                    allowBresenhamForNonStrictLines);
 }
 
+namespace
+{
+
+// Coverage map computed as before the TriangleGrid: serially, testing every triangle as a friend.
+void generateTriangleCoverageMapReference(const tcu::PixelBufferAccess &coverageMap, const TriangleSceneSpec &scene,
+                                          const tcu::IVec2 &viewportSize, int subPixelBits, bool multisampled)
+{
+    tcu::clear(coverageMap, tcu::IVec4(COVERAGE_NONE, 0, 0, 0));
+
+    for (int triNdx = 0; triNdx < (int)scene.triangles.size(); ++triNdx)
+    {
+        const tcu::IVec4 aabb = getTriangleAABB(scene.triangles[triNdx], viewportSize);
+
+        for (int y = de::max(0, aabb.y()); y <= de::min(aabb.w(), coverageMap.getHeight() - 1); ++y)
+            for (int x = de::max(0, aabb.x()); x <= de::min(aabb.z(), coverageMap.getWidth() - 1); ++x)
+            {
+                if (coverageMap.getPixelUint(x, y).x() == COVERAGE_FULL)
+                    continue;
+
+                const CoverageType coverage = calculateTriangleCoverage(
+                    scene.triangles[triNdx].positions[0], scene.triangles[triNdx].positions[1],
+                    scene.triangles[triNdx].positions[2], tcu::IVec2(x, y), viewportSize, subPixelBits, multisampled);
+
+                if (coverage == COVERAGE_FULL)
+                    coverageMap.setPixel(tcu::IVec4(COVERAGE_FULL, 0, 0, 0), x, y);
+                else if (coverage == COVERAGE_PARTIAL)
+                {
+                    CoverageType resultCoverage = COVERAGE_PARTIAL;
+
+                    if (pixelOnlyOnASharedEdge(tcu::IVec2(x, y), scene.triangles[triNdx], viewportSize))
+                    {
+                        for (int friendTriNdx = 0; friendTriNdx < (int)scene.triangles.size(); ++friendTriNdx)
+                        {
+                            if (friendTriNdx == triNdx)
+                                continue;
+
+                            const CoverageType friendCoverage = calculateTriangleCoverage(
+                                scene.triangles[friendTriNdx].positions[0], scene.triangles[friendTriNdx].positions[1],
+                                scene.triangles[friendTriNdx].positions[2], tcu::IVec2(x, y), viewportSize,
+                                subPixelBits, multisampled);
+
+                            if (friendCoverage != COVERAGE_NONE &&
+                                pixelOnlyOnASharedEdge(tcu::IVec2(x, y), scene.triangles[friendTriNdx], viewportSize))
+                            {
+                                resultCoverage = COVERAGE_FULL;
+                                break;
+                            }
+                        }
+                    }
+
+                    coverageMap.setPixel(tcu::IVec4(resultCoverage, 0, 0, 0), x, y);
+                }
+            }
+    }
+}
+
+tcu::Vec4 toClipSpace(const tcu::Vec2 &screenPos, const tcu::IVec2 &viewportSize, float w)
+{
+    const tcu::Vec2 ndc = screenPos / viewportSize.cast<float>() * 2.0f - tcu::Vec2(1.0f);
+
+    return tcu::Vec4(ndc.x() * w, ndc.y() * w, 0.0f, w);
+}
+
+// Jittered grid of quads that extends past the viewport, split into triangles sharing their edges.
+TriangleSceneSpec generateMeshScene(de::Random &rnd, const tcu::IVec2 &viewportSize)
+{
+    const int numCells     = 6;
+    const tcu::Vec2 origin = tcu::Vec2(-8.0f);
+    const tcu::Vec2 cellSize =
+        (viewportSize.cast<float>() + tcu::Vec2(16.0f)) / tcu::Vec2((float)numCells, (float)numCells);
+    std::vector<tcu::Vec4> vertices;
+    TriangleSceneSpec scene;
+
+    for (int y = 0; y <= numCells; ++y)
+        for (int x = 0; x <= numCells; ++x)
+        {
+            const tcu::Vec2 jitter = (x == 0 || y == 0 || x == numCells || y == numCells) ?
+                                         tcu::Vec2(0.0f) :
+                                         tcu::Vec2(rnd.getFloat(-0.3f, 0.3f), rnd.getFloat(-0.3f, 0.3f));
+            const tcu::Vec2 pos    = origin + (tcu::Vec2((float)x, (float)y) + jitter) * cellSize;
+
+            vertices.push_back(toClipSpace(pos, viewportSize, rnd.getFloat(0.5f, 2.0f)));
+        }
+
+    for (int y = 0; y < numCells; ++y)
+        for (int x = 0; x < numCells; ++x)
+        {
+            const int v00 = y * (numCells + 1) + x;
+            const int v10 = v00 + 1;
+            const int v01 = v00 + numCells + 1;
+            const int v11 = v01 + 1;
+            TriangleSceneSpec::SceneTriangle first;
+            TriangleSceneSpec::SceneTriangle second;
+
+            first.positions[0]  = vertices[v00];
+            first.positions[1]  = vertices[v10];
+            first.positions[2]  = vertices[v11];
+            second.positions[0] = vertices[v00];
+            second.positions[1] = vertices[v11];
+            second.positions[2] = vertices[v01];
+
+            // Diagonal is shared within the quad, other edges with neighbouring quads.
+            first.sharedEdge[0]  = (y > 0);
+            first.sharedEdge[1]  = (x < numCells - 1);
+            first.sharedEdge[2]  = true;
+            second.sharedEdge[0] = true;
+            second.sharedEdge[1] = (y < numCells - 1);
+            second.sharedEdge[2] = (x > 0);
+
+            scene.triangles.push_back(first);
+            scene.triangles.push_back(second);
+        }
+
+    return scene;
+}
+
+// Overlapping triangles of all sizes, some partially or fully outside the viewport. Snapped vertices lie on pixel
+// edges, where the subpixel fuzz reaches into the neighbouring pixels.
+TriangleSceneSpec generateRandomScene(de::Random &rnd, const tcu::IVec2 &viewportSize, int numTriangles,
+                                      bool snapToPixels)
+{
+    TriangleSceneSpec scene;
+
+    for (int triNdx = 0; triNdx < numTriangles; ++triNdx)
+    {
+        const tcu::Vec2 center = tcu::Vec2(rnd.getFloat(-10.0f, (float)viewportSize.x() + 10.0f),
+                                           rnd.getFloat(-10.0f, (float)viewportSize.y() + 10.0f));
+        const float size       = (triNdx % 8 == 0) ? rnd.getFloat(50.0f, 200.0f) : rnd.getFloat(1.0f, 20.0f);
+        TriangleSceneSpec::SceneTriangle triangle;
+
+        for (int vtxNdx = 0; vtxNdx < 3; ++vtxNdx)
+        {
+            const tcu::Vec2 offset = tcu::Vec2(rnd.getFloat(-size, size), rnd.getFloat(-size, size));
+            const tcu::Vec2 pos    = snapToPixels ? tcu::floor(center + offset) : center + offset;
+
+            triangle.positions[vtxNdx]  = toClipSpace(pos, viewportSize, rnd.getFloat(0.5f, 2.0f));
+            triangle.sharedEdge[vtxNdx] = rnd.getBool();
+        }
+
+        scene.triangles.push_back(triangle);
+    }
+
+    return scene;
+}
+
+void checkCoverageMaps(const TriangleSceneSpec &scene, const tcu::IVec2 &viewportSize, int subPixelBits,
+                       bool multisampled)
+{
+    const tcu::TextureFormat format(tcu::TextureFormat::R, tcu::TextureFormat::UNSIGNED_INT8);
+    tcu::TextureLevel coverageMap(format, viewportSize.x(), viewportSize.y());
+    tcu::TextureLevel referenceMap(format, viewportSize.x(), viewportSize.y());
+    const TriangleGrid grid(scene, viewportSize);
+
+    generateTriangleCoverageMap(coverageMap.getAccess(), scene, viewportSize, subPixelBits, multisampled);
+    generateTriangleCoverageMapReference(referenceMap.getAccess(), scene, viewportSize, subPixelBits, multisampled);
+
+    for (int y = 0; y < viewportSize.y(); ++y)
+        for (int x = 0; x < viewportSize.x(); ++x)
+        {
+            const std::vector<int> &candidates = grid.getCandidates(tcu::IVec2(x, y));
+
+            if (coverageMap.getAccess().getPixelUint(x, y) != referenceMap.getAccess().getPixelUint(x, y))
+                throw tcu::TestError("Coverage differs from reference at " + de::toString(tcu::IVec2(x, y)));
+
+            // Every triangle covering the pixel must be a candidate of the interpolation verifier.
+            for (int triNdx = 0; triNdx < (int)scene.triangles.size(); ++triNdx)
+            {
+                const CoverageType coverage = calculateTriangleCoverage(
+                    scene.triangles[triNdx].positions[0], scene.triangles[triNdx].positions[1],
+                    scene.triangles[triNdx].positions[2], tcu::IVec2(x, y), viewportSize, subPixelBits, multisampled);
+
+                if (coverage != COVERAGE_NONE &&
+                    (!grid.mayCover(triNdx, tcu::IVec2(x, y)) ||
+                     std::find(candidates.begin(), candidates.end(), triNdx) == candidates.end()))
+                    throw tcu::TestError("Triangle " + de::toString(triNdx) + " covering " +
+                                         de::toString(tcu::IVec2(x, y)) + " is not a grid candidate");
+            }
+        }
+}
+
+} // namespace
+
+void RasterizationVerifier_selfTest(void)
+{
+    const tcu::IVec2 viewportSizes[] = {tcu::IVec2(67, 45), tcu::IVec2(16, 16), tcu::IVec2(5, 90)};
+    const float inf                  = std::numeric_limits<float>::infinity();
+    de::Random rnd(0x5e1f);
+
+    for (int sizeNdx = 0; sizeNdx < DE_LENGTH_OF_ARRAY(viewportSizes); ++sizeNdx)
+        for (int multisampled = 0; multisampled < 2; ++multisampled)
+        {
+            const tcu::IVec2 &viewportSize = viewportSizes[sizeNdx];
+            const TriangleSceneSpec mesh   = generateMeshScene(rnd, viewportSize);
+            TriangleSceneSpec nonFinite    = generateRandomScene(rnd, viewportSize, 40, false);
+
+            checkCoverageMaps(mesh, viewportSize, 8, multisampled != 0);
+            checkCoverageMaps(generateRandomScene(rnd, viewportSize, 60, false), viewportSize, 8, multisampled != 0);
+            checkCoverageMaps(generateRandomScene(rnd, viewportSize, 60, true), viewportSize, 8, multisampled != 0);
+
+            // Vertices at infinity or with w = 0 cannot be binned and must not be skipped.
+            nonFinite.triangles[3].positions[1]  = tcu::Vec4(0.0f, 0.0f, 0.0f, 0.0f);
+            nonFinite.triangles[7].positions[0]  = tcu::Vec4(0.5f, -0.5f, 0.0f, 0.0f);
+            nonFinite.triangles[11].positions[2] = tcu::Vec4(inf, 0.0f, 0.0f, 1.0f);
+            nonFinite.triangles[19].positions[2] = tcu::Vec4(-inf, inf, 0.0f, 1.0f);
+            nonFinite.triangles.insert(nonFinite.triangles.end(), mesh.triangles.begin(), mesh.triangles.end());
+
+            checkCoverageMaps(nonFinite, viewportSize, 8, multisampled != 0);
+        }
+}
+
 } // namespace tcu
@@ -275,6 +275,8 @@ bool verifyTriangulatedLineGroupInterpolation(const tcu::Surface &surface, const
                                               const bool strictMode                      = true,
                                               const bool allowBresenhamForNonStrictLines = false);
 
+void RasterizationVerifier_selfTest(void);
+
 } // namespace tcu
 
 #endif // _TCURASTERIZATIONVERIFIER_HPP
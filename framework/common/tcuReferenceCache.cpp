@@ -0,0 +1,779 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Persistent cache for deterministic reference results.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuReferenceCache.hpp"
+#include "tcuTextureUtil.hpp"
+#include "deClock.h"
+#include "deFile.h"
+#include "deFilePath.hpp"
+#include "deDirectoryIterator.hpp"
+#include "deMemory.h"
+#include "deRandom.hpp"
+#include "deStringUtil.hpp"
+#include "qpInfo.h"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <set>
+
+namespace tcu
+{
+
+using std::string;
+using std::vector;
+
+namespace
+{
+
+enum
+{
+    OBJECT_MAGIC   = 0x4f524564, //!< "dERO"
+    KEY_MAGIC      = 0x4b524564, //!< "dERK"
+    FORMAT_VERSION = 1,
+};
+
+// Files are stored in host byte order; the cache is not meant to be moved between machines.
+struct ObjectHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint64_t lastUse; //!< Seconds since the epoch, updated on every hit.
+    uint64_t uncompressedSize;
+    uint64_t compressedSize;
+};
+
+struct KeyHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t codeVersion;
+    uint32_t casePathLength;
+    char contentName[40];
+};
+
+struct LevelHeader
+{
+    uint32_t order;
+    uint32_t type;
+    int32_t width;
+    int32_t height;
+    int32_t depth;
+};
+
+string renderHash(const deSha1 &hash)
+{
+    char hashStr[41];
+
+    deSha1_render(&hash, hashStr);
+    hashStr[40] = '\0';
+
+    return string(hashStr);
+}
+
+bool readFile(const string &path, vector<uint8_t> &dst)
+{
+    FILE *const file = fopen(path.c_str(), "rb");
+    bool ok          = false;
+
+    if (!file)
+        return false;
+
+    if (fseek(file, 0, SEEK_END) == 0)
+    {
+        const long size = ftell(file);
+
+        if (size > 0 && fseek(file, 0, SEEK_SET) == 0)
+        {
+            dst.resize((size_t)size);
+            ok = fread(&dst[0], 1, dst.size(), file) == dst.size();
+        }
+    }
+
+    fclose(file);
+    return ok;
+}
+
+bool readObjectHeader(const string &path, ObjectHeader &header)
+{
+    FILE *const file = fopen(path.c_str(), "rb");
+    bool ok          = false;
+
+    if (!file)
+        return false;
+
+    ok = fread(&header, sizeof(header), 1, file) == 1;
+    fclose(file);
+
+    return ok && header.magic == OBJECT_MAGIC && header.version == FORMAT_VERSION;
+}
+
+void touchObject(const string &path, uint64_t lastUse)
+{
+    // Updated in place; a lost update only makes the object look older than it is.
+    FILE *const file = fopen(path.c_str(), "r+b");
+
+    if (!file)
+        return;
+
+    if (fseek(file, (long)offsetof(ObjectHeader, lastUse), SEEK_SET) == 0)
+        fwrite(&lastUse, sizeof(lastUse), 1, file);
+
+    fclose(file);
+}
+
+uint64_t getObjectFileSize(const ObjectHeader &header)
+{
+    return sizeof(ObjectHeader) + header.compressedSize;
+}
+
+bool decodeObject(const vector<uint8_t> &data, const string &contentName, vector<uint8_t> &dst, ObjectHeader &header)
+{
+    if (data.size() < sizeof(ObjectHeader))
+        return false;
+
+    deMemcpy(&header, &data[0], sizeof(header));
+
+    if (header.magic != OBJECT_MAGIC || header.version != FORMAT_VERSION || data.size() != getObjectFileSize(header))
+        return false;
+
+    {
+        vector<uint8_t> result((size_t)header.uncompressedSize);
+        uLongf resultSize = (uLongf)result.size();
+        deSha1 hash;
+
+        if (result.empty() || uncompress(&result[0], &resultSize, &data[sizeof(ObjectHeader)],
+                                         (uLong)header.compressedSize) != Z_OK ||
+            resultSize != result.size())
+            return false;
+
+        // Content hash doubles as a checksum against truncated or corrupted files.
+        deSha1_compute(&hash, result.size(), &result[0]);
+
+        if (renderHash(hash) != contentName)
+            return false;
+
+        dst.swap(result);
+    }
+
+    return true;
+}
+
+bool encodeObject(const vector<uint8_t> &data, uint64_t lastUse, vector<uint8_t> &dst)
+{
+    uLongf compressedSize = compressBound((uLong)data.size());
+    ObjectHeader header;
+
+    dst.resize(sizeof(ObjectHeader) + (size_t)compressedSize);
+
+    // References are usually large flat images, so the fastest level already gets most of the gain.
+    if (compress2(&dst[sizeof(ObjectHeader)], &compressedSize, &data[0], (uLong)data.size(), Z_BEST_SPEED) != Z_OK)
+        return false;
+
+    header.magic            = OBJECT_MAGIC;
+    header.version          = FORMAT_VERSION;
+    header.lastUse          = lastUse;
+    header.uncompressedSize = data.size();
+    header.compressedSize   = compressedSize;
+
+    dst.resize(sizeof(ObjectHeader) + (size_t)compressedSize);
+    deMemcpy(&dst[0], &header, sizeof(header));
+
+    return true;
+}
+
+bool decodeKey(const vector<uint8_t> &data, string &contentName, string &casePath, uint32_t &codeVersion)
+{
+    KeyHeader header;
+
+    if (data.size() < sizeof(KeyHeader))
+        return false;
+
+    deMemcpy(&header, &data[0], sizeof(header));
+
+    if (header.magic != KEY_MAGIC || header.version != FORMAT_VERSION ||
+        data.size() != sizeof(KeyHeader) + header.casePathLength)
+        return false;
+
+    contentName = string(header.contentName, header.contentName + sizeof(header.contentName));
+    casePath    = string(data.begin() + sizeof(KeyHeader), data.end());
+    codeVersion = header.codeVersion;
+
+    return true;
+}
+
+vector<uint8_t> encodeKey(const ReferenceCacheKey &key, const string &contentName)
+{
+    const string &casePath = key.getCasePath();
+    vector<uint8_t> data(sizeof(KeyHeader) + casePath.size());
+    KeyHeader header;
+
+    DE_ASSERT(contentName.size() == sizeof(header.contentName));
+
+    header.magic          = KEY_MAGIC;
+    header.version        = FORMAT_VERSION;
+    header.codeVersion    = key.getCodeVersion();
+    header.casePathLength = (uint32_t)casePath.size();
+    deMemcpy(header.contentName, contentName.c_str(), sizeof(header.contentName));
+
+    deMemcpy(&data[0], &header, sizeof(header));
+    if (!casePath.empty())
+        deMemcpy(&data[sizeof(KeyHeader)], casePath.c_str(), casePath.size());
+
+    return data;
+}
+
+void ensureDirectory(const string &path)
+{
+    try
+    {
+        if (!de::FilePath(path).exists())
+            de::createDirectoryAndParents(path.c_str());
+    }
+    catch (const std::exception &)
+    {
+        // Another process may have created it; failures show up as failed writes.
+    }
+}
+
+} // namespace
+
+// ReferenceCacheKey
+
+ReferenceCacheKey::ReferenceCacheKey(const std::string &casePath, uint32_t codeVersion)
+    : m_casePath(casePath)
+    , m_codeVersion(codeVersion)
+{
+    const char *const releaseName = qpGetReleaseName();
+    const uint32_t releaseId      = qpGetReleaseId();
+
+    deSha1Stream_init(&m_stream);
+    deSha1Stream_process(&m_stream, casePath.size() + 1, casePath.c_str());
+    deSha1Stream_process(&m_stream, sizeof(codeVersion), &codeVersion);
+    deSha1Stream_process(&m_stream, strlen(releaseName) + 1, releaseName);
+    deSha1Stream_process(&m_stream, sizeof(releaseId), &releaseId);
+}
+
+ReferenceCacheKey &ReferenceCacheKey::addData(const void *data, size_t size)
+{
+    // Size is included so that consecutive inputs can not alias each other.
+    const uint64_t size64 = size;
+
+    deSha1Stream_process(&m_stream, sizeof(size64), &size64);
+    if (size > 0)
+        deSha1Stream_process(&m_stream, size, data);
+
+    return *this;
+}
+
+ReferenceCacheKey &ReferenceCacheKey::addString(const std::string &value)
+{
+    return addData(value.c_str(), value.size());
+}
+
+deSha1 ReferenceCacheKey::getHash(void) const
+{
+    deSha1Stream stream = m_stream;
+    deSha1 hash;
+
+    deSha1Stream_finalize(&stream, &hash);
+
+    return hash;
+}
+
+// ReferenceCache
+
+ReferenceCache::ReferenceCache(const std::string &directory, size_t maxSize)
+    : m_directory(directory)
+    , m_maxSize(maxSize)
+    , m_objectsScanned(false)
+    , m_totalSize(0)
+{
+}
+
+ReferenceCache::~ReferenceCache(void)
+{
+}
+
+std::string ReferenceCache::getKeyPath(const deSha1 &keyHash) const
+{
+    return de::FilePath::join(m_directory, "keys").join(renderHash(keyHash) + ".key").getPath();
+}
+
+std::string ReferenceCache::getObjectPath(const std::string &contentName) const
+{
+    return de::FilePath::join(m_directory, "objects").join(contentName + ".ref").getPath();
+}
+
+bool ReferenceCache::find(const ReferenceCacheKey &key, std::vector<uint8_t> &dst)
+{
+    if (!isEnabled())
+        return false;
+
+    {
+        const deSha1 keyHash = key.getHash();
+        de::ScopedLock lock(m_lock);
+        vector<uint8_t> keyData;
+        vector<uint8_t> objectData;
+        string contentName;
+        string casePath;
+        uint32_t codeVersion = 0;
+        ObjectHeader header;
+
+        if (!readFile(getKeyPath(keyHash), keyData) || !decodeKey(keyData, contentName, casePath, codeVersion) ||
+            casePath != key.getCasePath() || codeVersion != key.getCodeVersion())
+            return false;
+
+        if (!readFile(getObjectPath(contentName), objectData))
+            return false;
+
+        if (!decodeObject(objectData, contentName, dst, header))
+        {
+            // Objects are replaced atomically, so this is a corrupted file. Remove it so that the next insert
+            // writes it again.
+            deDeleteFile(getObjectPath(contentName).c_str());
+
+            if (m_objectsScanned && m_objects.find(contentName) != m_objects.end())
+            {
+                m_totalSize -= m_objects[contentName].size;
+                m_objects.erase(contentName);
+            }
+
+            return false;
+        }
+
+        {
+            const uint64_t now = deGetTime();
+
+            if (header.lastUse != now)
+                touchObject(getObjectPath(contentName), now);
+
+            if (m_objectsScanned)
+                m_objects[contentName].lastUse = now;
+        }
+
+        return true;
+    }
+}
+
+void ReferenceCache::insert(const ReferenceCacheKey &key, const std::vector<uint8_t> &data)
+{
+    if (!isEnabled() || data.empty())
+        return;
+
+    {
+        const deSha1 keyHash = key.getHash();
+        const uint64_t now   = deGetTime();
+        de::ScopedLock lock(m_lock);
+        string contentName;
+        string objectPath;
+
+        {
+            deSha1 contentHash;
+
+            deSha1_compute(&contentHash, data.size(), &data[0]);
+            contentName = renderHash(contentHash);
+            objectPath  = getObjectPath(contentName);
+        }
+
+        ensureDirectory(de::FilePath::join(m_directory, "keys").getPath());
+        ensureDirectory(de::FilePath::join(m_directory, "objects").getPath());
+
+        if (!m_objectsScanned)
+            scanObjects();
+
+        if (m_objects.find(contentName) == m_objects.end() || !deFileExists(objectPath.c_str()))
+        {
+            vector<uint8_t> objectData;
+
+            if (!encodeObject(data, now, objectData) ||
+                !deWriteFileAtomic(objectPath.c_str(), objectData.data(), objectData.size()))
+                return;
+
+            {
+                ObjectInfo &info = m_objects[contentName];
+
+                m_totalSize  = m_totalSize - info.size + objectData.size();
+                info.size    = objectData.size();
+                info.lastUse = now;
+            }
+        }
+        else
+        {
+            touchObject(objectPath, now);
+            m_objects[contentName].lastUse = now;
+        }
+
+        {
+            const vector<uint8_t> keyData = encodeKey(key, contentName);
+
+            if (!deWriteFileAtomic(getKeyPath(keyHash).c_str(), keyData.data(), keyData.size()))
+                return;
+        }
+
+        if (m_totalSize > m_maxSize)
+            evict(contentName);
+    }
+}
+
+bool ReferenceCache::find(const ReferenceCacheKey &key, TextureLevel &dst)
+{
+    vector<uint8_t> data;
+    LevelHeader header;
+
+    if (!find(key, data) || data.size() < sizeof(LevelHeader))
+        return false;
+
+    deMemcpy(&header, &data[0], sizeof(header));
+
+    if (header.order >= TextureFormat::CHANNELORDER_LAST || header.type >= TextureFormat::CHANNELTYPE_LAST)
+        return false;
+
+    {
+        const TextureFormat format((TextureFormat::ChannelOrder)header.order, (TextureFormat::ChannelType)header.type);
+        const IVec3 size(header.width, header.height, header.depth);
+
+        if (!isValid(format) || size.x() <= 0 || size.y() <= 0 || size.z() <= 0 ||
+            data.size() != sizeof(LevelHeader) + (size_t)format.getPixelSize() * size.x() * size.y() * size.z())
+            return false;
+
+        dst.setStorage(format, size.x(), size.y(), size.z());
+        copy(dst.getAccess(), ConstPixelBufferAccess(format, size, &data[sizeof(LevelHeader)]));
+    }
+
+    return true;
+}
+
+void ReferenceCache::insert(const ReferenceCacheKey &key, const ConstPixelBufferAccess &src)
+{
+    if (!isEnabled())
+        return;
+
+    {
+        const TextureFormat &format = src.getFormat();
+        vector<uint8_t> data(sizeof(LevelHeader) +
+                             (size_t)format.getPixelSize() * src.getWidth() * src.getHeight() * src.getDepth());
+        LevelHeader header;
+
+        header.order  = (uint32_t)format.order;
+        header.type   = (uint32_t)format.type;
+        header.width  = src.getWidth();
+        header.height = src.getHeight();
+        header.depth  = src.getDepth();
+
+        deMemcpy(&data[0], &header, sizeof(header));
+        copy(PixelBufferAccess(format, src.getSize(), &data[sizeof(LevelHeader)]), src);
+
+        insert(key, data);
+    }
+}
+
+void ReferenceCache::scanObjects(void)
+{
+    const de::FilePath objectDir = de::FilePath::join(m_directory, "objects");
+
+    m_objects.clear();
+    m_totalSize      = 0;
+    m_objectsScanned = true;
+
+    if (!objectDir.exists())
+        return;
+
+    for (de::DirectoryIterator iter(objectDir); iter.hasItem(); iter.next())
+    {
+        const de::FilePath item = iter.getItem();
+        ObjectHeader header;
+
+        if (item.getFileExtension() != "ref")
+            continue;
+
+        if (readObjectHeader(item.getPath(), header))
+        {
+            ObjectInfo &info = m_objects[item.getBaseName().substr(0, item.getBaseName().size() - 4)];
+
+            info.size    = getObjectFileSize(header);
+            info.lastUse = header.lastUse;
+            m_totalSize += info.size;
+        }
+        else
+            deDeleteFile(item.getPath());
+    }
+}
+
+void ReferenceCache::evict(const std::string &keepName)
+{
+    const uint64_t targetSize = m_maxSize - m_maxSize / 10;
+    vector<std::pair<uint64_t, string>> candidates;
+    std::set<string> evicted;
+
+    for (std::map<string, ObjectInfo>::const_iterator iter = m_objects.begin(); iter != m_objects.end(); ++iter)
+    {
+        if (iter->first != keepName)
+            candidates.push_back(std::make_pair(iter->second.lastUse, iter->first));
+    }
+
+    std::sort(candidates.begin(), candidates.end());
+
+    for (size_t ndx = 0; ndx < candidates.size() && m_totalSize > targetSize; ndx++)
+    {
+        const string &name = candidates[ndx].second;
+
+        deDeleteFile(getObjectPath(name).c_str());
+        m_totalSize -= m_objects[name].size;
+        m_objects.erase(name);
+        evicted.insert(name);
+    }
+
+    // Keys are tiny, but would otherwise accumulate without bound.
+    if (!evicted.empty())
+    {
+        for (de::DirectoryIterator iter(de::FilePath::join(m_directory, "keys")); iter.hasItem(); iter.next())
+        {
+            const de::FilePath item = iter.getItem();
+            vector<uint8_t> keyData;
+            string contentName;
+            string casePath;
+            uint32_t codeVersion = 0;
+
+            if (item.getFileExtension() != "key")
+                continue;
+
+            if (!readFile(item.getPath(), keyData) || !decodeKey(keyData, contentName, casePath, codeVersion) ||
+                evicted.find(contentName) != evicted.end())
+                deDeleteFile(item.getPath());
+        }
+    }
+}
+
+namespace
+{
+
+vector<uint8_t> makeSelfTestData(uint32_t seed, size_t size)
+{
+    de::Random rnd(seed);
+    vector<uint8_t> data(size);
+
+    // Random data does not compress, so all objects of the same size have the same size on disk.
+    for (size_t ndx = 0; ndx < data.size(); ndx++)
+        data[ndx] = rnd.getUint8();
+
+    return data;
+}
+
+void clearSelfTestDirectory(const string &directory)
+{
+    const char *const subdirs[] = {"keys", "objects"};
+
+    for (int subdirNdx = 0; subdirNdx < DE_LENGTH_OF_ARRAY(subdirs); subdirNdx++)
+    {
+        const de::FilePath subdir = de::FilePath::join(directory, subdirs[subdirNdx]);
+
+        if (!subdir.exists())
+            continue;
+
+        for (de::DirectoryIterator iter(subdir); iter.hasItem(); iter.next())
+            deDeleteFile(iter.getItem().getPath());
+    }
+}
+
+bool isCached(ReferenceCache &cache, const ReferenceCacheKey &key, const vector<uint8_t> &expected)
+{
+    vector<uint8_t> data;
+
+    return cache.find(key, data) && data == expected;
+}
+
+} // namespace
+
+void ReferenceCache_selfTest(void)
+{
+    const string directory = "tcu-reference-cache-selftest";
+    const size_t dataSize  = 4096;
+
+    clearSelfTestDirectory(directory);
+
+    // Hit and miss
+    {
+        ReferenceCache cache(directory, 1u << 20);
+        const vector<uint8_t> data = makeSelfTestData(1u, dataSize);
+        ReferenceCacheKey key("case.a", 1u);
+        ReferenceCacheKey otherKey("case.a", 1u);
+        vector<uint8_t> result;
+
+        key.add(1);
+        otherKey.add(2);
+
+        TCU_CHECK(!cache.find(key, result));
+        cache.insert(key, data);
+        TCU_CHECK(isCached(cache, key, data));
+        TCU_CHECK(!cache.find(otherKey, result));
+
+        // Results persist over cache instances.
+        {
+            ReferenceCache otherCache(directory, 1u << 20);
+
+            TCU_CHECK(isCached(otherCache, key, data));
+        }
+
+        // Disabled cache
+        {
+            ReferenceCache disabledCache("", 1u << 20);
+
+            disabledCache.insert(otherKey, data);
+            TCU_CHECK(!disabledCache.find(key, result));
+        }
+    }
+
+    // Texture levels
+    {
+        ReferenceCache cache(directory, 1u << 20);
+        const ReferenceCacheKey key("case.level", 1u);
+        TextureLevel level(TextureFormat(TextureFormat::RGBA, TextureFormat::UNORM_INT8), 7, 5);
+        TextureLevel result;
+
+        for (int y = 0; y < level.getHeight(); y++)
+            for (int x = 0; x < level.getWidth(); x++)
+                level.getAccess().setPixel(IVec4(x, y, x * y, 255), x, y);
+
+        cache.insert(key, level.getAccess());
+        TCU_CHECK(cache.find(key, result));
+        TCU_CHECK(result.getFormat() == level.getFormat() && result.getSize() == level.getSize());
+
+        for (int y = 0; y < level.getHeight(); y++)
+            for (int x = 0; x < level.getWidth(); x++)
+                TCU_CHECK(result.getAccess().getPixelInt(x, y) == level.getAccess().getPixelInt(x, y));
+    }
+
+    // Key file of a different case path or code version
+    {
+        ReferenceCache cache(directory, 1u << 20);
+        const vector<uint8_t> data = makeSelfTestData(2u, dataSize);
+        const ReferenceCacheKey key("case.b", 1u);
+        const ReferenceCacheKey versionKey("case.b", 2u);
+        const ReferenceCacheKey pathKey("case.c", 1u);
+        vector<uint8_t> keyData;
+
+        cache.insert(key, data);
+        TCU_CHECK(isCached(cache, key, data));
+        TCU_CHECK(!isCached(cache, versionKey, data));
+        TCU_CHECK(!isCached(cache, pathKey, data));
+
+        // Simulate hash collisions by storing the key file of key under the names of the other keys.
+        TCU_CHECK(readFile(cache.getKeyPath(key.getHash()), keyData));
+        TCU_CHECK(deWriteFileAtomic(cache.getKeyPath(versionKey.getHash()).c_str(), keyData.data(), keyData.size()));
+        TCU_CHECK(deWriteFileAtomic(cache.getKeyPath(pathKey.getHash()).c_str(), keyData.data(), keyData.size()));
+        TCU_CHECK(!isCached(cache, versionKey, data));
+        TCU_CHECK(!isCached(cache, pathKey, data));
+    }
+
+    // Corrupted and truncated objects
+    {
+        ReferenceCache cache(directory, 1u << 20);
+        const vector<uint8_t> data = makeSelfTestData(3u, dataSize);
+        const ReferenceCacheKey key("case.d", 1u);
+        string objectPath;
+        vector<uint8_t> keyData;
+        vector<uint8_t> objectData;
+        string contentName;
+        string casePath;
+        uint32_t codeVersion = 0;
+
+        cache.insert(key, data);
+        TCU_CHECK(readFile(cache.getKeyPath(key.getHash()), keyData));
+        TCU_CHECK(decodeKey(keyData, contentName, casePath, codeVersion));
+        objectPath = cache.getObjectPath(contentName);
+        TCU_CHECK(readFile(objectPath, objectData));
+
+        {
+            vector<uint8_t> corrupted = objectData;
+
+            corrupted[corrupted.size() / 2] ^= 0xff;
+            TCU_CHECK(deWriteFileAtomic(objectPath.c_str(), corrupted.data(), corrupted.size()));
+            TCU_CHECK(!isCached(cache, key, data));
+        }
+
+        TCU_CHECK(deWriteFileAtomic(objectPath.c_str(), objectData.data(), objectData.size() - 1));
+        TCU_CHECK(!isCached(cache, key, data));
+
+        // Inserting again repairs the object.
+        cache.insert(key, data);
+        TCU_CHECK(isCached(cache, key, data));
+    }
+
+    clearSelfTestDirectory(directory);
+
+    // Least recently used objects are evicted first.
+    {
+        const ReferenceCacheKey keys[] = {
+            ReferenceCacheKey("case.e", 1u),
+            ReferenceCacheKey("case.f", 1u),
+            ReferenceCacheKey("case.g", 1u),
+            ReferenceCacheKey("case.h", 1u),
+        };
+        const uint64_t lastUses[] = {100u, 300u, 200u};
+        vector<vector<uint8_t>> data;
+        uint64_t objectSize = 0;
+
+        for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(keys); ndx++)
+            data.push_back(makeSelfTestData(10u + ndx, dataSize));
+
+        {
+            ReferenceCache cache(directory, 1u << 20);
+
+            for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(lastUses); ndx++)
+            {
+                deSha1 contentHash;
+
+                cache.insert(keys[ndx], data[ndx]);
+
+                deSha1_compute(&contentHash, data[ndx].size(), &data[ndx][0]);
+                touchObject(cache.getObjectPath(renderHash(contentHash)), lastUses[ndx]);
+            }
+
+            objectSize = cache.m_totalSize / DE_LENGTH_OF_ARRAY(lastUses);
+        }
+
+        {
+            // Four objects do not fit, and evicting one brings the total below 90% of the limit.
+            ReferenceCache cache(directory, (size_t)(objectSize * 3 + objectSize / 2));
+
+            // A hit makes the oldest object the most recently used one.
+            TCU_CHECK(isCached(cache, keys[0], data[0]));
+
+            cache.insert(keys[3], data[3]);
+
+            TCU_CHECK(isCached(cache, keys[0], data[0]));
+            TCU_CHECK(isCached(cache, keys[1], data[1]));
+            TCU_CHECK(!isCached(cache, keys[2], data[2]));
+            TCU_CHECK(isCached(cache, keys[3], data[3]));
+            TCU_CHECK(!deFileExists(cache.getKeyPath(keys[2].getHash()).c_str()));
+        }
+    }
+
+    clearSelfTestDirectory(directory);
+}
+
+} // namespace tcu
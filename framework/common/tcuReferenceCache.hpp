@@ -0,0 +1,172 @@
+#ifndef _TCUREFERENCECACHE_HPP
+#define _TCUREFERENCECACHE_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Persistent cache for deterministic reference results.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "tcuTexture.hpp"
+#include "deMutex.hpp"
+#include "deSha1.h"
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace tcu
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Key of a cached reference result
+ *
+ * Identifies a reference result by the case producing it, the build, a
+ * version of the code computing it and all inputs the result depends on.
+ *
+ * The release name and id are included automatically. Development builds
+ * share a release id and are identified by their git revision only, so
+ * callers should also add a hash of the sources computing the reference,
+ * such as rr::getSourceHash(). The version must still be bumped when the
+ * reference computation changes in code not covered by such a hash.
+ *//*--------------------------------------------------------------------*/
+class ReferenceCacheKey
+{
+public:
+    ReferenceCacheKey(const std::string &casePath, uint32_t codeVersion);
+
+    ReferenceCacheKey &addData(const void *data, size_t size);
+    ReferenceCacheKey &addString(const std::string &value);
+
+    //! Add scalar value. Structs may contain padding and must be added member by member.
+    template <typename T>
+    ReferenceCacheKey &add(const T &value)
+    {
+        return addData(&value, sizeof(T));
+    }
+
+    const std::string &getCasePath(void) const
+    {
+        return m_casePath;
+    }
+    uint32_t getCodeVersion(void) const
+    {
+        return m_codeVersion;
+    }
+
+    //! Hash of case path, build, code version and inputs.
+    deSha1 getHash(void) const;
+
+private:
+    std::string m_casePath;
+    uint32_t m_codeVersion;
+    deSha1Stream m_stream;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Persistent cache for deterministic reference results
+ *
+ * Reference results are stored compressed in a content-addressed object
+ * store, so identical results produced by different keys are stored only
+ * once. Keys are small files pointing to objects. When the total size of
+ * the objects exceeds the limit, least recently used objects are removed.
+ *
+ * The cache directory may be shared by several processes. Files are
+ * written to temporary files and renamed in place, and all reads validate
+ * the data, so a concurrent writer or a removed object only causes a miss.
+ *
+ * A cache constructed with an empty directory is disabled: lookups always
+ * miss and inserts are ignored.
+ *//*--------------------------------------------------------------------*/
+class ReferenceCache
+{
+public:
+    ReferenceCache(const std::string &directory, size_t maxSize);
+    ~ReferenceCache(void);
+
+    bool isEnabled(void) const
+    {
+        return !m_directory.empty();
+    }
+
+    bool find(const ReferenceCacheKey &key, std::vector<uint8_t> &dst);
+    void insert(const ReferenceCacheKey &key, const std::vector<uint8_t> &data);
+
+    //! Texture levels are stored in linear layout with tightly packed rows.
+    bool find(const ReferenceCacheKey &key, TextureLevel &dst);
+    void insert(const ReferenceCacheKey &key, const ConstPixelBufferAccess &src);
+
+    //! Fill dst from the cache or call compute(dst) and store the result.
+    template <typename Compute>
+    void getOrCompute(const ReferenceCacheKey &key, std::vector<uint8_t> &dst, Compute compute)
+    {
+        if (!find(key, dst))
+        {
+            compute(dst);
+            insert(key, dst);
+        }
+    }
+
+    template <typename Compute>
+    void getOrCompute(const ReferenceCacheKey &key, TextureLevel &dst, Compute compute)
+    {
+        if (!find(key, dst))
+        {
+            compute(dst);
+            insert(key, dst.getAccess());
+        }
+    }
+
+private:
+    friend void ReferenceCache_selfTest(void);
+
+    ReferenceCache(const ReferenceCache &);
+    ReferenceCache &operator=(const ReferenceCache &);
+
+    struct ObjectInfo
+    {
+        ObjectInfo(void) : size(0), lastUse(0)
+        {
+        }
+
+        uint64_t size;
+        uint64_t lastUse;
+    };
+
+    std::string getKeyPath(const deSha1 &keyHash) const;
+    std::string getObjectPath(const std::string &contentName) const;
+
+    void scanObjects(void);
+    void evict(const std::string &keepName);
+
+    const std::string m_directory;
+    const uint64_t m_maxSize;
+
+    de::Mutex m_lock;
+    bool m_objectsScanned; //!< Object sizes are only needed for eviction and are scanned at first insert.
+    std::map<std::string, ObjectInfo> m_objects;
+    uint64_t m_totalSize;
+};
+
+void ReferenceCache_selfTest(void);
+
+} // namespace tcu
+
+#endif // _TCUREFERENCECACHE_HPP
@@ -81,7 +81,13 @@ void TestNode::addRootChild(const std::string &groupName, const CaseListFilter *
     if (caseListFilter && !caseListFilter->checkTestGroupName((m_name + "." + groupName).c_str()))
         return;
 
-    return addChild(createTestGroup(m_testCtx, groupName));
+    addDeferredChild(groupName, createTestGroup);
+}
+
+void TestNode::addDeferredChild(const std::string &groupName,
+                                TestCaseGroup *(*createTestGroup)(tcu::TestContext &testCtx, const std::string &name))
+{
+    addChild(new DeferredTestCaseGroup(m_testCtx, groupName, createTestGroup));
 }
 
 void TestNode::addChild(TestNode *node)
@@ -154,6 +160,59 @@ TestCase::IterateResult TestCaseGroup::iterate(void)
     throw InternalError("TestCaseGroup::iterate() called!", "", __FILE__, __LINE__);
 }
 
+// DeferredTestCaseGroup
+
+DeferredTestCaseGroup::DeferredTestCaseGroup(TestContext &testCtx, const std::string &name, CreateFunc createGroup)
+    : TestCaseGroup(testCtx, name.c_str())
+    , m_createGroup(createGroup)
+    , m_group(DE_NULL)
+{
+}
+
+DeferredTestCaseGroup::~DeferredTestCaseGroup(void)
+{
+    DeferredTestCaseGroup::deinit();
+}
+
+void DeferredTestCaseGroup::init(void)
+{
+    DE_ASSERT(!m_group);
+
+    m_group = m_createGroup(m_testCtx, m_name);
+    DE_ASSERT(m_name == m_group->getName());
+
+    try
+    {
+        m_group->init();
+    }
+    catch (...)
+    {
+        delete m_group;
+        m_group = DE_NULL;
+        throw;
+    }
+}
+
+void DeferredTestCaseGroup::deinit(void)
+{
+    if (m_group)
+    {
+        m_group->deinit();
+        delete m_group;
+        m_group = DE_NULL;
+    }
+
+    TestCaseGroup::deinit();
+}
+
+void DeferredTestCaseGroup::getChildren(vector<TestNode *> &children) const
+{
+    if (m_group)
+        m_group->getChildren(children);
+    else
+        children.clear();
+}
+
 // TestCase
 
 TestCase::TestCase(TestContext &testCtx, const char *name) : TestNode(testCtx, NODETYPE_SELF_VALIDATE, name)
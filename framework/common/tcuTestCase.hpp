@@ -134,9 +134,11 @@ public:
     {
         return m_name.c_str();
     }
-    void getChildren(std::vector<TestNode *> &children) const;
+    virtual void getChildren(std::vector<TestNode *> &children) const;
     void addRootChild(const std::string &groupName, const CaseListFilter *caseListFilter,
                       TestCaseGroup *(*createTestGroup)(tcu::TestContext &testCtx, const std::string &name));
+    void addDeferredChild(const std::string &groupName,
+                          TestCaseGroup *(*createTestGroup)(tcu::TestContext &testCtx, const std::string &name));
     void addChild(TestNode *node);
     bool empty() const
     {
@@ -189,6 +191,34 @@ public:
     virtual IterateResult iterate(void);
 };
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Deferred test case group node
+ *
+ * Deferred group only declares the name of a child group. The actual group
+ * is created with the supplied function when the group is entered (init())
+ * and destroyed when it is left (deinit()). Subtrees that are filtered out
+ * or pruned by the test tree manifest are thus never constructed.
+ *//*--------------------------------------------------------------------*/
+class DeferredTestCaseGroup : public TestCaseGroup
+{
+public:
+    typedef TestCaseGroup *(*CreateFunc)(TestContext &testCtx, const std::string &name);
+
+    DeferredTestCaseGroup(TestContext &testCtx, const std::string &name, CreateFunc createGroup);
+    virtual ~DeferredTestCaseGroup(void);
+
+    virtual void init(void);
+    virtual void deinit(void);
+    virtual void getChildren(std::vector<TestNode *> &children) const;
+
+private:
+    DeferredTestCaseGroup(const DeferredTestCaseGroup &);            // not allowed!
+    DeferredTestCaseGroup &operator=(const DeferredTestCaseGroup &); // not allowed!
+
+    const CreateFunc m_createGroup;
+    TestCaseGroup *m_group;
+};
+
 /*--------------------------------------------------------------------*//*!
  * \brief Test case class
  *
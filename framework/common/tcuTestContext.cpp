@@ -24,6 +24,7 @@
 #include "tcuTestContext.hpp"
 #include "tcuCommandLine.hpp"
 #include "tcuTestLog.hpp"
+#include "tcuReferenceCache.hpp"
 
 namespace tcu
 {
@@ -38,10 +39,16 @@ TestContext::TestContext(Platform &platform, Archive &rootArchive, TestLog &log,
     , m_curArchive(DE_NULL)
     , m_testResult(QP_TEST_RESULT_LAST)
     , m_terminateAfter(false)
+    , m_referenceCache(
+          new ReferenceCache(cmdLine.getReferenceCacheDir(), (size_t)de::max(0, cmdLine.getReferenceCacheSize()) << 20))
 {
     setCurrentArchive(m_rootArchive);
 }
 
+TestContext::~TestContext(void)
+{
+}
+
 void TestContext::writeSessionInfo(void)
 {
     const std::string sessionInfo = "#sessionInfo commandLineParameters \"";
@@ -26,6 +26,7 @@
 #include "tcuDefs.hpp"
 #include "qpWatchDog.h"
 #include "qpTestLog.h"
+#include "deUniquePtr.hpp"
 
 #include <string>
 
@@ -36,6 +37,7 @@ class Archive;
 class Platform;
 class CommandLine;
 class TestLog;
+class ReferenceCache;
 
 /*--------------------------------------------------------------------*//*!
  * \brief Test context
@@ -50,9 +52,7 @@ class TestContext
 public:
     TestContext(Platform &platform, Archive &rootArchive, TestLog &log, const CommandLine &cmdLine,
                 qpWatchDog *watchDog);
-    ~TestContext(void)
-    {
-    }
+    ~TestContext(void);
 
     void writeSessionInfo(void);
 
@@ -77,6 +77,15 @@ public:
     {
         return m_cmdLine;
     }
+    ReferenceCache &getReferenceCache(void)
+    {
+        return *m_referenceCache;
+    }
+    //! Path of the case being executed, or empty outside of case execution.
+    const std::string &getCurrentCasePath(void) const
+    {
+        return m_currentCasePath;
+    }
 
     // API for test framework
     qpTestResult getTestResult(void) const
@@ -101,6 +110,11 @@ public:
         m_curArchive = &archive;
     }
 
+    void setCurrentCasePath(const std::string &casePath)
+    {
+        m_currentCasePath = casePath;
+    }
+
     void setTerminateAfter(bool terminate)
     {
         m_terminateAfter = terminate;
@@ -120,10 +134,13 @@ protected:
     const CommandLine &m_cmdLine; //!< Command line.
     qpWatchDog *m_watchDog;       //!< Watchdog (can be null).
 
-    Archive *m_curArchive;        //!< Current archive for test cases.
-    qpTestResult m_testResult;    //!< Latest test result.
-    std::string m_testResultDesc; //!< Latest test result description.
-    bool m_terminateAfter;        //!< Should tester terminate after execution of the current test
+    Archive *m_curArchive;         //!< Current archive for test cases.
+    qpTestResult m_testResult;     //!< Latest test result.
+    std::string m_testResultDesc;  //!< Latest test result description.
+    bool m_terminateAfter;         //!< Should tester terminate after execution of the current test
+    std::string m_currentCasePath; //!< Path of the case being executed.
+
+    const de::UniquePtr<ReferenceCache> m_referenceCache; //!< Cache for deterministic reference results.
 };
 
 } // namespace tcu
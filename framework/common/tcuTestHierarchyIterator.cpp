@@ -23,6 +23,9 @@
 
 #include "tcuTestHierarchyIterator.hpp"
 #include "tcuCommandLine.hpp"
+#include "tcuTestTreeManifest.hpp"
+
+#include "deString.h"
 
 namespace tcu
 {
@@ -88,13 +91,22 @@ void DefaultHierarchyInflater::leaveGroupNode(TestCaseGroup *testGroup)
 // TestHierarchyIterator
 
 TestHierarchyIterator::TestHierarchyIterator(TestPackageRoot &rootNode, TestHierarchyInflater &inflater,
-                                             const CaseListFilter &caseListFilter)
+                                             const CaseListFilter &caseListFilter, const TestTreeManifest *manifest)
     : m_inflater(inflater)
     , m_caseListFilter(caseListFilter)
+    , m_manifest(DE_NULL)
+    , m_manifestMismatched(false)
     , m_groupNumber(0)
 {
+    // Without a restrictive filter every group would be inflated anyway.
+    if (manifest && caseListFilter.isRestrictive())
+    {
+        m_manifest  = manifest;
+        m_selection = de::MovePtr<TestTreeSelection>(new TestTreeSelection(*manifest, caseListFilter));
+    }
+
     // Init traverse state and "seek" to first reportable node.
-    NodeIter iter(&rootNode);
+    NodeIter iter(&rootNode, m_manifest ? 0 : -1);
     iter.setState(NodeIter::NISTATE_ENTER); // Root is never reported
     m_sessionStack.push_back(iter);
     next();
@@ -116,7 +128,8 @@ TestHierarchyIterator::~TestHierarchyIterator(void)
             m_inflater.leaveTestPackage(static_cast<TestPackage *>(node));
             break;
         case NODETYPE_GROUP:
-            m_inflater.leaveGroupNode(static_cast<TestCaseGroup *>(node));
+            if (!iter->isPruned)
+                m_inflater.leaveGroupNode(static_cast<TestCaseGroup *>(node));
             break;
         default:
             break;
@@ -163,6 +176,35 @@ std::string TestHierarchyIterator::buildNodePath(const vector<NodeIter> &nodeSta
     return nodePath;
 }
 
+int TestHierarchyIterator::getChildManifestIndex(NodeIter &parent, const TestNode *childNode)
+{
+    if (!m_manifest || parent.childManifestNdx < 0)
+        return -1;
+
+    {
+        const int childNdx  = parent.childManifestNdx;
+        const int parentEnd = parent.manifestNdx + m_manifest->getSubtreeSize(parent.manifestNdx);
+
+        if (childNdx >= parentEnd || m_manifest->getNodeType(childNdx) != childNode->getNodeType() ||
+            !deStringEqual(m_manifest->getName(childNdx), childNode->getName()))
+        {
+            ignoreManifest(m_nodePath + "." + childNode->getName());
+            return -1;
+        }
+
+        parent.childManifestNdx += m_manifest->getSubtreeSize(childNdx);
+        return childNdx;
+    }
+}
+
+void TestHierarchyIterator::ignoreManifest(const std::string &nodePath)
+{
+    print("WARNING: Test tree manifest does not match test hierarchy at '%s', ignoring manifest\n", nodePath.c_str());
+    m_manifest           = DE_NULL;
+    m_manifestMismatched = true;
+    m_selection.clear();
+}
+
 void TestHierarchyIterator::next(void)
 {
     while (!m_sessionStack.empty())
@@ -203,6 +245,17 @@ void TestHierarchyIterator::next(void)
                 iter.setState(NodeIter::NISTATE_TRAVERSE_CHILDREN);
                 iter.children.clear();
 
+                if (node->getNodeType() == NODETYPE_GROUP && m_manifest && iter.manifestNdx >= 0 &&
+                    m_selection->getNumSelectedCases(iter.manifestNdx) == 0 &&
+                    !m_selection->hasLookupMiss(iter.manifestNdx))
+                {
+                    // Nothing to run in this subtree. Account for the groups that would have
+                    // been entered to keep case fraction group numbering intact.
+                    iter.isPruned = true;
+                    m_groupNumber += m_selection->getNumEnteredGroups(iter.manifestNdx);
+                    break;
+                }
+
                 switch (node->getNodeType())
                 {
                 case NODETYPE_ROOT:
@@ -217,6 +270,9 @@ void TestHierarchyIterator::next(void)
                 default:
                     DE_ASSERT(false);
                 }
+
+                if (iter.manifestNdx >= 0)
+                    iter.childManifestNdx = iter.manifestNdx + 1;
             }
 
             break;
@@ -228,7 +284,8 @@ void TestHierarchyIterator::next(void)
             if (++iter.curChildNdx < numChildren)
             {
                 // Push child to stack.
-                TestNode *childNode = iter.children[iter.curChildNdx];
+                TestNode *childNode        = iter.children[iter.curChildNdx];
+                const int childManifestNdx = getChildManifestIndex(iter, childNode);
 
                 // Check whether this is a bottom-level group (child is executable)
                 // and whether that group should be filtered out.
@@ -238,10 +295,15 @@ void TestHierarchyIterator::next(void)
                     if (!m_caseListFilter.checkCaseFraction(m_groupNumber, testName))
                         break;
                 }
-                m_sessionStack.push_back(NodeIter(childNode));
+                m_sessionStack.push_back(NodeIter(childNode, childManifestNdx));
             }
             else
             {
+                // Children removed from the hierarchy are left over in the manifest.
+                if (m_manifest && iter.childManifestNdx >= 0 &&
+                    iter.childManifestNdx != iter.manifestNdx + m_manifest->getSubtreeSize(iter.manifestNdx))
+                    ignoreManifest(m_nodePath);
+
                 iter.setState(NodeIter::NISTATE_LEAVE);
                 if (node->getNodeType() != NODETYPE_ROOT)
                     return; // Yield leave event
@@ -263,7 +325,8 @@ void TestHierarchyIterator::next(void)
                     m_inflater.leaveTestPackage(static_cast<TestPackage *>(node));
                     break;
                 case NODETYPE_GROUP:
-                    m_inflater.leaveGroupNode(static_cast<TestCaseGroup *>(node));
+                    if (!iter.isPruned)
+                        m_inflater.leaveGroupNode(static_cast<TestCaseGroup *>(node));
                     break;
                 default:
                     DE_ASSERT(false);
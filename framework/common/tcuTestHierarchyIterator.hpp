@@ -27,6 +27,7 @@
 #include "tcuTestContext.hpp"
 #include "tcuTestCase.hpp"
 #include "tcuTestPackage.hpp"
+#include "deUniquePtr.hpp"
 
 #include <vector>
 
@@ -34,6 +35,8 @@ namespace tcu
 {
 
 class CaseListFilter;
+class TestTreeManifest;
+class TestTreeSelection;
 
 /*--------------------------------------------------------------------*//*!
  * \brief Test hierarchy inflater
@@ -103,12 +106,17 @@ protected:
  * Upon exiting a group node, before STATE_LEAVE_NODE is called, inflater
  * is asked to clean up any resources by calling leaveGroupNode() or
  * leaveTestPackage() depending on the type of the node.
+ *
+ * If a test tree manifest is supplied and the filter is restrictive, groups
+ * that contain no selected test cases are reported but never inflated.
+ * Manifest is ignored from the first node that does not match it, and
+ * isManifestMismatched() reports that it should be rebuilt.
  *//*--------------------------------------------------------------------*/
 class TestHierarchyIterator
 {
 public:
     TestHierarchyIterator(TestPackageRoot &rootNode, TestHierarchyInflater &inflater,
-                          const CaseListFilter &caseListFilter);
+                          const CaseListFilter &caseListFilter, const TestTreeManifest *manifest = DE_NULL);
     ~TestHierarchyIterator(void);
 
     enum State
@@ -127,6 +135,12 @@ public:
 
     void next(void);
 
+    //! Check if an inflated group did not match the manifest.
+    bool isManifestMismatched(void) const
+    {
+        return m_manifestMismatched;
+    }
+
 private:
     struct NodeIter
     {
@@ -140,11 +154,23 @@ private:
             NISTATE_LAST
         };
 
-        NodeIter(void) : node(DE_NULL), curChildNdx(-1), m_state(NISTATE_LAST)
+        NodeIter(void)
+            : node(DE_NULL)
+            , curChildNdx(-1)
+            , manifestNdx(-1)
+            , childManifestNdx(-1)
+            , isPruned(false)
+            , m_state(NISTATE_LAST)
         {
         }
 
-        NodeIter(TestNode *node_) : node(node_), curChildNdx(-1), m_state(NISTATE_INIT)
+        NodeIter(TestNode *node_, int manifestNdx_)
+            : node(node_)
+            , curChildNdx(-1)
+            , manifestNdx(manifestNdx_)
+            , childManifestNdx(-1)
+            , isPruned(false)
+            , m_state(NISTATE_INIT)
         {
         }
 
@@ -171,6 +197,9 @@ private:
         TestNode *node;
         std::vector<TestNode *> children;
         int curChildNdx;
+        int manifestNdx;      //!< Manifest entry of node, or -1 if not known.
+        int childManifestNdx; //!< Manifest entry of next child.
+        bool isPruned;        //!< Group has no selected cases and was not inflated.
 
     private:
         State m_state;
@@ -184,9 +213,17 @@ private:
 
     static std::string buildNodePath(const std::vector<NodeIter> &nodeStack);
 
+    int getChildManifestIndex(NodeIter &parent, const TestNode *childNode);
+    void ignoreManifest(const std::string &nodePath);
+
     TestHierarchyInflater &m_inflater;
     const CaseListFilter &m_caseListFilter;
 
+    // Manifest and the selection derived from it, used to skip groups with no selected cases.
+    const TestTreeManifest *m_manifest;
+    de::MovePtr<TestTreeSelection> m_selection;
+    bool m_manifestMismatched;
+
     // Current session state.
     std::vector<NodeIter> m_sessionStack;
     std::string m_nodePath;
@@ -24,6 +24,7 @@
 #include "tcuTestHierarchyUtil.hpp"
 #include "tcuStringTemplate.hpp"
 #include "tcuCommandLine.hpp"
+#include "tcuTestTreeManifest.hpp"
 
 #include "qpXmlWriter.h"
 
@@ -65,16 +66,37 @@ static std::string makePackageFilename(const std::string &pattern, const std::st
     return StringTemplate(pattern).specialize(args);
 }
 
-static void writeXmlCaselist(TestHierarchyIterator &iter, qpXmlWriter *writer)
+// Caselist writers work both on the test hierarchy and on the test tree manifest.
+
+static const char *getNodeName(const TestHierarchyIterator &iter)
+{
+    return iter.getNode()->getName();
+}
+
+static TestNodeType getNodeType(const TestHierarchyIterator &iter)
 {
-    DE_ASSERT(iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE &&
-              iter.getNode()->getNodeType() == NODETYPE_PACKAGE);
+    return iter.getNode()->getNodeType();
+}
+
+static const char *getNodeName(const TestTreeManifestIterator &iter)
+{
+    return iter.getNodeName();
+}
+
+static TestNodeType getNodeType(const TestTreeManifestIterator &iter)
+{
+    return iter.getNodeType();
+}
+
+template <typename Iterator>
+static void writeXmlCaselist(Iterator &iter, qpXmlWriter *writer)
+{
+    DE_ASSERT(iter.getState() == Iterator::STATE_ENTER_NODE && getNodeType(iter) == NODETYPE_PACKAGE);
 
     {
-        const TestNode *node = iter.getNode();
         qpXmlAttribute attribs[1];
         int numAttribs        = 0;
-        attribs[numAttribs++] = qpSetStringAttrib("PackageName", node->getName());
+        attribs[numAttribs++] = qpSetStringAttrib("PackageName", getNodeName(iter));
         DE_ASSERT(numAttribs <= DE_LENGTH_OF_ARRAY(attribs));
 
         if (!qpXmlWriter_startDocument(writer, true) ||
@@ -84,18 +106,16 @@ static void writeXmlCaselist(TestHierarchyIterator &iter, qpXmlWriter *writer)
 
     iter.next();
 
-    while (iter.getNode()->getNodeType() != NODETYPE_PACKAGE)
+    while (getNodeType(iter) != NODETYPE_PACKAGE)
     {
-        const TestNode *const node  = iter.getNode();
-        const TestNodeType nodeType = node->getNodeType();
-        const bool isEnter          = iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE;
+        const TestNodeType nodeType = getNodeType(iter);
+        const bool isEnter          = iter.getState() == Iterator::STATE_ENTER_NODE;
 
-        DE_ASSERT(iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE ||
-                  iter.getState() == TestHierarchyIterator::STATE_LEAVE_NODE);
+        DE_ASSERT(iter.getState() == Iterator::STATE_ENTER_NODE || iter.getState() == Iterator::STATE_LEAVE_NODE);
         {
             if (isEnter)
             {
-                const string caseName = node->getName();
+                const string caseName = getNodeName(iter);
                 qpXmlAttribute attribs[2];
                 int numAttribs = 0;
 
@@ -121,26 +141,17 @@ static void writeXmlCaselist(TestHierarchyIterator &iter, qpXmlWriter *writer)
         throw Exception("Failed to terminate XML document");
 }
 
-/*--------------------------------------------------------------------*//*!
- * \brief Export the test list of each package into a separate XML file.
- *//*--------------------------------------------------------------------*/
-void writeXmlCaselistsToFiles(TestPackageRoot &root, TestContext &testCtx, const CommandLine &cmdLine)
+template <typename Iterator>
+static void writeXmlCaselists(Iterator &iter, const CommandLine &cmdLine)
 {
-    DefaultHierarchyInflater inflater(testCtx);
-    de::MovePtr<const CaseListFilter> caseListFilter(
-        testCtx.getCommandLine().createCaseListFilter(testCtx.getArchive()));
-
-    TestHierarchyIterator iter(root, inflater, *caseListFilter);
     const char *const filenamePattern = cmdLine.getCaseListExportFile();
 
-    while (iter.getState() != TestHierarchyIterator::STATE_FINISHED)
+    while (iter.getState() != Iterator::STATE_FINISHED)
     {
-        const TestNode *node  = iter.getNode();
-        const char *pkgName   = node->getName();
+        const string pkgName  = getNodeName(iter);
         const string filename = makePackageFilename(filenamePattern, pkgName, "xml");
 
-        DE_ASSERT(iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE &&
-                  node->getNodeType() == NODETYPE_PACKAGE);
+        DE_ASSERT(iter.getState() == Iterator::STATE_ENTER_NODE && getNodeType(iter) == NODETYPE_PACKAGE);
 
         FILE *file          = DE_NULL;
         qpXmlWriter *writer = DE_NULL;
@@ -155,7 +166,7 @@ void writeXmlCaselistsToFiles(TestPackageRoot &root, TestContext &testCtx, const
             if (!writer)
                 throw Exception("XML writer creation failed");
 
-            print("Writing test cases from '%s' to file '%s'..\n", pkgName, filename.c_str());
+            print("Writing test cases from '%s' to file '%s'..\n", pkgName.c_str(), filename.c_str());
 
             writeXmlCaselist(iter, writer);
 
@@ -174,38 +185,28 @@ void writeXmlCaselistsToFiles(TestPackageRoot &root, TestContext &testCtx, const
             throw;
         }
 
-        DE_ASSERT(iter.getState() == TestHierarchyIterator::STATE_LEAVE_NODE &&
-                  iter.getNode()->getNodeType() == NODETYPE_PACKAGE);
+        DE_ASSERT(iter.getState() == Iterator::STATE_LEAVE_NODE && getNodeType(iter) == NODETYPE_PACKAGE);
         iter.next();
     }
 }
 
-/*--------------------------------------------------------------------*//*!
- * \brief Export the test list of each package into a separate ascii file.
- *//*--------------------------------------------------------------------*/
-void writeTxtCaselistsToFiles(TestPackageRoot &root, TestContext &testCtx, const CommandLine &cmdLine)
+template <typename Iterator>
+static void writeTxtCaselists(Iterator &iter, const CommandLine &cmdLine)
 {
-    DefaultHierarchyInflater inflater(testCtx);
-    de::MovePtr<const CaseListFilter> caseListFilter(
-        testCtx.getCommandLine().createCaseListFilter(testCtx.getArchive()));
-
-    TestHierarchyIterator iter(root, inflater, *caseListFilter);
     const char *const filenamePattern = cmdLine.getCaseListExportFile();
 
-    while (iter.getState() != TestHierarchyIterator::STATE_FINISHED)
+    while (iter.getState() != Iterator::STATE_FINISHED)
     {
-        const TestNode *node  = iter.getNode();
-        const char *pkgName   = node->getName();
+        const string pkgName  = getNodeName(iter);
         const string filename = makePackageFilename(filenamePattern, pkgName, "txt");
 
-        DE_ASSERT(iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE &&
-                  node->getNodeType() == NODETYPE_PACKAGE);
+        DE_ASSERT(iter.getState() == Iterator::STATE_ENTER_NODE && getNodeType(iter) == NODETYPE_PACKAGE);
 
         std::ofstream out(filename.c_str(), std::ios_base::binary);
         if (!out.is_open() || !out.good())
             throw Exception("Failed to open " + filename);
 
-        print("Writing test cases from '%s' to file '%s'..\n", pkgName, filename.c_str());
+        print("Writing test cases from '%s' to file '%s'..\n", pkgName.c_str(), filename.c_str());
 
         try
         {
@@ -216,18 +217,67 @@ void writeTxtCaselistsToFiles(TestPackageRoot &root, TestContext &testCtx, const
             return;
         }
 
-        while (iter.getNode()->getNodeType() != NODETYPE_PACKAGE)
+        while (getNodeType(iter) != NODETYPE_PACKAGE)
         {
-            if (iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE)
-                out << (isTestNodeTypeExecutable(iter.getNode()->getNodeType()) ? "TEST" : "GROUP") << ": "
-                    << iter.getNodePath() << "\n";
+            if (iter.getState() == Iterator::STATE_ENTER_NODE)
+                out << (isTestNodeTypeExecutable(getNodeType(iter)) ? "TEST" : "GROUP") << ": " << iter.getNodePath()
+                    << "\n";
             iter.next();
         }
 
-        DE_ASSERT(iter.getState() == TestHierarchyIterator::STATE_LEAVE_NODE &&
-                  iter.getNode()->getNodeType() == NODETYPE_PACKAGE);
+        DE_ASSERT(iter.getState() == Iterator::STATE_LEAVE_NODE && getNodeType(iter) == NODETYPE_PACKAGE);
         iter.next();
     }
 }
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Export the test list of each package into a separate XML file.
+ *
+ * If a test tree manifest is available the test hierarchy is not
+ * constructed at all.
+ *//*--------------------------------------------------------------------*/
+void writeXmlCaselistsToFiles(TestPackageRoot &root, TestContext &testCtx, const CommandLine &cmdLine)
+{
+    de::MovePtr<const CaseListFilter> caseListFilter(
+        testCtx.getCommandLine().createCaseListFilter(testCtx.getArchive()));
+    de::MovePtr<TestTreeManifest> manifest = getTestTreeManifest(root, testCtx);
+
+    if (manifest.get())
+    {
+        TestTreeManifestIterator iter(*manifest, *caseListFilter);
+        writeXmlCaselists(iter, cmdLine);
+    }
+    else
+    {
+        DefaultHierarchyInflater inflater(testCtx);
+        TestHierarchyIterator iter(root, inflater, *caseListFilter);
+        writeXmlCaselists(iter, cmdLine);
+    }
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Export the test list of each package into a separate ascii file.
+ *
+ * If a test tree manifest is available the test hierarchy is not
+ * constructed at all.
+ *//*--------------------------------------------------------------------*/
+void writeTxtCaselistsToFiles(TestPackageRoot &root, TestContext &testCtx, const CommandLine &cmdLine)
+{
+    de::MovePtr<const CaseListFilter> caseListFilter(
+        testCtx.getCommandLine().createCaseListFilter(testCtx.getArchive()));
+    de::MovePtr<TestTreeManifest> manifest = getTestTreeManifest(root, testCtx);
+
+    if (manifest.get())
+    {
+        TestTreeManifestIterator iter(*manifest, *caseListFilter);
+        writeTxtCaselists(iter, cmdLine);
+    }
+    else
+    {
+        DefaultHierarchyInflater inflater(testCtx);
+        TestHierarchyIterator iter(root, inflater, *caseListFilter);
+        writeTxtCaselists(iter, cmdLine);
+    }
+}
+
 } // namespace tcu
@@ -25,9 +25,13 @@
 #include "tcuTestLog.hpp"
 #include "tcuTextureUtil.hpp"
 #include "tcuSurface.hpp"
+#include "tcuInstrumentation.hpp"
 #include "deMath.h"
 
+#include <cstring>
 #include <limits>
+#include <type_traits>
+#include <vector>
 
 namespace tcu
 {
@@ -150,24 +154,284 @@ void LogImage::write(TestLog &log) const
 
 // MessageBuilder
 
-MessageBuilder::MessageBuilder(const MessageBuilder &other) : m_log(other.m_log)
+namespace
 {
-    m_str.str(other.m_str.str());
+
+// Growable output buffer that is reused between messages.
+class MessageBuffer : public std::streambuf
+{
+public:
+    void reset(void)
+    {
+        setp(m_data.data(), m_data.data() + m_data.size());
+    }
+
+    const char *getBegin(void) const
+    {
+        return pbase();
+    }
+
+    size_t getSize(void) const
+    {
+        return (size_t)(pptr() - pbase());
+    }
+
+    // Null-terminated contents.
+    const char *getText(void)
+    {
+        if (pptr() == epptr())
+            grow();
+        *pptr() = 0;
+        return pbase();
+    }
+
+protected:
+    int_type overflow(int_type c)
+    {
+        grow();
+
+        if (!traits_type::eq_int_type(c, traits_type::eof()))
+        {
+            *pptr() = traits_type::to_char_type(c);
+            pbump(1);
+        }
+
+        return traits_type::not_eof(c);
+    }
+
+private:
+    void grow(void)
+    {
+        const size_t size = getSize();
+
+        m_data.resize(de::max<size_t>(m_data.size() * 2, 256));
+        setp(m_data.data(), m_data.data() + m_data.size());
+        pbump((int)size);
+    }
+
+    std::vector<char> m_data;
+};
+
+class MessageStream : public std::ostream
+{
+public:
+    MessageStream(void) : std::ostream(DE_NULL), m_isClassicLocale(getloc() == std::locale::classic())
+    {
+        rdbuf(&m_buffer);
+    }
+
+    MessageBuffer &getBuffer(void)
+    {
+        return m_buffer;
+    }
+
+    // Output is same as from stream formatting: no base, sign, width or digit grouping to apply.
+    bool hasDefaultIntegerFormat(void) const
+    {
+        const std::ios_base::fmtflags base = flags() & std::ios_base::basefield;
+
+        return m_isClassicLocale && width() == 0 && (base == std::ios_base::dec || base == 0) &&
+               (flags() & std::ios_base::showpos) == 0;
+    }
+
+    bool hasDefaultStringFormat(void) const
+    {
+        return width() == 0;
+    }
+
+    // Restore state of freshly constructed stream.
+    void reset(void)
+    {
+        m_buffer.reset();
+        clear();
+        flags(std::ios_base::skipws | std::ios_base::dec);
+        precision(6);
+        width(0);
+        fill(widen(' '));
+    }
+
+private:
+    MessageBuffer m_buffer;
+    const bool m_isClassicLocale;
+};
+
+class MessageStreamPool
+{
+public:
+    ~MessageStreamPool(void)
+    {
+        for (MessageStream *stream : m_freeStreams)
+            delete stream;
+    }
+
+    MessageStream *acquire(void)
+    {
+        if (m_freeStreams.empty())
+            return new MessageStream();
+
+        MessageStream *const stream = m_freeStreams.back();
+        m_freeStreams.pop_back();
+        return stream;
+    }
+
+    void release(MessageStream *stream)
+    {
+        stream->reset();
+        m_freeStreams.push_back(stream);
+    }
+
+private:
+    std::vector<MessageStream *> m_freeStreams;
+};
+
+MessageStreamPool &getMessageStreamPool(void)
+{
+    thread_local MessageStreamPool pool;
+    return pool;
+}
+
+MessageStream &getMessageStream(std::ostream *str)
+{
+    return *static_cast<MessageStream *>(str);
+}
+
+} // namespace
+
+MessageBuilder::MessageBuilder(TestLog *log) : m_log(log), m_str(getMessageStreamPool().acquire())
+{
+}
+
+MessageBuilder::~MessageBuilder(void)
+{
+    if (m_str)
+        getMessageStreamPool().release(&getMessageStream(m_str));
+}
+
+MessageBuilder::MessageBuilder(const MessageBuilder &other)
+    : m_log(other.m_log)
+    , m_str(getMessageStreamPool().acquire())
+{
+    const MessageBuffer &otherBuffer = getMessageStream(other.m_str).getBuffer();
+
+    m_str->write(otherBuffer.getBegin(), (std::streamsize)otherBuffer.getSize());
+}
+
+MessageBuilder::MessageBuilder(MessageBuilder &&other) : m_log(other.m_log), m_str(other.m_str)
+{
+    other.m_str = DE_NULL;
 }
 
 MessageBuilder &MessageBuilder::operator=(const MessageBuilder &other)
 {
-    m_log = other.m_log;
-    m_str.str(other.m_str.str());
+    if (this != &other)
+    {
+        const MessageBuffer &otherBuffer = getMessageStream(other.m_str).getBuffer();
+
+        m_log = other.m_log;
+        getMessageStream(m_str).reset();
+        m_str->write(otherBuffer.getBegin(), (std::streamsize)otherBuffer.getSize());
+    }
     return *this;
 }
 
+std::string MessageBuilder::toString(void) const
+{
+    const MessageBuffer &buffer = getMessageStream(m_str).getBuffer();
+
+    return std::string(buffer.getBegin(), buffer.getSize());
+}
+
 TestLog &MessageBuilder::operator<<(const TestLog::EndMessageToken &)
 {
-    m_log->writeMessage(m_str.str().c_str());
+    m_log->writeMessage(getMessageStream(m_str).getBuffer().getText());
     return *m_log;
 }
 
+MessageBuilder &MessageBuilder::operator<<(const char *str)
+{
+    MessageStream &stream = getMessageStream(m_str);
+
+    if (str && stream.hasDefaultStringFormat())
+        stream.getBuffer().sputn(str, (std::streamsize)strlen(str));
+    else
+        stream << str;
+
+    return *this;
+}
+
+MessageBuilder &MessageBuilder::operator<<(const std::string &str)
+{
+    MessageStream &stream = getMessageStream(m_str);
+
+    if (stream.hasDefaultStringFormat())
+        stream.getBuffer().sputn(str.data(), (std::streamsize)str.size());
+    else
+        stream << str;
+
+    return *this;
+}
+
+template <typename T>
+MessageBuilder &MessageBuilder::writeInteger(T value)
+{
+    MessageStream &stream = getMessageStream(m_str);
+
+    if (stream.hasDefaultIntegerFormat())
+    {
+        typedef typename std::make_unsigned<T>::type UnsignedT;
+
+        char digits[std::numeric_limits<UnsignedT>::digits10 + 2];
+        char *const end = digits + sizeof(digits);
+        char *begin     = end;
+        UnsignedT abs   = value < 0 ? UnsignedT(0) - UnsignedT(value) : UnsignedT(value);
+
+        do
+        {
+            *--begin = (char)('0' + (int)(abs % 10));
+            abs /= 10;
+        } while (abs != 0);
+
+        if (value < 0)
+            *--begin = '-';
+
+        stream.getBuffer().sputn(begin, (std::streamsize)(end - begin));
+    }
+    else
+        stream << value;
+
+    return *this;
+}
+
+MessageBuilder &MessageBuilder::operator<<(int value)
+{
+    return writeInteger(value);
+}
+
+MessageBuilder &MessageBuilder::operator<<(unsigned int value)
+{
+    return writeInteger(value);
+}
+
+MessageBuilder &MessageBuilder::operator<<(long value)
+{
+    return writeInteger(value);
+}
+
+MessageBuilder &MessageBuilder::operator<<(unsigned long value)
+{
+    return writeInteger(value);
+}
+
+MessageBuilder &MessageBuilder::operator<<(long long value)
+{
+    return writeInteger(value);
+}
+
+MessageBuilder &MessageBuilder::operator<<(unsigned long long value)
+{
+    return writeInteger(value);
+}
+
 // SampleBuilder
 
 TestLog &SampleBuilder::operator<<(const TestLog::EndSampleToken &)
@@ -281,6 +545,8 @@ void TestLog::writeImage(const char *name, const char *description, const ConstP
     if ((qpTestLog_getLogFlags(m_log) & QP_TEST_LOG_EXCLUDE_IMAGES) != 0)
         return;
 
+    const ScopedPhaseTimer timer(INSTRUMENTATION_PHASE_LOG_IMAGE);
+
     if (depth == 1 && (format.type == TextureFormat::UNORM_INT8 || format.type == TextureFormat::UNSIGNED_INT8) &&
         width <= MAX_IMAGE_SIZE_2D && height <= MAX_IMAGE_SIZE_2D &&
         (format.order == TextureFormat::RGB || format.order == TextureFormat::RGBA) &&
@@ -400,6 +666,9 @@ void TestLog::writeImage(const char *name, const char *description, qpImageCompr
         return;
     if (m_skipAdditionalDataInLog)
         return;
+
+    const ScopedPhaseTimer timer(INSTRUMENTATION_PHASE_LOG_IMAGE);
+
     if (qpTestLog_writeImage(m_log, name, description, compressionMode, format, width, height, stride, data) == false)
         throw LogWriteFailedError();
 }
@@ -216,32 +216,46 @@ private:
     bool m_skipAdditionalDataInLog;
 };
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Message builder
+ *
+ * Message is formatted into a stream borrowed from a per-thread pool and
+ * returned there when the builder is destroyed, so building messages does
+ * not construct streams or allocate memory once the pool has warmed up.
+ * Strings and integers in default format bypass the stream formatting.
+ *//*--------------------------------------------------------------------*/
 class MessageBuilder
 {
 public:
-    explicit MessageBuilder(TestLog *log) : m_log(log)
-    {
-    }
-    ~MessageBuilder(void)
-    {
-    }
+    explicit MessageBuilder(TestLog *log);
+    ~MessageBuilder(void);
 
-    std::string toString(void) const
-    {
-        return m_str.str();
-    }
+    std::string toString(void) const;
 
     TestLog &operator<<(const TestLog::EndMessageToken &);
 
     template <typename T>
     MessageBuilder &operator<<(const T &value);
 
+    MessageBuilder &operator<<(const char *str);
+    MessageBuilder &operator<<(const std::string &str);
+    MessageBuilder &operator<<(int value);
+    MessageBuilder &operator<<(unsigned int value);
+    MessageBuilder &operator<<(long value);
+    MessageBuilder &operator<<(unsigned long value);
+    MessageBuilder &operator<<(long long value);
+    MessageBuilder &operator<<(unsigned long long value);
+
     MessageBuilder(const MessageBuilder &other);
+    MessageBuilder(MessageBuilder &&other);
     MessageBuilder &operator=(const MessageBuilder &other);
 
 private:
+    template <typename T>
+    MessageBuilder &writeInteger(T value);
+
     TestLog *m_log;
-    std::ostringstream m_str;
+    std::ostream *m_str;
 };
 
 class SampleBuilder
@@ -593,7 +607,7 @@ template <typename T>
 inline MessageBuilder &MessageBuilder::operator<<(const T &value)
 {
     // Overload stream operator to implement custom format
-    m_str << value;
+    *m_str << value;
     return *this;
 }
 
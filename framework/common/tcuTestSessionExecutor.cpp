@@ -24,6 +24,7 @@
 #include "tcuTestSessionExecutor.hpp"
 #include "qpTestLog.h"
 #include "tcuCommandLine.hpp"
+#include "tcuInstrumentation.hpp"
 #include "tcuTestLog.hpp"
 
 #include "deClock.h"
@@ -55,17 +56,22 @@ TestSessionExecutor::TestSessionExecutor(TestPackageRoot &root, TestContext &tes
     : m_testCtx(testCtx)
     , m_inflater(testCtx)
     , m_caseListFilter(testCtx.getCommandLine().createCaseListFilter(testCtx.getArchive()))
-    , m_iterator(root, m_inflater, *m_caseListFilter)
+    , m_treeManifest(m_caseListFilter->isRestrictive() ? getTestTreeManifest(root, testCtx) :
+                                                         de::MovePtr<TestTreeManifest>())
+    , m_iterator(root, m_inflater, *m_caseListFilter, m_treeManifest.get())
     , m_state(STATE_TRAVERSE_HIERARCHY)
     , m_abortSession(false)
     , m_isInTestCase(false)
     , m_testStartTime(0)
     , m_packageStartTime(0)
 {
+    setInstrumentationEnabled(testCtx.getCommandLine().isInstrumentationEnabled());
 }
 
 TestSessionExecutor::~TestSessionExecutor(void)
 {
+    if (m_iterator.isManifestMismatched())
+        discardTestTreeManifest(m_testCtx);
 }
 
 bool TestSessionExecutor::iterate(void)
@@ -183,17 +189,24 @@ void TestSessionExecutor::leaveTestPackage(TestPackage *testPackage)
 
     m_caseExecutor.clear();
 
-    if (!std::string(m_testCtx.getCommandLine().getServerAddress()).empty())
+    const bool reportGroupDurations = !std::string(m_testCtx.getCommandLine().getServerAddress()).empty();
+
+    if (reportGroupDurations || isInstrumentationEnabled())
     {
         m_testCtx.getLog().startTestsCasesTime();
 
-        m_testCtx.getLog() << TestLog::Integer(testPackage->getName(), "Total tests case duration in microseconds",
-                                               "us", QP_KEY_TAG_TIME, duration);
+        if (reportGroupDurations)
+        {
+            m_testCtx.getLog() << TestLog::Integer(testPackage->getName(), "Total tests case duration in microseconds",
+                                                   "us", QP_KEY_TAG_TIME, duration);
 
-        for (std::map<std::string, uint64_t>::iterator it = m_groupsDurationTime.begin();
-             it != m_groupsDurationTime.end(); ++it)
-            m_testCtx.getLog() << TestLog::Integer(it->first, "The test group case duration in microseconds", "us",
-                                                   QP_KEY_TAG_TIME, it->second);
+            for (std::map<std::string, uint64_t>::iterator it = m_groupsDurationTime.begin();
+                 it != m_groupsDurationTime.end(); ++it)
+                m_testCtx.getLog() << TestLog::Integer(it->first, "The test group case duration in microseconds",
+                                                       "us", QP_KEY_TAG_TIME, it->second);
+        }
+
+        logInstrumentationSummary(m_testCtx.getLog());
 
         m_testCtx.getLog().endTestsCasesTime();
     }
@@ -223,13 +236,18 @@ bool TestSessionExecutor::enterTestCase(TestCase *testCase, const std::string &c
 
     m_testCtx.setTestResult(QP_TEST_RESULT_LAST, "");
     m_testCtx.setTerminateAfter(false);
+    m_testCtx.setCurrentCasePath(casePath);
     log.startCase(casePath.c_str(), caseType);
 
     m_isInTestCase  = true;
     m_testStartTime = deGetMicroseconds();
+    m_casePath      = casePath;
+
+    beginInstrumentedCase();
 
     try
     {
+        ScopedPhaseTimer timer(INSTRUMENTATION_PHASE_INIT);
         m_caseExecutor->init(testCase, casePath);
         initOk = true;
     }
@@ -282,6 +300,8 @@ void TestSessionExecutor::leaveTestCase(TestCase *testCase)
         m_testCtx.getLog().supressLogging(suppressLogging);
     }
 
+    endInstrumentedCase(log, m_casePath);
+
     {
         const int64_t duration = deGetMicroseconds() - m_testStartTime;
         m_testStartTime        = 0;
@@ -296,6 +316,7 @@ void TestSessionExecutor::leaveTestCase(TestCase *testCase)
         DE_ASSERT(testResult != QP_TEST_RESULT_LAST);
 
         m_isInTestCase = false;
+        m_testCtx.setCurrentCasePath("");
         m_testCtx.getLog().endCase(testResult, testResultDesc);
 
         // Update statistics.
@@ -359,6 +380,7 @@ TestCase::IterateResult TestSessionExecutor::iterateTestCase(TestCase *testCase)
 
     try
     {
+        ScopedPhaseTimer timer(INSTRUMENTATION_PHASE_ITERATE);
         iterateResult = m_caseExecutor->iterate(testCase);
     }
     catch (const std::bad_alloc &)
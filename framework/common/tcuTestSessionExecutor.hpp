@@ -28,6 +28,7 @@
 #include "tcuTestCase.hpp"
 #include "tcuTestPackage.hpp"
 #include "tcuTestHierarchyIterator.hpp"
+#include "tcuTestTreeManifest.hpp"
 #include "deUniquePtr.hpp"
 #include <map>
 
@@ -74,6 +75,7 @@ private:
 
     DefaultHierarchyInflater m_inflater;
     de::MovePtr<CaseListFilter> m_caseListFilter;
+    de::MovePtr<TestTreeManifest> m_treeManifest;
     TestHierarchyIterator m_iterator;
 
     de::MovePtr<TestCaseExecutor> m_caseExecutor;
@@ -83,6 +85,7 @@ private:
     bool m_isInTestCase;
     uint64_t m_testStartTime;
     uint64_t m_packageStartTime;
+    std::string m_casePath;
     std::map<std::string, uint64_t> m_groupsDurationTime;
 };
 
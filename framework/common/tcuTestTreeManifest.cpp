@@ -0,0 +1,660 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Cached test hierarchy manifest.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuTestTreeManifest.hpp"
+#include "tcuTestHierarchyIterator.hpp"
+#include "tcuTestPackage.hpp"
+#include "tcuCommandLine.hpp"
+#include "tcuTestLog.hpp"
+
+#include "qpInfo.h"
+#include "deFile.h"
+#include "deMemory.h"
+#include "deStringUtil.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+namespace tcu
+{
+
+using std::string;
+using std::vector;
+
+namespace
+{
+
+enum
+{
+    MANIFEST_FORMAT_MAGIC   = 0x4d545464, //!< "dTTM"
+    MANIFEST_FORMAT_VERSION = 2,
+    ENTRY_SIZE              = 10 //!< Serialized size of one entry.
+};
+
+void writeU32(vector<uint8_t> &dst, uint32_t value)
+{
+    for (int byteNdx = 0; byteNdx < 4; byteNdx++)
+        dst.push_back((uint8_t)(value >> (8 * byteNdx)));
+}
+
+class BinaryReader
+{
+public:
+    BinaryReader(const vector<uint8_t> &data) : m_data(data), m_pos(0), m_ok(true)
+    {
+    }
+
+    uint32_t readU32(void)
+    {
+        uint32_t value = 0;
+
+        if (!require(4))
+            return 0;
+
+        for (int byteNdx = 0; byteNdx < 4; byteNdx++)
+            value |= (uint32_t)m_data[m_pos++] << (8 * byteNdx);
+
+        return value;
+    }
+
+    uint8_t readU8(void)
+    {
+        return require(1) ? m_data[m_pos++] : 0;
+    }
+
+    const uint8_t *readBytes(size_t size)
+    {
+        const uint8_t *const ptr = require(size) ? &m_data[m_pos] : DE_NULL;
+
+        if (ptr)
+            m_pos += size;
+
+        return ptr;
+    }
+
+    bool isOk(void) const
+    {
+        return m_ok;
+    }
+
+    bool isAtEnd(void) const
+    {
+        return m_pos == m_data.size();
+    }
+
+private:
+    bool require(size_t size)
+    {
+        m_ok = m_ok && (m_data.size() - m_pos >= size);
+        return m_ok;
+    }
+
+    const vector<uint8_t> &m_data;
+    size_t m_pos;
+    bool m_ok;
+};
+
+bool readFile(const string &path, vector<uint8_t> &dst)
+{
+    FILE *const file = fopen(path.c_str(), "rb");
+    bool ok          = false;
+
+    if (!file)
+        return false;
+
+    if (fseek(file, 0, SEEK_END) == 0)
+    {
+        const long size = ftell(file);
+
+        if (size > 0 && fseek(file, 0, SEEK_SET) == 0)
+        {
+            dst.resize((size_t)size);
+            ok = fread(&dst[0], 1, dst.size(), file) == dst.size();
+        }
+    }
+
+    fclose(file);
+    return ok;
+}
+
+deSha1 computeBuildKey(TestPackageRoot &root)
+{
+    const char *const releaseName = qpGetReleaseName();
+    const uint32_t releaseId      = qpGetReleaseId();
+    int64_t executableSize        = 0;
+    int64_t executableTime        = 0;
+    vector<TestNode *> packages;
+    deSha1Stream stream;
+    deSha1 key;
+
+    // Release name and id stay the same over local builds of a revision, but the executable changes whenever test
+    // registration does. Manifest files are not used if the executable cannot be identified.
+    deGetExecutableFileInfo(&executableSize, &executableTime);
+
+    // Package nodes are created with the root, so their names are available without initializing any package.
+    root.getChildren(packages);
+
+    deSha1Stream_init(&stream);
+    deSha1Stream_process(&stream, strlen(releaseName) + 1, releaseName);
+    deSha1Stream_process(&stream, sizeof(releaseId), &releaseId);
+    deSha1Stream_process(&stream, sizeof(executableSize), &executableSize);
+    deSha1Stream_process(&stream, sizeof(executableTime), &executableTime);
+
+    for (size_t packageNdx = 0; packageNdx < packages.size(); packageNdx++)
+        deSha1Stream_process(&stream, strlen(packages[packageNdx]->getName()) + 1, packages[packageNdx]->getName());
+
+    deSha1Stream_finalize(&stream, &key);
+
+    return key;
+}
+
+//! Inflater that does not write session info; manifest is built before the actual session starts.
+class ManifestInflater : public TestHierarchyInflater
+{
+public:
+    ManifestInflater(TestContext &testCtx) : m_testCtx(testCtx)
+    {
+    }
+
+    void enterTestPackage(TestPackage *testPackage, vector<TestNode *> &children)
+    {
+        Archive *const pkgArchive = testPackage->getArchive();
+
+        m_testCtx.setCurrentArchive(pkgArchive ? *pkgArchive : m_testCtx.getRootArchive());
+
+        testPackage->init();
+        testPackage->getChildren(children);
+    }
+
+    void leaveTestPackage(TestPackage *testPackage)
+    {
+        m_testCtx.setCurrentArchive(m_testCtx.getRootArchive());
+        testPackage->deinit();
+    }
+
+    void enterGroupNode(TestCaseGroup *testGroup, vector<TestNode *> &children)
+    {
+        testGroup->init();
+        testGroup->getChildren(children);
+    }
+
+    void leaveGroupNode(TestCaseGroup *testGroup)
+    {
+        testGroup->deinit();
+    }
+
+private:
+    TestContext &m_testCtx;
+};
+
+} // namespace
+
+// TestTreeManifest
+
+TestTreeManifest::TestTreeManifest(void)
+{
+    deMemset(&m_buildKey, 0, sizeof(m_buildKey));
+}
+
+TestTreeManifest::~TestTreeManifest(void)
+{
+}
+
+int TestTreeManifest::addEntry(const char *name, TestNodeType nodeType, TestRunnerType runnerType)
+{
+    const size_t nameLen = strlen(name);
+    Entry entry;
+
+    entry.nameOffset  = (uint32_t)m_names.size();
+    entry.subtreeSize = 1;
+    entry.nodeType    = (uint8_t)nodeType;
+    entry.runnerType  = (uint8_t)runnerType;
+
+    m_names.insert(m_names.end(), name, name + nameLen + 1);
+    m_entries.push_back(entry);
+
+    return (int)m_entries.size() - 1;
+}
+
+de::MovePtr<TestTreeManifest> TestTreeManifest::build(TestPackageRoot &root, TestContext &testCtx)
+{
+    de::MovePtr<TestTreeManifest> manifest(new TestTreeManifest());
+    TestLog &log               = testCtx.getLog();
+    const bool logWasSupressed = log.isSupressLogging();
+    vector<int> entryStack;
+
+    manifest->m_buildKey = computeBuildKey(root);
+
+    // Root is never reported by the iterator.
+    entryStack.push_back(manifest->addEntry("", NODETYPE_ROOT, RUNNERTYPE_NONE));
+
+    // Packages may log in init(); keep the session log clean.
+    log.supressLogging(true);
+
+    try
+    {
+        const CaseListFilter passAllFilter;
+        ManifestInflater inflater(testCtx);
+        TestHierarchyIterator iter(root, inflater, passAllFilter);
+
+        while (iter.getState() != TestHierarchyIterator::STATE_FINISHED)
+        {
+            const TestNode *const node = iter.getNode();
+
+            if (iter.getState() == TestHierarchyIterator::STATE_ENTER_NODE)
+                entryStack.push_back(manifest->addEntry(node->getName(), node->getNodeType(), node->getRunnerType()));
+            else
+            {
+                const int entryNdx = entryStack.back();
+
+                manifest->m_entries[entryNdx].subtreeSize = (uint32_t)(manifest->m_entries.size() - entryNdx);
+                entryStack.pop_back();
+            }
+
+            iter.next();
+        }
+    }
+    catch (...)
+    {
+        log.supressLogging(logWasSupressed);
+        throw;
+    }
+
+    log.supressLogging(logWasSupressed);
+
+    DE_ASSERT(entryStack.size() == 1);
+    manifest->m_entries[0].subtreeSize = (uint32_t)manifest->m_entries.size();
+
+    return manifest;
+}
+
+de::MovePtr<TestTreeManifest> TestTreeManifest::load(const string &filename, TestPackageRoot &root)
+{
+    vector<uint8_t> data;
+
+    if (!readFile(filename, data))
+        return de::MovePtr<TestTreeManifest>();
+
+    {
+        de::MovePtr<TestTreeManifest> manifest(new TestTreeManifest());
+        BinaryReader reader(data);
+        const uint32_t magic   = reader.readU32();
+        const uint32_t version = reader.readU32();
+        deSha1 buildKey;
+
+        for (int wordNdx = 0; wordNdx < DE_LENGTH_OF_ARRAY(buildKey.hash); wordNdx++)
+            buildKey.hash[wordNdx] = reader.readU32();
+
+        manifest->m_buildKey = computeBuildKey(root);
+
+        if (!reader.isOk() || magic != MANIFEST_FORMAT_MAGIC || version != MANIFEST_FORMAT_VERSION ||
+            !deSha1_equal(&buildKey, &manifest->m_buildKey))
+            return de::MovePtr<TestTreeManifest>();
+
+        {
+            const uint32_t numEntries = reader.readU32();
+            const uint32_t namesSize  = reader.readU32();
+
+            if (!reader.isOk() || numEntries == 0 || namesSize == 0 ||
+                (uint64_t)numEntries * ENTRY_SIZE + namesSize > (uint64_t)data.size())
+                return de::MovePtr<TestTreeManifest>();
+
+            manifest->m_entries.resize(numEntries);
+
+            for (uint32_t entryNdx = 0; entryNdx < numEntries && reader.isOk(); entryNdx++)
+            {
+                Entry &entry = manifest->m_entries[entryNdx];
+
+                entry.nameOffset  = reader.readU32();
+                entry.subtreeSize = reader.readU32();
+                entry.nodeType    = reader.readU8();
+                entry.runnerType  = reader.readU8();
+
+                if (entry.nameOffset >= namesSize || entry.subtreeSize == 0 ||
+                    entry.subtreeSize > numEntries - entryNdx || entry.nodeType > NODETYPE_ACCURACY)
+                    return de::MovePtr<TestTreeManifest>();
+            }
+
+            {
+                const uint8_t *const names = reader.readBytes(namesSize);
+
+                if (!names || !reader.isAtEnd() || names[namesSize - 1] != 0 ||
+                    manifest->m_entries[0].subtreeSize != numEntries)
+                    return de::MovePtr<TestTreeManifest>();
+
+                manifest->m_names.assign(names, names + namesSize);
+            }
+        }
+
+        return manifest;
+    }
+}
+
+void TestTreeManifest::store(const string &filename) const
+{
+    vector<uint8_t> data;
+
+    writeU32(data, MANIFEST_FORMAT_MAGIC);
+    writeU32(data, MANIFEST_FORMAT_VERSION);
+
+    for (int wordNdx = 0; wordNdx < DE_LENGTH_OF_ARRAY(m_buildKey.hash); wordNdx++)
+        writeU32(data, m_buildKey.hash[wordNdx]);
+
+    writeU32(data, (uint32_t)m_entries.size());
+    writeU32(data, (uint32_t)m_names.size());
+
+    for (size_t entryNdx = 0; entryNdx < m_entries.size(); entryNdx++)
+    {
+        writeU32(data, m_entries[entryNdx].nameOffset);
+        writeU32(data, m_entries[entryNdx].subtreeSize);
+        data.push_back(m_entries[entryNdx].nodeType);
+        data.push_back(m_entries[entryNdx].runnerType);
+    }
+
+    data.insert(data.end(), m_names.begin(), m_names.end());
+
+    if (!deWriteFileAtomic(filename.c_str(), data.data(), data.size()))
+        throw Exception("Failed to write test tree manifest " + filename);
+}
+
+// TestTreeManifestIterator
+
+TestTreeManifestIterator::TestTreeManifestIterator(const TestTreeManifest &manifest,
+                                                   const CaseListFilter &caseListFilter)
+    : m_manifest(manifest)
+    , m_caseListFilter(caseListFilter)
+    , m_groupNumber(0)
+{
+    // Root is never reported
+    m_sessionStack.push_back(NodeIter(0, NodeIter::NISTATE_ENTER));
+    next();
+}
+
+TestTreeManifestIterator::~TestTreeManifestIterator(void)
+{
+}
+
+TestTreeManifestIterator::State TestTreeManifestIterator::getState(void) const
+{
+    if (!m_sessionStack.empty())
+    {
+        const NodeIter &iter = m_sessionStack.back();
+
+        DE_ASSERT(iter.state == NodeIter::NISTATE_ENTER || iter.state == NodeIter::NISTATE_LEAVE);
+
+        return iter.state == NodeIter::NISTATE_ENTER ? STATE_ENTER_NODE : STATE_LEAVE_NODE;
+    }
+    else
+        return STATE_FINISHED;
+}
+
+int TestTreeManifestIterator::getEntryIndex(void) const
+{
+    DE_ASSERT(getState() != STATE_FINISHED);
+    return m_sessionStack.back().entryNdx;
+}
+
+const char *TestTreeManifestIterator::getNodeName(void) const
+{
+    return m_manifest.getName(getEntryIndex());
+}
+
+TestNodeType TestTreeManifestIterator::getNodeType(void) const
+{
+    return m_manifest.getNodeType(getEntryIndex());
+}
+
+const std::string &TestTreeManifestIterator::getNodePath(void) const
+{
+    DE_ASSERT(getState() != STATE_FINISHED);
+    return m_nodePath;
+}
+
+std::string TestTreeManifestIterator::buildNodePath(void) const
+{
+    string nodePath;
+    for (size_t ndx = 1; ndx < m_sessionStack.size(); ndx++)
+    {
+        if (ndx > 1) // ignore root package
+            nodePath += ".";
+        nodePath += m_manifest.getName(m_sessionStack[ndx].entryNdx);
+    }
+    return nodePath;
+}
+
+void TestTreeManifestIterator::next(void)
+{
+    while (!m_sessionStack.empty())
+    {
+        NodeIter &iter              = m_sessionStack.back();
+        const TestNodeType nodeType = m_manifest.getNodeType(iter.entryNdx);
+        const bool isLeaf           = isTestNodeTypeExecutable(nodeType);
+
+        switch (iter.state)
+        {
+        case NodeIter::NISTATE_INIT:
+        {
+            const std::string nodePath = buildNodePath();
+
+            // Return to parent if name or runner type doesn't match filter.
+            if (!(isLeaf ? (m_caseListFilter.checkRunnerType(m_manifest.getRunnerType(iter.entryNdx)) &&
+                            m_caseListFilter.checkTestCaseName(nodePath.c_str())) :
+                           m_caseListFilter.checkTestGroupName(nodePath.c_str())))
+            {
+                m_sessionStack.pop_back();
+                break;
+            }
+
+            m_nodePath = nodePath;
+            iter.state = NodeIter::NISTATE_ENTER;
+            return; // Yield enter event
+        }
+
+        case NodeIter::NISTATE_ENTER:
+        {
+            if (isLeaf)
+            {
+                iter.state = NodeIter::NISTATE_LEAVE;
+                return; // Yield leave event
+            }
+
+            iter.state        = NodeIter::NISTATE_TRAVERSE_CHILDREN;
+            iter.nextChildNdx = iter.entryNdx + 1;
+            break;
+        }
+
+        case NodeIter::NISTATE_TRAVERSE_CHILDREN:
+        {
+            if (iter.nextChildNdx < iter.entryNdx + m_manifest.getSubtreeSize(iter.entryNdx))
+            {
+                const int childNdx = iter.nextChildNdx;
+
+                iter.nextChildNdx += m_manifest.getSubtreeSize(childNdx);
+
+                // Same case fraction filtering as in TestHierarchyIterator.
+                if (isTestNodeTypeExecutable(m_manifest.getNodeType(childNdx)))
+                {
+                    const std::string testName = m_nodePath + "." + m_manifest.getName(childNdx);
+                    if (!m_caseListFilter.checkCaseFraction(m_groupNumber, testName))
+                        break;
+                }
+                m_sessionStack.push_back(NodeIter(childNdx, NodeIter::NISTATE_INIT));
+            }
+            else
+            {
+                iter.state = NodeIter::NISTATE_LEAVE;
+                if (nodeType != NODETYPE_ROOT)
+                    return; // Yield leave event
+            }
+
+            break;
+        }
+
+        case NodeIter::NISTATE_LEAVE:
+        {
+            if (!isLeaf)
+                m_groupNumber++;
+
+            m_sessionStack.pop_back();
+            m_nodePath = buildNodePath();
+            break;
+        }
+
+        default:
+            DE_ASSERT(false);
+            return;
+        }
+    }
+
+    DE_ASSERT(m_sessionStack.empty() && getState() == STATE_FINISHED);
+}
+
+// TestTreeSelection
+
+TestTreeSelection::TestTreeSelection(const TestTreeManifest &manifest, const CaseListFilter &caseListFilter)
+    : m_numSelectedCases(manifest.getNumEntries(), 0u)
+    , m_numEnteredGroups(manifest.getNumEntries(), 0u)
+    , m_hasLookupMiss(manifest.getNumEntries(), false)
+{
+    TestTreeManifestIterator iter(manifest, caseListFilter);
+    vector<int> entryStack;
+
+    while (iter.getState() != TestTreeManifestIterator::STATE_FINISHED)
+    {
+        const int entryNdx = iter.getEntryIndex();
+
+        if (iter.getState() == TestTreeManifestIterator::STATE_ENTER_NODE)
+        {
+            if (isTestNodeTypeExecutable(iter.getNodeType()))
+                m_numSelectedCases[entryNdx] = 1u;
+
+            entryStack.push_back(entryNdx);
+        }
+        else
+        {
+            DE_ASSERT(entryStack.back() == entryNdx);
+            entryStack.pop_back();
+
+            if (!entryStack.empty())
+            {
+                const int parentNdx = entryStack.back();
+
+                m_numSelectedCases[parentNdx] += m_numSelectedCases[entryNdx];
+
+                if (!isTestNodeTypeExecutable(iter.getNodeType()))
+                    m_numEnteredGroups[parentNdx] += 1u + m_numEnteredGroups[entryNdx];
+            }
+        }
+
+        iter.next();
+    }
+
+    findLookupMisses(manifest, caseListFilter, 0, "");
+}
+
+TestTreeSelection::~TestTreeSelection(void)
+{
+}
+
+bool TestTreeSelection::findLookupMisses(const TestTreeManifest &manifest, const CaseListFilter &caseListFilter,
+                                         int entryNdx, const std::string &nodePath)
+{
+    const int endNdx     = entryNdx + manifest.getSubtreeSize(entryNdx);
+    bool anyChildMatches = false;
+    bool hasMiss         = false;
+
+    for (int childNdx = entryNdx + 1; childNdx < endNdx; childNdx += manifest.getSubtreeSize(childNdx))
+    {
+        const string childPath =
+            nodePath.empty() ? string(manifest.getName(childNdx)) : nodePath + "." + manifest.getName(childNdx);
+
+        if (isTestNodeTypeExecutable(manifest.getNodeType(childNdx)))
+            anyChildMatches = caseListFilter.checkTestCaseName(childPath.c_str()) || anyChildMatches;
+        else if (caseListFilter.checkTestGroupName(childPath.c_str()))
+        {
+            anyChildMatches = true;
+            hasMiss         = findLookupMisses(manifest, caseListFilter, childNdx, childPath) || hasMiss;
+        }
+    }
+
+    // Filter descends into this node, but nothing it looks for is in the manifest.
+    hasMiss                   = hasMiss || !anyChildMatches;
+    m_hasLookupMiss[entryNdx] = hasMiss;
+
+    return hasMiss;
+}
+
+de::MovePtr<TestTreeManifest> getTestTreeManifest(TestPackageRoot &root, TestContext &testCtx)
+{
+    const string filename = testCtx.getCommandLine().getTestTreeManifestFile();
+
+    if (filename.empty())
+        return de::MovePtr<TestTreeManifest>();
+
+    {
+        int64_t executableSize = 0;
+        int64_t executableTime = 0;
+
+        // Without the executable in the key a stale manifest could not be told apart, and caselist export never
+        // inflates the hierarchy to notice the difference.
+        if (!deGetExecutableFileInfo(&executableSize, &executableTime))
+        {
+            print("WARNING: Cannot identify test executable, not using test tree manifest '%s'\n", filename.c_str());
+            return de::MovePtr<TestTreeManifest>();
+        }
+    }
+
+    {
+        de::MovePtr<TestTreeManifest> manifest = TestTreeManifest::load(filename, root);
+
+        if (manifest.get())
+            return manifest;
+    }
+
+    print("Building test tree manifest '%s'..\n", filename.c_str());
+
+    try
+    {
+        de::MovePtr<TestTreeManifest> manifest = TestTreeManifest::build(root, testCtx);
+
+        manifest->store(filename);
+
+        return manifest;
+    }
+    catch (const std::exception &e)
+    {
+        // Manifest is only an optimization; fall back to traversing the hierarchy.
+        print("WARNING: Failed to build test tree manifest: %s\n", e.what());
+        return de::MovePtr<TestTreeManifest>();
+    }
+}
+
+void discardTestTreeManifest(TestContext &testCtx)
+{
+    const string filename = testCtx.getCommandLine().getTestTreeManifestFile();
+
+    if (!filename.empty() && deDeleteFile(filename.c_str()))
+        print("Removed outdated test tree manifest '%s', it will be rebuilt by the next run\n", filename.c_str());
+}
+
+} // namespace tcu
@@ -0,0 +1,232 @@
+#ifndef _TCUTESTTREEMANIFEST_HPP
+#define _TCUTESTTREEMANIFEST_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program Tester Core
+ * ----------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Cached test hierarchy manifest.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "tcuTestCase.hpp"
+#include "deUniquePtr.hpp"
+#include "deSha1.h"
+
+#include <string>
+#include <vector>
+
+namespace tcu
+{
+
+class TestPackageRoot;
+class CaseListFilter;
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Flattened test hierarchy
+ *
+ * Manifest stores name, node type and runner type of every node in the
+ * test hierarchy in pre-order, starting from the root node. Each entry
+ * records the size of its subtree, which gives group boundaries without
+ * materializing any test nodes: children of entry N start at N+1 and the
+ * next sibling of entry N is at N + getSubtreeSize(N).
+ *
+ * Manifest is built once by traversing the whole hierarchy and can be
+ * stored into a binary file (--deqp-test-tree-manifest-file) for later
+ * runs. The file is keyed on the release name and id, which identify the
+ * git revision in development builds, on the size and modification time
+ * of the test executable, which change whenever it is relinked, and on the
+ * names of the test packages. The file is not used on platforms where the
+ * executable cannot be identified. Changes the key does not cover are
+ * detected by TestHierarchyIterator, after which the file is discarded and
+ * rebuilt by the next run.
+ *//*--------------------------------------------------------------------*/
+class TestTreeManifest
+{
+public:
+    TestTreeManifest(void);
+    ~TestTreeManifest(void);
+
+    //! Build manifest by traversing the whole hierarchy.
+    static de::MovePtr<TestTreeManifest> build(TestPackageRoot &root, TestContext &testCtx);
+
+    //! Load manifest from file. Returns null if file is missing, corrupt or from another build or package set.
+    static de::MovePtr<TestTreeManifest> load(const std::string &filename, TestPackageRoot &root);
+
+    //! Store manifest into file atomically.
+    void store(const std::string &filename) const;
+
+    int getNumEntries(void) const
+    {
+        return (int)m_entries.size();
+    }
+    const char *getName(int entryNdx) const
+    {
+        return &m_names[m_entries[entryNdx].nameOffset];
+    }
+    TestNodeType getNodeType(int entryNdx) const
+    {
+        return (TestNodeType)m_entries[entryNdx].nodeType;
+    }
+    TestRunnerType getRunnerType(int entryNdx) const
+    {
+        return (TestRunnerType)m_entries[entryNdx].runnerType;
+    }
+    int getSubtreeSize(int entryNdx) const
+    {
+        return (int)m_entries[entryNdx].subtreeSize;
+    }
+
+private:
+    struct Entry
+    {
+        uint32_t nameOffset;  //!< Offset of null-terminated name in m_names.
+        uint32_t subtreeSize; //!< Number of entries in subtree, including this entry.
+        uint8_t nodeType;
+        uint8_t runnerType;
+    };
+
+    TestTreeManifest(const TestTreeManifest &);            // not allowed!
+    TestTreeManifest &operator=(const TestTreeManifest &); // not allowed!
+
+    int addEntry(const char *name, TestNodeType nodeType, TestRunnerType runnerType);
+
+    std::vector<Entry> m_entries;
+    std::vector<char> m_names;
+    deSha1 m_buildKey; //!< Identifies the build and test packages the manifest was built from.
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Test tree manifest iterator
+ *
+ * Traverses manifest entries exactly like TestHierarchyIterator traverses
+ * the hierarchy with the same filter, including case fraction grouping,
+ * but without constructing any test nodes.
+ *//*--------------------------------------------------------------------*/
+class TestTreeManifestIterator
+{
+public:
+    TestTreeManifestIterator(const TestTreeManifest &manifest, const CaseListFilter &caseListFilter);
+    ~TestTreeManifestIterator(void);
+
+    enum State
+    {
+        STATE_ENTER_NODE = 0,
+        STATE_LEAVE_NODE,
+        STATE_FINISHED,
+
+        STATE_LAST
+    };
+
+    State getState(void) const;
+
+    int getEntryIndex(void) const;
+    const char *getNodeName(void) const;
+    TestNodeType getNodeType(void) const;
+    const std::string &getNodePath(void) const;
+
+    void next(void);
+
+private:
+    struct NodeIter
+    {
+        enum State
+        {
+            NISTATE_INIT = 0,
+            NISTATE_ENTER,
+            NISTATE_TRAVERSE_CHILDREN,
+            NISTATE_LEAVE,
+
+            NISTATE_LAST
+        };
+
+        NodeIter(int entryNdx_, State state_) : entryNdx(entryNdx_), nextChildNdx(-1), state(state_)
+        {
+        }
+
+        int entryNdx;
+        int nextChildNdx;
+        State state;
+    };
+
+    TestTreeManifestIterator(const TestTreeManifestIterator &);            // not allowed!
+    TestTreeManifestIterator &operator=(const TestTreeManifestIterator &); // not allowed!
+
+    std::string buildNodePath(void) const;
+
+    const TestTreeManifest &m_manifest;
+    const CaseListFilter &m_caseListFilter;
+
+    std::vector<NodeIter> m_sessionStack;
+    std::string m_nodePath;
+
+    // Counter that increments by one for each group left, matching TestHierarchyIterator
+    int m_groupNumber;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Test cases selected by filter in each manifest subtree
+ *
+ * Used by TestHierarchyIterator to skip inflating groups that have no
+ * selected cases while keeping case fraction group numbering intact.
+ * Groups the filter descends into without matching any node of the
+ * manifest may have gained nodes since the manifest was built and are
+ * reported as lookup misses, so that they are inflated and checked.
+ *//*--------------------------------------------------------------------*/
+class TestTreeSelection
+{
+public:
+    TestTreeSelection(const TestTreeManifest &manifest, const CaseListFilter &caseListFilter);
+    ~TestTreeSelection(void);
+
+    //! Number of test cases selected in the subtree of given entry.
+    int getNumSelectedCases(int entryNdx) const
+    {
+        return (int)m_numSelectedCases[entryNdx];
+    }
+
+    //! Number of groups entered inside the subtree of given entry, not counting the entry itself.
+    int getNumEnteredGroups(int entryNdx) const
+    {
+        return (int)m_numEnteredGroups[entryNdx];
+    }
+
+    //! Check if the filter looks for nodes in the subtree of given entry that are missing from the manifest.
+    bool hasLookupMiss(int entryNdx) const
+    {
+        return m_hasLookupMiss[entryNdx];
+    }
+
+private:
+    bool findLookupMisses(const TestTreeManifest &manifest, const CaseListFilter &caseListFilter, int entryNdx,
+                          const std::string &nodePath);
+
+    std::vector<uint32_t> m_numSelectedCases;
+    std::vector<uint32_t> m_numEnteredGroups;
+    std::vector<bool> m_hasLookupMiss;
+};
+
+//! Get test tree manifest for the session (--deqp-test-tree-manifest-file), building and storing it if needed.
+de::MovePtr<TestTreeManifest> getTestTreeManifest(TestPackageRoot &root, TestContext &testCtx);
+
+//! Remove the stored test tree manifest after it was found not to match the test hierarchy.
+void discardTestTreeManifest(TestContext &testCtx);
+
+} // namespace tcu
+
+#endif // _TCUTESTTREEMANIFEST_HPP
@@ -0,0 +1,697 @@
+/*-------------------------------------------------------------------------
+ * drawElements C++ Base Library
+ * -----------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Work-stealing task scheduler.
+ *//*--------------------------------------------------------------------*/
+
+#include "deTaskScheduler.hpp"
+#include "deThread.hpp"
+#include "deInt32.h"
+
+#include <stdexcept>
+
+namespace de
+{
+
+namespace
+{
+
+enum
+{
+    INITIAL_DEQUE_SIZE     = 64, //!< Must be power of two.
+    NUM_SPINS_BEFORE_SLEEP = 64,
+    CHUNKS_PER_THREAD      = 4 //!< Default parallelFor() granularity.
+};
+
+// Scheduler and worker index of the current thread, if it is a worker thread.
+thread_local const TaskScheduler *s_currentScheduler = DE_NULL;
+thread_local int s_currentWorkerNdx                  = -1;
+
+} // namespace
+
+namespace detail
+{
+
+// WorkStealingDeque
+
+WorkStealingDeque::Array::Array(int64_t size_) : size(size_), slots((size_t)size_)
+{
+    DE_ASSERT(deIsPowerOfTwo64((uint64_t)size_));
+}
+
+WorkStealingDeque::WorkStealingDeque(void) : m_top(0), m_bottom(0), m_array(new Array(INITIAL_DEQUE_SIZE))
+{
+}
+
+WorkStealingDeque::~WorkStealingDeque(void)
+{
+    delete m_array.load(std::memory_order_relaxed);
+
+    for (size_t ndx = 0; ndx < m_retiredArrays.size(); ndx++)
+        delete m_retiredArrays[ndx];
+}
+
+WorkStealingDeque::Array *WorkStealingDeque::grow(Array *array, int64_t bottom, int64_t top)
+{
+    Array *const newArray = new Array(array->size * 2);
+
+    for (int64_t ndx = top; ndx < bottom; ndx++)
+        newArray->put(ndx, array->get(ndx));
+
+    // Thieves may still be reading the old array.
+    m_retiredArrays.push_back(array);
+    m_array.store(newArray, std::memory_order_release);
+
+    return newArray;
+}
+
+void WorkStealingDeque::push(Task *task)
+{
+    const int64_t bottom = m_bottom.load(std::memory_order_relaxed);
+    const int64_t top    = m_top.load(std::memory_order_acquire);
+    Array *array         = m_array.load(std::memory_order_relaxed);
+
+    if (bottom - top > array->size - 1)
+        array = grow(array, bottom, top);
+
+    array->put(bottom, task);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_bottom.store(bottom + 1, std::memory_order_relaxed);
+}
+
+Task *WorkStealingDeque::take(void)
+{
+    const int64_t bottom = m_bottom.load(std::memory_order_relaxed) - 1;
+    Array *const array   = m_array.load(std::memory_order_relaxed);
+    int64_t top;
+    Task *task = DE_NULL;
+
+    m_bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    top = m_top.load(std::memory_order_relaxed);
+
+    if (top <= bottom)
+    {
+        task = array->get(bottom);
+
+        if (top == bottom)
+        {
+            // Last element, race against thieves.
+            if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                task = DE_NULL;
+
+            m_bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+    }
+    else
+        m_bottom.store(bottom + 1, std::memory_order_relaxed);
+
+    return task;
+}
+
+Task *WorkStealingDeque::steal(void)
+{
+    int64_t top = m_top.load(std::memory_order_acquire);
+    int64_t bottom;
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    bottom = m_bottom.load(std::memory_order_acquire);
+
+    if (top < bottom)
+    {
+        Array *const array = m_array.load(std::memory_order_acquire);
+        Task *const task   = array->get(top);
+
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return DE_NULL;
+
+        return task;
+    }
+
+    return DE_NULL;
+}
+
+// WorkerThread
+
+class WorkerThread : public de::Thread
+{
+public:
+    WorkerThread(TaskScheduler &scheduler, int workerNdx) : m_scheduler(scheduler), m_workerNdx(workerNdx)
+    {
+    }
+
+    void run(void)
+    {
+        s_currentScheduler = &m_scheduler;
+        s_currentWorkerNdx = m_workerNdx;
+
+        m_scheduler.workerLoop(m_workerNdx);
+    }
+
+private:
+    TaskScheduler &m_scheduler;
+    const int m_workerNdx;
+};
+
+} // namespace detail
+
+// TaskScheduler
+
+TaskScheduler::TaskScheduler(int numThreads)
+    : m_numThreads(numThreads > 0 ? numThreads : de::max(1, (int)deGetNumAvailableLogicalCores()))
+    , m_injectionQueueSize(0)
+    , m_numPendingTasks(0)
+    , m_numSleeping(0)
+    , m_isShuttingDown(false)
+{
+    // Calling thread counts as one of the threads as it executes tasks while waiting.
+    const int numWorkers = m_numThreads - 1;
+
+    for (int workerNdx = 0; workerNdx < numWorkers; workerNdx++)
+        m_deques.push_back(new detail::WorkStealingDeque());
+}
+
+TaskScheduler::~TaskScheduler(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_sleepLock);
+        m_isShuttingDown = true;
+    }
+    m_sleepCond.notify_all();
+
+    for (size_t ndx = 0; ndx < m_workers.size(); ndx++)
+    {
+        m_workers[ndx]->join();
+        delete m_workers[ndx];
+    }
+
+    for (size_t ndx = 0; ndx < m_deques.size(); ndx++)
+        delete m_deques[ndx];
+
+    DE_ASSERT(m_injectionQueue.empty());
+}
+
+void TaskScheduler::startWorkers(void)
+{
+    for (int workerNdx = 0; workerNdx < (int)m_deques.size(); workerNdx++)
+    {
+        m_workers.push_back(new detail::WorkerThread(*this, workerNdx));
+        m_workers.back()->start();
+    }
+}
+
+int TaskScheduler::getCurrentWorkerIndex(void) const
+{
+    return s_currentScheduler == this ? s_currentWorkerNdx : -1;
+}
+
+void TaskScheduler::spawn(detail::Task *task)
+{
+    const int workerNdx = getCurrentWorkerIndex();
+
+    // Workers are only started once there is work for them.
+    std::call_once(m_startWorkersFlag, &TaskScheduler::startWorkers, this);
+
+    // Count the task before publishing it so that the counter never goes negative.
+    m_numPendingTasks.fetch_add(1);
+
+    if (workerNdx >= 0)
+        m_deques[workerNdx]->push(task);
+    else
+    {
+        std::lock_guard<std::mutex> lock(m_injectionLock);
+        m_injectionQueue.push_back(task);
+        m_injectionQueueSize.store(m_injectionQueue.size());
+    }
+
+    // Sleeping workers re-check m_numPendingTasks while holding m_sleepLock.
+    if (m_numSleeping.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_sleepLock);
+        m_sleepCond.notify_one();
+    }
+}
+
+detail::Task *TaskScheduler::findTask(int workerNdx)
+{
+    const int numDeques = (int)m_deques.size();
+
+    if (workerNdx >= 0)
+    {
+        detail::Task *const task = m_deques[workerNdx]->take();
+
+        if (task)
+            return task;
+    }
+
+    if (m_injectionQueueSize.load() > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_injectionLock);
+
+        if (!m_injectionQueue.empty())
+        {
+            detail::Task *const task = m_injectionQueue.front();
+
+            m_injectionQueue.pop_front();
+            m_injectionQueueSize.store(m_injectionQueue.size());
+            return task;
+        }
+    }
+
+    for (int offset = 1; offset <= numDeques; offset++)
+    {
+        const int victimNdx = (de::max(workerNdx, 0) + offset) % numDeques;
+
+        if (victimNdx != workerNdx)
+        {
+            detail::Task *const task = m_deques[victimNdx]->steal();
+
+            if (task)
+                return task;
+        }
+    }
+
+    return DE_NULL;
+}
+
+bool TaskScheduler::executeOne(int workerNdx)
+{
+    detail::Task *const task = findTask(workerNdx);
+
+    if (!task)
+        return false;
+
+    m_numPendingTasks.fetch_sub(1);
+    task->group->execute(task);
+
+    return true;
+}
+
+void TaskScheduler::workerLoop(int workerNdx)
+{
+    int numFailedSpins = 0;
+
+    while (!m_isShuttingDown.load())
+    {
+        if (executeOne(workerNdx))
+        {
+            numFailedSpins = 0;
+            continue;
+        }
+
+        if (++numFailedSpins < NUM_SPINS_BEFORE_SLEEP)
+        {
+            deYield();
+            continue;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(m_sleepLock);
+
+            m_numSleeping.fetch_add(1);
+            while (m_numPendingTasks.load() == 0 && !m_isShuttingDown.load())
+                m_sleepCond.wait(lock);
+            m_numSleeping.fetch_sub(1);
+        }
+
+        numFailedSpins = 0;
+    }
+}
+
+namespace
+{
+
+struct SchedulerInstance
+{
+    SchedulerInstance(void) : numThreads(0), scheduler(DE_NULL)
+    {
+    }
+
+    ~SchedulerInstance(void)
+    {
+        delete scheduler;
+    }
+
+    std::mutex lock;
+    int numThreads;
+    TaskScheduler *scheduler;
+};
+
+SchedulerInstance &getSchedulerInstance(void)
+{
+    static SchedulerInstance instance;
+    return instance;
+}
+
+} // namespace
+
+TaskScheduler &TaskScheduler::getInstance(void)
+{
+    SchedulerInstance &instance = getSchedulerInstance();
+    std::lock_guard<std::mutex> lock(instance.lock);
+
+    if (!instance.scheduler)
+        instance.scheduler = new TaskScheduler(instance.numThreads);
+
+    return *instance.scheduler;
+}
+
+void TaskScheduler::setNumThreads(int numThreads)
+{
+    SchedulerInstance &instance = getSchedulerInstance();
+    std::lock_guard<std::mutex> lock(instance.lock);
+
+    if (instance.scheduler && instance.numThreads != numThreads)
+    {
+        delete instance.scheduler;
+        instance.scheduler = DE_NULL;
+    }
+
+    instance.numThreads = numThreads;
+}
+
+// TaskGroup
+
+TaskGroup::TaskGroup(TaskScheduler &scheduler) : m_scheduler(scheduler), m_numPending(0)
+{
+}
+
+TaskGroup::~TaskGroup(void)
+{
+    waitNoThrow();
+}
+
+void TaskGroup::run(const std::function<void(void)> &func)
+{
+    detail::Task *const task = new detail::Task();
+
+    task->func  = func;
+    task->group = this;
+
+    m_numPending.fetch_add(1);
+
+    // Single-threaded scheduler runs tasks immediately, in submission order.
+    if (m_scheduler.getNumThreads() == 1)
+        execute(task);
+    else
+        m_scheduler.spawn(task);
+}
+
+void TaskGroup::execute(detail::Task *task)
+{
+    try
+    {
+        task->func();
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> lock(m_exceptionLock);
+
+        if (!m_exception)
+            m_exception = std::current_exception();
+    }
+
+    delete task;
+
+    // The last task decrements the counter under m_waitLock, which waitNoThrow() acquires before returning, so
+    // the group is not destroyed before the notification is done.
+    for (;;)
+    {
+        int numPending = m_numPending.load(std::memory_order_relaxed);
+
+        if (numPending == 1)
+        {
+            std::lock_guard<std::mutex> lock(m_waitLock);
+
+            if (m_numPending.fetch_sub(1, std::memory_order_release) == 1)
+                m_waitCond.notify_all();
+
+            break;
+        }
+
+        if (m_numPending.compare_exchange_weak(numPending, numPending - 1, std::memory_order_release,
+                                               std::memory_order_relaxed))
+            break;
+    }
+}
+
+void TaskGroup::waitNoThrow(void)
+{
+    const int workerNdx = m_scheduler.getCurrentWorkerIndex();
+
+    // Help executing tasks instead of blocking; this also makes nested waits safe. Once no task can be found, the
+    // remaining tasks of the group are running on other threads and any tasks they spawn are visible to those
+    // threads, so blocking until the group is done cannot deadlock.
+    while (m_numPending.load(std::memory_order_acquire) > 0)
+    {
+        if (!m_scheduler.executeOne(workerNdx))
+        {
+            std::unique_lock<std::mutex> lock(m_waitLock);
+
+            m_waitCond.wait(lock, [this]() { return m_numPending.load(std::memory_order_acquire) == 0; });
+        }
+    }
+
+    // Wait until the task that completed the group has released m_waitLock.
+    std::lock_guard<std::mutex> lock(m_waitLock);
+}
+
+void TaskGroup::wait(void)
+{
+    waitNoThrow();
+
+    if (m_exception)
+    {
+        std::exception_ptr exception = m_exception;
+
+        m_exception = DE_NULL;
+        std::rethrow_exception(exception);
+    }
+}
+
+// Parallel algorithms
+
+size_t getParallelGrainSize(size_t numElements, size_t grainSize, const TaskScheduler &scheduler)
+{
+    if (grainSize > 0)
+        return grainSize;
+    else if (scheduler.getNumThreads() == 1)
+        return de::max<size_t>(numElements, 1);
+    else
+    {
+        const size_t numChunks = (size_t)scheduler.getNumThreads() * CHUNKS_PER_THREAD;
+
+        return de::max<size_t>((numElements + numChunks - 1) / numChunks, 1);
+    }
+}
+
+void parallelFor(size_t begin, size_t end, size_t grainSize, const std::function<void(size_t, size_t)> &func,
+                 TaskScheduler &scheduler)
+{
+    if (end <= begin)
+        return;
+
+    {
+        const size_t chunkSize = getParallelGrainSize(end - begin, grainSize, scheduler);
+
+        if (scheduler.getNumThreads() == 1 || chunkSize >= end - begin)
+        {
+            for (size_t chunkBegin = begin; chunkBegin < end; chunkBegin += de::min(chunkSize, end - chunkBegin))
+                func(chunkBegin, chunkBegin + de::min(chunkSize, end - chunkBegin));
+        }
+        else
+        {
+            TaskGroup group(scheduler);
+
+            for (size_t chunkBegin = begin + chunkSize; chunkBegin < end; chunkBegin += chunkSize)
+            {
+                const size_t chunkEnd = chunkBegin + de::min(chunkSize, end - chunkBegin);
+
+                group.run([&func, chunkBegin, chunkEnd]() { func(chunkBegin, chunkEnd); });
+            }
+
+            // Calling thread takes the first chunk.
+            func(begin, begin + chunkSize);
+
+            group.wait();
+        }
+    }
+}
+
+// Self-test
+
+namespace
+{
+
+void testDeque(void)
+{
+    detail::WorkStealingDeque deque;
+    std::vector<detail::Task> tasks(1000);
+
+    // Owner side is LIFO, thief side FIFO; exercise array growth as well.
+    for (size_t ndx = 0; ndx < tasks.size(); ndx++)
+        deque.push(&tasks[ndx]);
+
+    DE_TEST_ASSERT(deque.steal() == &tasks[0]);
+    DE_TEST_ASSERT(deque.take() == &tasks[tasks.size() - 1]);
+
+    for (size_t ndx = 1; ndx < tasks.size() - 1; ndx++)
+        DE_TEST_ASSERT(deque.steal() == &tasks[ndx]);
+
+    DE_TEST_ASSERT(deque.take() == DE_NULL);
+    DE_TEST_ASSERT(deque.steal() == DE_NULL);
+}
+
+void testParallelFor(TaskScheduler &scheduler)
+{
+    const size_t numElements = 100000;
+    std::vector<int> counts(numElements, 0);
+
+    parallelFor(0, numElements, 0,
+                [&counts](size_t begin, size_t end)
+                {
+                    for (size_t ndx = begin; ndx < end; ndx++)
+                        counts[ndx] += 1;
+                },
+                scheduler);
+
+    for (size_t ndx = 0; ndx < numElements; ndx++)
+        DE_TEST_ASSERT(counts[ndx] == 1);
+}
+
+void testNested(TaskScheduler &scheduler)
+{
+    const size_t numOuter = 32;
+    const size_t numInner = 1000;
+    std::vector<int64_t> sums(numOuter, 0);
+
+    parallelFor(0, numOuter, 1,
+                [&sums, &scheduler](size_t outerBegin, size_t outerEnd)
+                {
+                    for (size_t outerNdx = outerBegin; outerNdx < outerEnd; outerNdx++)
+                    {
+                        sums[outerNdx] = parallelReduce(
+                            0, numInner, 16, (int64_t)0,
+                            [outerNdx](size_t begin, size_t end)
+                            {
+                                int64_t sum = 0;
+                                for (size_t ndx = begin; ndx < end; ndx++)
+                                    sum += (int64_t)(ndx * outerNdx);
+                                return sum;
+                            },
+                            [](int64_t a, int64_t b) { return a + b; }, scheduler);
+                    }
+                },
+                scheduler);
+
+    for (size_t outerNdx = 0; outerNdx < numOuter; outerNdx++)
+        DE_TEST_ASSERT(sums[outerNdx] == (int64_t)(outerNdx * numInner * (numInner - 1) / 2));
+}
+
+void testReduceDeterminism(TaskScheduler &scheduler)
+{
+    const auto map = [](size_t begin, size_t end)
+    {
+        float sum = 0.0f;
+        for (size_t ndx = begin; ndx < end; ndx++)
+            sum += 1.0f / (float)(ndx + 1);
+        return sum;
+    };
+    const auto reduce = [](float a, float b) { return a + b; };
+    const float first = parallelReduce(0, 50000, 0, 0.0f, map, reduce, scheduler);
+
+    for (int iterNdx = 0; iterNdx < 10; iterNdx++)
+        DE_TEST_ASSERT(parallelReduce(0, 50000, 0, 0.0f, map, reduce, scheduler) == first);
+}
+
+void testExceptions(TaskScheduler &scheduler)
+{
+    TaskGroup group(scheduler);
+    std::atomic<int> numExecuted(0);
+    bool caught = false;
+
+    for (int taskNdx = 0; taskNdx < 100; taskNdx++)
+    {
+        group.run(
+            [&numExecuted, taskNdx]()
+            {
+                numExecuted.fetch_add(1);
+                if (taskNdx == 50)
+                    throw std::runtime_error("Task failed");
+            });
+    }
+
+    try
+    {
+        group.wait();
+    }
+    catch (const std::runtime_error &)
+    {
+        caught = true;
+    }
+
+    DE_TEST_ASSERT(caught);
+    DE_TEST_ASSERT(numExecuted.load() == 100);
+
+    // Exception is reported only once.
+    group.wait();
+}
+
+void testSingleThreadOrder(void)
+{
+    TaskScheduler scheduler(1);
+    TaskGroup group(scheduler);
+    std::vector<int> order;
+
+    for (int taskNdx = 0; taskNdx < 10; taskNdx++)
+        group.run([&order, taskNdx]() { order.push_back(taskNdx); });
+
+    // Tasks have already been executed at this point.
+    DE_TEST_ASSERT(order.size() == 10);
+
+    group.wait();
+
+    for (int taskNdx = 0; taskNdx < 10; taskNdx++)
+        DE_TEST_ASSERT(order[taskNdx] == taskNdx);
+}
+
+} // namespace
+
+void TaskScheduler_selfTest(void)
+{
+    testDeque();
+    testSingleThreadOrder();
+
+    {
+        const int numThreads[] = {1, 2, 4, 8};
+
+        for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(numThreads); ndx++)
+        {
+            TaskScheduler scheduler(numThreads[ndx]);
+
+            testParallelFor(scheduler);
+            testNested(scheduler);
+            testReduceDeterminism(scheduler);
+            testExceptions(scheduler);
+        }
+    }
+}
+
+} // namespace de
@@ -0,0 +1,266 @@
+#ifndef _DETASKSCHEDULER_HPP
+#define _DETASKSCHEDULER_HPP
+/*-------------------------------------------------------------------------
+ * drawElements C++ Base Library
+ * -----------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Work-stealing task scheduler.
+ *//*--------------------------------------------------------------------*/
+
+#include "deDefs.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace de
+{
+
+class TaskGroup;
+
+namespace detail
+{
+
+struct Task
+{
+    std::function<void(void)> func;
+    TaskGroup *group;
+};
+
+class WorkerThread;
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Chase-Lev work-stealing deque
+ *
+ * Owner thread pushes and takes tasks at the bottom, other threads steal
+ * from the top. The backing array grows on demand; retired arrays are kept
+ * alive until the deque is destroyed since thieves may still read them.
+ *//*--------------------------------------------------------------------*/
+class WorkStealingDeque
+{
+public:
+    WorkStealingDeque(void);
+    ~WorkStealingDeque(void);
+
+    //! Push task. Owner thread only.
+    void push(Task *task);
+
+    //! Take most recently pushed task. Owner thread only.
+    Task *take(void);
+
+    //! Steal oldest task. Can be called from any thread; may fail spuriously under contention.
+    Task *steal(void);
+
+private:
+    WorkStealingDeque(const WorkStealingDeque &);            // not allowed!
+    WorkStealingDeque &operator=(const WorkStealingDeque &); // not allowed!
+
+    struct Array
+    {
+        Array(int64_t size_);
+
+        Task *get(int64_t ndx) const
+        {
+            return slots[ndx & (size - 1)].load(std::memory_order_relaxed);
+        }
+
+        void put(int64_t ndx, Task *task)
+        {
+            slots[ndx & (size - 1)].store(task, std::memory_order_relaxed);
+        }
+
+        const int64_t size;
+        std::vector<std::atomic<Task *>> slots;
+    };
+
+    Array *grow(Array *array, int64_t bottom, int64_t top);
+
+    std::atomic<int64_t> m_top;
+    std::atomic<int64_t> m_bottom;
+    std::atomic<Array *> m_array;
+    std::vector<Array *> m_retiredArrays;
+};
+
+} // namespace detail
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Work-stealing task scheduler
+ *
+ * TaskScheduler runs tasks on a pool of worker threads. Each worker owns a
+ * Chase-Lev deque: tasks spawned from a worker go to its own deque and
+ * idle workers steal from the others. Tasks spawned from other threads
+ * go to a shared injection queue.
+ *
+ * Threads waiting for a TaskGroup execute pending tasks while waiting,
+ * so parallel algorithms can be nested freely without deadlocks.
+ *
+ * Scheduler with a single thread creates no workers and runs every task
+ * on the calling thread in submission order, which is useful for
+ * debugging.
+ *
+ * Worker threads are started when the first task is spawned, so processes
+ * that never run parallel work do not create them.
+ *
+ * Process-wide scheduler is available through getInstance(). Its thread
+ * count is set with setNumThreads(), which tcu::App does based on
+ * --deqp-worker-threads.
+ *//*--------------------------------------------------------------------*/
+class TaskScheduler
+{
+public:
+    //! Create scheduler with numThreads threads in total including the waiting threads (0 = number of logical cores).
+    explicit TaskScheduler(int numThreads);
+    ~TaskScheduler(void);
+
+    int getNumThreads(void) const
+    {
+        return m_numThreads;
+    }
+
+    //! Get process-wide scheduler, creating it on first use.
+    static TaskScheduler &getInstance(void);
+
+    //! Set number of threads in process-wide scheduler (0 = number of logical cores).
+    //! Must not be called while the process-wide scheduler is in use.
+    static void setNumThreads(int numThreads);
+
+private:
+    friend class TaskGroup;
+    friend class detail::WorkerThread;
+
+    TaskScheduler(const TaskScheduler &);            // not allowed!
+    TaskScheduler &operator=(const TaskScheduler &); // not allowed!
+
+    void startWorkers(void);
+    void spawn(detail::Task *task);
+    bool executeOne(int workerNdx);
+    detail::Task *findTask(int workerNdx);
+    void workerLoop(int workerNdx);
+    int getCurrentWorkerIndex(void) const;
+
+    const int m_numThreads;
+    std::once_flag m_startWorkersFlag;
+    std::vector<detail::WorkerThread *> m_workers;
+    std::vector<detail::WorkStealingDeque *> m_deques;
+
+    std::mutex m_injectionLock;
+    std::deque<detail::Task *> m_injectionQueue;
+    std::atomic<size_t> m_injectionQueueSize; //!< Lets idle threads skip m_injectionLock.
+
+    std::mutex m_sleepLock;
+    std::condition_variable m_sleepCond;
+    std::atomic<int> m_numPendingTasks; //!< Tasks spawned but not yet picked up.
+    std::atomic<int> m_numSleeping;
+    std::atomic<bool> m_isShuttingDown;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Group of tasks that can be waited for
+ *
+ * Tasks may run concurrently with each other and with the spawning thread
+ * until wait() returns. If a task throws, the first exception is rethrown
+ * from wait(). Destructor waits for remaining tasks but discards
+ * exceptions.
+ *//*--------------------------------------------------------------------*/
+class TaskGroup
+{
+public:
+    TaskGroup(TaskScheduler &scheduler = TaskScheduler::getInstance());
+    ~TaskGroup(void);
+
+    void run(const std::function<void(void)> &func);
+    void wait(void);
+
+private:
+    friend class TaskScheduler;
+
+    TaskGroup(const TaskGroup &);            // not allowed!
+    TaskGroup &operator=(const TaskGroup &); // not allowed!
+
+    void execute(detail::Task *task);
+    void waitNoThrow(void);
+
+    TaskScheduler &m_scheduler;
+    std::atomic<int> m_numPending;
+    std::mutex m_waitLock;
+    std::condition_variable m_waitCond; //!< Signaled when m_numPending reaches zero.
+    std::mutex m_exceptionLock;
+    std::exception_ptr m_exception;
+};
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Parallel loop over range
+ *
+ * Splits [begin, end) into chunks of at most grainSize elements and calls
+ * func(chunkBegin, chunkEnd) for each chunk, possibly concurrently. If
+ * grainSize is 0 a size giving a few chunks per thread is chosen.
+ *//*--------------------------------------------------------------------*/
+void parallelFor(size_t begin, size_t end, size_t grainSize, const std::function<void(size_t, size_t)> &func,
+                 TaskScheduler &scheduler = TaskScheduler::getInstance());
+
+//! Compute chunk size for parallelFor()/parallelReduce().
+size_t getParallelGrainSize(size_t numElements, size_t grainSize, const TaskScheduler &scheduler);
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Parallel reduction over range
+ *
+ * Maps each chunk of [begin, end) to a value with map(chunkBegin, chunkEnd)
+ * and combines the chunk values in range order with reduce(a, b), starting
+ * from identity. Chunking only depends on grainSize and thread count, so
+ * the result is deterministic for non-associative operations like
+ * floating-point addition as long as those stay fixed.
+ *//*--------------------------------------------------------------------*/
+template <typename T, typename MapFunc, typename ReduceFunc>
+T parallelReduce(size_t begin, size_t end, size_t grainSize, const T &identity, const MapFunc &map,
+                 const ReduceFunc &reduce, TaskScheduler &scheduler = TaskScheduler::getInstance())
+{
+    const size_t chunkSize = getParallelGrainSize(end > begin ? end - begin : 0, grainSize, scheduler);
+    const size_t numChunks = end > begin ? (end - begin + chunkSize - 1) / chunkSize : 0;
+    std::vector<T> chunkValues(numChunks, identity);
+    T result = identity;
+
+    parallelFor(
+        0, numChunks, 1,
+        [&](size_t chunkBegin, size_t chunkEnd)
+        {
+            for (size_t chunkNdx = chunkBegin; chunkNdx < chunkEnd; chunkNdx++)
+            {
+                const size_t rangeBegin = begin + chunkNdx * chunkSize;
+                const size_t rangeEnd   = rangeBegin + chunkSize < end ? rangeBegin + chunkSize : end;
+
+                chunkValues[chunkNdx] = map(rangeBegin, rangeEnd);
+            }
+        },
+        scheduler);
+
+    for (size_t chunkNdx = 0; chunkNdx < numChunks; chunkNdx++)
+        result = reduce(result, chunkValues[chunkNdx]);
+
+    return result;
+}
+
+void TaskScheduler_selfTest(void);
+
+} // namespace de
+
+#endif // _DETASKSCHEDULER_HPP
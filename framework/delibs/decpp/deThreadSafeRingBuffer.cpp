@@ -60,7 +60,9 @@ struct Message
 class Consumer : public Thread
 {
 public:
-    Consumer(ThreadSafeRingBuffer<Message> &buffer, int numProducers) : m_buffer(buffer)
+    Consumer(ThreadSafeRingBuffer<Message> &buffer, int numProducers, int batchSize)
+        : m_buffer(buffer)
+        , m_batchSize(batchSize)
     {
         m_lastPayload.resize(numProducers, 0);
         m_payloadSum.resize(numProducers, 0);
@@ -68,21 +70,33 @@ public:
 
     void run(void)
     {
+        vector<Message> batch(m_batchSize);
+
         for (;;)
         {
-            Message msg = m_buffer.popBack();
-
-            uint16_t threadId = msg.getThreadId();
-
-            if (threadId == 0xffff)
-                break;
-
-            DE_TEST_ASSERT(de::inBounds<int>(threadId, 0, (int)m_lastPayload.size()));
-            DE_TEST_ASSERT((m_lastPayload[threadId] == 0 && msg.getPayload() == 0) ||
-                           m_lastPayload[threadId] < msg.getPayload());
-
-            m_lastPayload[threadId] = msg.getPayload();
-            m_payloadSum[threadId] += (uint32_t)msg.getPayload();
+            size_t numMessages = m_batchSize > 1 ? m_buffer.tryPopBack(&batch[0], batch.size()) : 0;
+
+            if (numMessages == 0)
+            {
+                batch[0]    = m_buffer.popBack();
+                numMessages = 1;
+            }
+
+            for (size_t msgNdx = 0; msgNdx < numMessages; msgNdx++)
+            {
+                if (batch[msgNdx].getThreadId() == 0xffff)
+                {
+                    // End messages come last; hand over any extra ones to other consumers.
+                    for (size_t extraNdx = msgNdx + 1; extraNdx < numMessages; extraNdx++)
+                    {
+                        DE_TEST_ASSERT(batch[extraNdx].getThreadId() == 0xffff);
+                        m_buffer.pushFront(batch[extraNdx]);
+                    }
+                    return;
+                }
+
+                consume(batch[msgNdx]);
+            }
         }
     }
 
@@ -92,7 +106,20 @@ public:
     }
 
 private:
+    void consume(const Message &msg)
+    {
+        const uint16_t threadId = msg.getThreadId();
+
+        DE_TEST_ASSERT(de::inBounds<int>(threadId, 0, (int)m_lastPayload.size()));
+        DE_TEST_ASSERT((m_lastPayload[threadId] == 0 && msg.getPayload() == 0) ||
+                       m_lastPayload[threadId] < msg.getPayload());
+
+        m_lastPayload[threadId] = msg.getPayload();
+        m_payloadSum[threadId] += (uint32_t)msg.getPayload();
+    }
+
     ThreadSafeRingBuffer<Message> &m_buffer;
+    const int m_batchSize;
     vector<uint16_t> m_lastPayload;
     vector<uint32_t> m_payloadSum;
 };
@@ -100,33 +127,82 @@ private:
 class Producer : public Thread
 {
 public:
-    Producer(ThreadSafeRingBuffer<Message> &buffer, uint16_t threadId, int dataSize)
+    Producer(ThreadSafeRingBuffer<Message> &buffer, uint16_t threadId, int dataSize, int batchSize)
         : m_buffer(buffer)
         , m_threadId(threadId)
         , m_dataSize(dataSize)
+        , m_batchSize(batchSize)
     {
     }
 
     void run(void)
     {
+        vector<Message> batch;
+
         // Yield to give main thread chance to start other producers.
         deSleep(1);
 
         for (int ndx = 0; ndx < m_dataSize; ndx++)
-            m_buffer.pushFront(Message(m_threadId, (uint16_t)ndx));
+        {
+            if (m_batchSize > 1)
+            {
+                batch.push_back(Message(m_threadId, (uint16_t)ndx));
+
+                if ((int)batch.size() == m_batchSize || ndx + 1 == m_dataSize)
+                {
+                    m_buffer.pushFront(&batch[0], batch.size());
+                    batch.clear();
+                }
+            }
+            else
+                m_buffer.pushFront(Message(m_threadId, (uint16_t)ndx));
+        }
     }
 
 private:
     ThreadSafeRingBuffer<Message> &m_buffer;
     uint16_t m_threadId;
     int m_dataSize;
+    int m_batchSize;
 };
 
+void testNonBlocking(void)
+{
+    ThreadSafeRingBuffer<int> buffer(5);
+    vector<int> elems(8);
+    int elem = 0;
+
+    // Capacity is rounded up to a power of two.
+    for (int ndx = 0; ndx < 8; ndx++)
+        DE_TEST_ASSERT(buffer.tryPushFront(ndx));
+
+    DE_TEST_ASSERT(!buffer.tryPushFront(8));
+    DE_TEST_ASSERT(buffer.tryPopBack(elem) && elem == 0);
+    DE_TEST_ASSERT(buffer.popBack() == 1);
+
+    for (int ndx = 0; ndx < 8; ndx++)
+        elems[ndx] = 8 + ndx;
+
+    DE_TEST_ASSERT(buffer.tryPushFront(&elems[0], elems.size()) == 2);
+    DE_TEST_ASSERT(buffer.tryPopBack(&elems[0], 3) == 3);
+    DE_TEST_ASSERT(elems[0] == 2 && elems[1] == 3 && elems[2] == 4);
+    DE_TEST_ASSERT(buffer.tryPopBack(&elems[0], elems.size()) == 5);
+
+    for (int ndx = 0; ndx < 5; ndx++)
+        DE_TEST_ASSERT(elems[ndx] == 5 + ndx);
+
+    DE_TEST_ASSERT(!buffer.tryPopBack(elem));
+    DE_TEST_ASSERT(buffer.tryPopBack(&elems[0], elems.size()) == 0);
+}
+
 } // namespace
 
 void ThreadSafeRingBuffer_selfTest(void)
 {
     const int numIterations = 16;
+
+    testNonBlocking();
+
     for (int iterNdx = 0; iterNdx < numIterations; iterNdx++)
     {
         Random rnd(iterNdx);
@@ -134,15 +210,16 @@ void ThreadSafeRingBuffer_selfTest(void)
         int numProducers = rnd.getInt(1, 16);
         int numConsumers = rnd.getInt(1, 16);
         int dataSize     = rnd.getInt(1000, 10000);
+        int batchSize    = (iterNdx % 2) ? rnd.getInt(2, 64) : 1;
         ThreadSafeRingBuffer<Message> buffer(bufSize);
         vector<Producer *> producers;
         vector<Consumer *> consumers;
 
         for (int i = 0; i < numProducers; i++)
-            producers.push_back(new Producer(buffer, (uint16_t)i, dataSize));
+            producers.push_back(new Producer(buffer, (uint16_t)i, dataSize, batchSize));
 
         for (int i = 0; i < numConsumers; i++)
-            consumers.push_back(new Consumer(buffer, numProducers));
+            consumers.push_back(new Consumer(buffer, numProducers, batchSize));
 
         // Start consumers.
         for (vector<Consumer *>::iterator i = consumers.begin(); i != consumers.end(); i++)
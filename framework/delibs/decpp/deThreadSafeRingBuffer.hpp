@@ -24,9 +24,12 @@
  *//*--------------------------------------------------------------------*/
 
 #include "deDefs.hpp"
-#include "deMutex.hpp"
-#include "deSemaphore.hpp"
+#include "deInt32.h"
+#include "deThread.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
 #include <vector>
 
 namespace de
@@ -34,7 +37,20 @@ namespace de
 
 void ThreadSafeRingBuffer_selfTest(void);
 
-/** Thread-safe ring buffer template. */
+/*--------------------------------------------------------------------*//*!
+ * \brief Thread-safe ring buffer template.
+ *
+ * Bounded multi-producer multi-consumer queue. Every slot carries a
+ * sequence number that tells whether it is ready for writing or reading
+ * in the current lap, so producers and consumers only contend on a single
+ * compare-and-swap of the front or back position.
+ *
+ * Blocking operations spin for a while and only sleep when the buffer is
+ * full (pushFront) or empty (popBack). Waking up sleepers is skipped
+ * unless some thread is actually waiting.
+ *
+ * Capacity is size rounded up to the next power of two.
+ *//*--------------------------------------------------------------------*/
 template <typename T>
 class ThreadSafeRingBuffer
 {
@@ -49,109 +65,254 @@ public:
     T popBack(void);
     bool tryPopBack(T &dst);
 
+    //! Push all elements, blocking while the buffer is full.
+    void pushFront(const T *elems, size_t numElems);
+    //! Push as many elements as fit without blocking. Returns number of elements pushed.
+    size_t tryPushFront(const T *elems, size_t numElems);
+    //! Pop up to maxElems elements without blocking. Returns number of elements popped.
+    size_t tryPopBack(T *dst, size_t maxElems);
+
 protected:
-    void pushFrontInternal(const T &elem);
-    T popBackInternal(void);
+    enum
+    {
+        NUM_SPINS_BEFORE_WAIT = 64
+    };
+
+    struct Slot
+    {
+        std::atomic<size_t> sequence;
+        T element;
+    };
 
-    const size_t m_size;
-    std::vector<T> m_elements;
+    bool pushFrontInternal(const T &elem);
+    bool popBackInternal(T &dst);
+    void wakeWaiters(std::atomic<int> &numWaiting, std::condition_variable &cond, bool wakeAll);
 
-    size_t m_front;
-    size_t m_back;
+    const size_t m_mask;
+    std::vector<Slot> m_slots;
 
-    Mutex m_writeMutex;
-    Mutex m_readMutex;
+    // Positions are kept on separate cache lines to avoid false sharing between producers and consumers.
+    alignas(64) std::atomic<size_t> m_front;
+    alignas(64) std::atomic<size_t> m_back;
 
-    Semaphore m_fill;
-    Semaphore m_empty;
+    alignas(64) std::mutex m_waitLock;
+    std::condition_variable m_notEmpty;
+    std::condition_variable m_notFull;
+    std::atomic<int> m_numWaitingPushers;
+    std::atomic<int> m_numWaitingPoppers;
 };
 
 // ThreadSafeRingBuffer implementation.
 
 template <typename T>
 ThreadSafeRingBuffer<T>::ThreadSafeRingBuffer(size_t size)
-    : m_size(size + 1)
-    , m_elements(m_size)
+    : m_mask((size_t)deSmallestGreaterOrEquallPowerOfTwoU32((uint32_t)size) - 1)
+    , m_slots(m_mask + 1)
     , m_front(0)
     , m_back(0)
-    , m_fill(0)
-    , m_empty((int)size)
+    , m_numWaitingPushers(0)
+    , m_numWaitingPoppers(0)
 {
-    // Semaphores currently only support INT_MAX
     DE_ASSERT(size > 0 && size < 0x7fffffff);
+
+    for (size_t ndx = 0; ndx < m_slots.size(); ndx++)
+        m_slots[ndx].sequence.store(ndx, std::memory_order_relaxed);
 }
 
 template <typename T>
-inline void ThreadSafeRingBuffer<T>::pushFrontInternal(const T &elem)
+bool ThreadSafeRingBuffer<T>::pushFrontInternal(const T &elem)
 {
-    m_elements[m_front] = elem;
-    m_front             = (m_front + 1) % m_size;
+    size_t pos = m_front.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        Slot &slot          = m_slots[pos & m_mask];
+        const size_t seq    = slot.sequence.load(std::memory_order_acquire);
+        const intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+        if (diff == 0)
+        {
+            if (m_front.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                slot.element = elem;
+                slot.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0)
+            return false; // Full
+        else
+            pos = m_front.load(std::memory_order_relaxed);
+    }
 }
 
 template <typename T>
-inline T ThreadSafeRingBuffer<T>::popBackInternal()
+bool ThreadSafeRingBuffer<T>::popBackInternal(T &dst)
 {
-    const size_t ndx = m_back;
-    m_back           = (m_back + 1) % m_size;
-    return m_elements[ndx];
+    size_t pos = m_back.load(std::memory_order_relaxed);
+
+    for (;;)
+    {
+        Slot &slot          = m_slots[pos & m_mask];
+        const size_t seq    = slot.sequence.load(std::memory_order_acquire);
+        const intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+
+        if (diff == 0)
+        {
+            if (m_back.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                dst = slot.element;
+                slot.sequence.store(pos + m_mask + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0)
+            return false; // Empty
+        else
+            pos = m_back.load(std::memory_order_relaxed);
+    }
 }
 
 template <typename T>
-void ThreadSafeRingBuffer<T>::pushFront(const T &elem)
+void ThreadSafeRingBuffer<T>::wakeWaiters(std::atomic<int> &numWaiting, std::condition_variable &cond, bool wakeAll)
 {
-    m_writeMutex.lock();
-    m_empty.decrement();
-    pushFrontInternal(elem);
-    m_fill.increment();
-    m_writeMutex.unlock();
+    // Pairs with the fence in waiting threads: either the waiter sees the new state or we see the waiter.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (numWaiting.load(std::memory_order_relaxed) > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_waitLock);
+
+        if (wakeAll)
+            cond.notify_all();
+        else
+            cond.notify_one();
+    }
 }
 
 template <typename T>
-bool ThreadSafeRingBuffer<T>::tryPushFront(const T &elem)
+void ThreadSafeRingBuffer<T>::pushFront(const T &elem)
 {
-    if (!m_writeMutex.tryLock())
-        return false;
+    for (int spinNdx = 0; !pushFrontInternal(elem); spinNdx++)
+    {
+        if (spinNdx < NUM_SPINS_BEFORE_WAIT)
+            deYield();
+        else
+        {
+            std::unique_lock<std::mutex> lock(m_waitLock);
+            bool pushed;
 
-    const bool success = m_empty.tryDecrement();
+            m_numWaitingPushers.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
 
-    if (success)
-    {
-        pushFrontInternal(elem);
-        m_fill.increment();
+            pushed = pushFrontInternal(elem);
+
+            if (!pushed)
+                m_notFull.wait(lock);
+
+            m_numWaitingPushers.fetch_sub(1, std::memory_order_relaxed);
+
+            if (pushed)
+                break;
+        }
     }
 
-    m_writeMutex.unlock();
-    return success;
+    wakeWaiters(m_numWaitingPoppers, m_notEmpty, false);
+}
+
+template <typename T>
+bool ThreadSafeRingBuffer<T>::tryPushFront(const T &elem)
+{
+    if (!pushFrontInternal(elem))
+        return false;
+
+    wakeWaiters(m_numWaitingPoppers, m_notEmpty, false);
+    return true;
 }
 
 template <typename T>
-T ThreadSafeRingBuffer<T>::popBack()
+T ThreadSafeRingBuffer<T>::popBack(void)
 {
-    m_readMutex.lock();
-    m_fill.decrement();
-    T elem = popBackInternal();
-    m_empty.increment();
-    m_readMutex.unlock();
+    T elem;
+
+    for (int spinNdx = 0; !popBackInternal(elem); spinNdx++)
+    {
+        if (spinNdx < NUM_SPINS_BEFORE_WAIT)
+            deYield();
+        else
+        {
+            std::unique_lock<std::mutex> lock(m_waitLock);
+            bool popped;
+
+            m_numWaitingPoppers.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            popped = popBackInternal(elem);
+
+            if (!popped)
+                m_notEmpty.wait(lock);
+
+            m_numWaitingPoppers.fetch_sub(1, std::memory_order_relaxed);
+
+            if (popped)
+                break;
+        }
+    }
+
+    wakeWaiters(m_numWaitingPushers, m_notFull, false);
     return elem;
 }
 
 template <typename T>
 bool ThreadSafeRingBuffer<T>::tryPopBack(T &dst)
 {
-    if (!m_readMutex.tryLock())
+    if (!popBackInternal(dst))
         return false;
 
-    bool success = m_fill.tryDecrement();
+    wakeWaiters(m_numWaitingPushers, m_notFull, false);
+    return true;
+}
+
+template <typename T>
+void ThreadSafeRingBuffer<T>::pushFront(const T *elems, size_t numElems)
+{
+    size_t numPushed = 0;
 
-    if (success)
+    while (numPushed < numElems)
     {
-        dst = popBackInternal();
-        m_empty.increment();
+        numPushed += tryPushFront(elems + numPushed, numElems - numPushed);
+
+        if (numPushed < numElems)
+            pushFront(elems[numPushed++]);
     }
+}
+
+template <typename T>
+size_t ThreadSafeRingBuffer<T>::tryPushFront(const T *elems, size_t numElems)
+{
+    size_t numPushed = 0;
+
+    while (numPushed < numElems && pushFrontInternal(elems[numPushed]))
+        numPushed++;
+
+    if (numPushed > 0)
+        wakeWaiters(m_numWaitingPoppers, m_notEmpty, numPushed > 1);
+
+    return numPushed;
+}
+
+template <typename T>
+size_t ThreadSafeRingBuffer<T>::tryPopBack(T *dst, size_t maxElems)
+{
+    size_t numPopped = 0;
+
+    while (numPopped < maxElems && popBackInternal(dst[numPopped]))
+        numPopped++;
 
-    m_readMutex.unlock();
+    if (numPopped > 0)
+        wakeWaiters(m_numWaitingPushers, m_notFull, numPopped > 1);
 
-    return success;
+    return numPopped;
 }
 
 } // namespace de
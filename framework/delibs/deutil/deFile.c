@@ -23,6 +23,9 @@
 
 #include "deFile.h"
 #include "deMemory.h"
+#include "deString.h"
+
+#include <string.h>
 
 #if (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_OSX) || (DE_OS == DE_OS_IOS) || (DE_OS == DE_OS_ANDROID) || \
     (DE_OS == DE_OS_SYMBIAN) || (DE_OS == DE_OS_QNX) || (DE_OS == DE_OS_FUCHSIA)
@@ -32,6 +35,13 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <errno.h>
+#include <stdio.h>
+#include <pthread.h>
+
+#if (DE_OS == DE_OS_OSX) || (DE_OS == DE_OS_IOS)
+#include <limits.h>
+#include <mach-o/dyld.h>
+#endif
 
 struct deFile_s
 {
@@ -50,6 +60,51 @@ bool deDeleteFile(const char *filename)
     return unlink(filename) == 0;
 }
 
+/*--------------------------------------------------------------------*//*!
+ * \brief Rename file, replacing dstFilename if it exists.
+ *//*--------------------------------------------------------------------*/
+bool deRenameFile(const char *srcFilename, const char *dstFilename)
+{
+    return rename(srcFilename, dstFilename) == 0;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Get size and modification time of the running executable.
+ *
+ * Both change whenever the executable is relinked. Returns false if the
+ * executable file cannot be determined.
+ *//*--------------------------------------------------------------------*/
+bool deGetExecutableFileInfo(int64_t *size, int64_t *modificationTime)
+{
+#if (DE_OS == DE_OS_OSX) || (DE_OS == DE_OS_IOS)
+    char path[PATH_MAX];
+    uint32_t pathSize = (uint32_t)sizeof(path);
+
+    if (_NSGetExecutablePath(path, &pathSize) != 0)
+        return false;
+#else
+    const char *const path = "/proc/self/exe";
+#endif
+    struct stat st;
+
+    if (stat(path, &st) != 0)
+        return false;
+
+    *size             = (int64_t)st.st_size;
+    *modificationTime = (int64_t)st.st_mtime;
+    return true;
+}
+
+static uint64_t getProcessId(void)
+{
+    return (uint64_t)getpid();
+}
+
+static uint64_t getThreadId(void)
+{
+    return (uint64_t)(uintptr_t)pthread_self();
+}
+
 deFile *deFile_createFromHandle(uintptr_t handle)
 {
     int fd       = (int)handle;
@@ -229,6 +284,38 @@ bool deDeleteFile(const char *filename)
     return DeleteFile(filename) == TRUE;
 }
 
+bool deRenameFile(const char *srcFilename, const char *dstFilename)
+{
+    /* rename() fails on Win32 if destination exists. */
+    return MoveFileEx(srcFilename, dstFilename, MOVEFILE_REPLACE_EXISTING) == TRUE;
+}
+
+bool deGetExecutableFileInfo(int64_t *size, int64_t *modificationTime)
+{
+    char path[MAX_PATH];
+    const DWORD pathLength = GetModuleFileName(DE_NULL, path, DE_LENGTH_OF_ARRAY(path));
+    WIN32_FILE_ATTRIBUTE_DATA attributes;
+
+    if (pathLength == 0 || pathLength == DE_LENGTH_OF_ARRAY(path) ||
+        !GetFileAttributesEx(path, GetFileExInfoStandard, &attributes))
+        return false;
+
+    *size             = (int64_t)(((uint64_t)attributes.nFileSizeHigh << 32) | attributes.nFileSizeLow);
+    *modificationTime = (int64_t)(((uint64_t)attributes.ftLastWriteTime.dwHighDateTime << 32) |
+                                  attributes.ftLastWriteTime.dwLowDateTime);
+    return true;
+}
+
+static uint64_t getProcessId(void)
+{
+    return (uint64_t)GetCurrentProcessId();
+}
+
+static uint64_t getThreadId(void)
+{
+    return (uint64_t)GetCurrentThreadId();
+}
+
 deFile *deFile_createFromHandle(uintptr_t handle)
 {
     deFile *file = (deFile *)deCalloc(sizeof(deFile));
@@ -410,3 +497,147 @@ deFileResult deFile_write(deFile *file, const void *buf, int64_t bufSize, int64_
 #else
 #error Implement deFile for your OS.
 #endif
+
+static char *getTempFilename(const char *filename)
+{
+    const size_t tmpFilenameSize = strlen(filename) + 64;
+    char *tmpFilename            = (char *)deMalloc(tmpFilenameSize);
+
+    if (tmpFilename)
+        deSprintf(tmpFilename, tmpFilenameSize, "%s.tmp%llu_%llx", filename, (unsigned long long)getProcessId(),
+                  (unsigned long long)getThreadId());
+
+    return tmpFilename;
+}
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Replace file contents so that readers never observe partial files.
+ *
+ * Data is written to a temporary file next to filename, which is then
+ * renamed over filename. The temporary name includes process and thread
+ * ids, so processes sharing a directory never write to the same
+ * temporary file.
+ *
+ * \return true on success. On failure filename is left unmodified.
+ *//*--------------------------------------------------------------------*/
+bool deWriteFileAtomic(const char *filename, const void *data, size_t dataSize)
+{
+    char *tmpFilename = getTempFilename(filename);
+    deFile *file      = DE_NULL;
+    bool ok           = false;
+
+    if (!tmpFilename)
+        return false;
+
+    file = deFile_create(tmpFilename, DE_FILEMODE_CREATE | DE_FILEMODE_OPEN | DE_FILEMODE_WRITE | DE_FILEMODE_TRUNCATE);
+
+    if (file)
+    {
+        const uint8_t *ptr = (const uint8_t *)data;
+        int64_t numLeft    = (int64_t)dataSize;
+
+        ok = true;
+
+        while (ok && numLeft > 0)
+        {
+            int64_t numWritten = 0;
+
+            ok = deFile_write(file, ptr, numLeft, &numWritten) == DE_FILERESULT_SUCCESS && numWritten > 0;
+            ptr += numWritten;
+            numLeft -= numWritten;
+        }
+
+        deFile_destroy(file);
+
+        if (!ok || !deRenameFile(tmpFilename, filename))
+        {
+            deDeleteFile(tmpFilename);
+            ok = false;
+        }
+    }
+
+    deFree(tmpFilename);
+    return ok;
+}
+
+static bool fileContentsEqual(const char *filename, const void *data, size_t dataSize)
+{
+    deFile *file   = deFile_create(filename, DE_FILEMODE_OPEN | DE_FILEMODE_READ);
+    uint8_t *buf   = DE_NULL;
+    int64_t size   = 0;
+    int64_t offset = 0;
+    bool ok        = false;
+
+    if (!file)
+        return false;
+
+    size = deFile_getSize(file);
+    buf  = (uint8_t *)deMalloc((size_t)size + 1);
+
+    if (buf && size == (int64_t)dataSize)
+    {
+        ok = true;
+
+        while (ok && offset < size)
+        {
+            int64_t numRead = 0;
+
+            ok = deFile_read(file, buf + offset, size - offset, &numRead) == DE_FILERESULT_SUCCESS && numRead > 0;
+            offset += numRead;
+        }
+
+        ok = ok && (dataSize == 0 || deMemCmp(buf, data, dataSize) == 0);
+    }
+
+    deFree(buf);
+    deFile_destroy(file);
+    return ok;
+}
+
+void deFile_selfTest(void)
+{
+    const char *filename     = "deFile_selfTest.bin";
+    const char firstData[]   = "first contents of the file";
+    const char replaceData[] = "replaced";
+
+    deDeleteFile(filename);
+
+    /* Write new file. */
+    DE_TEST_ASSERT(deWriteFileAtomic(filename, firstData, sizeof(firstData)));
+    DE_TEST_ASSERT(fileContentsEqual(filename, firstData, sizeof(firstData)));
+
+    /* Replace with shorter contents, nothing of the old file may remain. */
+    DE_TEST_ASSERT(deWriteFileAtomic(filename, replaceData, sizeof(replaceData)));
+    DE_TEST_ASSERT(fileContentsEqual(filename, replaceData, sizeof(replaceData)));
+
+    /* Empty contents. */
+    DE_TEST_ASSERT(deWriteFileAtomic(filename, DE_NULL, 0));
+    DE_TEST_ASSERT(fileContentsEqual(filename, DE_NULL, 0));
+
+    DE_TEST_ASSERT(deDeleteFile(filename));
+
+    /* Failed rename must remove the temporary file. Renaming a file over a directory fails on all platforms. */
+    {
+        const char *dirname = ".";
+        char *tmpFilename   = getTempFilename(dirname);
+
+        DE_TEST_ASSERT(tmpFilename);
+        DE_TEST_ASSERT(!deWriteFileAtomic(dirname, firstData, sizeof(firstData)));
+        DE_TEST_ASSERT(!deFileExists(tmpFilename));
+
+        deFree(tmpFilename);
+    }
+
+    /* Failed create leaves nothing behind. */
+    {
+        const char *missingFilename = "deFile_selfTest_missing_dir/file.bin";
+        char *tmpFilename           = getTempFilename(missingFilename);
+
+        DE_TEST_ASSERT(tmpFilename);
+        DE_TEST_ASSERT(!deWriteFileAtomic(missingFilename, firstData, sizeof(firstData)));
+        DE_TEST_ASSERT(!deFileExists(missingFilename));
+        DE_TEST_ASSERT(!deFileExists(tmpFilename));
+
+        deFree(tmpFilename);
+    }
+}
@@ -68,6 +68,9 @@ typedef enum deFilePosition_e
 
 bool deFileExists(const char *filename);
 bool deDeleteFile(const char *filename);
+bool deRenameFile(const char *srcFilename, const char *dstFilename);
+bool deGetExecutableFileInfo(int64_t *size, int64_t *modificationTime);
+bool deWriteFileAtomic(const char *filename, const void *data, size_t dataSize);
 
 deFile *deFile_create(const char *filename, uint32_t mode);
 deFile *deFile_createFromHandle(uintptr_t handle);
@@ -82,6 +85,8 @@ int64_t deFile_getSize(const deFile *file);
 deFileResult deFile_read(deFile *file, void *buf, int64_t bufSize, int64_t *numRead);
 deFileResult deFile_write(deFile *file, const void *buf, int64_t bufSize, int64_t *numWritten);
 
+void deFile_selfTest(void);
+
 DE_END_EXTERN_C
 
 #endif /* _DEFILE_H */
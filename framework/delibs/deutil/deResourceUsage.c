@@ -0,0 +1,97 @@
+/*-------------------------------------------------------------------------
+ * drawElements Utility Library
+ * ----------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Process resource usage queries.
+ *//*--------------------------------------------------------------------*/
+
+#include "deResourceUsage.h"
+
+#include <time.h>
+
+#if (DE_OS == DE_OS_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define PSAPI_VERSION 2
+#include <windows.h>
+#include <psapi.h>
+#elif (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_ANDROID) || (DE_OS == DE_OS_QNX) || (DE_OS == DE_OS_OSX) || \
+    (DE_OS == DE_OS_IOS)
+#include <sys/resource.h>
+#endif
+
+uint64_t deGetProcessCpuTimeMicroseconds(void)
+{
+#if (DE_OS == DE_OS_WIN32)
+    FILETIME creationTime;
+    FILETIME exitTime;
+    FILETIME kernelTime;
+    FILETIME userTime;
+
+    if (!GetProcessTimes(GetCurrentProcess(), &creationTime, &exitTime, &kernelTime, &userTime))
+        return 0;
+
+    /* FILETIME is in 100ns units. */
+    return ((((uint64_t)kernelTime.dwHighDateTime << 32) | kernelTime.dwLowDateTime) +
+            (((uint64_t)userTime.dwHighDateTime << 32) | userTime.dwLowDateTime)) /
+           10;
+
+#elif (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_ANDROID) || (DE_OS == DE_OS_QNX) || (DE_OS == DE_OS_FUCHSIA)
+    struct timespec cpuTime;
+    if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &cpuTime) != 0)
+        return 0;
+    return (uint64_t)cpuTime.tv_sec * 1000000 + ((uint64_t)cpuTime.tv_nsec / 1000);
+
+#elif (DE_OS == DE_OS_OSX) || (DE_OS == DE_OS_IOS)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+    return ((uint64_t)usage.ru_utime.tv_sec + (uint64_t)usage.ru_stime.tv_sec) * 1000000 +
+           (uint64_t)usage.ru_utime.tv_usec + (uint64_t)usage.ru_stime.tv_usec;
+
+#else
+    return (uint64_t)clock() * 1000000 / CLOCKS_PER_SEC;
+#endif
+}
+
+uint64_t deGetPeakResidentMemorySize(void)
+{
+#if (DE_OS == DE_OS_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+    return (uint64_t)counters.PeakWorkingSetSize;
+
+#elif (DE_OS == DE_OS_UNIX) || (DE_OS == DE_OS_ANDROID) || (DE_OS == DE_OS_QNX)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+    /* ru_maxrss is reported in kilobytes. */
+    return (uint64_t)usage.ru_maxrss * 1024;
+
+#elif (DE_OS == DE_OS_OSX) || (DE_OS == DE_OS_IOS)
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+    /* ru_maxrss is reported in bytes. */
+    return (uint64_t)usage.ru_maxrss;
+
+#else
+    return 0;
+#endif
+}
@@ -0,0 +1,44 @@
+#ifndef _DERESOURCEUSAGE_H
+#define _DERESOURCEUSAGE_H
+/*-------------------------------------------------------------------------
+ * drawElements Utility Library
+ * ----------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Process resource usage queries.
+ *//*--------------------------------------------------------------------*/
+
+#include "deDefs.h"
+
+DE_BEGIN_EXTERN_C
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Get CPU time consumed by the process in microseconds.
+ * \return CPU time used by all threads of the process (user + system).
+ *//*--------------------------------------------------------------------*/
+uint64_t deGetProcessCpuTimeMicroseconds(void);
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Get peak resident memory size of the process.
+ * \return Peak resident set size in bytes, or 0 if not supported.
+ *//*--------------------------------------------------------------------*/
+uint64_t deGetPeakResidentMemorySize(void);
+
+DE_END_EXTERN_C
+
+#endif /* _DERESOURCEUSAGE_H */
@@ -26,16 +26,20 @@
 #include "tcuStringTemplate.hpp"
 #include "tcuResource.hpp"
 #include "tcuTestLog.hpp"
+#include "tcuCommandLine.hpp"
 
 #include "deStringUtil.hpp"
 #include "deUniquePtr.hpp"
 #include "deFilePath.hpp"
+#include "deSha1.h"
+#include "deFile.h"
 
 #include "glwEnums.hpp"
 
 #include <sstream>
 #include <map>
 #include <cstdlib>
+#include <cstdio>
 
 #if 0
 #define PARSE_DBG(X) printf X
@@ -246,6 +250,313 @@ bool isCapabilityRequired(CapabilityFlag capabilityFlag, const ShaderCaseSpecifi
     return false;
 }
 
+// Binary format
+
+enum
+{
+    BINARY_FORMAT_MAGIC   = 0x4c534544, //!< "DESL"
+    BINARY_FORMAT_VERSION = 1
+};
+
+enum BinaryNodeType
+{
+    BINARYNODE_GROUP = 0,
+    BINARYNODE_CASE,
+
+    BINARYNODE_LAST
+};
+
+struct FileDependency
+{
+    string filename;
+    string hash; //!< SHA-1 of file contents in hex
+};
+
+static string computeFileHash(const vector<uint8_t> &data)
+{
+    deSha1 hash;
+    char hashStr[41];
+
+    deSha1_compute(&hash, data.size(), data.empty() ? DE_NULL : &data[0]);
+    deSha1_render(&hash, hashStr);
+    hashStr[40] = '\0';
+
+    return string(hashStr);
+}
+
+static vector<uint8_t> readResource(const tcu::Archive &archive, const string &filename)
+{
+    const UniquePtr<tcu::Resource> resource(archive.getResource(filename.c_str()));
+    vector<uint8_t> data(resource->getSize());
+
+    resource->setPosition(0);
+    if (!data.empty())
+        resource->read(&data[0], (int)data.size());
+
+    return data;
+}
+
+class BinaryWriter
+{
+public:
+    BinaryWriter(vector<uint8_t> &dst) : m_dst(dst)
+    {
+    }
+
+    void writeU8(uint8_t value)
+    {
+        m_dst.push_back(value);
+    }
+
+    void writeU32(uint32_t value)
+    {
+        m_dst.push_back((uint8_t)(value >> 0));
+        m_dst.push_back((uint8_t)(value >> 8));
+        m_dst.push_back((uint8_t)(value >> 16));
+        m_dst.push_back((uint8_t)(value >> 24));
+    }
+
+    void writeString(const string &str)
+    {
+        writeU32((uint32_t)str.size());
+        m_dst.insert(m_dst.end(), str.begin(), str.end());
+    }
+
+    void writeStrings(const vector<string> &strs)
+    {
+        writeU32((uint32_t)strs.size());
+        for (size_t ndx = 0; ndx < strs.size(); ndx++)
+            writeString(strs[ndx]);
+    }
+
+    //! Reserve space for value written later with patchU32().
+    size_t reserveU32(void)
+    {
+        const size_t offset = m_dst.size();
+        writeU32(0u);
+        return offset;
+    }
+
+    void patchU32(size_t offset, uint32_t value)
+    {
+        DE_ASSERT(offset + 4 <= m_dst.size());
+        m_dst[offset + 0] = (uint8_t)(value >> 0);
+        m_dst[offset + 1] = (uint8_t)(value >> 8);
+        m_dst[offset + 2] = (uint8_t)(value >> 16);
+        m_dst[offset + 3] = (uint8_t)(value >> 24);
+    }
+
+    size_t getPosition(void) const
+    {
+        return m_dst.size();
+    }
+
+private:
+    vector<uint8_t> &m_dst;
+};
+
+class BinaryReader
+{
+public:
+    BinaryReader(const vector<uint8_t> &src, size_t offset) : m_src(src), m_pos(offset)
+    {
+    }
+
+    uint8_t readU8(void)
+    {
+        check(1);
+        return m_src[m_pos++];
+    }
+
+    uint32_t readU32(void)
+    {
+        check(4);
+
+        const uint32_t value = ((uint32_t)m_src[m_pos + 0] << 0) | ((uint32_t)m_src[m_pos + 1] << 8) |
+                               ((uint32_t)m_src[m_pos + 2] << 16) | ((uint32_t)m_src[m_pos + 3] << 24);
+
+        m_pos += 4;
+        return value;
+    }
+
+    string readString(void)
+    {
+        const size_t len = readU32();
+        check(len);
+
+        const string str(m_src.begin() + m_pos, m_src.begin() + m_pos + len);
+        m_pos += len;
+        return str;
+    }
+
+    void readStrings(vector<string> &dst)
+    {
+        const uint32_t numStrings = readU32();
+
+        dst.resize(numStrings);
+        for (uint32_t ndx = 0; ndx < numStrings; ndx++)
+            dst[ndx] = readString();
+    }
+
+    void skip(size_t numBytes)
+    {
+        check(numBytes);
+        m_pos += numBytes;
+    }
+
+    size_t getPosition(void) const
+    {
+        return m_pos;
+    }
+
+private:
+    void check(size_t numBytes) const
+    {
+        if (m_pos + numBytes > m_src.size())
+            throw tcu::InternalError("Corrupted shader library binary", DE_NULL, __FILE__, __LINE__);
+    }
+
+    const vector<uint8_t> &m_src;
+    size_t m_pos;
+};
+
+static void writeValues(BinaryWriter &dst, const vector<Value> &values)
+{
+    dst.writeU32((uint32_t)values.size());
+
+    for (size_t valNdx = 0; valNdx < values.size(); valNdx++)
+    {
+        const Value &value = values[valNdx];
+
+        DE_ASSERT(value.type.isBasicType());
+
+        dst.writeString(value.name);
+        dst.writeU32((uint32_t)value.type.getBasicType());
+        dst.writeU32((uint32_t)value.elements.size());
+
+        for (size_t elemNdx = 0; elemNdx < value.elements.size(); elemNdx++)
+            dst.writeU32((uint32_t)value.elements[elemNdx].int32);
+    }
+}
+
+static void readValues(BinaryReader &src, vector<Value> &values)
+{
+    values.resize(src.readU32());
+
+    for (size_t valNdx = 0; valNdx < values.size(); valNdx++)
+    {
+        Value &value = values[valNdx];
+
+        value.name = src.readString();
+        value.type = VarType((DataType)src.readU32(), PRECISION_LAST);
+        value.elements.resize(src.readU32());
+
+        for (size_t elemNdx = 0; elemNdx < value.elements.size(); elemNdx++)
+            value.elements[elemNdx].int32 = (int32_t)src.readU32();
+    }
+}
+
+static void writeSpec(BinaryWriter &dst, const ShaderCaseSpecification &spec)
+{
+    dst.writeU32((uint32_t)spec.caseType);
+    dst.writeU32((uint32_t)spec.expectResult);
+    dst.writeU32((uint32_t)spec.outputType);
+    dst.writeU32((uint32_t)spec.outputFormat);
+    dst.writeU32((uint32_t)spec.targetVersion);
+
+    dst.writeU32((uint32_t)spec.requiredCaps.size());
+    for (size_t capNdx = 0; capNdx < spec.requiredCaps.size(); capNdx++)
+    {
+        const RequiredCapability &cap = spec.requiredCaps[capNdx];
+
+        dst.writeU32((uint32_t)cap.type);
+        dst.writeU32(cap.type == CAPABILITY_FLAG ? (uint32_t)cap.flagName : cap.enumName);
+        dst.writeU32((uint32_t)cap.referenceValue);
+    }
+
+    writeValues(dst, spec.values.inputs);
+    writeValues(dst, spec.values.outputs);
+    writeValues(dst, spec.values.uniforms);
+
+    dst.writeU32((uint32_t)spec.programs.size());
+    for (size_t progNdx = 0; progNdx < spec.programs.size(); progNdx++)
+    {
+        const ProgramSpecification &program = spec.programs[progNdx];
+
+        for (int shaderType = 0; shaderType < SHADERTYPE_LAST; shaderType++)
+            dst.writeStrings(program.sources.sources[shaderType]);
+
+        dst.writeU8(program.sources.separable ? 1u : 0u);
+
+        dst.writeU32((uint32_t)program.requiredExtensions.size());
+        for (size_t extNdx = 0; extNdx < program.requiredExtensions.size(); extNdx++)
+        {
+            dst.writeStrings(program.requiredExtensions[extNdx].alternatives);
+            dst.writeU32(program.requiredExtensions[extNdx].effectiveStages);
+        }
+
+        dst.writeU32(program.activeStages);
+    }
+}
+
+static void readSpec(BinaryReader &src, ShaderCaseSpecification &spec)
+{
+    spec.caseType      = (CaseType)src.readU32();
+    spec.expectResult  = (ExpectResult)src.readU32();
+    spec.outputType    = (OutputType)src.readU32();
+    spec.outputFormat  = (DataType)src.readU32();
+    spec.targetVersion = (GLSLVersion)src.readU32();
+
+    {
+        const uint32_t numCaps = src.readU32();
+
+        for (uint32_t capNdx = 0; capNdx < numCaps; capNdx++)
+        {
+            const CapabilityType type = (CapabilityType)src.readU32();
+            const uint32_t name       = src.readU32();
+            const int referenceValue  = (int)src.readU32();
+
+            if (type == CAPABILITY_FLAG)
+                spec.requiredCaps.push_back(RequiredCapability((CapabilityFlag)name));
+            else
+                spec.requiredCaps.push_back(RequiredCapability(name, referenceValue));
+        }
+    }
+
+    readValues(src, spec.values.inputs);
+    readValues(src, spec.values.outputs);
+    readValues(src, spec.values.uniforms);
+
+    spec.programs.resize(src.readU32());
+    for (size_t progNdx = 0; progNdx < spec.programs.size(); progNdx++)
+    {
+        ProgramSpecification &program = spec.programs[progNdx];
+
+        for (int shaderType = 0; shaderType < SHADERTYPE_LAST; shaderType++)
+            src.readStrings(program.sources.sources[shaderType]);
+
+        program.sources.separable = src.readU8() != 0;
+
+        program.requiredExtensions.resize(src.readU32());
+        for (size_t extNdx = 0; extNdx < program.requiredExtensions.size(); extNdx++)
+        {
+            src.readStrings(program.requiredExtensions[extNdx].alternatives);
+            program.requiredExtensions[extNdx].effectiveStages = src.readU32();
+        }
+
+        program.activeStages = src.readU32();
+    }
+}
+
+static void writeCaseNode(BinaryWriter &dst, const string &name, const string &description,
+                          const ShaderCaseSpecification &spec)
+{
+    dst.writeU8((uint8_t)BINARYNODE_CASE);
+    dst.writeString(name);
+    dst.writeString(description);
+    writeSpec(dst, spec);
+}
+
 // Parser
 
 static const glu::GLSLVersion DEFAULT_GLSL_VERSION = glu::GLSL_VERSION_100_ES;
@@ -279,10 +590,11 @@ DE_INLINE bool isCaseNameChar(char c)
 class ShaderParser
 {
 public:
-    ShaderParser(const tcu::Archive &archive, const std::string &filename, ShaderCaseFactory *caseFactory);
+    ShaderParser(const tcu::Archive &archive, const std::string &filename, BinaryWriter &dst,
+                 vector<FileDependency> &dependencies);
     ~ShaderParser(void);
 
-    vector<tcu::TestNode *> parse(void);
+    int parse(void);
 
 private:
     enum Token
@@ -388,15 +700,15 @@ private:
     void parseFormat(DataType &format);
     void parseGLSLVersion(glu::GLSLVersion &version);
     void parsePipelineProgram(ProgramSpecification &program);
-    void parseShaderCase(vector<tcu::TestNode *> &shaderNodeList);
-    void parseShaderGroup(vector<tcu::TestNode *> &shaderNodeList);
-    void parseImport(vector<tcu::TestNode *> &shaderNodeList);
+    void parseShaderCase(int &numNodes);
+    void parseShaderGroup(int &numNodes);
+    void parseImport(int &numNodes);
 
     const tcu::Archive &m_archive;
     const string m_filename;
-    ShaderCaseFactory *const m_caseFactory;
+    BinaryWriter &m_dst;
+    vector<FileDependency> &m_dependencies;
 
-    UniquePtr<tcu::Resource> m_resource;
     vector<char> m_input;
 
     const char *m_curPtr;
@@ -404,11 +716,12 @@ private:
     std::string m_curTokenStr;
 };
 
-ShaderParser::ShaderParser(const tcu::Archive &archive, const string &filename, ShaderCaseFactory *caseFactroy)
+ShaderParser::ShaderParser(const tcu::Archive &archive, const string &filename, BinaryWriter &dst,
+                           vector<FileDependency> &dependencies)
     : m_archive(archive)
     , m_filename(filename)
-    , m_caseFactory(caseFactroy)
-    , m_resource(archive.getResource(m_filename.c_str()))
+    , m_dst(dst)
+    , m_dependencies(dependencies)
     , m_curPtr(DE_NULL)
     , m_curToken(TOKEN_LAST)
 {
@@ -1457,7 +1770,7 @@ void ShaderParser::parsePipelineProgram(ProgramSpecification &program)
         parseError("program pipeline object must have active stages");
 }
 
-void ShaderParser::parseShaderCase(vector<tcu::TestNode *> &shaderNodeList)
+void ShaderParser::parseShaderCase(int &numNodes)
 {
     // Parse 'case'.
     PARSE_DBG(("  parseShaderCase()\n"));
@@ -1600,8 +1913,8 @@ void ShaderParser::parseShaderCase(vector<tcu::TestNode *> &shaderNodeList)
             spec.programs[0].sources << VertexSource(bothSource);
             spec.programs[0].requiredExtensions = requiredExts;
 
-            shaderNodeList.push_back(
-                m_caseFactory->createCase(caseName + "_vertex", description, ShaderCaseSpecification(spec)));
+            writeCaseNode(m_dst, caseName + "_vertex", description, spec);
+            numNodes += 1;
         }
 
         // fragment
@@ -1617,8 +1930,8 @@ void ShaderParser::parseShaderCase(vector<tcu::TestNode *> &shaderNodeList)
             spec.programs[0].sources << FragmentSource(bothSource);
             spec.programs[0].requiredExtensions = requiredExts;
 
-            shaderNodeList.push_back(
-                m_caseFactory->createCase(caseName + "_fragment", description, ShaderCaseSpecification(spec)));
+            writeCaseNode(m_dst, caseName + "_fragment", description, spec);
+            numNodes += 1;
         }
     }
     else if (pipelinePrograms.empty())
@@ -1640,7 +1953,8 @@ void ShaderParser::parseShaderCase(vector<tcu::TestNode *> &shaderNodeList)
         spec.programs[0].sources.sources[SHADERTYPE_GEOMETRY].swap(geometrySources);
         spec.programs[0].requiredExtensions.swap(requiredExts);
 
-        shaderNodeList.push_back(m_caseFactory->createCase(caseName, description, ShaderCaseSpecification(spec)));
+        writeCaseNode(m_dst, caseName, description, spec);
+        numNodes += 1;
     }
     else
     {
@@ -1664,12 +1978,13 @@ void ShaderParser::parseShaderCase(vector<tcu::TestNode *> &shaderNodeList)
 
             spec.programs.swap(pipelinePrograms);
 
-            shaderNodeList.push_back(m_caseFactory->createCase(caseName, description, ShaderCaseSpecification(spec)));
+            writeCaseNode(m_dst, caseName, description, spec);
+            numNodes += 1;
         }
     }
 }
 
-void ShaderParser::parseShaderGroup(vector<tcu::TestNode *> &shaderNodeList)
+void ShaderParser::parseShaderGroup(int &numNodes)
 {
     // Parse 'case'.
     PARSE_DBG(("  parseShaderGroup()\n"));
@@ -1684,7 +1999,14 @@ void ShaderParser::parseShaderGroup(vector<tcu::TestNode *> &shaderNodeList)
     string description = parseStringLiteral(m_curTokenStr.c_str());
     advanceToken(TOKEN_STRING);
 
-    std::vector<tcu::TestNode *> children;
+    // Group node header. Children are written as a node list prefixed with its size in bytes.
+    m_dst.writeU8((uint8_t)BINARYNODE_GROUP);
+    m_dst.writeString(name);
+    m_dst.writeString(description);
+
+    const size_t listSizeOffset = m_dst.reserveU32();
+    const size_t numChildOffset = m_dst.reserveU32();
+    int numChildren             = 0;
 
     // Parse group children.
     for (;;)
@@ -1692,23 +2014,23 @@ void ShaderParser::parseShaderGroup(vector<tcu::TestNode *> &shaderNodeList)
         if (m_curToken == TOKEN_END)
             break;
         else if (m_curToken == TOKEN_GROUP)
-            parseShaderGroup(children);
+            parseShaderGroup(numChildren);
         else if (m_curToken == TOKEN_CASE)
-            parseShaderCase(children);
+            parseShaderCase(numChildren);
         else if (m_curToken == TOKEN_IMPORT)
-            parseImport(children);
+            parseImport(numChildren);
         else
             parseError(string("unexpected token while parsing shader group: " + m_curTokenStr));
     }
 
     advanceToken(TOKEN_END); // group end
 
-    // Create group node.
-    tcu::TestCaseGroup *groupNode = m_caseFactory->createGroup(name, description, children);
-    shaderNodeList.push_back(groupNode);
+    m_dst.patchU32(numChildOffset, (uint32_t)numChildren);
+    m_dst.patchU32(listSizeOffset, (uint32_t)(m_dst.getPosition() - numChildOffset));
+    numNodes += 1;
 }
 
-void ShaderParser::parseImport(vector<tcu::TestNode *> &shaderNodeList)
+void ShaderParser::parseImport(int &numNodes)
 {
     std::string importFileName;
 
@@ -1721,22 +2043,26 @@ void ShaderParser::parseImport(vector<tcu::TestNode *> &shaderNodeList)
     {
         ShaderParser subParser(m_archive,
                                de::FilePath::join(de::FilePath(m_filename).getDirName(), importFileName).getPath(),
-                               m_caseFactory);
-        const vector<tcu::TestNode *> importedCases = subParser.parse();
+                               m_dst, m_dependencies);
 
-        // \todo [2015-08-03 pyry] Not exception safe
-        shaderNodeList.insert(shaderNodeList.end(), importedCases.begin(), importedCases.end());
+        numNodes += subParser.parse();
     }
 }
 
-vector<tcu::TestNode *> ShaderParser::parse(void)
+int ShaderParser::parse(void)
 {
-    const int dataLen = m_resource->getSize();
+    {
+        const vector<uint8_t> data = readResource(m_archive, m_filename);
+        FileDependency dependency;
+
+        dependency.filename = m_filename;
+        dependency.hash     = computeFileHash(data);
+        m_dependencies.push_back(dependency);
 
-    m_input.resize(dataLen + 1);
-    m_resource->setPosition(0);
-    m_resource->read((uint8_t *)&m_input[0], dataLen);
-    m_input[dataLen] = '\0';
+        m_input.resize(data.size() + 1);
+        std::copy(data.begin(), data.end(), m_input.begin());
+        m_input[data.size()] = '\0';
+    }
 
     // Initialize parser.
     m_curPtr      = &m_input[0];
@@ -1744,18 +2070,18 @@ vector<tcu::TestNode *> ShaderParser::parse(void)
     m_curTokenStr = "";
     advanceToken();
 
-    vector<tcu::TestNode *> nodeList;
+    int numNodes = 0;
 
     // Parse all cases.
     PARSE_DBG(("parse()\n"));
     for (;;)
     {
         if (m_curToken == TOKEN_CASE)
-            parseShaderCase(nodeList);
+            parseShaderCase(numNodes);
         else if (m_curToken == TOKEN_GROUP)
-            parseShaderGroup(nodeList);
+            parseShaderGroup(numNodes);
         else if (m_curToken == TOKEN_IMPORT)
-            parseImport(nodeList);
+            parseImport(numNodes);
         else if (m_curToken == TOKEN_EOF)
             break;
         else
@@ -1763,16 +2089,313 @@ vector<tcu::TestNode *> ShaderParser::parse(void)
     }
 
     assumeToken(TOKEN_EOF);
-    // printf("  parsed %d test cases.\n", caseList.size());
-    return nodeList;
+    return numNodes;
 }
 
 std::vector<tcu::TestNode *> parseFile(const tcu::Archive &archive, const std::string &filename,
                                        ShaderCaseFactory *caseFactory)
 {
-    sl::ShaderParser parser(archive, filename, caseFactory);
+    return deserializeFile(serializeFile(archive, filename), caseFactory);
+}
+
+// Binary form
+
+namespace
+{
+
+typedef de::SharedPtr<vector<uint8_t>> BinaryDataSp;
+
+size_t readHeader(const vector<uint8_t> &data, vector<FileDependency> &dependencies)
+{
+    BinaryReader src(data, 0);
+
+    if (src.readU32() != BINARY_FORMAT_MAGIC || src.readU32() != BINARY_FORMAT_VERSION)
+        throw tcu::InternalError("Invalid shader library binary", DE_NULL, __FILE__, __LINE__);
+
+    dependencies.resize(src.readU32());
+    for (size_t depNdx = 0; depNdx < dependencies.size(); depNdx++)
+    {
+        dependencies[depNdx].filename = src.readString();
+        dependencies[depNdx].hash     = src.readString();
+    }
+
+    return src.getPosition();
+}
+
+void deleteNodes(const vector<tcu::TestNode *> &nodes)
+{
+    for (size_t ndx = 0; ndx < nodes.size(); ndx++)
+        delete nodes[ndx];
+}
+
+vector<tcu::TestNode *> createNodes(BinaryReader &src, ShaderCaseFactory *caseFactory)
+{
+    const uint32_t numNodes = src.readU32();
+    vector<tcu::TestNode *> nodes;
+
+    try
+    {
+        for (uint32_t nodeNdx = 0; nodeNdx < numNodes; nodeNdx++)
+        {
+            const uint8_t nodeType   = src.readU8();
+            const string name        = src.readString();
+            const string description = src.readString();
+
+            if (nodeType == BINARYNODE_GROUP)
+            {
+                src.skip(4); // Size of child list
+
+                const vector<tcu::TestNode *> children = createNodes(src, caseFactory);
+
+                try
+                {
+                    nodes.push_back(caseFactory->createGroup(name, description, children));
+                }
+                catch (...)
+                {
+                    deleteNodes(children);
+                    throw;
+                }
+            }
+            else if (nodeType == BINARYNODE_CASE)
+            {
+                ShaderCaseSpecification spec;
+
+                readSpec(src, spec);
+                nodes.push_back(caseFactory->createCase(name, description, spec));
+            }
+            else
+                throw tcu::InternalError("Corrupted shader library binary", DE_NULL, __FILE__, __LINE__);
+        }
+    }
+    catch (...)
+    {
+        deleteNodes(nodes);
+        throw;
+    }
+
+    return nodes;
+}
+
+vector<tcu::TestNode *> createLazyNodes(tcu::TestContext &testCtx, const BinaryDataSp &data, size_t listOffset,
+                                        const de::SharedPtr<ShaderCaseFactory> &caseFactory);
+
+//! Group that creates its children from binary form only when it is entered.
+class LazyShaderGroup : public tcu::TestCaseGroup
+{
+public:
+    LazyShaderGroup(tcu::TestContext &testCtx, const string &name, const BinaryDataSp &data, size_t listOffset,
+                    const de::SharedPtr<ShaderCaseFactory> &caseFactory)
+        : tcu::TestCaseGroup(testCtx, name.c_str())
+        , m_data(data)
+        , m_listOffset(listOffset)
+        , m_caseFactory(caseFactory)
+    {
+    }
+
+    void init(void)
+    {
+        const vector<tcu::TestNode *> children = createLazyNodes(m_testCtx, m_data, m_listOffset, m_caseFactory);
+
+        for (size_t ndx = 0; ndx < children.size(); ndx++)
+        {
+            try
+            {
+                addChild(children[ndx]);
+            }
+            catch (...)
+            {
+                for (; ndx < children.size(); ndx++)
+                    delete children[ndx];
+                throw;
+            }
+        }
+    }
+
+private:
+    const BinaryDataSp m_data;
+    const size_t m_listOffset;
+    const de::SharedPtr<ShaderCaseFactory> m_caseFactory;
+};
+
+vector<tcu::TestNode *> createLazyNodes(tcu::TestContext &testCtx, const BinaryDataSp &data, size_t listOffset,
+                                        const de::SharedPtr<ShaderCaseFactory> &caseFactory)
+{
+    BinaryReader src(*data, listOffset);
+    const uint32_t numNodes = src.readU32();
+    vector<tcu::TestNode *> nodes;
+
+    try
+    {
+        for (uint32_t nodeNdx = 0; nodeNdx < numNodes; nodeNdx++)
+        {
+            const uint8_t nodeType   = src.readU8();
+            const string name        = src.readString();
+            const string description = src.readString();
+
+            if (nodeType == BINARYNODE_GROUP)
+            {
+                const uint32_t listSize = src.readU32();
+
+                nodes.push_back(new LazyShaderGroup(testCtx, name, data, src.getPosition(), caseFactory));
+                src.skip(listSize);
+            }
+            else if (nodeType == BINARYNODE_CASE)
+            {
+                ShaderCaseSpecification spec;
 
-    return parser.parse();
+                readSpec(src, spec);
+                nodes.push_back(caseFactory->createCase(name, description, spec));
+            }
+            else
+                throw tcu::InternalError("Corrupted shader library binary", DE_NULL, __FILE__, __LINE__);
+        }
+    }
+    catch (...)
+    {
+        deleteNodes(nodes);
+        throw;
+    }
+
+    return nodes;
+}
+
+string getCacheFileName(const tcu::Archive &archive, const string &filename)
+{
+    const vector<uint8_t> data = readResource(archive, filename);
+    const uint32_t version     = BINARY_FORMAT_VERSION;
+    deSha1Stream stream;
+    deSha1 hash;
+    char hashStr[41];
+
+    // Imports are resolved relative to the file, so path is part of the key.
+    deSha1Stream_init(&stream);
+    deSha1Stream_process(&stream, sizeof(version), &version);
+    deSha1Stream_process(&stream, filename.size() + 1, filename.c_str());
+    deSha1Stream_process(&stream, data.size(), data.empty() ? DE_NULL : &data[0]);
+    deSha1Stream_finalize(&stream, &hash);
+
+    deSha1_render(&hash, hashStr);
+    hashStr[40] = '\0';
+
+    return string(hashStr) + ".slb";
+}
+
+bool readCacheFile(const string &path, vector<uint8_t> &dst)
+{
+    FILE *const file = fopen(path.c_str(), "rb");
+    bool ok          = false;
+
+    if (!file)
+        return false;
+
+    if (fseek(file, 0, SEEK_END) == 0)
+    {
+        const long size = ftell(file);
+
+        if (size > 0 && fseek(file, 0, SEEK_SET) == 0)
+        {
+            dst.resize((size_t)size);
+            ok = fread(&dst[0], 1, dst.size(), file) == dst.size();
+        }
+    }
+
+    fclose(file);
+    return ok;
+}
+
+} // namespace
+
+std::vector<uint8_t> serializeFile(const tcu::Archive &archive, const std::string &filename)
+{
+    vector<FileDependency> dependencies;
+    vector<uint8_t> nodeData;
+
+    {
+        BinaryWriter nodeWriter(nodeData);
+        const size_t numNodesOffset = nodeWriter.reserveU32();
+        ShaderParser parser(archive, filename, nodeWriter, dependencies);
+
+        nodeWriter.patchU32(numNodesOffset, (uint32_t)parser.parse());
+    }
+
+    {
+        vector<uint8_t> data;
+        BinaryWriter dst(data);
+
+        dst.writeU32(BINARY_FORMAT_MAGIC);
+        dst.writeU32(BINARY_FORMAT_VERSION);
+
+        dst.writeU32((uint32_t)dependencies.size());
+        for (size_t depNdx = 0; depNdx < dependencies.size(); depNdx++)
+        {
+            dst.writeString(dependencies[depNdx].filename);
+            dst.writeString(dependencies[depNdx].hash);
+        }
+
+        data.insert(data.end(), nodeData.begin(), nodeData.end());
+
+        return data;
+    }
+}
+
+bool isSerializedFileUpToDate(const tcu::Archive &archive, const std::vector<uint8_t> &data)
+{
+    vector<FileDependency> dependencies;
+
+    // Corrupted data and removed source files both make the binary stale.
+    try
+    {
+        readHeader(data, dependencies);
+
+        for (size_t depNdx = 0; depNdx < dependencies.size(); depNdx++)
+        {
+            if (computeFileHash(readResource(archive, dependencies[depNdx].filename)) != dependencies[depNdx].hash)
+                return false;
+        }
+    }
+    catch (const tcu::Exception &)
+    {
+        return false;
+    }
+
+    return !dependencies.empty();
+}
+
+std::vector<tcu::TestNode *> deserializeFile(const std::vector<uint8_t> &data, ShaderCaseFactory *caseFactory)
+{
+    vector<FileDependency> dependencies;
+    BinaryReader src(data, readHeader(data, dependencies));
+
+    return createNodes(src, caseFactory);
+}
+
+std::vector<tcu::TestNode *> loadFile(tcu::TestContext &testCtx, const std::string &filename,
+                                      const de::SharedPtr<ShaderCaseFactory> &caseFactory)
+{
+    const tcu::Archive &archive = testCtx.getArchive();
+    const string cacheDir       = testCtx.getCommandLine().getShaderLibraryCacheDir();
+    const BinaryDataSp data(new vector<uint8_t>());
+
+    if (cacheDir.empty())
+        *data = serializeFile(archive, filename);
+    else
+    {
+        const string cachePath = de::FilePath::join(cacheDir, getCacheFileName(archive, filename)).getPath();
+
+        if (!readCacheFile(cachePath, *data) || !isSerializedFileUpToDate(archive, *data))
+        {
+            *data = serializeFile(archive, filename);
+            deWriteFileAtomic(cachePath.c_str(), data->data(), data->size());
+        }
+    }
+
+    {
+        vector<FileDependency> dependencies;
+        const size_t listOffset = readHeader(*data, dependencies);
+
+        return createLazyNodes(testCtx, data, listOffset, caseFactory);
+    }
 }
 
 // Execution utilities
@@ -27,6 +27,7 @@
 #include "gluVarType.hpp"
 #include "gluShaderProgram.hpp"
 #include "tcuTestCase.hpp"
+#include "deSharedPtr.hpp"
 
 #include <string>
 #include <vector>
@@ -203,6 +204,34 @@ public:
 std::vector<tcu::TestNode *> parseFile(const tcu::Archive &archive, const std::string &filename,
                                        ShaderCaseFactory *caseFactory);
 
+// Binary form of parsed .test files
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Parse .test file (and its imports) into compact binary form
+ *
+ * The binary form stores the parsed case specifications together with
+ * content hashes of all files read. It can be turned back into test nodes
+ * with deserializeFile() or loadFile() without tokenizing the sources again.
+ *//*--------------------------------------------------------------------*/
+std::vector<uint8_t> serializeFile(const tcu::Archive &archive, const std::string &filename);
+
+//! Check that binary form is valid and all source files it was built from are unchanged.
+bool isSerializedFileUpToDate(const tcu::Archive &archive, const std::vector<uint8_t> &data);
+
+//! Create all test nodes from binary form.
+std::vector<tcu::TestNode *> deserializeFile(const std::vector<uint8_t> &data, ShaderCaseFactory *caseFactory);
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Load .test file using cached binary form
+ *
+ * Binary form is read from (and written to) the directory given with
+ * --deqp-shader-library-cache-dir, if any. Groups are created empty and
+ * their children are materialized only when the group is initialized, so
+ * case factory is shared with the returned nodes.
+ *//*--------------------------------------------------------------------*/
+std::vector<tcu::TestNode *> loadFile(tcu::TestContext &testCtx, const std::string &filename,
+                                      const de::SharedPtr<ShaderCaseFactory> &caseFactory);
+
 // Specialization utilties
 
 struct ProgramSpecializationParams
@@ -32,6 +32,7 @@
 
 #include "deMath.h"
 #include "deStringUtil.hpp"
+#include "deTaskScheduler.hpp"
 
 #include <string>
 
@@ -412,6 +413,18 @@ static inline tcu::Vec4 execSample(const tcu::Texture1DArrayView &src, const Ref
         return src.sample(params.sampler, s, t, lod);
 }
 
+//! Compute rows of a reference image, split across worker threads. Each pixel is computed as in a serial loop.
+template <typename RowFunc>
+static void forEachRow(int numRows, const RowFunc &rowFunc)
+{
+    de::parallelFor(0, (size_t)numRows, 0,
+                    [&rowFunc](size_t rowBegin, size_t rowEnd)
+                    {
+                        for (size_t rowNdx = rowBegin; rowNdx < rowEnd; rowNdx++)
+                            rowFunc((int)rowNdx);
+                    });
+}
+
 static void sampleTextureNonProjected(const tcu::SurfaceAccess &dst, const tcu::Texture1DView &rawSrc,
                                       const tcu::Vec4 &sq, const ReferenceParams &params)
 {
@@ -431,7 +444,7 @@ static void sampleTextureNonProjected(const tcu::SurfaceAccess &dst, const tcu::
                          de::clamp(computeNonProjectedTriLod(params.lodMode, dstSize, srcSize, triS[1]) + lodBias,
                                    params.minLod, params.maxLod)};
 
-    for (int y = 0; y < dst.getHeight(); y++)
+    const auto sampleRow = [&](int y)
     {
         for (int x = 0; x < dst.getWidth(); x++)
         {
@@ -447,7 +460,9 @@ static void sampleTextureNonProjected(const tcu::SurfaceAccess &dst, const tcu::
 
             dst.setPixel(execSample(src, params, s, lod) * params.colorScale + params.colorBias, x, y);
         }
-    }
+    };
+
+    forEachRow(dst.getHeight(), sampleRow);
 }
 
 template <class PixelAccess>
@@ -472,7 +487,7 @@ static void sampleTextureNonProjected(const PixelAccess &dst, const tcu::Texture
         de::clamp(computeNonProjectedTriLod(params.lodMode, dstSize, srcSize, triS[1], triT[1]) + lodBias,
                     params.minLod, params.maxLod)};
 
-    for (int y = 0; y < dst.getHeight(); y++)
+    const auto sampleRow = [&](int y)
     {
         for (int x = 0; x < dst.getWidth(); x++)
         {
@@ -498,7 +513,9 @@ static void sampleTextureNonProjected(const PixelAccess &dst, const tcu::Texture
 
             dst.setPixel(execSample(src, params, s, t, lod) * params.colorScale + params.colorBias, x, y);
         }
-    }
+    };
+
+    forEachRow(dst.getHeight(), sampleRow);
 }
 
 static void sampleTextureProjected(const tcu::SurfaceAccess &dst, const tcu::Texture1DView &rawSrc, const tcu::Vec4 &sq,
@@ -518,7 +535,7 @@ static void sampleTextureProjected(const tcu::SurfaceAccess &dst, const tcu::Tex
     tcu::Vec3 triU[2] = {uq.swizzle(0, 1, 2), uq.swizzle(3, 2, 1)};
     tcu::Vec3 triW[2] = {params.w.swizzle(0, 1, 2), params.w.swizzle(3, 2, 1)};
 
-    for (int py = 0; py < dst.getHeight(); py++)
+    const auto sampleRow = [&](int py)
     {
         for (int px = 0; px < dst.getWidth(); px++)
         {
@@ -540,7 +557,9 @@ static void sampleTextureProjected(const tcu::SurfaceAccess &dst, const tcu::Tex
 
             dst.setPixel(execSample(src, params, s, lod) * params.colorScale + params.colorBias, px, py);
         }
-    }
+    };
+
+    forEachRow(dst.getHeight(), sampleRow);
 }
 
 template <class PixelAccess>
@@ -564,7 +583,7 @@ static void sampleTextureProjected(const PixelAccess &dst, const tcu::Texture2DV
     tcu::Vec3 triV[2] = {vq.swizzle(0, 1, 2), vq.swizzle(3, 2, 1)};
     tcu::Vec3 triW[2] = {params.w.swizzle(0, 1, 2), params.w.swizzle(3, 2, 1)};
 
-    for (int py = 0; py < dst.getHeight(); py++)
+    const auto sampleRow = [&](int py)
     {
         for (int px = 0; px < dst.getWidth(); px++)
         {
@@ -587,7 +606,9 @@ static void sampleTextureProjected(const PixelAccess &dst, const tcu::Texture2DV
 
             dst.setPixel(execSample(src, params, s, t, lod) * params.colorScale + params.colorBias, px, py);
         }
-    }
+    };
+
+    forEachRow(dst.getHeight(), sampleRow);
 }
 
 void sampleTexture(const tcu::PixelBufferAccess &dst, const tcu::Texture2DView &src, const float *texCoord,
@@ -720,7 +741,7 @@ static void sampleTextureCube(const tcu::SurfaceAccess &dst, const tcu::TextureC
 
     const float lodBias((params.flags & ReferenceParams::USE_BIAS) ? params.bias : 0.0f);
 
-    for (int py = 0; py < dst.getHeight(); py++)
+    const auto sampleRow = [&](int py)
     {
         for (int px = 0; px < dst.getWidth(); px++)
         {
@@ -751,7 +772,9 @@ static void sampleTextureCube(const tcu::SurfaceAccess &dst, const tcu::TextureC
                              params.colorBias,
                          px, py);
         }
-    }
+    };
+
+    forEachRow(dst.getHeight(), sampleRow);
 }
 
 void sampleTexture(const tcu::SurfaceAccess &dst, const tcu::TextureCubeView &src, const float *texCoord,
@@ -798,7 +821,7 @@ static void sampleTextureNonProjected(const tcu::SurfaceAccess &dst, const tcu::
         de::clamp(computeNonProjectedTriLod(params.lodMode, dstSize, srcSize, triS[1], triT[1]) + lodBias,
                     params.minLod, params.maxLod)};
 
-    for (int y = 0; y < dst.getHeight(); y++)
+    const auto sampleRow = [&](int y)
     {
         for (int x = 0; x < dst.getWidth(); x++)
         {
@@ -816,7 +839,9 @@ static void sampleTextureNonProjected(const tcu::SurfaceAccess &dst, const tcu::
 
             dst.setPixel(execSample(src, params, s, t, r, lod) * params.colorScale + params.colorBias, x, y);
         }
-    }
+    };
+
+    forEachRow(dst.getHeight(), sampleRow);
 }
 
 void sampleTexture(const tcu::SurfaceAccess &dst, const tcu::Texture2DArrayView &src, const float *texCoord,
@@ -848,7 +873,7 @@ static void sampleTextureNonProjected(const tcu::SurfaceAccess &dst, const tcu::
     float triLod[2]   = {computeNonProjectedTriLod(params.lodMode, dstSize, srcSize, triS[0]) + lodBias,
                          computeNonProjectedTriLod(params.lodMode, dstSize, srcSize, triS[1]) + lodBias};
 
-    for (int y = 0; y < dst.getHeight(); y++)
+    const auto sampleRow = [&](int y)
     {
         for (int x = 0; x < dst.getWidth(); x++)
         {
@@ -865,7 +890,9 @@ static void sampleTextureNonProjected(const tcu::SurfaceAccess &dst, const tcu::
 
             dst.setPixel(execSample(src, params, s, t, lod) * params.colorScale + params.colorBias, x, y);
         }
-    }
+    };
+
+    forEachRow(dst.getHeight(), sampleRow);
 }
 
 void sampleTexture(const tcu::SurfaceAccess &dst, const tcu::Texture1DArrayView &src, const float *texCoord,
@@ -901,7 +928,7 @@ static void sampleTextureNonProjected(const tcu::SurfaceAccess &dst, const tcu::
         de::clamp(computeNonProjectedTriLod(params.lodMode, dstSize, srcSize, triS[1], triT[1], triR[1]) + lodBias,
                     params.minLod, params.maxLod)};
 
-    for (int y = 0; y < dst.getHeight(); y++)
+    const auto sampleRow = [&](int y)
     {
         for (int x = 0; x < dst.getWidth(); x++)
         {
@@ -922,7 +949,9 @@ static void sampleTextureNonProjected(const tcu::SurfaceAccess &dst, const tcu::
 
             dst.setPixel(src.sample(params.sampler, s, t, r, lod) * params.colorScale + params.colorBias, x, y);
         }
-    }
+    };
+
+    forEachRow(dst.getHeight(), sampleRow);
 }
 
 static void sampleTextureProjected(const tcu::SurfaceAccess &dst, const tcu::Texture3DView &rawSrc, const tcu::Vec4 &sq,
@@ -948,7 +977,7 @@ static void sampleTextureProjected(const tcu::SurfaceAccess &dst, const tcu::Tex
     tcu::Vec3 triW[2] = {wq.swizzle(0, 1, 2), wq.swizzle(3, 2, 1)};
     tcu::Vec3 triP[2] = {params.w.swizzle(0, 1, 2), params.w.swizzle(3, 2, 1)};
 
-    for (int py = 0; py < dst.getHeight(); py++)
+    const auto sampleRow = [&](int py)
     {
         for (int px = 0; px < dst.getWidth(); px++)
         {
@@ -972,7 +1001,9 @@ static void sampleTextureProjected(const tcu::SurfaceAccess &dst, const tcu::Tex
 
             dst.setPixel(src.sample(params.sampler, s, t, r, lod) * params.colorScale + params.colorBias, px, py);
         }
-    }
+    };
+
+    forEachRow(dst.getHeight(), sampleRow);
 }
 
 void sampleTexture(const tcu::SurfaceAccess &dst, const tcu::Texture3DView &src, const float *texCoord,
@@ -1019,7 +1050,7 @@ static void sampleTextureCubeArray(const tcu::SurfaceAccess &dst, const tcu::Tex
 
     const float lodBias = (params.flags & ReferenceParams::USE_BIAS) ? params.bias : 0.0f;
 
-    for (int py = 0; py < dst.getHeight(); py++)
+    const auto sampleRow = [&](int py)
     {
         for (int px = 0; px < dst.getWidth(); px++)
         {
@@ -1053,7 +1084,9 @@ static void sampleTextureCubeArray(const tcu::SurfaceAccess &dst, const tcu::Tex
                              params.colorBias,
                          px, py);
         }
-    }
+    };
+
+    forEachRow(dst.getHeight(), sampleRow);
 }
 
 void sampleTexture(const tcu::SurfaceAccess &dst, const tcu::TextureCubeArrayView &src, const float *texCoord,
@@ -1073,7 +1106,7 @@ void fetchTexture(const tcu::SurfaceAccess &dst, const tcu::ConstPixelBufferAcce
     const tcu::Vec4 sq      = tcu::Vec4(texCoord[0], texCoord[1], texCoord[2], texCoord[3]);
     const tcu::Vec3 triS[2] = {sq.swizzle(0, 1, 2), sq.swizzle(3, 2, 1)};
 
-    for (int y = 0; y < dst.getHeight(); y++)
+    const auto sampleRow = [&](int y)
     {
         for (int x = 0; x < dst.getWidth(); x++)
         {
@@ -1088,7 +1121,9 @@ void fetchTexture(const tcu::SurfaceAccess &dst, const tcu::ConstPixelBufferAcce
 
             dst.setPixel(src.getPixel((int)s, 0) * colorScale + colorBias, x, y);
         }
-    }
+    };
+
+    forEachRow(dst.getHeight(), sampleRow);
 }
 
 bool compareImages(tcu::TestLog &log, const tcu::Surface &reference, const tcu::Surface &rendered, tcu::RGBA threshold)
@@ -0,0 +1,1165 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program OpenGL ES Utilities
+ * ------------------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Context decorator that replays calls on a worker thread.
+ *//*--------------------------------------------------------------------*/
+
+#include "sglrAsyncContext.hpp"
+#include "deThread.hpp"
+#include "glwEnums.hpp"
+
+namespace sglr
+{
+
+namespace
+{
+
+template <typename T>
+std::vector<T> copyArray(const T *data, intptr_t count)
+{
+    if (!data || count <= 0)
+        return std::vector<T>();
+
+    return std::vector<T>(data, data + count);
+}
+
+std::vector<uint8_t> copyBytes(const void *data, intptr_t size)
+{
+    return copyArray(static_cast<const uint8_t *>(data), size);
+}
+
+template <typename T>
+const T *getArrayPtr(const std::vector<T> &array)
+{
+    return array.empty() ? DE_NULL : &array[0];
+}
+
+int getIndexSize(uint32_t type)
+{
+    switch (type)
+    {
+    case GL_UNSIGNED_BYTE:
+        return 1;
+    case GL_UNSIGNED_SHORT:
+        return 2;
+    case GL_UNSIGNED_INT:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+//! Number of values read by clearBuffer*v().
+int getNumClearValues(uint32_t buffer)
+{
+    return (buffer == GL_COLOR) ? 4 : 1;
+}
+
+//! Use copied client-side indices if there are any, otherwise the original buffer offset.
+const void *selectIndices(const std::vector<uint8_t> &clientIndices, const void *indices)
+{
+    return clientIndices.empty() ? indices : getArrayPtr(clientIndices);
+}
+
+} // namespace
+
+class AsyncContext::WorkerThread : public de::Thread
+{
+public:
+    WorkerThread(AsyncContext &context) : m_context(context)
+    {
+    }
+
+    void run(void)
+    {
+        m_context.processCommands();
+    }
+
+private:
+    AsyncContext &m_context;
+};
+
+AsyncContext::AsyncContext(Context &context)
+    : Context(context.getType())
+    , m_context(context)
+    , m_thread(DE_NULL)
+    , m_isBusy(false)
+    , m_isShuttingDown(false)
+    , m_error(GL_NO_ERROR)
+    , m_arrayBufferBinding(0)
+    , m_vertexArrayBinding(0)
+{
+    m_thread = new WorkerThread(*this);
+    m_thread->start();
+}
+
+AsyncContext::~AsyncContext(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_isShuttingDown = true;
+        m_commandCond.notify_one();
+    }
+
+    // Worker executes remaining commands before exiting.
+    m_thread->join();
+    delete m_thread;
+}
+
+void AsyncContext::processCommands(void)
+{
+    std::vector<Command> commands;
+
+    for (;;)
+    {
+        bool dropCommands;
+
+        {
+            std::unique_lock<std::mutex> lock(m_lock);
+
+            m_isBusy = false;
+            m_idleCond.notify_all();
+            m_commandCond.wait(lock, [this]() { return !m_commands.empty() || m_isShuttingDown; });
+
+            if (m_commands.empty())
+                return;
+
+            commands.swap(m_commands);
+            m_isBusy     = true;
+            dropCommands = (bool)m_exception;
+        }
+
+        uint32_t error = GL_NO_ERROR;
+
+        for (size_t commandNdx = 0; commandNdx < commands.size() && !dropCommands; commandNdx++)
+        {
+            try
+            {
+                commands[commandNdx](m_context);
+
+                const uint32_t commandError = m_context.getError();
+
+                if (error == GL_NO_ERROR)
+                    error = commandError;
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(m_lock);
+
+                m_exception  = std::current_exception();
+                dropCommands = true;
+            }
+        }
+
+        commands.clear();
+
+        if (error != GL_NO_ERROR)
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+
+            if (m_error == GL_NO_ERROR)
+                m_error = error;
+        }
+    }
+}
+
+void AsyncContext::synchronize(void)
+{
+    std::exception_ptr exception;
+
+    {
+        std::unique_lock<std::mutex> lock(m_lock);
+
+        m_idleCond.wait(lock, [this]() { return m_commands.empty() && !m_isBusy; });
+        std::swap(exception, m_exception);
+    }
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+void AsyncContext::synchronizeNoThrow(void)
+{
+    std::unique_lock<std::mutex> lock(m_lock);
+
+    m_idleCond.wait(lock, [this]() { return m_commands.empty() && !m_isBusy; });
+    m_exception = std::exception_ptr();
+}
+
+void AsyncContext::enqueue(Command &&command)
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+
+    m_commands.push_back(std::move(command));
+
+    // Busy worker checks for new commands before going idle.
+    if (!m_isBusy && m_commands.size() == 1)
+        m_commandCond.notify_one();
+}
+
+void AsyncContext::execute(const Command &command)
+{
+    synchronize();
+
+    // Worker is idle and only this thread can wake it up.
+    command(m_context);
+
+    const uint32_t error = m_context.getError();
+
+    if (error != GL_NO_ERROR)
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+
+        if (m_error == GL_NO_ERROR)
+            m_error = error;
+    }
+}
+
+AsyncContext::VertexArrayState &AsyncContext::getVertexArrayState(void)
+{
+    return m_vertexArrays[m_vertexArrayBinding];
+}
+
+void AsyncContext::setClientArray(uint32_t index, bool isClientArray)
+{
+    VertexArrayState &state = getVertexArrayState();
+
+    if (isClientArray)
+        state.clientArrays.insert(index);
+    else
+        state.clientArrays.erase(index);
+}
+
+bool AsyncContext::canRecordDraw(void)
+{
+    const VertexArrayState &state = getVertexArrayState();
+
+    for (uint32_t index : state.clientArrays)
+    {
+        if (state.enabledArrays.find(index) != state.enabledArrays.end())
+            return false;
+    }
+
+    return true;
+}
+
+bool AsyncContext::canRecordDraw(int count, uint32_t type, const void *indices, std::vector<uint8_t> &clientIndices)
+{
+    if (!canRecordDraw())
+        return false;
+
+    if (getVertexArrayState().elementArrayBufferBinding != 0 || !indices || count <= 0)
+        return true;
+
+    if (getIndexSize(type) == 0)
+        return false;
+
+    clientIndices = copyBytes(indices, (intptr_t)count * getIndexSize(type));
+    return true;
+}
+
+int AsyncContext::getWidth(void) const
+{
+    // Default framebuffer size is fixed, so this can be queried while the worker is running.
+    return m_context.getWidth();
+}
+
+int AsyncContext::getHeight(void) const
+{
+    return m_context.getHeight();
+}
+
+void AsyncContext::viewport(int x, int y, int width, int height)
+{
+    enqueue([=](Context &ctx) { ctx.viewport(x, y, width, height); });
+}
+
+void AsyncContext::activeTexture(uint32_t texture)
+{
+    enqueue([=](Context &ctx) { ctx.activeTexture(texture); });
+}
+
+void AsyncContext::bindTexture(uint32_t target, uint32_t texture)
+{
+    enqueue([=](Context &ctx) { ctx.bindTexture(target, texture); });
+}
+
+void AsyncContext::genTextures(int numTextures, uint32_t *textures)
+{
+    execute([&](Context &ctx) { ctx.genTextures(numTextures, textures); });
+}
+
+void AsyncContext::deleteTextures(int numTextures, const uint32_t *textures)
+{
+    enqueue([numTextures, names = copyArray(textures, numTextures)](Context &ctx)
+            { ctx.deleteTextures(numTextures, getArrayPtr(names)); });
+}
+
+void AsyncContext::bindFramebuffer(uint32_t target, uint32_t framebuffer)
+{
+    enqueue([=](Context &ctx) { ctx.bindFramebuffer(target, framebuffer); });
+}
+
+void AsyncContext::genFramebuffers(int numFramebuffers, uint32_t *framebuffers)
+{
+    execute([&](Context &ctx) { ctx.genFramebuffers(numFramebuffers, framebuffers); });
+}
+
+void AsyncContext::deleteFramebuffers(int numFramebuffers, const uint32_t *framebuffers)
+{
+    enqueue([numFramebuffers, names = copyArray(framebuffers, numFramebuffers)](Context &ctx)
+            { ctx.deleteFramebuffers(numFramebuffers, getArrayPtr(names)); });
+}
+
+void AsyncContext::bindRenderbuffer(uint32_t target, uint32_t renderbuffer)
+{
+    enqueue([=](Context &ctx) { ctx.bindRenderbuffer(target, renderbuffer); });
+}
+
+void AsyncContext::genRenderbuffers(int numRenderbuffers, uint32_t *renderbuffers)
+{
+    execute([&](Context &ctx) { ctx.genRenderbuffers(numRenderbuffers, renderbuffers); });
+}
+
+void AsyncContext::deleteRenderbuffers(int numRenderbuffers, const uint32_t *renderbuffers)
+{
+    enqueue([numRenderbuffers, names = copyArray(renderbuffers, numRenderbuffers)](Context &ctx)
+            { ctx.deleteRenderbuffers(numRenderbuffers, getArrayPtr(names)); });
+}
+
+void AsyncContext::pixelStorei(uint32_t pname, int param)
+{
+    enqueue([=](Context &ctx) { ctx.pixelStorei(pname, param); });
+}
+
+// Texture uploads with data are executed immediately since the size of the data depends on the unpack state.
+
+void AsyncContext::texImage1D(uint32_t target, int level, uint32_t internalFormat, int width, int border,
+                              uint32_t format, uint32_t type, const void *data)
+{
+    const Command command = [=](Context &ctx)
+    { ctx.texImage1D(target, level, internalFormat, width, border, format, type, data); };
+
+    if (data)
+        execute(command);
+    else
+        enqueue(Command(command));
+}
+
+void AsyncContext::texImage2D(uint32_t target, int level, uint32_t internalFormat, int width, int height, int border,
+                              uint32_t format, uint32_t type, const void *data)
+{
+    const Command command = [=](Context &ctx)
+    { ctx.texImage2D(target, level, internalFormat, width, height, border, format, type, data); };
+
+    if (data)
+        execute(command);
+    else
+        enqueue(Command(command));
+}
+
+void AsyncContext::texImage3D(uint32_t target, int level, uint32_t internalFormat, int width, int height, int depth,
+                              int border, uint32_t format, uint32_t type, const void *data)
+{
+    const Command command = [=](Context &ctx)
+    { ctx.texImage3D(target, level, internalFormat, width, height, depth, border, format, type, data); };
+
+    if (data)
+        execute(command);
+    else
+        enqueue(Command(command));
+}
+
+void AsyncContext::texSubImage1D(uint32_t target, int level, int xoffset, int width, uint32_t format, uint32_t type,
+                                 const void *data)
+{
+    const Command command = [=](Context &ctx)
+    { ctx.texSubImage1D(target, level, xoffset, width, format, type, data); };
+
+    if (data)
+        execute(command);
+    else
+        enqueue(Command(command));
+}
+
+void AsyncContext::texSubImage2D(uint32_t target, int level, int xoffset, int yoffset, int width, int height,
+                                 uint32_t format, uint32_t type, const void *data)
+{
+    const Command command = [=](Context &ctx)
+    { ctx.texSubImage2D(target, level, xoffset, yoffset, width, height, format, type, data); };
+
+    if (data)
+        execute(command);
+    else
+        enqueue(Command(command));
+}
+
+void AsyncContext::texSubImage3D(uint32_t target, int level, int xoffset, int yoffset, int zoffset, int width,
+                                 int height, int depth, uint32_t format, uint32_t type, const void *data)
+{
+    const Command command = [=](Context &ctx)
+    { ctx.texSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, data); };
+
+    if (data)
+        execute(command);
+    else
+        enqueue(Command(command));
+}
+
+void AsyncContext::copyTexImage1D(uint32_t target, int level, uint32_t internalFormat, int x, int y, int width,
+                                  int border)
+{
+    enqueue([=](Context &ctx) { ctx.copyTexImage1D(target, level, internalFormat, x, y, width, border); });
+}
+
+void AsyncContext::copyTexImage2D(uint32_t target, int level, uint32_t internalFormat, int x, int y, int width,
+                                  int height, int border)
+{
+    enqueue([=](Context &ctx) { ctx.copyTexImage2D(target, level, internalFormat, x, y, width, height, border); });
+}
+
+void AsyncContext::copyTexSubImage1D(uint32_t target, int level, int xoffset, int x, int y, int width)
+{
+    enqueue([=](Context &ctx) { ctx.copyTexSubImage1D(target, level, xoffset, x, y, width); });
+}
+
+void AsyncContext::copyTexSubImage2D(uint32_t target, int level, int xoffset, int yoffset, int x, int y, int width,
+                                     int height)
+{
+    enqueue([=](Context &ctx) { ctx.copyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height); });
+}
+
+void AsyncContext::copyTexSubImage3D(uint32_t target, int level, int xoffset, int yoffset, int zoffset, int x, int y,
+                                     int width, int height)
+{
+    enqueue([=](Context &ctx)
+            { ctx.copyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height); });
+}
+
+void AsyncContext::texStorage2D(uint32_t target, int levels, uint32_t internalFormat, int width, int height)
+{
+    enqueue([=](Context &ctx) { ctx.texStorage2D(target, levels, internalFormat, width, height); });
+}
+
+void AsyncContext::texStorage3D(uint32_t target, int levels, uint32_t internalFormat, int width, int height, int depth)
+{
+    enqueue([=](Context &ctx) { ctx.texStorage3D(target, levels, internalFormat, width, height, depth); });
+}
+
+void AsyncContext::texParameteri(uint32_t target, uint32_t pname, int value)
+{
+    enqueue([=](Context &ctx) { ctx.texParameteri(target, pname, value); });
+}
+
+void AsyncContext::framebufferTexture2D(uint32_t target, uint32_t attachment, uint32_t textarget, uint32_t texture,
+                                        int level)
+{
+    enqueue([=](Context &ctx) { ctx.framebufferTexture2D(target, attachment, textarget, texture, level); });
+}
+
+void AsyncContext::framebufferTextureLayer(uint32_t target, uint32_t attachment, uint32_t texture, int level,
+                                           int layer)
+{
+    enqueue([=](Context &ctx) { ctx.framebufferTextureLayer(target, attachment, texture, level, layer); });
+}
+
+void AsyncContext::framebufferRenderbuffer(uint32_t target, uint32_t attachment, uint32_t renderbuffertarget,
+                                           uint32_t renderbuffer)
+{
+    enqueue([=](Context &ctx) { ctx.framebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer); });
+}
+
+uint32_t AsyncContext::checkFramebufferStatus(uint32_t target)
+{
+    uint32_t status = GL_NONE;
+    execute([&](Context &ctx) { status = ctx.checkFramebufferStatus(target); });
+    return status;
+}
+
+void AsyncContext::getFramebufferAttachmentParameteriv(uint32_t target, uint32_t attachment, uint32_t pname,
+                                                       int *params)
+{
+    execute([&](Context &ctx) { ctx.getFramebufferAttachmentParameteriv(target, attachment, pname, params); });
+}
+
+void AsyncContext::renderbufferStorage(uint32_t target, uint32_t internalformat, int width, int height)
+{
+    enqueue([=](Context &ctx) { ctx.renderbufferStorage(target, internalformat, width, height); });
+}
+
+void AsyncContext::renderbufferStorageMultisample(uint32_t target, int samples, uint32_t internalFormat, int width,
+                                                  int height)
+{
+    enqueue([=](Context &ctx) { ctx.renderbufferStorageMultisample(target, samples, internalFormat, width, height); });
+}
+
+void AsyncContext::bindBuffer(uint32_t target, uint32_t buffer)
+{
+    if (target == GL_ARRAY_BUFFER)
+        m_arrayBufferBinding = buffer;
+    else if (target == GL_ELEMENT_ARRAY_BUFFER)
+        getVertexArrayState().elementArrayBufferBinding = buffer;
+
+    enqueue([=](Context &ctx) { ctx.bindBuffer(target, buffer); });
+}
+
+void AsyncContext::genBuffers(int numBuffers, uint32_t *buffers)
+{
+    execute([&](Context &ctx) { ctx.genBuffers(numBuffers, buffers); });
+}
+
+void AsyncContext::deleteBuffers(int numBuffers, const uint32_t *buffers)
+{
+    VertexArrayState &state = getVertexArrayState();
+
+    // Deleted buffers are unbound from the current bindings.
+    for (int bufferNdx = 0; bufferNdx < numBuffers; bufferNdx++)
+    {
+        if (buffers[bufferNdx] == 0)
+            continue;
+
+        if (m_arrayBufferBinding == buffers[bufferNdx])
+            m_arrayBufferBinding = 0;
+
+        if (state.elementArrayBufferBinding == buffers[bufferNdx])
+            state.elementArrayBufferBinding = 0;
+    }
+
+    enqueue([numBuffers, names = copyArray(buffers, numBuffers)](Context &ctx)
+            { ctx.deleteBuffers(numBuffers, getArrayPtr(names)); });
+}
+
+void AsyncContext::bufferData(uint32_t target, intptr_t size, const void *data, uint32_t usage)
+{
+    enqueue([target, size, usage, bytes = copyBytes(data, size)](Context &ctx)
+            { ctx.bufferData(target, size, getArrayPtr(bytes), usage); });
+}
+
+void AsyncContext::bufferSubData(uint32_t target, intptr_t offset, intptr_t size, const void *data)
+{
+    enqueue([target, offset, size, bytes = copyBytes(data, size)](Context &ctx)
+            { ctx.bufferSubData(target, offset, size, getArrayPtr(bytes)); });
+}
+
+void AsyncContext::clearColor(float red, float green, float blue, float alpha)
+{
+    enqueue([=](Context &ctx) { ctx.clearColor(red, green, blue, alpha); });
+}
+
+void AsyncContext::clearDepthf(float depth)
+{
+    enqueue([=](Context &ctx) { ctx.clearDepthf(depth); });
+}
+
+void AsyncContext::clearStencil(int stencil)
+{
+    enqueue([=](Context &ctx) { ctx.clearStencil(stencil); });
+}
+
+void AsyncContext::clear(uint32_t buffers)
+{
+    enqueue([=](Context &ctx) { ctx.clear(buffers); });
+}
+
+void AsyncContext::clearBufferiv(uint32_t buffer, int drawbuffer, const int *value)
+{
+    enqueue([buffer, drawbuffer, values = copyArray(value, getNumClearValues(buffer))](Context &ctx)
+            { ctx.clearBufferiv(buffer, drawbuffer, getArrayPtr(values)); });
+}
+
+void AsyncContext::clearBufferfv(uint32_t buffer, int drawbuffer, const float *value)
+{
+    enqueue([buffer, drawbuffer, values = copyArray(value, getNumClearValues(buffer))](Context &ctx)
+            { ctx.clearBufferfv(buffer, drawbuffer, getArrayPtr(values)); });
+}
+
+void AsyncContext::clearBufferuiv(uint32_t buffer, int drawbuffer, const uint32_t *value)
+{
+    enqueue([buffer, drawbuffer, values = copyArray(value, getNumClearValues(buffer))](Context &ctx)
+            { ctx.clearBufferuiv(buffer, drawbuffer, getArrayPtr(values)); });
+}
+
+void AsyncContext::clearBufferfi(uint32_t buffer, int drawbuffer, float depth, int stencil)
+{
+    enqueue([=](Context &ctx) { ctx.clearBufferfi(buffer, drawbuffer, depth, stencil); });
+}
+
+void AsyncContext::scissor(int x, int y, int width, int height)
+{
+    enqueue([=](Context &ctx) { ctx.scissor(x, y, width, height); });
+}
+
+void AsyncContext::enable(uint32_t cap)
+{
+    enqueue([=](Context &ctx) { ctx.enable(cap); });
+}
+
+void AsyncContext::disable(uint32_t cap)
+{
+    enqueue([=](Context &ctx) { ctx.disable(cap); });
+}
+
+void AsyncContext::stencilFunc(uint32_t func, int ref, uint32_t mask)
+{
+    enqueue([=](Context &ctx) { ctx.stencilFunc(func, ref, mask); });
+}
+
+void AsyncContext::stencilOp(uint32_t sfail, uint32_t dpfail, uint32_t dppass)
+{
+    enqueue([=](Context &ctx) { ctx.stencilOp(sfail, dpfail, dppass); });
+}
+
+void AsyncContext::stencilFuncSeparate(uint32_t face, uint32_t func, int ref, uint32_t mask)
+{
+    enqueue([=](Context &ctx) { ctx.stencilFuncSeparate(face, func, ref, mask); });
+}
+
+void AsyncContext::stencilOpSeparate(uint32_t face, uint32_t sfail, uint32_t dpfail, uint32_t dppass)
+{
+    enqueue([=](Context &ctx) { ctx.stencilOpSeparate(face, sfail, dpfail, dppass); });
+}
+
+void AsyncContext::depthFunc(uint32_t func)
+{
+    enqueue([=](Context &ctx) { ctx.depthFunc(func); });
+}
+
+void AsyncContext::depthRangef(float n, float f)
+{
+    enqueue([=](Context &ctx) { ctx.depthRangef(n, f); });
+}
+
+void AsyncContext::depthRange(double n, double f)
+{
+    enqueue([=](Context &ctx) { ctx.depthRange(n, f); });
+}
+
+void AsyncContext::polygonOffset(float factor, float units)
+{
+    enqueue([=](Context &ctx) { ctx.polygonOffset(factor, units); });
+}
+
+void AsyncContext::provokingVertex(uint32_t convention)
+{
+    enqueue([=](Context &ctx) { ctx.provokingVertex(convention); });
+}
+
+void AsyncContext::primitiveRestartIndex(uint32_t index)
+{
+    enqueue([=](Context &ctx) { ctx.primitiveRestartIndex(index); });
+}
+
+void AsyncContext::blendEquation(uint32_t mode)
+{
+    enqueue([=](Context &ctx) { ctx.blendEquation(mode); });
+}
+
+void AsyncContext::blendEquationSeparate(uint32_t modeRGB, uint32_t modeAlpha)
+{
+    enqueue([=](Context &ctx) { ctx.blendEquationSeparate(modeRGB, modeAlpha); });
+}
+
+void AsyncContext::blendFunc(uint32_t src, uint32_t dst)
+{
+    enqueue([=](Context &ctx) { ctx.blendFunc(src, dst); });
+}
+
+void AsyncContext::blendFuncSeparate(uint32_t srcRGB, uint32_t dstRGB, uint32_t srcAlpha, uint32_t dstAlpha)
+{
+    enqueue([=](Context &ctx) { ctx.blendFuncSeparate(srcRGB, dstRGB, srcAlpha, dstAlpha); });
+}
+
+void AsyncContext::blendColor(float red, float green, float blue, float alpha)
+{
+    enqueue([=](Context &ctx) { ctx.blendColor(red, green, blue, alpha); });
+}
+
+void AsyncContext::colorMask(bool r, bool g, bool b, bool a)
+{
+    enqueue([=](Context &ctx) { ctx.colorMask(r, g, b, a); });
+}
+
+void AsyncContext::depthMask(bool mask)
+{
+    enqueue([=](Context &ctx) { ctx.depthMask(mask); });
+}
+
+void AsyncContext::stencilMask(uint32_t mask)
+{
+    enqueue([=](Context &ctx) { ctx.stencilMask(mask); });
+}
+
+void AsyncContext::stencilMaskSeparate(uint32_t face, uint32_t mask)
+{
+    enqueue([=](Context &ctx) { ctx.stencilMaskSeparate(face, mask); });
+}
+
+void AsyncContext::blitFramebuffer(int srcX0, int srcY0, int srcX1, int srcY1, int dstX0, int dstY0, int dstX1,
+                                   int dstY1, uint32_t mask, uint32_t filter)
+{
+    enqueue([=](Context &ctx)
+            { ctx.blitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter); });
+}
+
+void AsyncContext::invalidateSubFramebuffer(uint32_t target, int numAttachments, const uint32_t *attachments, int x,
+                                            int y, int width, int height)
+{
+    enqueue([=, names = copyArray(attachments, numAttachments)](Context &ctx)
+            { ctx.invalidateSubFramebuffer(target, numAttachments, getArrayPtr(names), x, y, width, height); });
+}
+
+void AsyncContext::invalidateFramebuffer(uint32_t target, int numAttachments, const uint32_t *attachments)
+{
+    enqueue([target, numAttachments, names = copyArray(attachments, numAttachments)](Context &ctx)
+            { ctx.invalidateFramebuffer(target, numAttachments, getArrayPtr(names)); });
+}
+
+void AsyncContext::bindVertexArray(uint32_t array)
+{
+    m_vertexArrayBinding = array;
+
+    enqueue([=](Context &ctx) { ctx.bindVertexArray(array); });
+}
+
+void AsyncContext::genVertexArrays(int numArrays, uint32_t *vertexArrays)
+{
+    execute([&](Context &ctx) { ctx.genVertexArrays(numArrays, vertexArrays); });
+}
+
+void AsyncContext::deleteVertexArrays(int numArrays, const uint32_t *vertexArrays)
+{
+    for (int arrayNdx = 0; arrayNdx < numArrays; arrayNdx++)
+    {
+        if (vertexArrays[arrayNdx] == 0)
+            continue;
+
+        if (m_vertexArrayBinding == vertexArrays[arrayNdx])
+            m_vertexArrayBinding = 0;
+
+        m_vertexArrays.erase(vertexArrays[arrayNdx]);
+    }
+
+    enqueue([numArrays, names = copyArray(vertexArrays, numArrays)](Context &ctx)
+            { ctx.deleteVertexArrays(numArrays, getArrayPtr(names)); });
+}
+
+void AsyncContext::vertexAttribPointer(uint32_t index, int size, uint32_t type, bool normalized, int stride,
+                                       const void *pointer)
+{
+    setClientArray(index, m_arrayBufferBinding == 0);
+
+    enqueue([=](Context &ctx) { ctx.vertexAttribPointer(index, size, type, normalized, stride, pointer); });
+}
+
+void AsyncContext::vertexAttribIPointer(uint32_t index, int size, uint32_t type, int stride, const void *pointer)
+{
+    setClientArray(index, m_arrayBufferBinding == 0);
+
+    enqueue([=](Context &ctx) { ctx.vertexAttribIPointer(index, size, type, stride, pointer); });
+}
+
+void AsyncContext::enableVertexAttribArray(uint32_t index)
+{
+    getVertexArrayState().enabledArrays.insert(index);
+
+    enqueue([=](Context &ctx) { ctx.enableVertexAttribArray(index); });
+}
+
+void AsyncContext::disableVertexAttribArray(uint32_t index)
+{
+    getVertexArrayState().enabledArrays.erase(index);
+
+    enqueue([=](Context &ctx) { ctx.disableVertexAttribArray(index); });
+}
+
+void AsyncContext::vertexAttribDivisor(uint32_t index, uint32_t divisor)
+{
+    enqueue([=](Context &ctx) { ctx.vertexAttribDivisor(index, divisor); });
+}
+
+void AsyncContext::vertexAttrib1f(uint32_t index, float x)
+{
+    enqueue([=](Context &ctx) { ctx.vertexAttrib1f(index, x); });
+}
+
+void AsyncContext::vertexAttrib2f(uint32_t index, float x, float y)
+{
+    enqueue([=](Context &ctx) { ctx.vertexAttrib2f(index, x, y); });
+}
+
+void AsyncContext::vertexAttrib3f(uint32_t index, float x, float y, float z)
+{
+    enqueue([=](Context &ctx) { ctx.vertexAttrib3f(index, x, y, z); });
+}
+
+void AsyncContext::vertexAttrib4f(uint32_t index, float x, float y, float z, float w)
+{
+    enqueue([=](Context &ctx) { ctx.vertexAttrib4f(index, x, y, z, w); });
+}
+
+void AsyncContext::vertexAttribI4i(uint32_t index, int32_t x, int32_t y, int32_t z, int32_t w)
+{
+    enqueue([=](Context &ctx) { ctx.vertexAttribI4i(index, x, y, z, w); });
+}
+
+void AsyncContext::vertexAttribI4ui(uint32_t index, uint32_t x, uint32_t y, uint32_t z, uint32_t w)
+{
+    enqueue([=](Context &ctx) { ctx.vertexAttribI4ui(index, x, y, z, w); });
+}
+
+int32_t AsyncContext::getLocation(LocationMap &cache, uint32_t program, const char *name,
+                                  int32_t (Context::*getter)(uint32_t, const char *))
+{
+    // Locations can be cached only for programs known to be valid.
+    const bool isCacheable = name && m_programs.find(program) != m_programs.end();
+    const LocationKey key(program, isCacheable ? name : "");
+    int32_t location = -1;
+
+    if (isCacheable)
+    {
+        const LocationMap::const_iterator cached = cache.find(key);
+
+        if (cached != cache.end())
+            return cached->second;
+    }
+
+    execute([&](Context &ctx) { location = (ctx.*getter)(program, name); });
+
+    if (isCacheable)
+        cache[key] = location;
+
+    return location;
+}
+
+int32_t AsyncContext::getAttribLocation(uint32_t program, const char *name)
+{
+    return getLocation(m_attribLocations, program, name, &Context::getAttribLocation);
+}
+
+void AsyncContext::uniform1f(int32_t location, float x)
+{
+    enqueue([=](Context &ctx) { ctx.uniform1f(location, x); });
+}
+
+void AsyncContext::uniform1i(int32_t location, int32_t x)
+{
+    enqueue([=](Context &ctx) { ctx.uniform1i(location, x); });
+}
+
+void AsyncContext::uniform1fv(int32_t index, int32_t count, const float *values)
+{
+    enqueue([index, count, data = copyArray(values, count)](Context &ctx)
+            { ctx.uniform1fv(index, count, getArrayPtr(data)); });
+}
+
+void AsyncContext::uniform2fv(int32_t index, int32_t count, const float *values)
+{
+    enqueue([index, count, data = copyArray(values, 2 * (intptr_t)count)](Context &ctx)
+            { ctx.uniform2fv(index, count, getArrayPtr(data)); });
+}
+
+void AsyncContext::uniform3fv(int32_t index, int32_t count, const float *values)
+{
+    enqueue([index, count, data = copyArray(values, 3 * (intptr_t)count)](Context &ctx)
+            { ctx.uniform3fv(index, count, getArrayPtr(data)); });
+}
+
+void AsyncContext::uniform4fv(int32_t index, int32_t count, const float *values)
+{
+    enqueue([index, count, data = copyArray(values, 4 * (intptr_t)count)](Context &ctx)
+            { ctx.uniform4fv(index, count, getArrayPtr(data)); });
+}
+
+void AsyncContext::uniform1iv(int32_t index, int32_t count, const int32_t *values)
+{
+    enqueue([index, count, data = copyArray(values, count)](Context &ctx)
+            { ctx.uniform1iv(index, count, getArrayPtr(data)); });
+}
+
+void AsyncContext::uniform2iv(int32_t index, int32_t count, const int32_t *values)
+{
+    enqueue([index, count, data = copyArray(values, 2 * (intptr_t)count)](Context &ctx)
+            { ctx.uniform2iv(index, count, getArrayPtr(data)); });
+}
+
+void AsyncContext::uniform3iv(int32_t index, int32_t count, const int32_t *values)
+{
+    enqueue([index, count, data = copyArray(values, 3 * (intptr_t)count)](Context &ctx)
+            { ctx.uniform3iv(index, count, getArrayPtr(data)); });
+}
+
+void AsyncContext::uniform4iv(int32_t index, int32_t count, const int32_t *values)
+{
+    enqueue([index, count, data = copyArray(values, 4 * (intptr_t)count)](Context &ctx)
+            { ctx.uniform4iv(index, count, getArrayPtr(data)); });
+}
+
+void AsyncContext::uniformMatrix3fv(int32_t location, int32_t count, bool transpose, const float *value)
+{
+    enqueue([location, count, transpose, data = copyArray(value, 9 * (intptr_t)count)](Context &ctx)
+            { ctx.uniformMatrix3fv(location, count, transpose, getArrayPtr(data)); });
+}
+
+void AsyncContext::uniformMatrix4fv(int32_t location, int32_t count, bool transpose, const float *value)
+{
+    enqueue([location, count, transpose, data = copyArray(value, 16 * (intptr_t)count)](Context &ctx)
+            { ctx.uniformMatrix4fv(location, count, transpose, getArrayPtr(data)); });
+}
+
+int32_t AsyncContext::getUniformLocation(uint32_t program, const char *name)
+{
+    return getLocation(m_uniformLocations, program, name, &Context::getUniformLocation);
+}
+
+void AsyncContext::lineWidth(float width)
+{
+    enqueue([=](Context &ctx) { ctx.lineWidth(width); });
+}
+
+// Draws are recorded unless they read vertex attributes from client memory. Client-side indices are copied.
+
+void AsyncContext::drawArrays(uint32_t mode, int first, int count)
+{
+    const Command command = [=](Context &ctx) { ctx.drawArrays(mode, first, count); };
+
+    if (canRecordDraw())
+        enqueue(Command(command));
+    else
+        execute(command);
+}
+
+void AsyncContext::drawArraysInstanced(uint32_t mode, int first, int count, int instanceCount)
+{
+    const Command command = [=](Context &ctx) { ctx.drawArraysInstanced(mode, first, count, instanceCount); };
+
+    if (canRecordDraw())
+        enqueue(Command(command));
+    else
+        execute(command);
+}
+
+void AsyncContext::drawElements(uint32_t mode, int count, uint32_t type, const void *indices)
+{
+    std::vector<uint8_t> clientIndices;
+
+    if (canRecordDraw(count, type, indices, clientIndices))
+        enqueue([=, clientIndices = std::move(clientIndices)](Context &ctx)
+                { ctx.drawElements(mode, count, type, selectIndices(clientIndices, indices)); });
+    else
+        execute([&](Context &ctx) { ctx.drawElements(mode, count, type, indices); });
+}
+
+void AsyncContext::drawElementsInstanced(uint32_t mode, int count, uint32_t type, const void *indices,
+                                         int instanceCount)
+{
+    std::vector<uint8_t> clientIndices;
+
+    if (canRecordDraw(count, type, indices, clientIndices))
+        enqueue(
+            [=, clientIndices = std::move(clientIndices)](Context &ctx)
+            { ctx.drawElementsInstanced(mode, count, type, selectIndices(clientIndices, indices), instanceCount); });
+    else
+        execute([&](Context &ctx) { ctx.drawElementsInstanced(mode, count, type, indices, instanceCount); });
+}
+
+void AsyncContext::drawElementsBaseVertex(uint32_t mode, int count, uint32_t type, const void *indices,
+                                          int baseVertex)
+{
+    std::vector<uint8_t> clientIndices;
+
+    if (canRecordDraw(count, type, indices, clientIndices))
+        enqueue(
+            [=, clientIndices = std::move(clientIndices)](Context &ctx)
+            { ctx.drawElementsBaseVertex(mode, count, type, selectIndices(clientIndices, indices), baseVertex); });
+    else
+        execute([&](Context &ctx) { ctx.drawElementsBaseVertex(mode, count, type, indices, baseVertex); });
+}
+
+void AsyncContext::drawElementsInstancedBaseVertex(uint32_t mode, int count, uint32_t type, const void *indices,
+                                                   int instanceCount, int baseVertex)
+{
+    std::vector<uint8_t> clientIndices;
+
+    if (canRecordDraw(count, type, indices, clientIndices))
+        enqueue(
+            [=, clientIndices = std::move(clientIndices)](Context &ctx)
+            {
+                ctx.drawElementsInstancedBaseVertex(mode, count, type, selectIndices(clientIndices, indices),
+                                                    instanceCount, baseVertex);
+            });
+    else
+        execute([&](Context &ctx)
+                { ctx.drawElementsInstancedBaseVertex(mode, count, type, indices, instanceCount, baseVertex); });
+}
+
+void AsyncContext::drawRangeElements(uint32_t mode, uint32_t start, uint32_t end, int count, uint32_t type,
+                                     const void *indices)
+{
+    std::vector<uint8_t> clientIndices;
+
+    if (canRecordDraw(count, type, indices, clientIndices))
+        enqueue([=, clientIndices = std::move(clientIndices)](Context &ctx)
+                { ctx.drawRangeElements(mode, start, end, count, type, selectIndices(clientIndices, indices)); });
+    else
+        execute([&](Context &ctx) { ctx.drawRangeElements(mode, start, end, count, type, indices); });
+}
+
+void AsyncContext::drawRangeElementsBaseVertex(uint32_t mode, uint32_t start, uint32_t end, int count, uint32_t type,
+                                               const void *indices, int baseVertex)
+{
+    std::vector<uint8_t> clientIndices;
+
+    if (canRecordDraw(count, type, indices, clientIndices))
+        enqueue(
+            [=, clientIndices = std::move(clientIndices)](Context &ctx)
+            {
+                ctx.drawRangeElementsBaseVertex(mode, start, end, count, type, selectIndices(clientIndices, indices),
+                                                baseVertex);
+            });
+    else
+        execute([&](Context &ctx)
+                { ctx.drawRangeElementsBaseVertex(mode, start, end, count, type, indices, baseVertex); });
+}
+
+// Indirect draws always source commands from the draw indirect buffer.
+
+void AsyncContext::drawArraysIndirect(uint32_t mode, const void *indirect)
+{
+    const Command command = [=](Context &ctx) { ctx.drawArraysIndirect(mode, indirect); };
+
+    if (canRecordDraw())
+        enqueue(Command(command));
+    else
+        execute(command);
+}
+
+void AsyncContext::drawElementsIndirect(uint32_t mode, uint32_t type, const void *indirect)
+{
+    const Command command = [=](Context &ctx) { ctx.drawElementsIndirect(mode, type, indirect); };
+
+    if (canRecordDraw())
+        enqueue(Command(command));
+    else
+        execute(command);
+}
+
+void AsyncContext::multiDrawArrays(uint32_t mode, const int *first, const int *count, int primCount)
+{
+    if (canRecordDraw())
+        enqueue([mode, primCount, firsts = copyArray(first, primCount), counts = copyArray(count, primCount)](
+                    Context &ctx) { ctx.multiDrawArrays(mode, getArrayPtr(firsts), getArrayPtr(counts), primCount); });
+    else
+        execute([&](Context &ctx) { ctx.multiDrawArrays(mode, first, count, primCount); });
+}
+
+void AsyncContext::multiDrawElements(uint32_t mode, const int *count, uint32_t type, const void **indices,
+                                     int primCount)
+{
+    // Client-side index arrays are not copied.
+    if (canRecordDraw() && getVertexArrayState().elementArrayBufferBinding != 0)
+        enqueue(
+            [mode, type, primCount, counts = copyArray(count, primCount),
+             offsets = copyArray(indices, primCount)](Context &ctx) mutable
+            {
+                ctx.multiDrawElements(mode, getArrayPtr(counts), type, offsets.empty() ? DE_NULL : &offsets[0],
+                                      primCount);
+            });
+    else
+        execute([&](Context &ctx) { ctx.multiDrawElements(mode, count, type, indices, primCount); });
+}
+
+void AsyncContext::multiDrawElementsBaseVertex(uint32_t mode, const int *count, uint32_t type, const void **indices,
+                                               int primCount, const int *baseVertex)
+{
+    if (canRecordDraw() && getVertexArrayState().elementArrayBufferBinding != 0)
+        enqueue(
+            [mode, type, primCount, counts = copyArray(count, primCount), offsets = copyArray(indices, primCount),
+             baseVertices = copyArray(baseVertex, primCount)](Context &ctx) mutable
+            {
+                ctx.multiDrawElementsBaseVertex(mode, getArrayPtr(counts), type,
+                                                offsets.empty() ? DE_NULL : &offsets[0], primCount,
+                                                getArrayPtr(baseVertices));
+            });
+    else
+        execute([&](Context &ctx)
+                { ctx.multiDrawElementsBaseVertex(mode, count, type, indices, primCount, baseVertex); });
+}
+
+uint32_t AsyncContext::createProgram(ShaderProgram *program)
+{
+    uint32_t name = 0;
+
+    execute([&](Context &ctx) { name = ctx.createProgram(program); });
+
+    if (name != 0)
+        m_programs.insert(name);
+
+    return name;
+}
+
+void AsyncContext::deleteProgram(uint32_t program)
+{
+    // Name may be reused by a later program.
+    m_programs.erase(program);
+    m_attribLocations.erase(m_attribLocations.lower_bound(LocationKey(program, "")),
+                            m_attribLocations.lower_bound(LocationKey(program + 1, "")));
+    m_uniformLocations.erase(m_uniformLocations.lower_bound(LocationKey(program, "")),
+                             m_uniformLocations.lower_bound(LocationKey(program + 1, "")));
+
+    enqueue([=](Context &ctx) { ctx.deleteProgram(program); });
+}
+
+void AsyncContext::useProgram(uint32_t program)
+{
+    enqueue([=](Context &ctx) { ctx.useProgram(program); });
+}
+
+void AsyncContext::readPixels(int x, int y, int width, int height, uint32_t format, uint32_t type, void *data)
+{
+    execute([&](Context &ctx) { ctx.readPixels(x, y, width, height, format, type, data); });
+}
+
+uint32_t AsyncContext::getError(void)
+{
+    std::lock_guard<std::mutex> lock(m_lock);
+    const uint32_t error = m_error;
+
+    m_error = GL_NO_ERROR;
+    return error;
+}
+
+void AsyncContext::finish(void)
+{
+    execute([](Context &ctx) { ctx.finish(); });
+}
+
+void AsyncContext::getIntegerv(uint32_t pname, int *params)
+{
+    execute([&](Context &ctx) { ctx.getIntegerv(pname, params); });
+}
+
+const char *AsyncContext::getString(uint32_t pname)
+{
+    const char *str = DE_NULL;
+    execute([&](Context &ctx) { str = ctx.getString(pname); });
+    return str;
+}
+
+} // namespace sglr
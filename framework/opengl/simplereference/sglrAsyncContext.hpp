@@ -0,0 +1,320 @@
+#ifndef _SGLRASYNCCONTEXT_HPP
+#define _SGLRASYNCCONTEXT_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program OpenGL ES Utilities
+ * ------------------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Context decorator that replays calls on a worker thread.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "sglrContext.hpp"
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace sglr
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Asynchronous context
+ *
+ * AsyncContext records calls made to it and replays them into the wrapped
+ * context on a worker thread, so that a slow context such as
+ * ReferenceContext can render while the caller keeps issuing work to
+ * another context.
+ *
+ * Data passed by pointer is copied when the call is recorded. Calls that
+ * return values (gen*, createProgram, readPixels, getIntegerv, ...) and
+ * finish() wait for all recorded calls to finish and then run directly.
+ * Draw calls that source vertex attributes from client memory, and texture
+ * uploads from client memory, are run the same way since the amount of
+ * data they read is not known up front. Attribute and uniform locations of
+ * programs created through this context are cached so that they don't
+ * need to wait.
+ *
+ * Unlike the other calls returning values, getError() does not
+ * synchronize with the worker. Errors generated by recorded calls are
+ * returned by getError() once the calls have executed, which is
+ * guaranteed after any waiting call, so callers checking for errors of
+ * recorded calls must issue a waiting call such as finish() first. Exceptions thrown by recorded calls
+ * are rethrown from the next waiting call, and the calls recorded after
+ * the throwing one are dropped.
+ *
+ * Objects referenced by recorded calls, such as ShaderProgram instances,
+ * must stay alive until the next waiting call. The wrapped context must
+ * not be accessed directly while it is wrapped.
+ *//*--------------------------------------------------------------------*/
+class AsyncContext : public Context
+{
+public:
+    AsyncContext(Context &context);
+    virtual ~AsyncContext(void);
+
+    //! Wait until all recorded calls have executed.
+    void synchronize(void);
+
+    //! Wait until all recorded calls have executed and discard exceptions thrown by them.
+    void synchronizeNoThrow(void);
+
+    virtual int getWidth(void) const;
+    virtual int getHeight(void) const;
+
+    virtual void viewport(int x, int y, int width, int height);
+    virtual void activeTexture(uint32_t texture);
+
+    virtual void bindTexture(uint32_t target, uint32_t texture);
+    virtual void genTextures(int numTextures, uint32_t *textures);
+    virtual void deleteTextures(int numTextures, const uint32_t *textures);
+
+    virtual void bindFramebuffer(uint32_t target, uint32_t framebuffer);
+    virtual void genFramebuffers(int numFramebuffers, uint32_t *framebuffers);
+    virtual void deleteFramebuffers(int numFramebuffers, const uint32_t *framebuffers);
+
+    virtual void bindRenderbuffer(uint32_t target, uint32_t renderbuffer);
+    virtual void genRenderbuffers(int numRenderbuffers, uint32_t *renderbuffers);
+    virtual void deleteRenderbuffers(int numRenderbuffers, const uint32_t *renderbuffers);
+
+    virtual void pixelStorei(uint32_t pname, int param);
+    virtual void texImage1D(uint32_t target, int level, uint32_t internalFormat, int width, int border, uint32_t format,
+                            uint32_t type, const void *data);
+    virtual void texImage2D(uint32_t target, int level, uint32_t internalFormat, int width, int height, int border,
+                            uint32_t format, uint32_t type, const void *data);
+    virtual void texImage3D(uint32_t target, int level, uint32_t internalFormat, int width, int height, int depth,
+                            int border, uint32_t format, uint32_t type, const void *data);
+    virtual void texSubImage1D(uint32_t target, int level, int xoffset, int width, uint32_t format, uint32_t type,
+                               const void *data);
+    virtual void texSubImage2D(uint32_t target, int level, int xoffset, int yoffset, int width, int height,
+                               uint32_t format, uint32_t type, const void *data);
+    virtual void texSubImage3D(uint32_t target, int level, int xoffset, int yoffset, int zoffset, int width, int height,
+                               int depth, uint32_t format, uint32_t type, const void *data);
+    virtual void copyTexImage1D(uint32_t target, int level, uint32_t internalFormat, int x, int y, int width,
+                                int border);
+    virtual void copyTexImage2D(uint32_t target, int level, uint32_t internalFormat, int x, int y, int width,
+                                int height, int border);
+    virtual void copyTexSubImage1D(uint32_t target, int level, int xoffset, int x, int y, int width);
+    virtual void copyTexSubImage2D(uint32_t target, int level, int xoffset, int yoffset, int x, int y, int width,
+                                   int height);
+    virtual void copyTexSubImage3D(uint32_t target, int level, int xoffset, int yoffset, int zoffset, int x, int y,
+                                   int width, int height);
+
+    virtual void texStorage2D(uint32_t target, int levels, uint32_t internalFormat, int width, int height);
+    virtual void texStorage3D(uint32_t target, int levels, uint32_t internalFormat, int width, int height, int depth);
+
+    virtual void texParameteri(uint32_t target, uint32_t pname, int value);
+
+    virtual void framebufferTexture2D(uint32_t target, uint32_t attachment, uint32_t textarget, uint32_t texture,
+                                      int level);
+    virtual void framebufferTextureLayer(uint32_t target, uint32_t attachment, uint32_t texture, int level, int layer);
+    virtual void framebufferRenderbuffer(uint32_t target, uint32_t attachment, uint32_t renderbuffertarget,
+                                         uint32_t renderbuffer);
+    virtual uint32_t checkFramebufferStatus(uint32_t target);
+
+    virtual void getFramebufferAttachmentParameteriv(uint32_t target, uint32_t attachment, uint32_t pname, int *params);
+
+    virtual void renderbufferStorage(uint32_t target, uint32_t internalformat, int width, int height);
+    virtual void renderbufferStorageMultisample(uint32_t target, int samples, uint32_t internalFormat, int width,
+                                                int height);
+
+    virtual void bindBuffer(uint32_t target, uint32_t buffer);
+    virtual void genBuffers(int numBuffers, uint32_t *buffers);
+    virtual void deleteBuffers(int numBuffers, const uint32_t *buffers);
+
+    virtual void bufferData(uint32_t target, intptr_t size, const void *data, uint32_t usage);
+    virtual void bufferSubData(uint32_t target, intptr_t offset, intptr_t size, const void *data);
+
+    virtual void clearColor(float red, float green, float blue, float alpha);
+    virtual void clearDepthf(float depth);
+    virtual void clearStencil(int stencil);
+
+    virtual void clear(uint32_t buffers);
+    virtual void clearBufferiv(uint32_t buffer, int drawbuffer, const int *value);
+    virtual void clearBufferfv(uint32_t buffer, int drawbuffer, const float *value);
+    virtual void clearBufferuiv(uint32_t buffer, int drawbuffer, const uint32_t *value);
+    virtual void clearBufferfi(uint32_t buffer, int drawbuffer, float depth, int stencil);
+    virtual void scissor(int x, int y, int width, int height);
+
+    virtual void enable(uint32_t cap);
+    virtual void disable(uint32_t cap);
+
+    virtual void stencilFunc(uint32_t func, int ref, uint32_t mask);
+    virtual void stencilOp(uint32_t sfail, uint32_t dpfail, uint32_t dppass);
+    virtual void stencilFuncSeparate(uint32_t face, uint32_t func, int ref, uint32_t mask);
+    virtual void stencilOpSeparate(uint32_t face, uint32_t sfail, uint32_t dpfail, uint32_t dppass);
+
+    virtual void depthFunc(uint32_t func);
+    virtual void depthRangef(float n, float f);
+    virtual void depthRange(double n, double f);
+
+    virtual void polygonOffset(float factor, float units);
+    virtual void provokingVertex(uint32_t convention);
+    virtual void primitiveRestartIndex(uint32_t index);
+
+    virtual void blendEquation(uint32_t mode);
+    virtual void blendEquationSeparate(uint32_t modeRGB, uint32_t modeAlpha);
+    virtual void blendFunc(uint32_t src, uint32_t dst);
+    virtual void blendFuncSeparate(uint32_t srcRGB, uint32_t dstRGB, uint32_t srcAlpha, uint32_t dstAlpha);
+    virtual void blendColor(float red, float green, float blue, float alpha);
+
+    virtual void colorMask(bool r, bool g, bool b, bool a);
+    virtual void depthMask(bool mask);
+    virtual void stencilMask(uint32_t mask);
+    virtual void stencilMaskSeparate(uint32_t face, uint32_t mask);
+
+    virtual void blitFramebuffer(int srcX0, int srcY0, int srcX1, int srcY1, int dstX0, int dstY0, int dstX1, int dstY1,
+                                 uint32_t mask, uint32_t filter);
+
+    virtual void invalidateSubFramebuffer(uint32_t target, int numAttachments, const uint32_t *attachments, int x,
+                                          int y, int width, int height);
+    virtual void invalidateFramebuffer(uint32_t target, int numAttachments, const uint32_t *attachments);
+
+    virtual void bindVertexArray(uint32_t array);
+    virtual void genVertexArrays(int numArrays, uint32_t *vertexArrays);
+    virtual void deleteVertexArrays(int numArrays, const uint32_t *vertexArrays);
+
+    virtual void vertexAttribPointer(uint32_t index, int size, uint32_t type, bool normalized, int stride,
+                                     const void *pointer);
+    virtual void vertexAttribIPointer(uint32_t index, int size, uint32_t type, int stride, const void *pointer);
+    virtual void enableVertexAttribArray(uint32_t index);
+    virtual void disableVertexAttribArray(uint32_t index);
+    virtual void vertexAttribDivisor(uint32_t index, uint32_t divisor);
+
+    virtual void vertexAttrib1f(uint32_t index, float);
+    virtual void vertexAttrib2f(uint32_t index, float, float);
+    virtual void vertexAttrib3f(uint32_t index, float, float, float);
+    virtual void vertexAttrib4f(uint32_t index, float, float, float, float);
+    virtual void vertexAttribI4i(uint32_t index, int32_t, int32_t, int32_t, int32_t);
+    virtual void vertexAttribI4ui(uint32_t index, uint32_t, uint32_t, uint32_t, uint32_t);
+
+    virtual int32_t getAttribLocation(uint32_t program, const char *name);
+
+    virtual void uniform1f(int32_t location, float);
+    virtual void uniform1i(int32_t location, int32_t);
+    virtual void uniform1fv(int32_t index, int32_t count, const float *);
+    virtual void uniform2fv(int32_t index, int32_t count, const float *);
+    virtual void uniform3fv(int32_t index, int32_t count, const float *);
+    virtual void uniform4fv(int32_t index, int32_t count, const float *);
+    virtual void uniform1iv(int32_t index, int32_t count, const int32_t *);
+    virtual void uniform2iv(int32_t index, int32_t count, const int32_t *);
+    virtual void uniform3iv(int32_t index, int32_t count, const int32_t *);
+    virtual void uniform4iv(int32_t index, int32_t count, const int32_t *);
+    virtual void uniformMatrix3fv(int32_t location, int32_t count, bool transpose, const float *value);
+    virtual void uniformMatrix4fv(int32_t location, int32_t count, bool transpose, const float *value);
+    virtual int32_t getUniformLocation(uint32_t program, const char *name);
+
+    virtual void lineWidth(float);
+
+    virtual void drawArrays(uint32_t mode, int first, int count);
+    virtual void drawArraysInstanced(uint32_t mode, int first, int count, int instanceCount);
+    virtual void drawElements(uint32_t mode, int count, uint32_t type, const void *indices);
+    virtual void drawElementsInstanced(uint32_t mode, int count, uint32_t type, const void *indices, int instanceCount);
+    virtual void drawElementsBaseVertex(uint32_t mode, int count, uint32_t type, const void *indices, int baseVertex);
+    virtual void drawElementsInstancedBaseVertex(uint32_t mode, int count, uint32_t type, const void *indices,
+                                                 int instanceCount, int baseVertex);
+    virtual void drawRangeElements(uint32_t mode, uint32_t start, uint32_t end, int count, uint32_t type,
+                                   const void *indices);
+    virtual void drawRangeElementsBaseVertex(uint32_t mode, uint32_t start, uint32_t end, int count, uint32_t type,
+                                             const void *indices, int baseVertex);
+    virtual void drawArraysIndirect(uint32_t mode, const void *indirect);
+    virtual void drawElementsIndirect(uint32_t mode, uint32_t type, const void *indirect);
+
+    virtual void multiDrawArrays(uint32_t mode, const int *first, const int *count, int primCount);
+    virtual void multiDrawElements(uint32_t mode, const int *count, uint32_t type, const void **indices, int primCount);
+    virtual void multiDrawElementsBaseVertex(uint32_t mode, const int *count, uint32_t type, const void **indices,
+                                             int primCount, const int *baseVertex);
+
+    virtual uint32_t createProgram(ShaderProgram *);
+    virtual void deleteProgram(uint32_t program);
+    virtual void useProgram(uint32_t program);
+
+    virtual void readPixels(int x, int y, int width, int height, uint32_t format, uint32_t type, void *data);
+    //! Does not synchronize with the worker: errors of calls still recorded are not returned yet.
+    virtual uint32_t getError(void);
+    virtual void finish(void);
+
+    virtual void getIntegerv(uint32_t pname, int *params);
+    virtual const char *getString(uint32_t pname);
+
+    // Expose helpers from Context.
+    using Context::readPixels;
+    using Context::texImage2D;
+    using Context::texSubImage2D;
+
+private:
+    class WorkerThread;
+
+    typedef std::function<void(Context &)> Command;
+    typedef std::pair<uint32_t, std::string> LocationKey;
+    typedef std::map<LocationKey, int32_t> LocationMap;
+
+    struct VertexArrayState
+    {
+        VertexArrayState(void) : elementArrayBufferBinding(0)
+        {
+        }
+
+        uint32_t elementArrayBufferBinding;
+        std::set<uint32_t> clientArrays;
+        std::set<uint32_t> enabledArrays;
+    };
+
+    AsyncContext(const AsyncContext &other);
+    AsyncContext &operator=(const AsyncContext &other);
+
+    void enqueue(Command &&command);
+    void execute(const Command &command);
+    void processCommands(void);
+
+    VertexArrayState &getVertexArrayState(void);
+    void setClientArray(uint32_t index, bool isClientArray);
+    bool canRecordDraw(void);
+    bool canRecordDraw(int count, uint32_t type, const void *indices, std::vector<uint8_t> &clientIndices);
+    int32_t getLocation(LocationMap &cache, uint32_t program, const char *name,
+                        int32_t (Context::*getter)(uint32_t, const char *));
+
+    Context &m_context;
+    WorkerThread *m_thread;
+
+    std::mutex m_lock;
+    std::condition_variable m_commandCond;
+    std::condition_variable m_idleCond;
+    std::vector<Command> m_commands;
+    bool m_isBusy;
+    bool m_isShuttingDown;
+    uint32_t m_error;
+    std::exception_ptr m_exception;
+
+    // State tracked on the recording side. Only touched by the recording thread.
+    uint32_t m_arrayBufferBinding;
+    uint32_t m_vertexArrayBinding;
+    std::map<uint32_t, VertexArrayState> m_vertexArrays;
+    std::set<uint32_t> m_programs;
+    LocationMap m_attribLocations;
+    LocationMap m_uniformLocations;
+} DE_WARN_UNUSED_TYPE;
+
+} // namespace sglr
+
+#endif // _SGLRASYNCCONTEXT_HPP
@@ -26,6 +26,7 @@
 #include "tcuDefs.hpp"
 #include "tcuAndroidNativeActivity.hpp"
 #include "deThread.hpp"
+#include "deSemaphore.hpp"
 #include "deThreadSafeRingBuffer.hpp"
 
 namespace tcu
@@ -43,150 +43,62 @@ struct qpXmlWriter_s
     int xmlElementDepth;
 };
 
+/* Get escape sequence for character, or null if it can be written as-is. */
+static const char *getEscapeSequence(char c)
+{
+    /* Non-printable characters. Tab and line breaks are written as-is. */
+    static const char *const s_controlChars[32] = {
+        DE_NULL, "&lt;SOH&gt;", "&lt;STX&gt;", "&lt;ETX&gt;", "&lt;EOT&gt;", "&lt;ENQ&gt;", "&lt;ACK&gt;",
+        "&lt;BEL&gt;", "&lt;BS&gt;", DE_NULL, DE_NULL, "&lt;VT&gt;", "&lt;FF&gt;", DE_NULL, "&lt;SO&gt;", "&lt;SI&gt;",
+        "&lt;DLE&gt;", "&lt;DC1&gt;", "&lt;DC2&gt;", "&lt;DC3&gt;", "&lt;DC4&gt;", "&lt;NAK&gt;", "&lt;SYN&gt;",
+        "&lt;ETB&gt;", "&lt;CAN&gt;", "&lt;EM&gt;", "&lt;SUB&gt;", "&lt;ESC&gt;", "&lt;FS&gt;", "&lt;GS&gt;",
+        "&lt;RS&gt;", "&lt;US&gt;"};
+
+    if ((unsigned char)c < 32)
+        return s_controlChars[(unsigned char)c];
+
+    switch (c)
+    {
+    case '<':
+        return "&lt;";
+    case '>':
+        return "&gt;";
+    case '&':
+        return "&amp;";
+    case '\'':
+        return "&apos;";
+    case '"':
+        return "&quot;";
+    default:
+        return DE_NULL;
+    }
+}
+
 static bool writeEscaped(qpXmlWriter *writer, const char *str)
 {
-    char buf[256 + 10];
-    char *d       = &buf[0];
     const char *s = str;
-    bool isEOS    = false;
 
-    do
+    while (*s)
     {
-        /* Check for characters that need to be escaped. */
-        const char *repl = DE_NULL;
-        switch (*s)
-        {
-        case 0:
-            isEOS = true;
-            break;
-        case '<':
-            repl = "&lt;";
-            break;
-        case '>':
-            repl = "&gt;";
-            break;
-        case '&':
-            repl = "&amp;";
-            break;
-        case '\'':
-            repl = "&apos;";
-            break;
-        case '"':
-            repl = "&quot;";
-            break;
+        /* Write run of characters that don't need escaping at once. */
+        const char *runStart = s;
+        const char *repl     = DE_NULL;
 
-        /* Non-printable characters. */
-        case 1:
-            repl = "&lt;SOH&gt;";
-            break;
-        case 2:
-            repl = "&lt;STX&gt;";
-            break;
-        case 3:
-            repl = "&lt;ETX&gt;";
-            break;
-        case 4:
-            repl = "&lt;EOT&gt;";
-            break;
-        case 5:
-            repl = "&lt;ENQ&gt;";
-            break;
-        case 6:
-            repl = "&lt;ACK&gt;";
-            break;
-        case 7:
-            repl = "&lt;BEL&gt;";
-            break;
-        case 8:
-            repl = "&lt;BS&gt;";
-            break;
-        case 11:
-            repl = "&lt;VT&gt;";
-            break;
-        case 12:
-            repl = "&lt;FF&gt;";
-            break;
-        case 14:
-            repl = "&lt;SO&gt;";
-            break;
-        case 15:
-            repl = "&lt;SI&gt;";
-            break;
-        case 16:
-            repl = "&lt;DLE&gt;";
-            break;
-        case 17:
-            repl = "&lt;DC1&gt;";
-            break;
-        case 18:
-            repl = "&lt;DC2&gt;";
-            break;
-        case 19:
-            repl = "&lt;DC3&gt;";
-            break;
-        case 20:
-            repl = "&lt;DC4&gt;";
-            break;
-        case 21:
-            repl = "&lt;NAK&gt;";
-            break;
-        case 22:
-            repl = "&lt;SYN&gt;";
-            break;
-        case 23:
-            repl = "&lt;ETB&gt;";
-            break;
-        case 24:
-            repl = "&lt;CAN&gt;";
-            break;
-        case 25:
-            repl = "&lt;EM&gt;";
-            break;
-        case 26:
-            repl = "&lt;SUB&gt;";
-            break;
-        case 27:
-            repl = "&lt;ESC&gt;";
-            break;
-        case 28:
-            repl = "&lt;FS&gt;";
-            break;
-        case 29:
-            repl = "&lt;GS&gt;";
-            break;
-        case 30:
-            repl = "&lt;RS&gt;";
-            break;
-        case 31:
-            repl = "&lt;US&gt;";
-            break;
+        while (*s && (repl = getEscapeSequence(*s)) == DE_NULL)
+            s++;
 
-        default: /* nada */
-            break;
-        }
+        if (s != runStart)
+            fwrite(runStart, 1, (size_t)(s - runStart), writer->outputFile);
 
-        /* Write out char or escape sequence. */
         if (repl)
         {
+            fputs(repl, writer->outputFile);
             s++;
-            strcpy(d, repl);
-            d += strlen(repl);
-        }
-        else
-            *d++ = *s++;
-
-        /* Write buffer if EOS or buffer full. */
-        if (isEOS || ((d - &buf[0]) >= 4))
-        {
-            *d = 0;
-            fputs(buf, writer->outputFile);
-            d = &buf[0];
         }
-    } while (!isEOS);
+    }
 
     if (writer->flushAfterWrite)
         fflush(writer->outputFile);
-    DE_ASSERT(d == &buf[0]); /* buffer must be empty */
     return true;
 }
 
@@ -333,9 +245,9 @@ bool qpXmlWriter_writeBase64(qpXmlWriter *writer, const uint8_t *data, size_t nu
         'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r',
         's', 't', 'u', 'v', 'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/'};
 
-    int numWritten        = 0;
+    char line[64];
+    int lineLen           = 0;
     size_t srcNdx         = 0;
-    bool writeIndent      = true;
     const char *indentStr = getIndentStr(writer->xmlElementDepth);
 
     DE_ASSERT(writer && data && (numBytes > 0));
@@ -350,7 +262,7 @@ bool qpXmlWriter_writeBase64(qpXmlWriter *writer, const uint8_t *data, size_t nu
         uint8_t s0     = data[srcNdx];
         uint8_t s1     = (numRead >= 2) ? data[srcNdx + 1] : 0;
         uint8_t s2     = (numRead >= 3) ? data[srcNdx + 2] : 0;
-        char d[5];
+        char *d        = &line[lineLen];
 
         srcNdx += numRead;
 
@@ -358,37 +270,23 @@ bool qpXmlWriter_writeBase64(qpXmlWriter *writer, const uint8_t *data, size_t nu
         d[1] = s_base64Table[((s0 & 0x3) << 4) | (s1 >> 4)];
         d[2] = s_base64Table[((s1 & 0xF) << 2) | (s2 >> 6)];
         d[3] = s_base64Table[s2 & 0x3F];
-        d[4] = 0;
 
         if (numRead < 3)
             d[3] = '=';
         if (numRead < 2)
             d[2] = '=';
 
-        /* Write indent (if needed). */
-        if (writeIndent)
-        {
-            fprintf(writer->outputFile, "%s", indentStr);
-            writeIndent = false;
-        }
-
-        /* Write data. */
-        fprintf(writer->outputFile, "%s", &d[0]);
-
-        /* EOL every now and then. */
-        numWritten += 4;
-        if (numWritten >= 64)
+        /* Write whole lines at once. */
+        lineLen += 4;
+        if (lineLen >= (int)sizeof(line) || srcNdx == numBytes)
         {
-            fprintf(writer->outputFile, "\n");
-            numWritten  = 0;
-            writeIndent = true;
+            fputs(indentStr, writer->outputFile);
+            fwrite(line, 1, (size_t)lineLen, writer->outputFile);
+            fputc('\n', writer->outputFile);
+            lineLen = 0;
         }
     }
 
-    /* Last EOL. */
-    if (numWritten > 0)
-        fprintf(writer->outputFile, "\n");
-
     DE_ASSERT(srcNdx == numBytes);
     return true;
 }
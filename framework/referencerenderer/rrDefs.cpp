@@ -25,4 +25,14 @@
 
 namespace rr
 {
+
+const char *getSourceHash(void)
+{
+#if defined(RR_SOURCE_HASH)
+    return RR_SOURCE_HASH;
+#else
+    return "";
+#endif
+}
+
 } // namespace rr
@@ -54,6 +54,9 @@ enum ProvokingVertex
     PROVOKINGVERTEX_LAST, // \note valid value, "last vertex", not last of enum
 };
 
+//! Hash of the reference renderer sources, or an empty string if the build does not provide one.
+const char *getSourceHash(void);
+
 // \todo [pyry]
 //  - subpixel bits
 
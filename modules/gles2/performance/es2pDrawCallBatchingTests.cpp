@@ -31,16 +31,16 @@
 #include "glwEnums.hpp"
 
 #include "tcuTestLog.hpp"
+#include "tcuBenchmark.hpp"
 
 #include "deRandom.hpp"
 #include "deStringUtil.hpp"
+#include "deUniquePtr.hpp"
 
 #include "deFile.h"
 #include "deString.h"
-#include "deClock.h"
 #include "deThread.h"
 
-#include <cmath>
 #include <vector>
 #include <string>
 #include <sstream>
@@ -61,7 +61,6 @@ namespace Performance
 
 namespace
 {
-const int CALIBRATION_SAMPLE_COUNT = 34;
 
 class DrawCallBatchingTest : public tcu::TestCase
 {
@@ -93,9 +92,6 @@ private:
     enum State
     {
         STATE_LOG_INFO = 0,
-        STATE_WARMUP_BATCHED,
-        STATE_WARMUP_UNBATCHED,
-        STATE_CALC_CALIBRATION,
         STATE_SAMPLE
     };
 
@@ -103,10 +99,6 @@ private:
 
     glu::RenderContext &m_renderCtx;
     de::Random m_rnd;
-    int m_sampleIteration;
-
-    int m_unbatchedSampleCount;
-    int m_batchedSampleCount;
 
     TestSpec m_spec;
 
@@ -130,13 +122,16 @@ private:
     vector<GLuint> m_batchedDynamicBuffers;
     vector<vector<GLuint>> m_unbatchedDynamicBuffers;
 
-    vector<uint64_t> m_unbatchedSamplesUs;
-    vector<uint64_t> m_batchedSamplesUs;
+    tcu::WallClockTimingSource m_timingSource;
+    de::MovePtr<tcu::BenchmarkEngine> m_unbatchedBenchmark;
+    de::MovePtr<tcu::BenchmarkEngine> m_batchedBenchmark;
+    bool m_sampleUnbatched;
 
     void logTestInfo(void);
+    void logAndSetTestResult(void);
 
-    uint64_t renderUnbatched(void);
-    uint64_t renderBatched(void);
+    void renderUnbatched(tcu::BenchmarkEngine &benchmark);
+    void renderBatched(tcu::BenchmarkEngine &benchmark);
 
     void createIndexData(void);
     void createIndexBuffer(void);
@@ -152,14 +147,12 @@ DrawCallBatchingTest::DrawCallBatchingTest(Context &context, const char *name, c
     , m_state(STATE_LOG_INFO)
     , m_renderCtx(context.getRenderContext())
     , m_rnd(deStringHash(name))
-    , m_sampleIteration(0)
-    , m_unbatchedSampleCount(CALIBRATION_SAMPLE_COUNT)
-    , m_batchedSampleCount(CALIBRATION_SAMPLE_COUNT)
     , m_spec(spec)
     , m_program(NULL)
     , m_batchedDynamicIndexBuffer(0)
     , m_unbatchedStaticIndexBuffer(0)
     , m_batchedStaticIndexBuffer(0)
+    , m_sampleUnbatched(true)
 {
 }
 
@@ -497,6 +490,17 @@ void DrawCallBatchingTest::init(void)
         if (m_spec.useIndexBuffer)
             createIndexBuffer();
     }
+
+    {
+        tcu::BenchmarkParameters params;
+
+        // Each sample renders the whole fixed workload.
+        params.targetSampleTimeUs = 0.0f;
+
+        m_unbatchedBenchmark = de::MovePtr<tcu::BenchmarkEngine>(new tcu::BenchmarkEngine(m_timingSource, params));
+        m_batchedBenchmark   = de::MovePtr<tcu::BenchmarkEngine>(new tcu::BenchmarkEngine(m_timingSource, params));
+        m_sampleUnbatched    = true;
+    }
 }
 
 void DrawCallBatchingTest::deinit(void)
@@ -576,15 +580,13 @@ void DrawCallBatchingTest::deinit(void)
 
     m_unbatchedDynamicBuffers = vector<vector<GLuint>>();
 
-    m_unbatchedSamplesUs = vector<uint64_t>();
-    m_batchedSamplesUs   = vector<uint64_t>();
+    m_unbatchedBenchmark.clear();
+    m_batchedBenchmark.clear();
 }
 
-uint64_t DrawCallBatchingTest::renderUnbatched(void)
+void DrawCallBatchingTest::renderUnbatched(tcu::BenchmarkEngine &benchmark)
 {
     const glw::Functions &gl = m_renderCtx.getFunctions();
-    uint64_t beginUs         = 0;
-    uint64_t endUs           = 0;
     vector<GLint> dynamicAttributeLocations;
 
     gl.viewport(0, 0, 32, 32);
@@ -623,7 +625,7 @@ uint64_t DrawCallBatchingTest::renderUnbatched(void)
 
     gl.finish();
 
-    beginUs = deGetMicroseconds();
+    benchmark.beginSample();
 
     for (int drawNdx = 0; drawNdx < m_spec.drawCallCount; drawNdx++)
     {
@@ -668,7 +670,7 @@ uint64_t DrawCallBatchingTest::renderUnbatched(void)
 
     gl.finish();
 
-    endUs = deGetMicroseconds();
+    benchmark.endSample();
 
     GLU_EXPECT_NO_ERROR(gl.getError(), "Unbatched rendering failed");
 
@@ -684,15 +686,11 @@ uint64_t DrawCallBatchingTest::renderUnbatched(void)
         gl.disableVertexAttribArray(dynamicAttributeLocations[attribNdx]);
 
     GLU_EXPECT_NO_ERROR(gl.getError(), "Failed to reset state after unbatched rendering");
-
-    return endUs - beginUs;
 }
 
-uint64_t DrawCallBatchingTest::renderBatched(void)
+void DrawCallBatchingTest::renderBatched(tcu::BenchmarkEngine &benchmark)
 {
     const glw::Functions &gl = m_renderCtx.getFunctions();
-    uint64_t beginUs         = 0;
-    uint64_t endUs           = 0;
     vector<GLint> dynamicAttributeLocations;
 
     gl.viewport(0, 0, 32, 32);
@@ -731,7 +729,7 @@ uint64_t DrawCallBatchingTest::renderBatched(void)
 
     gl.finish();
 
-    beginUs = deGetMicroseconds();
+    benchmark.beginSample();
 
     for (int attribute = 0; attribute < m_spec.dynamicAttributeCount; attribute++)
     {
@@ -774,7 +772,7 @@ uint64_t DrawCallBatchingTest::renderBatched(void)
 
     gl.finish();
 
-    endUs = deGetMicroseconds();
+    benchmark.endSample();
 
     GLU_EXPECT_NO_ERROR(gl.getError(), "Batched rendering failed");
 
@@ -790,46 +788,6 @@ uint64_t DrawCallBatchingTest::renderBatched(void)
         gl.disableVertexAttribArray(dynamicAttributeLocations[attribNdx]);
 
     GLU_EXPECT_NO_ERROR(gl.getError(), "Failed to reset state after batched rendering");
-
-    return endUs - beginUs;
-}
-
-struct Statistics
-{
-    double mean;
-    double standardDeviation;
-    double standardErrorOfMean;
-};
-
-Statistics calculateStats(const vector<uint64_t> &samples)
-{
-    double mean = 0.0;
-
-    for (int i = 0; i < (int)samples.size(); i++)
-        mean += (double)samples[i];
-
-    mean /= (double)samples.size();
-
-    double standardDeviation = 0.0;
-
-    for (int i = 0; i < (int)samples.size(); i++)
-    {
-        double x = (double)samples[i];
-        standardDeviation += (x - mean) * (x - mean);
-    }
-
-    standardDeviation /= (double)samples.size();
-    standardDeviation = std::sqrt(standardDeviation);
-
-    double standardErrorOfMean = standardDeviation / std::sqrt((double)samples.size());
-
-    Statistics stats;
-
-    stats.mean                = mean;
-    stats.standardDeviation   = standardDeviation;
-    stats.standardErrorOfMean = standardErrorOfMean;
-
-    return stats;
 }
 
 void DrawCallBatchingTest::logTestInfo(void)
@@ -858,101 +816,49 @@ void DrawCallBatchingTest::logTestInfo(void)
         << " triangles per call." << TestLog::EndMessage;
 }
 
+void DrawCallBatchingTest::logAndSetTestResult(void)
+{
+    TestLog &log                             = m_testCtx.getLog();
+    const tcu::BenchmarkStatistics unbatched = m_unbatchedBenchmark->computeStatistics();
+    const tcu::BenchmarkStatistics batched   = m_batchedBenchmark->computeStatistics();
+
+    tcu::logBenchmarkResult(log, "Batched", "Batched rendering", *m_batchedBenchmark);
+    tcu::logBenchmarkResult(log, "Unbatched", "Unbatched rendering", *m_unbatchedBenchmark);
+
+    log << TestLog::Message << "Batched/Unbatched mean ratio: " << (batched.mean / unbatched.mean)
+        << TestLog::EndMessage;
+    log << TestLog::Message << "Batched/Unbatched median ratio: " << (batched.median / unbatched.median)
+        << TestLog::EndMessage;
+
+    m_testCtx.setTestResult(QP_TEST_RESULT_PASS, de::floatToString(batched.median / unbatched.median, 1).c_str());
+}
+
 tcu::TestCase::IterateResult DrawCallBatchingTest::iterate(void)
 {
     if (m_state == STATE_LOG_INFO)
     {
         logTestInfo();
-        m_state = STATE_WARMUP_BATCHED;
-    }
-    else if (m_state == STATE_WARMUP_BATCHED)
-    {
-        renderBatched();
-        m_state = STATE_WARMUP_UNBATCHED;
-    }
-    else if (m_state == STATE_WARMUP_UNBATCHED)
-    {
-        renderUnbatched();
         m_state = STATE_SAMPLE;
     }
     else if (m_state == STATE_SAMPLE)
     {
-        if ((int)m_unbatchedSamplesUs.size() < m_unbatchedSampleCount &&
-            ((double)m_unbatchedSamplesUs.size() / ((double)m_unbatchedSampleCount) <
-                 (double)m_batchedSamplesUs.size() / ((double)m_batchedSampleCount) ||
-             (int)m_batchedSamplesUs.size() >= m_batchedSampleCount))
-            m_unbatchedSamplesUs.push_back(renderUnbatched());
-        else if ((int)m_batchedSamplesUs.size() < m_batchedSampleCount)
-            m_batchedSamplesUs.push_back(renderBatched());
-        else
-            m_state = STATE_CALC_CALIBRATION;
-    }
-    else if (m_state == STATE_CALC_CALIBRATION)
-    {
-        TestLog &log = m_testCtx.getLog();
-
-        tcu::ScopedLogSection section(log, ("Sampling iteration " + de::toString(m_sampleIteration)).c_str(),
-                                      ("Sampling iteration " + de::toString(m_sampleIteration)).c_str());
-        const double targetSEM = 0.02;
-        const double limitSEM  = 0.025;
-
-        Statistics unbatchedStats = calculateStats(m_unbatchedSamplesUs);
-        Statistics batchedStats   = calculateStats(m_batchedSamplesUs);
-
-        log << TestLog::Message << "Batched samples; Count: " << m_batchedSamplesUs.size()
-            << ", Mean: " << batchedStats.mean << "us, Standard deviation: " << batchedStats.standardDeviation
-            << "us, Standard error of mean: " << batchedStats.standardErrorOfMean << "us("
-            << (batchedStats.standardErrorOfMean / batchedStats.mean) << ")" << TestLog::EndMessage;
-        log << TestLog::Message << "Unbatched samples; Count: " << m_unbatchedSamplesUs.size()
-            << ", Mean: " << unbatchedStats.mean << "us, Standard deviation: " << unbatchedStats.standardDeviation
-            << "us, Standard error of mean: " << unbatchedStats.standardErrorOfMean << "us("
-            << (unbatchedStats.standardErrorOfMean / unbatchedStats.mean) << ")" << TestLog::EndMessage;
-
-        if (m_sampleIteration > 2 ||
-            (m_sampleIteration > 0 && (unbatchedStats.standardErrorOfMean / unbatchedStats.mean) +
-                                              (batchedStats.standardErrorOfMean / batchedStats.mean) <=
-                                          2.0 * limitSEM))
+        if (m_unbatchedBenchmark->isFinished() && m_batchedBenchmark->isFinished())
         {
-            if (m_sampleIteration > 2)
-                log << TestLog::Message << "Maximum iteration count reached." << TestLog::EndMessage;
-
-            log << TestLog::Message << "Standard errors in target range." << TestLog::EndMessage;
-            log << TestLog::Message << "Batched/Unbatched ratio: " << (batchedStats.mean / unbatchedStats.mean)
-                << TestLog::EndMessage;
-
-            m_testCtx.setTestResult(QP_TEST_RESULT_PASS,
-                                    de::floatToString((float)(batchedStats.mean / unbatchedStats.mean), 1).c_str());
+            logAndSetTestResult();
             return STOP;
         }
-        else
-        {
-            if ((unbatchedStats.standardErrorOfMean / unbatchedStats.mean) > targetSEM)
-                log << TestLog::Message << "Unbatched standard error of mean outside of range." << TestLog::EndMessage;
-
-            if ((batchedStats.standardErrorOfMean / batchedStats.mean) > targetSEM)
-                log << TestLog::Message << "Batched standard error of mean outside of range." << TestLog::EndMessage;
 
-            if (unbatchedStats.standardDeviation > 0.0)
-            {
-                double x               = (unbatchedStats.standardDeviation / unbatchedStats.mean) / targetSEM;
-                m_unbatchedSampleCount = std::max((int)m_unbatchedSamplesUs.size(), (int)(x * x));
-            }
-            else
-                m_unbatchedSampleCount = (int)m_unbatchedSamplesUs.size();
+        // Interleave sampling to balance effects of power state etc.
+        {
+            const bool unbatched =
+                !m_unbatchedBenchmark->isFinished() && (m_sampleUnbatched || m_batchedBenchmark->isFinished());
 
-            if (batchedStats.standardDeviation > 0.0)
-            {
-                double x             = (batchedStats.standardDeviation / batchedStats.mean) / targetSEM;
-                m_batchedSampleCount = std::max((int)m_batchedSamplesUs.size(), (int)(x * x));
-            }
+            if (unbatched)
+                renderUnbatched(*m_unbatchedBenchmark);
             else
-                m_batchedSampleCount = (int)m_batchedSamplesUs.size();
-
-            m_batchedSamplesUs.clear();
-            m_unbatchedSamplesUs.clear();
+                renderBatched(*m_batchedBenchmark);
 
-            m_sampleIteration++;
-            m_state = STATE_SAMPLE;
+            m_sampleUnbatched = !unbatched;
         }
     }
     else
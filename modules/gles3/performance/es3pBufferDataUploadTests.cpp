@@ -24,6 +24,7 @@
 #include "es3pBufferDataUploadTests.hpp"
 #include "glsCalibration.hpp"
 #include "tcuTestLog.hpp"
+#include "tcuBenchmark.hpp"
 #include "tcuVectorUtil.hpp"
 #include "tcuSurface.hpp"
 #include "tcuCPUWarmup.hpp"
@@ -42,6 +43,7 @@
 #include "deMemory.h"
 #include "deThread.h"
 #include "deMeta.hpp"
+#include "deUniquePtr.hpp"
 
 #include <algorithm>
 #include <iomanip>
@@ -5073,6 +5075,7 @@ public:
 
 private:
     void init(void);
+    void deinit(void);
     IterateResult iterate(void);
     void logAndSetTestResult(void);
 
@@ -5082,21 +5085,27 @@ private:
     };
 
     const int m_numSamples;
-    int m_sampleNdx;
-    std::vector<int> m_samples;
+    tcu::WallClockTimingSource m_timingSource;
+    de::MovePtr<tcu::BenchmarkEngine> m_benchmark;
 };
 
 ReferenceReadPixelsTimeCase::ReferenceReadPixelsTimeCase(Context &context, const char *name, const char *description)
     : TestCase(context, tcu::NODETYPE_PERFORMANCE, name, description)
     , m_numSamples(20)
-    , m_sampleNdx(0)
-    , m_samples(m_numSamples)
 {
 }
 
 void ReferenceReadPixelsTimeCase::init(void)
 {
-    m_testCtx.getLog() << tcu::TestLog::Message << "Measuring the time used in a single readPixels call with "
+    tcu::BenchmarkParameters params;
+
+    // One sample is one readPixels call, the render it waits for is done outside of the sample.
+    params.targetSampleTimeUs = 0.0f;
+    params.minSamples         = m_numSamples;
+
+    m_benchmark = de::MovePtr<tcu::BenchmarkEngine>(new tcu::BenchmarkEngine(m_timingSource, params));
+
+    m_testCtx.getLog() << tcu::TestLog::Message << "Measuring the time used in a single readPixels call with at least "
                        << m_numSamples << " test samples.\n"
                        << "Test result is the median of the samples in microseconds.\n"
                        << "Note! Test result should only be used as a baseline reference result for "
@@ -5104,32 +5113,34 @@ void ReferenceReadPixelsTimeCase::init(void)
                        << tcu::TestLog::EndMessage;
 }
 
+void ReferenceReadPixelsTimeCase::deinit(void)
+{
+    m_benchmark.clear();
+}
+
 ReferenceReadPixelsTimeCase::IterateResult ReferenceReadPixelsTimeCase::iterate(void)
 {
     const glw::Functions &gl = m_context.getRenderContext().getFunctions();
+    const int sampleNdx      = (int)m_benchmark->getSamples().size() + m_benchmark->getNumWarmupSamples();
     tcu::Surface resultSurface(RENDER_AREA_SIZE, RENDER_AREA_SIZE);
-    uint64_t startTime;
-    uint64_t endTime;
 
     deYield();
     tcu::warmupCPU();
     deYield();
 
     // "Render" something and wait for it
-    gl.clearColor(0.0f, 1.0f, float(m_sampleNdx) / float(m_numSamples), 1.0f);
+    gl.clearColor(0.0f, 1.0f, float(sampleNdx % m_numSamples) / float(m_numSamples), 1.0f);
     gl.clear(GL_COLOR_BUFFER_BIT);
 
     // wait for results
     glu::readPixels(m_context.getRenderContext(), 0, 0, resultSurface.getAccess());
 
     // measure time used in readPixels
-    startTime = deGetMicroseconds();
+    m_benchmark->beginSample();
     glu::readPixels(m_context.getRenderContext(), 0, 0, resultSurface.getAccess());
-    endTime = deGetMicroseconds();
-
-    m_samples[m_sampleNdx] = (int)(endTime - startTime);
+    m_benchmark->endSample();
 
-    if (++m_sampleNdx < m_numSamples)
+    if (!m_benchmark->isFinished())
         return CONTINUE;
 
     logAndSetTestResult();
@@ -5138,37 +5149,11 @@ ReferenceReadPixelsTimeCase::IterateResult ReferenceReadPixelsTimeCase::iterate(
 
 void ReferenceReadPixelsTimeCase::logAndSetTestResult(void)
 {
-    // Log sample list
-    {
-        m_testCtx.getLog() << tcu::TestLog::SampleList("Samples", "Samples") << tcu::TestLog::SampleInfo
-                           << tcu::TestLog::ValueInfo("ReadTime", "ReadPixels time", "us", QP_SAMPLE_VALUE_TAG_RESPONSE)
-                           << tcu::TestLog::EndSampleInfo;
-
-        for (int sampleNdx = 0; sampleNdx < (int)m_samples.size(); ++sampleNdx)
-            m_testCtx.getLog() << tcu::TestLog::Sample << m_samples[sampleNdx] << tcu::TestLog::EndSample;
+    const tcu::BenchmarkStatistics stats = m_benchmark->computeStatistics();
 
-        m_testCtx.getLog() << tcu::TestLog::EndSampleList;
-    }
+    tcu::logBenchmarkResult(m_testCtx.getLog(), "Samples", "Samples", *m_benchmark);
 
-    // Log median
-    {
-        float median;
-        float limit60Low;
-        float limit60Up;
-
-        std::sort(m_samples.begin(), m_samples.end());
-        median     = linearSample(m_samples, 0.5f);
-        limit60Low = linearSample(m_samples, 0.2f);
-        limit60Up  = linearSample(m_samples, 0.8f);
-
-        m_testCtx.getLog() << tcu::TestLog::Float("Median", "Median", "us", QP_KEY_TAG_TIME, median)
-                           << tcu::TestLog::Message << "60 % of samples within range:\n"
-                           << tcu::TestLog::EndMessage
-                           << tcu::TestLog::Float("Low60Range", "Lower", "us", QP_KEY_TAG_TIME, limit60Low)
-                           << tcu::TestLog::Float("High60Range", "Upper", "us", QP_KEY_TAG_TIME, limit60Up);
-
-        m_testCtx.setTestResult(QP_TEST_RESULT_PASS, de::floatToString(median, 2).c_str());
-    }
+    m_testCtx.setTestResult(QP_TEST_RESULT_PASS, de::floatToString(stats.median, 2).c_str());
 }
 
 template <typename SampleType>
@@ -0,0 +1,77 @@
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program OpenGL (ES) Module
+ * -----------------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief GL timing sources for the benchmark engine.
+ *//*--------------------------------------------------------------------*/
+
+#include "glsBenchmark.hpp"
+
+#include "gluDefs.hpp"
+#include "gluRenderContext.hpp"
+
+#include "glwFunctions.hpp"
+#include "glwEnums.hpp"
+
+namespace deqp
+{
+namespace gls
+{
+
+TimerQueryTimingSource::TimerQueryTimingSource(const glu::RenderContext &renderCtx)
+    : m_gl(renderCtx.getFunctions())
+    , m_query(0)
+{
+    if (!isSupported(renderCtx))
+        throw tcu::NotSupportedError("GL_TIME_ELAPSED queries are not supported");
+
+    m_gl.genQueries(1, &m_query);
+    GLU_EXPECT_NO_ERROR(m_gl.getError(), "glGenQueries()");
+}
+
+TimerQueryTimingSource::~TimerQueryTimingSource(void)
+{
+    m_gl.deleteQueries(1, &m_query);
+}
+
+bool TimerQueryTimingSource::isSupported(const glu::RenderContext &renderCtx)
+{
+    // \note glw only loads glGetQueryObjectui64v() for desktop GL 3.3 and later.
+    return glu::contextSupports(renderCtx.getType(), glu::ApiType::core(3, 3));
+}
+
+void TimerQueryTimingSource::begin(void)
+{
+    m_gl.beginQuery(GL_TIME_ELAPSED, m_query);
+}
+
+bool TimerQueryTimingSource::end(uint64_t &elapsedUs)
+{
+    glw::GLuint64 elapsedNs = 0;
+
+    m_gl.endQuery(GL_TIME_ELAPSED);
+    m_gl.getQueryObjectui64v(m_query, GL_QUERY_RESULT, &elapsedNs);
+    GLU_EXPECT_NO_ERROR(m_gl.getError(), "Timer query");
+
+    elapsedUs = (uint64_t)elapsedNs / 1000u;
+    return true;
+}
+
+} // namespace gls
+} // namespace deqp
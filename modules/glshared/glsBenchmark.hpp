@@ -0,0 +1,72 @@
+#ifndef _GLSBENCHMARK_HPP
+#define _GLSBENCHMARK_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Quality Program OpenGL (ES) Module
+ * -----------------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief GL timing sources for the benchmark engine.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "tcuBenchmark.hpp"
+
+namespace glu
+{
+class RenderContext;
+}
+
+namespace glw
+{
+class Functions;
+}
+
+namespace deqp
+{
+namespace gls
+{
+
+// GPU time of the commands issued between begin() and end(). end() waits for the query result.
+class TimerQueryTimingSource : public tcu::TimingSource
+{
+public:
+    TimerQueryTimingSource(const glu::RenderContext &renderCtx);
+    ~TimerQueryTimingSource(void);
+
+    static bool isSupported(const glu::RenderContext &renderCtx);
+
+    const char *getName(void) const
+    {
+        return "TimerQuery";
+    }
+
+    void begin(void);
+    bool end(uint64_t &elapsedUs);
+
+private:
+    TimerQueryTimingSource(const TimerQueryTimingSource &);
+    TimerQueryTimingSource &operator=(const TimerQueryTimingSource &);
+
+    const glw::Functions &m_gl;
+    uint32_t m_query;
+};
+
+} // namespace gls
+} // namespace deqp
+
+#endif // _GLSBENCHMARK_HPP
@@ -42,6 +42,7 @@
 #include "tcuImageCompare.hpp"
 #include "tcuFloat.hpp"
 #include "tcuTextureUtil.hpp"
+#include "tcuReferenceCache.hpp"
 
 #include "gluContextInfo.hpp"
 #include "gluPixelTransfer.hpp"
@@ -50,7 +51,9 @@
 #include "sglrContext.hpp"
 #include "sglrReferenceContext.hpp"
 #include "sglrGLContext.hpp"
+#include "sglrAsyncContext.hpp"
 
+#include "rrDefs.hpp"
 #include "rrGenericVector.hpp"
 
 #include <cstring>
@@ -75,6 +78,10 @@ using namespace glw; // GL types
 
 const int MAX_RENDER_TARGET_SIZE = 512;
 
+//! Bump when reference rendering in this file or sglr changes so that stale cached reference images are not used.
+//! Changes to the reference renderer itself are detected through rr::getSourceHash().
+const uint32_t REFERENCE_CACHE_VERSION = 1;
+
 // Utils
 
 static GLenum targetToGL(DrawTestSpec::Target target)
@@ -1255,6 +1262,14 @@ inline GLValue::Half abs(GLValue::Half val)
     return GLValue::Half::create(std::fabs(val.to<float>()));
 }
 
+// Errors of calls recorded into an AsyncContext only show up once it has caught up with them, so checking them
+// after each call would report them against later calls. They are checked after reading back the reference instead.
+void expectNoError(sglr::Context &ctx, const char *msg)
+{
+    if (dynamic_cast<sglr::AsyncContext *>(&ctx) == DE_NULL)
+        GLU_EXPECT_NO_ERROR(ctx.getError(), msg);
+}
+
 // AttributeArray
 
 class AttributeArray
@@ -1349,7 +1364,7 @@ AttributeArray::AttributeArray(DrawTestSpec::Storage storage, sglr::Context &con
     if (m_storage == DrawTestSpec::STORAGE_BUFFER)
     {
         m_ctx.genBuffers(1, &m_glBuffer);
-        GLU_EXPECT_NO_ERROR(m_ctx.getError(), "glGenBuffers()");
+        expectNoError(m_ctx, "glGenBuffers()");
     }
 }
 
@@ -1358,7 +1373,7 @@ AttributeArray::~AttributeArray(void)
     if (m_storage == DrawTestSpec::STORAGE_BUFFER)
     {
         m_ctx.deleteBuffers(1, &m_glBuffer);
-        GLU_EXPECT_NO_ERROR(m_ctx.getError(), "glDeleteBuffers()");
+        expectNoError(m_ctx, "glDeleteBuffers()");
     }
     else if (m_storage == DrawTestSpec::STORAGE_USER)
         delete[] m_data;
@@ -1374,10 +1389,10 @@ void AttributeArray::data(DrawTestSpec::Target target, size_t size, const char *
     if (m_storage == DrawTestSpec::STORAGE_BUFFER)
     {
         m_ctx.bindBuffer(targetToGL(target), m_glBuffer);
-        GLU_EXPECT_NO_ERROR(m_ctx.getError(), "glBindBuffer()");
+        expectNoError(m_ctx, "glBindBuffer()");
 
         m_ctx.bufferData(targetToGL(target), size, ptr, usageToGL(usage));
-        GLU_EXPECT_NO_ERROR(m_ctx.getError(), "glBufferData()");
+        expectNoError(m_ctx, "glBufferData()");
     }
     else if (m_storage == DrawTestSpec::STORAGE_USER)
     {
@@ -1462,14 +1477,14 @@ void AttributeArray::bindAttribute(uint32_t loc)
         if (m_storage == DrawTestSpec::STORAGE_BUFFER)
         {
             m_ctx.bindBuffer(targetToGL(m_target), m_glBuffer);
-            GLU_EXPECT_NO_ERROR(m_ctx.getError(), "glBindBuffer()");
+            expectNoError(m_ctx, "glBindBuffer()");
 
             basePtr = DE_NULL;
         }
         else if (m_storage == DrawTestSpec::STORAGE_USER)
         {
             m_ctx.bindBuffer(targetToGL(m_target), 0);
-            GLU_EXPECT_NO_ERROR(m_ctx.getError(), "glBindBuffer()");
+            expectNoError(m_ctx, "glBindBuffer()");
 
             basePtr = (const uint8_t *)m_data;
         }
@@ -1489,14 +1504,14 @@ void AttributeArray::bindAttribute(uint32_t loc)
                 // Output type is float type
                 m_ctx.vertexAttribPointer(loc, size, inputTypeToGL(m_inputType), m_normalize, m_stride,
                                           basePtr + m_offset);
-                GLU_EXPECT_NO_ERROR(m_ctx.getError(), "glVertexAttribPointer()");
+                expectNoError(m_ctx, "glVertexAttribPointer()");
             }
             else
             {
                 // Output type is int type
                 m_ctx.vertexAttribIPointer(loc, m_componentCount, inputTypeToGL(m_inputType), m_stride,
                                            basePtr + m_offset);
-                GLU_EXPECT_NO_ERROR(m_ctx.getError(), "glVertexAttribIPointer()");
+                expectNoError(m_ctx, "glVertexAttribIPointer()");
             }
         }
         else
@@ -1508,7 +1523,7 @@ void AttributeArray::bindAttribute(uint32_t loc)
 
             m_ctx.vertexAttribPointer(loc, m_componentCount, inputTypeToGL(m_inputType), m_normalize, m_stride,
                                       basePtr + m_offset);
-            GLU_EXPECT_NO_ERROR(m_ctx.getError(), "glVertexAttribPointer()");
+            expectNoError(m_ctx, "glVertexAttribPointer()");
         }
 
         if (m_instanceDivisor)
@@ -2224,6 +2239,7 @@ public:
                 int vertexCount, DrawTestSpec::IndexType indexType, const void *indexOffset, int rangeStart,
                 int rangeEnd, int instanceCount, int indirectOffset, int baseVertex, float coordScale, float colorScale,
                 AttributeArray *indexArray);
+    void readSurface(void);
 
     const tcu::Surface &getSurface(void) const
     {
@@ -2320,7 +2336,7 @@ void AttributePack::render(DrawTestSpec::Primitive primitive, DrawTestSpec::Draw
     m_ctx.clear(GL_COLOR_BUFFER_BIT);
 
     m_ctx.useProgram(m_programID);
-    GLU_EXPECT_NO_ERROR(m_ctx.getError(), "glUseProgram()");
+    expectNoError(m_ctx, "glUseProgram()");
 
     m_ctx.uniform1f(m_ctx.getUniformLocation(m_programID, "u_coordScale"), coordScale);
     m_ctx.uniform1f(m_ctx.getUniformLocation(m_programID, "u_colorScale"), colorScale);
@@ -2341,7 +2357,7 @@ void AttributePack::render(DrawTestSpec::Primitive primitive, DrawTestSpec::Draw
         if (m_arrays[arrayNdx]->isBound())
         {
             m_ctx.enableVertexAttribArray(loc);
-            GLU_EXPECT_NO_ERROR(m_ctx.getError(), "glEnableVertexAttribArray()");
+            expectNoError(m_ctx, "glEnableVertexAttribArray()");
         }
 
         m_arrays[arrayNdx]->bindAttribute(loc);
@@ -2350,29 +2366,29 @@ void AttributePack::render(DrawTestSpec::Primitive primitive, DrawTestSpec::Draw
     if (drawMethod == DrawTestSpec::DRAWMETHOD_DRAWARRAYS)
     {
         m_ctx.drawArrays(primitiveToGL(primitive), firstVertex, vertexCount);
-        GLU_EXPECT_NO_ERROR(m_ctx.getError(), "glDrawArrays()");
+        expectNoError(m_ctx, "glDrawArrays()");
     }
     else if (drawMethod == DrawTestSpec::DRAWMETHOD_DRAWARRAYS_INSTANCED)
     {
         m_ctx.drawArraysInstanced(primitiveToGL(primitive), firstVertex, vertexCount, instanceCount);
-        GLU_EXPECT_NO_ERROR(m_ctx.getError(), "glDrawArraysInstanced()");
+        expectNoError(m_ctx, "glDrawArraysInstanced()");
     }
     else if (drawMethod == DrawTestSpec::DRAWMETHOD_DRAWELEMENTS)
     {
         m_ctx.drawElements(primitiveToGL(primitive), vertexCount, indexTypeToGL(indexType), indexOffset);
-        GLU_EXPECT_NO_ERROR(m_ctx.getError(), "glDrawElements()");
+        expectNoError(m_ctx, "glDrawElements()");
     }
     else if (drawMethod == DrawTestSpec::DRAWMETHOD_DRAWELEMENTS_RANGED)
     {
         m_ctx.drawRangeElements(primitiveToGL(primitive), rangeStart, rangeEnd, vertexCount, indexTypeToGL(indexType),
                                 indexOffset);
-        GLU_EXPECT_NO_ERROR(m_ctx.getError(), "glDrawRangeElements()");
+        expectNoError(m_ctx, "glDrawRangeElements()");
     }
     else if (drawMethod == DrawTestSpec::DRAWMETHOD_DRAWELEMENTS_INSTANCED)
     {
         m_ctx.drawElementsInstanced(primitiveToGL(primitive), vertexCount, indexTypeToGL(indexType), indexOffset,
                                     instanceCount);
-        GLU_EXPECT_NO_ERROR(m_ctx.getError(), "glDrawElementsInstanced()");
+        expectNoError(m_ctx, "glDrawElementsInstanced()");
     }
     else if (drawMethod == DrawTestSpec::DRAWMETHOD_DRAWARRAYS_INDIRECT)
     {
@@ -2410,10 +2426,10 @@ void AttributePack::render(DrawTestSpec::Primitive primitive, DrawTestSpec::Draw
         m_ctx.bufferData(GL_DRAW_INDIRECT_BUFFER, sizeof(DrawCommand) + indirectOffset, buffer, GL_STATIC_DRAW);
         delete[] buffer;
 
-        GLU_EXPECT_NO_ERROR(m_ctx.getError(), "Setup draw indirect buffer");
+        expectNoError(m_ctx, "Setup draw indirect buffer");
 
         m_ctx.drawArraysIndirect(primitiveToGL(primitive), glu::BufferOffsetAsPointer(indirectOffset));
-        GLU_EXPECT_NO_ERROR(m_ctx.getError(), "glDrawArraysIndirect()");
+        expectNoError(m_ctx, "glDrawArraysIndirect()");
 
         m_ctx.deleteBuffers(1, &indirectBuf);
     }
@@ -2461,11 +2477,11 @@ void AttributePack::render(DrawTestSpec::Primitive primitive, DrawTestSpec::Draw
         m_ctx.bufferData(GL_DRAW_INDIRECT_BUFFER, sizeof(DrawCommand) + indirectOffset, buffer, GL_STATIC_DRAW);
         delete[] buffer;
 
-        GLU_EXPECT_NO_ERROR(m_ctx.getError(), "Setup draw indirect buffer");
+        expectNoError(m_ctx, "Setup draw indirect buffer");
 
         m_ctx.drawElementsIndirect(primitiveToGL(primitive), indexTypeToGL(indexType),
                                    glu::BufferOffsetAsPointer(indirectOffset));
-        GLU_EXPECT_NO_ERROR(m_ctx.getError(), "glDrawArraysIndirect()");
+        expectNoError(m_ctx, "glDrawArraysIndirect()");
 
         m_ctx.deleteBuffers(1, &indirectBuf);
     }
@@ -2473,19 +2489,19 @@ void AttributePack::render(DrawTestSpec::Primitive primitive, DrawTestSpec::Draw
     {
         m_ctx.drawElementsBaseVertex(primitiveToGL(primitive), vertexCount, indexTypeToGL(indexType), indexOffset,
                                      baseVertex);
-        GLU_EXPECT_NO_ERROR(m_ctx.getError(), "glDrawElementsBaseVertex()");
+        expectNoError(m_ctx, "glDrawElementsBaseVertex()");
     }
     else if (drawMethod == DrawTestSpec::DRAWMETHOD_DRAWELEMENTS_INSTANCED_BASEVERTEX)
     {
         m_ctx.drawElementsInstancedBaseVertex(primitiveToGL(primitive), vertexCount, indexTypeToGL(indexType),
                                               indexOffset, instanceCount, baseVertex);
-        GLU_EXPECT_NO_ERROR(m_ctx.getError(), "glDrawElementsInstancedBaseVertex()");
+        expectNoError(m_ctx, "glDrawElementsInstancedBaseVertex()");
     }
     else if (drawMethod == DrawTestSpec::DRAWMETHOD_DRAWELEMENTS_RANGED_BASEVERTEX)
     {
         m_ctx.drawRangeElementsBaseVertex(primitiveToGL(primitive), rangeStart, rangeEnd, vertexCount,
                                           indexTypeToGL(indexType), indexOffset, baseVertex);
-        GLU_EXPECT_NO_ERROR(m_ctx.getError(), "glDrawRangeElementsBaseVertex()");
+        expectNoError(m_ctx, "glDrawRangeElementsBaseVertex()");
     }
     else
         DE_ASSERT(false);
@@ -2500,7 +2516,7 @@ void AttributePack::render(DrawTestSpec::Primitive primitive, DrawTestSpec::Draw
             uint32_t loc = m_ctx.getAttribLocation(m_programID, attribName.str().c_str());
 
             m_ctx.disableVertexAttribArray(loc);
-            GLU_EXPECT_NO_ERROR(m_ctx.getError(), "glDisableVertexAttribArray()");
+            expectNoError(m_ctx, "glDisableVertexAttribArray()");
         }
     }
 
@@ -2508,6 +2524,10 @@ void AttributePack::render(DrawTestSpec::Primitive primitive, DrawTestSpec::Draw
         m_ctx.bindVertexArray(0);
 
     m_ctx.useProgram(0);
+}
+
+void AttributePack::readSurface(void)
+{
     m_ctx.readPixels(m_screen, 0, 0, m_screen.getWidth(), m_screen.getHeight());
 }
 
@@ -3500,6 +3520,43 @@ static bool containsLineCases(const std::vector<DrawTestSpec> &m_specs)
     return false;
 }
 
+static void addSpecToReferenceKey(tcu::ReferenceCacheKey &key, const DrawTestSpec &spec)
+{
+    // Attribute and index data are generated from seeds derived from these, so the spec covers them too.
+    key.add(spec.apiType.getPacked())
+        .add(spec.primitive)
+        .add(spec.primitiveCount)
+        .add(spec.drawMethod)
+        .add(spec.indexType)
+        .add(spec.indexPointerOffset)
+        .add(spec.indexStorage)
+        .add(spec.first)
+        .add(spec.indexMin)
+        .add(spec.indexMax)
+        .add(spec.instanceCount)
+        .add(spec.indirectOffset)
+        .add(spec.baseVertex)
+        .add(spec.attribs.size());
+
+    for (size_t attribNdx = 0; attribNdx < spec.attribs.size(); attribNdx++)
+    {
+        const DrawTestSpec::AttributeSpec &attrib = spec.attribs[attribNdx];
+
+        key.add(attrib.inputType)
+            .add(attrib.outputType)
+            .add(attrib.storage)
+            .add(attrib.usage)
+            .add(attrib.componentCount)
+            .add(attrib.offset)
+            .add(attrib.stride)
+            .add(attrib.normalize)
+            .add(attrib.instanceDivisor)
+            .add(attrib.useDefaultAttribute)
+            .add(attrib.additionalPositionAttribute)
+            .add(attrib.bgraComponentOrder);
+    }
+}
+
 // DrawTest
 
 DrawTest::DrawTest(tcu::TestContext &testCtx, glu::RenderContext &renderCtx, const DrawTestSpec &spec, const char *name,
@@ -3509,6 +3566,7 @@ DrawTest::DrawTest(tcu::TestContext &testCtx, glu::RenderContext &renderCtx, con
     , m_contextInfo(DE_NULL)
     , m_refBuffers(DE_NULL)
     , m_refContext(DE_NULL)
+    , m_asyncRefContext(DE_NULL)
     , m_glesContext(DE_NULL)
     , m_glArrayPack(DE_NULL)
     , m_rrArrayPack(DE_NULL)
@@ -3517,6 +3575,7 @@ DrawTest::DrawTest(tcu::TestContext &testCtx, glu::RenderContext &renderCtx, con
     , m_maxDiffBlue(-1)
     , m_iteration(0)
     , m_result() // \note no per-iteration result logging (only one iteration)
+    , m_referenceFromCache(false)
 {
     addIteration(spec);
 }
@@ -3527,6 +3586,7 @@ DrawTest::DrawTest(tcu::TestContext &testCtx, glu::RenderContext &renderCtx, con
     , m_contextInfo(DE_NULL)
     , m_refBuffers(DE_NULL)
     , m_refContext(DE_NULL)
+    , m_asyncRefContext(DE_NULL)
     , m_glesContext(DE_NULL)
     , m_glArrayPack(DE_NULL)
     , m_rrArrayPack(DE_NULL)
@@ -3535,6 +3595,7 @@ DrawTest::DrawTest(tcu::TestContext &testCtx, glu::RenderContext &renderCtx, con
     , m_maxDiffBlue(-1)
     , m_iteration(0)
     , m_result(testCtx.getLog(), "Iteration result: ")
+    , m_referenceFromCache(false)
 {
 }
 
@@ -3603,10 +3664,11 @@ void DrawTest::init(void)
                                                      renderTargetWidth, renderTargetHeight, renderTargetSamples);
     m_refContext = new sglr::ReferenceContext(limits, m_refBuffers->getColorbuffer(), m_refBuffers->getDepthbuffer(),
                                               m_refBuffers->getStencilbuffer());
+    m_asyncRefContext = new sglr::AsyncContext(*m_refContext);
 
     m_glArrayPack = new AttributePack(m_testCtx, m_renderCtx, *m_glesContext,
                                       tcu::UVec2(renderTargetWidth, renderTargetHeight), useVao, true);
-    m_rrArrayPack = new AttributePack(m_testCtx, m_renderCtx, *m_refContext,
+    m_rrArrayPack = new AttributePack(m_testCtx, m_renderCtx, *m_asyncRefContext,
                                       tcu::UVec2(renderTargetWidth, renderTargetHeight), useVao, false);
 
     m_maxDiffRed =
@@ -3620,19 +3682,25 @@ void DrawTest::init(void)
 
 void DrawTest::deinit(void)
 {
+    // Reference draws recorded before iterate() threw may still read programs and arrays owned by the pack.
+    if (m_asyncRefContext)
+        m_asyncRefContext->synchronizeNoThrow();
+
     delete m_glArrayPack;
     delete m_rrArrayPack;
+    delete m_asyncRefContext;
     delete m_refBuffers;
     delete m_refContext;
     delete m_glesContext;
     delete m_contextInfo;
 
-    m_glArrayPack = DE_NULL;
-    m_rrArrayPack = DE_NULL;
-    m_refBuffers  = DE_NULL;
-    m_refContext  = DE_NULL;
-    m_glesContext = DE_NULL;
-    m_contextInfo = DE_NULL;
+    m_glArrayPack     = DE_NULL;
+    m_rrArrayPack     = DE_NULL;
+    m_asyncRefContext = DE_NULL;
+    m_refBuffers      = DE_NULL;
+    m_refContext      = DE_NULL;
+    m_glesContext     = DE_NULL;
+    m_contextInfo     = DE_NULL;
 }
 
 DrawTest::IterateResult DrawTest::iterate(void)
@@ -3695,6 +3763,9 @@ DrawTest::IterateResult DrawTest::iterate(void)
         m_testCtx.getLog() << TestLog::Message << spec.getMultilineDesc() << TestLog::EndMessage;
         m_testCtx.getLog() << TestLog::Message << TestLog::EndMessage; // extra line for clarity
 
+        // Reference image may be available from an earlier run
+        m_referenceFromCache = findCachedReference(spec);
+
         // Data
 
         m_glArrayPack->clearArrays();
@@ -3789,7 +3860,7 @@ DrawTest::IterateResult DrawTest::iterate(void)
                 const char *indexPointer = indexPointerBase + spec.indexPointerOffset;
 
                 de::UniquePtr<AttributeArray> glArray(new AttributeArray(spec.indexStorage, *m_glesContext));
-                de::UniquePtr<AttributeArray> rrArray(new AttributeArray(spec.indexStorage, *m_refContext));
+                de::UniquePtr<AttributeArray> rrArray(new AttributeArray(spec.indexStorage, *m_asyncRefContext));
 
                 try
                 {
@@ -3798,14 +3869,17 @@ DrawTest::IterateResult DrawTest::iterate(void)
                     rrArray->data(DrawTestSpec::TARGET_ELEMENT_ARRAY, indexArraySize, indexArray,
                                   DrawTestSpec::USAGE_STATIC_DRAW);
 
+                    // Reference is issued first so that it renders while GL renders.
+                    if (!m_referenceFromCache)
+                        m_rrArrayPack->render(spec.primitive, spec.drawMethod, 0, (int)primitiveElementCount,
+                                              spec.indexType, indexPointer, spec.indexMin, spec.indexMax,
+                                              spec.instanceCount, spec.indirectOffset, spec.baseVertex, coordScale,
+                                              colorScale, rrArray.get());
                     m_glArrayPack->render(spec.primitive, spec.drawMethod, 0, (int)primitiveElementCount,
                                           spec.indexType, indexPointer, spec.indexMin, spec.indexMax,
                                           spec.instanceCount, spec.indirectOffset, spec.baseVertex, coordScale,
                                           colorScale, glArray.get());
-                    m_rrArrayPack->render(spec.primitive, spec.drawMethod, 0, (int)primitiveElementCount,
-                                          spec.indexType, indexPointer, spec.indexMin, spec.indexMax,
-                                          spec.instanceCount, spec.indirectOffset, spec.baseVertex, coordScale,
-                                          colorScale, rrArray.get());
+                    m_glArrayPack->readSurface();
 
                     delete[] indexArray;
                     indexArray = NULL;
@@ -3818,13 +3892,15 @@ DrawTest::IterateResult DrawTest::iterate(void)
             }
             else
             {
+                if (!m_referenceFromCache)
+                    m_rrArrayPack->render(spec.primitive, spec.drawMethod, spec.first, (int)primitiveElementCount,
+                                          DrawTestSpec::INDEXTYPE_LAST, DE_NULL, 0, 0, spec.instanceCount,
+                                          spec.indirectOffset, 0, coordScale, colorScale, DE_NULL);
                 m_glArrayPack->render(spec.primitive, spec.drawMethod, spec.first, (int)primitiveElementCount,
                                       DrawTestSpec::INDEXTYPE_LAST, DE_NULL, 0, 0, spec.instanceCount,
                                       spec.indirectOffset, 0, coordScale, colorScale, DE_NULL);
+                m_glArrayPack->readSurface();
                 m_testCtx.touchWatchdog();
-                m_rrArrayPack->render(spec.primitive, spec.drawMethod, spec.first, (int)primitiveElementCount,
-                                      DrawTestSpec::INDEXTYPE_LAST, DE_NULL, 0, 0, spec.instanceCount,
-                                      spec.indirectOffset, 0, coordScale, colorScale, DE_NULL);
             }
         }
         catch (glu::Error &err)
@@ -3845,6 +3921,15 @@ DrawTest::IterateResult DrawTest::iterate(void)
     }
     else if (compareStep)
     {
+        if (!m_referenceFromCache)
+        {
+            // Wait for reference rendering.
+            m_rrArrayPack->readSurface();
+            GLU_EXPECT_NO_ERROR(m_asyncRefContext->getError(), "Reference rendering");
+
+            m_testCtx.getReferenceCache().insert(getReferenceCacheKey(spec), m_rrArrayPack->getSurface().getAccess());
+        }
+
         if (!compare(spec.primitive))
         {
             const DrawTestSpec::CompatibilityTestType ctype = spec.isCompatibilityTest();
@@ -4235,9 +4320,46 @@ static bool intersectionRelaxedLineImageCompare(tcu::TestLog &log, const char *i
     }
 }
 
+tcu::ReferenceCacheKey DrawTest::getReferenceCacheKey(const DrawTestSpec &spec) const
+{
+    const tcu::PixelBufferAccess colorBuffer = m_refBuffers->getColorbuffer().raw();
+    tcu::ReferenceCacheKey key(m_testCtx.getCurrentCasePath(), REFERENCE_CACHE_VERSION);
+
+    key.addString(rr::getSourceHash());
+    addSpecToReferenceKey(key, spec);
+
+    // Multisample buffers store samples in x, so size is (samples, width, height).
+    key.add(colorBuffer.getFormat().order)
+        .add(colorBuffer.getFormat().type)
+        .add(colorBuffer.getWidth())
+        .add(colorBuffer.getHeight())
+        .add(colorBuffer.getDepth());
+
+    return key;
+}
+
+bool DrawTest::findCachedReference(const DrawTestSpec &spec)
+{
+    tcu::ReferenceCache &cache = m_testCtx.getReferenceCache();
+    tcu::TextureLevel reference;
+
+    if (!cache.isEnabled() || !cache.find(getReferenceCacheKey(spec), reference))
+        return false;
+
+    if (reference.getFormat() != m_cachedReference.getAccess().getFormat() ||
+        reference.getWidth() != m_refBuffers->getColorbuffer().raw().getHeight() ||
+        reference.getHeight() != m_refBuffers->getColorbuffer().raw().getDepth())
+        return false;
+
+    m_cachedReference.setSize(reference.getWidth(), reference.getHeight());
+    tcu::copy(m_cachedReference.getAccess(), reference.getAccess());
+
+    return true;
+}
+
 bool DrawTest::compare(gls::DrawTestSpec::Primitive primitiveType)
 {
-    const tcu::Surface &ref    = m_rrArrayPack->getSurface();
+    const tcu::Surface &ref    = m_referenceFromCache ? m_cachedReference : m_rrArrayPack->getSurface();
     const tcu::Surface &screen = m_glArrayPack->getSurface();
 
     if (m_renderCtx.getRenderTarget().getNumSamples() > 1)
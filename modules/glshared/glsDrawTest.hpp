@@ -25,6 +25,8 @@
 
 #include "tcuTestCase.hpp"
 #include "tcuResultCollector.hpp"
+#include "tcuReferenceCache.hpp"
+#include "tcuSurface.hpp"
 #include "gluRenderContext.hpp"
 
 namespace glu
@@ -37,6 +39,7 @@ namespace sglr
 
 class ReferenceContextBuffers;
 class ReferenceContext;
+class AsyncContext;
 class Context;
 
 } // namespace sglr
@@ -266,6 +269,8 @@ private:
     IterateResult iterate(void);
 
     bool compare(gls::DrawTestSpec::Primitive primitiveType);
+    tcu::ReferenceCacheKey getReferenceCacheKey(const DrawTestSpec &spec) const;
+    bool findCachedReference(const DrawTestSpec &spec);
     float getCoordScale(const DrawTestSpec &spec) const;
     float getColorScale(const DrawTestSpec &spec) const;
 
@@ -274,6 +279,7 @@ private:
     glu::ContextInfo *m_contextInfo;
     sglr::ReferenceContextBuffers *m_refBuffers;
     sglr::ReferenceContext *m_refContext;
+    sglr::AsyncContext *m_asyncRefContext; //!< Renders reference on a worker thread while GL renders.
     sglr::Context *m_glesContext;
 
     AttributePack *m_glArrayPack;
@@ -287,6 +293,9 @@ private:
     std::vector<std::string> m_iteration_descriptions;
     int m_iteration;
     tcu::ResultCollector m_result;
+
+    bool m_referenceFromCache; //!< Reference of the current iteration was loaded from the reference cache.
+    tcu::Surface m_cachedReference;
 };
 
 } // namespace gls
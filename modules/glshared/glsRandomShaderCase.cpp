@@ -29,6 +29,7 @@
 #include "gluStrUtil.hpp"
 
 #include "tcuImageCompare.hpp"
+#include "tcuReferenceCache.hpp"
 #include "tcuTestLog.hpp"
 
 #include "deRandom.hpp"
@@ -54,6 +55,10 @@ namespace deqp
 namespace gls
 {
 
+//! Bump when reference rendering in rsg or the fixed textures in this file change so that stale cached reference
+//! images are not used.
+const uint32_t REFERENCE_CACHE_VERSION = 1;
+
 enum
 {
     VIEWPORT_WIDTH  = 64,
@@ -610,8 +615,32 @@ RandomShaderCase::IterateResult RandomShaderCase::iterate(void)
     glFlush();
     GLU_CHECK_MSG("Draw");
 
-    // Render reference while GPU is doing work
-    executor.execute(m_vertexShader, m_fragmentShader, m_uniforms);
+    // Render reference while GPU is doing work. Uniform values and the viewport are generated from the seed, so the
+    // program sources and the seed identify the reference image.
+    {
+        tcu::ReferenceCache &cache = m_testCtx.getReferenceCache();
+        tcu::ReferenceCacheKey key(m_testCtx.getCurrentCasePath(), REFERENCE_CACHE_VERSION);
+
+        key.addString(m_vertexShader.getSource())
+            .addString(m_fragmentShader.getSource())
+            .add(m_parameters.seed)
+            .add(m_gridWidth)
+            .add(m_gridHeight)
+            .add(viewportWidth)
+            .add(viewportHeight)
+            .add(hasAlpha);
+
+        for (size_t ndx = 0; ndx < tex2DBindings.size(); ndx++)
+            key.add(tex2DBindings[ndx].first);
+        for (size_t ndx = 0; ndx < texCubeBindings.size(); ndx++)
+            key.add(texCubeBindings[ndx].first);
+
+        if (!cache.isEnabled() || !cache.find(key, reference))
+        {
+            executor.execute(m_vertexShader, m_fragmentShader, m_uniforms);
+            cache.insert(key, reference.getAccess());
+        }
+    }
 
     if (rendered.getFormat().order != tcu::TextureFormat::RGBA ||
         rendered.getFormat().type != tcu::TextureFormat::UNORM_INT8)
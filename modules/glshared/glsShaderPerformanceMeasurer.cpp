@@ -27,7 +27,6 @@
 #include "tcuRenderTarget.hpp"
 #include "deStringUtil.hpp"
 #include "deMath.h"
-#include "deClock.h"
 
 #include "glwFunctions.hpp"
 #include "glwEnums.hpp"
@@ -126,8 +125,6 @@ ShaderPerformanceMeasurer::ShaderPerformanceMeasurer(const glu::RenderContext &r
     , m_viewportWidth(measureType == CASETYPE_VERTEX ? 32 : renderCtx.getRenderTarget().getWidth())
     , m_viewportHeight(measureType == CASETYPE_VERTEX ? 32 : renderCtx.getRenderTarget().getHeight())
     , m_state(STATE_UNINITIALIZED)
-    , m_isFirstIteration(false)
-    , m_prevRenderStartTime(0)
     , m_result(-1.0f, -1.0f)
     , m_indexBuffer(0)
     , m_vao(0)
@@ -140,8 +137,7 @@ void ShaderPerformanceMeasurer::logParameters(TestLog &log) const
         << TestLog::Message << "Viewport: " << m_viewportWidth << "x" << m_viewportHeight << TestLog::EndMessage;
 }
 
-void ShaderPerformanceMeasurer::init(uint32_t program, const vector<AttribSpec> &attributes,
-                                     int calibratorInitialNumCalls)
+void ShaderPerformanceMeasurer::init(uint32_t program, const vector<AttribSpec> &attributes, int initialNumCalls)
 {
     DE_ASSERT(m_state == STATE_UNINITIALIZED);
 
@@ -228,14 +224,25 @@ void ShaderPerformanceMeasurer::init(uint32_t program, const vector<AttribSpec>
     gl.useProgram(program);
     GLU_EXPECT_NO_ERROR(gl.getError(), "glUseProgram()");
 
-    m_state            = STATE_MEASURING;
-    m_isFirstIteration = true;
+    // Timer queries leave the CPU side of the draw calls out of the measurement.
+    if (TimerQueryTimingSource::isSupported(m_renderCtx))
+        m_timingSource = de::MovePtr<tcu::TimingSource>(new TimerQueryTimingSource(m_renderCtx));
+    else
+        m_timingSource = de::MovePtr<tcu::TimingSource>(new tcu::WallClockTimingSource());
+
+    {
+        tcu::BenchmarkParameters params;
+
+        // One benchmark iteration is one draw call. A sample is sized to about one 30Hz frame and
+        // measuring stops after a second of samples at the latest.
+        params.initialIterations  = de::max(1, initialNumCalls);
+        params.targetSampleTimeUs = 1000000.0f / 30.0f;
+        params.maxMeasureTimeUs   = 1000000.0f;
 
-    m_calibrator.clear(CalibratorParameters(calibratorInitialNumCalls, 10 /* calibrate iteration frames */,
-                                            2000.0f /* calibrate iteration shortcut threshold (ms) */,
-                                            16 /* max calibrate iterations */, 1000.0f / 30.0f /* frame time (ms) */,
-                                            1000.0f / 60.0f /* frame time cap (ms) */,
-                                            1000.0f /* target measure duration (ms) */));
+        m_benchmark = de::MovePtr<tcu::BenchmarkEngine>(new tcu::BenchmarkEngine(*m_timingSource, params));
+    }
+
+    m_state = STATE_MEASURING;
 }
 
 void ShaderPerformanceMeasurer::deinit(void)
@@ -260,6 +267,9 @@ void ShaderPerformanceMeasurer::deinit(void)
         m_attribBuffers.clear();
     }
 
+    m_benchmark.clear();
+    m_timingSource.clear();
+
     m_state = STATE_UNINITIALIZED;
 }
 
@@ -278,44 +288,27 @@ void ShaderPerformanceMeasurer::iterate(void)
 {
     DE_ASSERT(m_state == STATE_MEASURING);
 
-    uint64_t renderStartTime = deGetMicroseconds();
-    render(m_calibrator.getCallCount()); // Always render. This gives more stable performance behavior.
-
-    TheilSenCalibrator::State calibratorState = m_calibrator.getState();
+    const glw::Functions &gl = m_renderCtx.getFunctions();
 
-    if (calibratorState == TheilSenCalibrator::STATE_RECOMPUTE_PARAMS)
-    {
-        m_calibrator.recomputeParameters();
+    // Earlier work must not be included in the sample.
+    gl.finish();
 
-        m_isFirstIteration    = true;
-        m_prevRenderStartTime = renderStartTime;
-    }
-    else if (calibratorState == TheilSenCalibrator::STATE_MEASURE)
-    {
-        if (!m_isFirstIteration)
-            m_calibrator.recordIteration(renderStartTime - m_prevRenderStartTime);
+    m_benchmark->beginSample();
+    render(m_benchmark->getIterationCount());
+    gl.finish();
+    m_benchmark->endSample();
 
-        m_isFirstIteration    = false;
-        m_prevRenderStartTime = renderStartTime;
-    }
-    else
+    if (m_benchmark->isFinished())
     {
-        DE_ASSERT(calibratorState == TheilSenCalibrator::STATE_FINISHED);
-
-        GLU_EXPECT_NO_ERROR(m_renderCtx.getFunctions().getError(), "End of rendering");
-
-        const MeasureState &measureState = m_calibrator.getMeasureState();
+        GLU_EXPECT_NO_ERROR(gl.getError(), "End of rendering");
 
-        // Compute result.
-        uint64_t totalTime    = measureState.getTotalTime();
-        int numFrames         = (int)measureState.frameTimes.size();
-        int64_t numQuadGrids  = measureState.numDrawCalls * numFrames;
-        int64_t numPixels     = (int64_t)m_viewportWidth * (int64_t)m_viewportHeight * numQuadGrids;
-        int64_t numVertices   = (int64_t)getNumVertices(m_gridSizeX, m_gridSizeY) * numQuadGrids;
-        double mfragPerSecond = (double)numPixels / (double)totalTime;
-        double mvertPerSecond = (double)numVertices / (double)totalTime;
+        // Compute result from the median time of one draw call.
+        const tcu::BenchmarkStatistics stats = m_benchmark->computeStatistics();
+        const double numPixels               = (double)m_viewportWidth * (double)m_viewportHeight;
+        const double numVertices             = (double)getNumVertices(m_gridSizeX, m_gridSizeY);
+        const double drawCallTimeUs          = de::max((double)stats.median, 1e-6);
 
-        m_result = Result((float)mvertPerSecond, (float)mfragPerSecond);
+        m_result = Result((float)(numVertices / drawCallTimeUs), (float)(numPixels / drawCallTimeUs));
         m_state  = STATE_FINISHED;
     }
 }
@@ -324,27 +317,24 @@ void ShaderPerformanceMeasurer::logMeasurementInfo(TestLog &log) const
 {
     DE_ASSERT(m_state == STATE_FINISHED);
 
-    const MeasureState &measureState(m_calibrator.getMeasureState());
+    const vector<tcu::BenchmarkSample> &samples = m_benchmark->getSamples();
+    const float numPixels                       = (float)m_viewportWidth * (float)m_viewportHeight;
+    const float numVertices                     = (float)getNumVertices(m_gridSizeX, m_gridSizeY);
+    uint64_t totalTime                          = 0;
 
-    // Compute totals.
-    uint64_t totalTime     = measureState.getTotalTime();
-    int numFrames          = (int)measureState.frameTimes.size();
-    int64_t numQuadGrids   = measureState.numDrawCalls * numFrames;
-    int64_t numPixels      = (int64_t)m_viewportWidth * (int64_t)m_viewportHeight * numQuadGrids;
-    int64_t numVertices    = (int64_t)getNumVertices(m_gridSizeX, m_gridSizeY) * numQuadGrids;
-    double mfragPerSecond  = (double)numPixels / (double)totalTime;
-    double mvertPerSecond  = (double)numVertices / (double)totalTime;
-    double framesPerSecond = (double)numFrames / ((double)totalTime / 1000000.0);
+    for (size_t sampleNdx = 0; sampleNdx < samples.size(); sampleNdx++)
+        totalTime += samples[sampleNdx].durationUs;
 
-    logCalibrationInfo(log, m_calibrator);
+    tcu::logBenchmarkResult(log, "DrawCalls", "Time per draw call", *m_benchmark);
 
     log << TestLog::Float("FramesPerSecond", "Frames per second in measurement", "Frames/s", QP_KEY_TAG_PERFORMANCE,
-                          (float)framesPerSecond)
+                          (float)((double)samples.size() / ((double)de::max<uint64_t>(totalTime, 1) / 1000000.0)))
         << TestLog::Float("FragmentsPerVertices", "Vertex-fragment ratio", "Fragments/Vertices", QP_KEY_TAG_NONE,
-                          (float)numPixels / (float)numVertices)
+                          numPixels / numVertices)
         << TestLog::Float("FragmentPerf", "Fragment performance", "MPix/s", QP_KEY_TAG_PERFORMANCE,
-                          (float)mfragPerSecond)
-        << TestLog::Float("VertexPerf", "Vertex performance", "MVert/s", QP_KEY_TAG_PERFORMANCE, (float)mvertPerSecond);
+                          m_result.megaFragPerSec)
+        << TestLog::Float("VertexPerf", "Vertex performance", "MVert/s", QP_KEY_TAG_PERFORMANCE,
+                          m_result.megaVertPerSec);
 }
 
 void ShaderPerformanceMeasurer::setGridSize(int gridW, int gridH)
@@ -27,7 +27,8 @@
 #include "tcuTestCase.hpp"
 #include "tcuVector.hpp"
 #include "gluRenderContext.hpp"
-#include "glsCalibration.hpp"
+#include "glsBenchmark.hpp"
+#include "deUniquePtr.hpp"
 
 namespace deqp
 {
@@ -87,7 +88,7 @@ public:
         deinit();
     }
 
-    void init(uint32_t program, const std::vector<AttribSpec> &attributes, int calibratorInitialNumCalls);
+    void init(uint32_t program, const std::vector<AttribSpec> &attributes, int initialNumCalls);
     void deinit(void);
     void iterate(void);
 
@@ -126,7 +127,7 @@ public:
     int getFinalCallCount(void) const
     {
         DE_ASSERT(m_state == STATE_FINISHED);
-        return m_calibrator.getCallCount();
+        return m_benchmark->getIterationCount();
     }
 
 private:
@@ -148,10 +149,9 @@ private:
     int m_viewportHeight;
 
     State m_state;
-    bool m_isFirstIteration;
-    uint64_t m_prevRenderStartTime;
     Result m_result;
-    TheilSenCalibrator m_calibrator;
+    de::MovePtr<tcu::TimingSource> m_timingSource;
+    de::MovePtr<tcu::BenchmarkEngine> m_benchmark;
     uint32_t m_indexBuffer;
     std::vector<AttribSpec> m_attributes;
     std::vector<uint32_t> m_attribBuffers;
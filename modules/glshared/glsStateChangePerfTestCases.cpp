@@ -34,13 +34,14 @@
 
 #include "deStringUtil.hpp"
 
-#include "deClock.h"
-
 #include <vector>
 #include <algorithm>
 
 using std::string;
 using std::vector;
+using tcu::BenchmarkEngine;
+using tcu::BenchmarkParameters;
+using tcu::BenchmarkStatistics;
 using tcu::TestLog;
 using namespace glw;
 
@@ -52,54 +53,6 @@ namespace gls
 namespace
 {
 
-struct ResultStats
-{
-    double median;
-    double mean;
-    double variance;
-
-    uint64_t min;
-    uint64_t max;
-};
-
-ResultStats calculateStats(const vector<uint64_t> &values)
-{
-    ResultStats result = {0.0, 0.0, 0.0, 0xFFFFFFFFFFFFFFFFu, 0};
-
-    uint64_t sum = 0;
-
-    for (int i = 0; i < (int)values.size(); i++)
-        sum += values[i];
-
-    result.mean = ((double)sum) / (double)values.size();
-
-    for (int i = 0; i < (int)values.size(); i++)
-    {
-        const double val = (double)values[i];
-        result.variance += (val - result.mean) * (val - result.mean);
-    }
-
-    result.variance /= (double)values.size();
-
-    {
-        const int n = (int)(values.size() / 2);
-
-        vector<uint64_t> sortedValues = values;
-
-        std::sort(sortedValues.begin(), sortedValues.end());
-
-        result.median = (double)sortedValues[n];
-    }
-
-    for (int i = 0; i < (int)values.size(); i++)
-    {
-        result.min = std::min(result.min, values[i]);
-        result.max = std::max(result.max, values[i]);
-    }
-
-    return result;
-}
-
 void genIndices(vector<GLushort> &indices, int triangleCount)
 {
     indices.reserve(triangleCount * 3);
@@ -162,49 +115,6 @@ void genTextureData(vector<uint8_t> &data, int width, int height)
     }
 }
 
-double calculateVariance(const vector<uint64_t> &values, double avg)
-{
-    double sum = 0.0;
-
-    for (int valueNdx = 0; valueNdx < (int)values.size(); valueNdx++)
-    {
-        double value = (double)values[valueNdx];
-        sum += (value - avg) * (value - avg);
-    }
-
-    return sum / (double)values.size();
-}
-
-uint64_t findMin(const vector<uint64_t> &values)
-{
-    uint64_t min = ~0ull;
-
-    for (int valueNdx = 0; valueNdx < (int)values.size(); valueNdx++)
-        min = std::min(values[valueNdx], min);
-
-    return min;
-}
-
-uint64_t findMax(const vector<uint64_t> &values)
-{
-    uint64_t max = 0;
-
-    for (int valueNdx = 0; valueNdx < (int)values.size(); valueNdx++)
-        max = std::max(values[valueNdx], max);
-
-    return max;
-}
-
-uint64_t findMedian(const vector<uint64_t> &v)
-{
-    vector<uint64_t> values = v;
-    size_t n                = values.size() / 2;
-
-    std::nth_element(values.begin(), values.begin() + n, values.end());
-
-    return values[n];
-}
-
 } // namespace
 
 StateChangePerformanceCase::StateChangePerformanceCase(tcu::TestContext &testCtx, glu::RenderContext &renderCtx,
@@ -216,6 +126,7 @@ StateChangePerformanceCase::StateChangePerformanceCase(tcu::TestContext &testCtx
     , m_iterationCount(100)
     , m_callCount(drawCallCount)
     , m_triangleCount(triangleCount)
+    , m_sampleInterleaved(true)
 {
 }
 
@@ -226,8 +137,22 @@ StateChangePerformanceCase::~StateChangePerformanceCase(void)
 
 void StateChangePerformanceCase::init(void)
 {
+    TestLog &log = m_testCtx.getLog();
+    BenchmarkParameters params;
+
     if (m_drawType == DRAWTYPE_INDEXED_USER_PTR)
         genIndices(m_indices, m_triangleCount);
+
+    // Each sample renders the whole fixed workload.
+    params.targetSampleTimeUs = 0.0f;
+    params.maxSamples         = m_iterationCount;
+
+    m_interleavedBenchmark = de::MovePtr<BenchmarkEngine>(new BenchmarkEngine(m_timingSource, params));
+    m_batchedBenchmark     = de::MovePtr<BenchmarkEngine>(new BenchmarkEngine(m_timingSource, params));
+    m_sampleInterleaved    = true;
+
+    log << TestLog::Message << "Draw call count: " << m_callCount << TestLog::EndMessage;
+    log << TestLog::Message << "Per call triangle count: " << m_triangleCount << TestLog::EndMessage;
 }
 
 void StateChangePerformanceCase::requireIndexBuffers(int count)
@@ -487,8 +412,8 @@ void StateChangePerformanceCase::requireVertexArrays(int count)
 void StateChangePerformanceCase::deinit(void)
 {
     m_indices.clear();
-    m_interleavedResults.clear();
-    m_batchedResults.clear();
+    m_interleavedBenchmark.clear();
+    m_batchedBenchmark.clear();
 
     {
         const glw::Functions &gl = m_renderCtx.getFunctions();
@@ -546,94 +471,55 @@ void StateChangePerformanceCase::deinit(void)
 
 void StateChangePerformanceCase::logAndSetTestResult(void)
 {
-    TestLog &log = m_testCtx.getLog();
-
-    ResultStats interleaved = calculateStats(m_interleavedResults);
-    ResultStats batched     = calculateStats(m_batchedResults);
+    TestLog &log                          = m_testCtx.getLog();
+    const BenchmarkStatistics interleaved = m_interleavedBenchmark->computeStatistics();
+    const BenchmarkStatistics batched     = m_batchedBenchmark->computeStatistics();
 
-    log << TestLog::Message << "Interleaved mean: " << interleaved.mean << TestLog::EndMessage;
-    log << TestLog::Message << "Interleaved median: " << interleaved.median << TestLog::EndMessage;
-    log << TestLog::Message << "Interleaved variance: " << interleaved.variance << TestLog::EndMessage;
-    log << TestLog::Message << "Interleaved min: " << interleaved.min << TestLog::EndMessage;
-    log << TestLog::Message << "Interleaved max: " << interleaved.max << TestLog::EndMessage;
-
-    log << TestLog::Message << "Batched mean: " << batched.mean << TestLog::EndMessage;
-    log << TestLog::Message << "Batched median: " << batched.median << TestLog::EndMessage;
-    log << TestLog::Message << "Batched variance: " << batched.variance << TestLog::EndMessage;
-    log << TestLog::Message << "Batched min: " << batched.min << TestLog::EndMessage;
-    log << TestLog::Message << "Batched max: " << batched.max << TestLog::EndMessage;
+    tcu::logBenchmarkResult(log, "Interleaved", "Interleaved state changes", *m_interleavedBenchmark);
+    tcu::logBenchmarkResult(log, "Batched", "Batched state changes", *m_batchedBenchmark);
 
     log << TestLog::Message << "Batched/Interleaved mean ratio: " << (interleaved.mean / batched.mean)
         << TestLog::EndMessage;
     log << TestLog::Message << "Batched/Interleaved median ratio: " << (interleaved.median / batched.median)
         << TestLog::EndMessage;
 
-    m_testCtx.setTestResult(QP_TEST_RESULT_PASS,
-                            de::floatToString((float)(((double)interleaved.median) / batched.median), 2).c_str());
+    m_testCtx.setTestResult(QP_TEST_RESULT_PASS, de::floatToString(interleaved.median / batched.median, 2).c_str());
 }
 
 tcu::TestCase::IterateResult StateChangePerformanceCase::iterate(void)
 {
-    if (m_interleavedResults.empty() && m_batchedResults.empty())
+    if (m_interleavedBenchmark->isFinished() && m_batchedBenchmark->isFinished())
     {
-        TestLog &log = m_testCtx.getLog();
-
-        log << TestLog::Message << "Draw call count: " << m_callCount << TestLog::EndMessage;
-        log << TestLog::Message << "Per call triangle count: " << m_triangleCount << TestLog::EndMessage;
+        logAndSetTestResult();
+        return STOP;
     }
 
     // \note [mika] Interleave sampling to balance effects of powerstate etc.
-    if ((int)m_interleavedResults.size() < m_iterationCount && m_batchedResults.size() >= m_interleavedResults.size())
     {
-        const glw::Functions &gl = m_renderCtx.getFunctions();
-        uint64_t resBeginUs      = 0;
-        uint64_t resEndUs        = 0;
+        const bool interleaved =
+            !m_interleavedBenchmark->isFinished() && (m_sampleInterleaved || m_batchedBenchmark->isFinished());
+        BenchmarkEngine &benchmark = interleaved ? *m_interleavedBenchmark : *m_batchedBenchmark;
+        const glw::Functions &gl   = m_renderCtx.getFunctions();
 
         setupInitialState(gl);
         gl.finish();
         GLU_EXPECT_NO_ERROR(gl.getError(), "glFinish()");
 
-        // Render result
-        resBeginUs = deGetMicroseconds();
+        benchmark.beginSample();
 
-        renderTest(gl);
+        if (interleaved)
+            renderTest(gl);
+        else
+            renderReference(gl);
 
         gl.finish();
-        resEndUs = deGetMicroseconds();
+        benchmark.endSample();
         GLU_EXPECT_NO_ERROR(gl.getError(), "glFinish()");
 
-        m_interleavedResults.push_back(resEndUs - resBeginUs);
-
-        return CONTINUE;
+        m_sampleInterleaved = !interleaved;
     }
-    else if ((int)m_batchedResults.size() < m_iterationCount)
-    {
-        const glw::Functions &gl = m_renderCtx.getFunctions();
-        uint64_t refBeginUs      = 0;
-        uint64_t refEndUs        = 0;
-
-        setupInitialState(gl);
-        gl.finish();
-        GLU_EXPECT_NO_ERROR(gl.getError(), "glFinish()");
-
-        // Render reference
-        refBeginUs = deGetMicroseconds();
 
-        renderReference(gl);
-
-        gl.finish();
-        refEndUs = deGetMicroseconds();
-        GLU_EXPECT_NO_ERROR(gl.getError(), "glFinish()");
-
-        m_batchedResults.push_back(refEndUs - refBeginUs);
-
-        return CONTINUE;
-    }
-    else
-    {
-        logAndSetTestResult();
-        return STOP;
-    }
+    return CONTINUE;
 }
 
 void StateChangePerformanceCase::callDraw(const glw::Functions &gl)
@@ -662,6 +548,7 @@ StateChangeCallPerformanceCase::StateChangeCallPerformanceCase(tcu::TestContext
     , m_renderCtx(renderCtx)
     , m_iterationCount(100)
     , m_callCount(1000)
+    , m_sampleNdx(0)
 {
 }
 
@@ -669,69 +556,70 @@ StateChangeCallPerformanceCase::~StateChangeCallPerformanceCase(void)
 {
 }
 
-void StateChangeCallPerformanceCase::executeTest(void)
+void StateChangeCallPerformanceCase::init(void)
 {
-    const glw::Functions &gl = m_renderCtx.getFunctions();
-    uint64_t beginTimeUs     = 0;
-    uint64_t endTimeUs       = 0;
+    BenchmarkParameters params;
 
-    beginTimeUs = deGetMicroseconds();
+    // One benchmark iteration is one call.
+    params.initialIterations = m_callCount;
+    params.maxIterations     = 64 * m_callCount;
+    params.maxSamples        = m_iterationCount;
 
-    execCalls(gl, (int)m_results.size(), m_callCount);
+    // Calls are measured without waiting for the GPU, so the time other threads run on this core is only noise.
+    if (tcu::ThreadTimeTimingSource::isSupported())
+        m_timingSource = de::MovePtr<tcu::TimingSource>(new tcu::ThreadTimeTimingSource());
+    else
+        m_timingSource = de::MovePtr<tcu::TimingSource>(new tcu::WallClockTimingSource());
 
-    endTimeUs = deGetMicroseconds();
+    m_benchmark = de::MovePtr<BenchmarkEngine>(new BenchmarkEngine(*m_timingSource, params));
+    m_sampleNdx = 0;
+}
 
-    m_results.push_back(endTimeUs - beginTimeUs);
+void StateChangeCallPerformanceCase::deinit(void)
+{
+    m_benchmark.clear();
+    m_timingSource.clear();
 }
 
-void StateChangeCallPerformanceCase::logTestCase(void)
+void StateChangeCallPerformanceCase::executeTest(void)
 {
-    TestLog &log = m_testCtx.getLog();
+    const glw::Functions &gl = m_renderCtx.getFunctions();
+
+    m_benchmark->beginSample();
+
+    execCalls(gl, m_sampleNdx, m_benchmark->getIterationCount());
+
+    m_benchmark->endSample();
 
-    log << TestLog::Message << "Iteration count: " << m_iterationCount << TestLog::EndMessage;
-    log << TestLog::Message << "Per iteration call count: " << m_callCount << TestLog::EndMessage;
+    m_sampleNdx += 1;
 }
 
-double calculateAverage(const vector<uint64_t> &values)
+void StateChangeCallPerformanceCase::logTestCase(void)
 {
-    uint64_t sum = 0;
-
-    for (int valueNdx = 0; valueNdx < (int)values.size(); valueNdx++)
-        sum += values[valueNdx];
+    TestLog &log = m_testCtx.getLog();
 
-    return ((double)sum) / (double)values.size();
+    log << TestLog::Message << "Maximum sample count: " << m_iterationCount << TestLog::EndMessage;
+    log << TestLog::Message << "Initial per sample call count: " << m_callCount << TestLog::EndMessage;
 }
 
 void StateChangeCallPerformanceCase::logAndSetTestResult(void)
 {
-    TestLog &log = m_testCtx.getLog();
+    TestLog &log                    = m_testCtx.getLog();
+    const BenchmarkStatistics stats = m_benchmark->computeStatistics();
 
-    uint64_t minUs         = findMin(m_results);
-    uint64_t maxUs         = findMax(m_results);
-    uint64_t medianUs      = findMedian(m_results);
-    double avgIterationUs  = calculateAverage(m_results);
-    double avgCallUs       = avgIterationUs / m_callCount;
-    double varIteration    = calculateVariance(m_results, avgIterationUs);
-    double avgMedianCallUs = ((double)medianUs) / m_callCount;
-
-    log << TestLog::Message << "Min iteration time: " << minUs << "us" << TestLog::EndMessage;
-    log << TestLog::Message << "Max iteration time: " << maxUs << "us" << TestLog::EndMessage;
-    log << TestLog::Message << "Average iteration time: " << avgIterationUs << "us" << TestLog::EndMessage;
-    log << TestLog::Message << "Iteration variance time: " << varIteration << TestLog::EndMessage;
-    log << TestLog::Message << "Median iteration time: " << medianUs << "us" << TestLog::EndMessage;
-    log << TestLog::Message << "Average call time: " << avgCallUs << "us" << TestLog::EndMessage;
-    log << TestLog::Message << "Average call time for median iteration: " << avgMedianCallUs << "us"
-        << TestLog::EndMessage;
+    tcu::logBenchmarkResult(log, "Calls", "Time per call", *m_benchmark);
+
+    log << TestLog::Message << "Median call time: " << stats.median << "us" << TestLog::EndMessage;
 
-    m_testCtx.setTestResult(QP_TEST_RESULT_PASS, de::floatToString((float)avgMedianCallUs, 3).c_str());
+    m_testCtx.setTestResult(QP_TEST_RESULT_PASS, de::floatToString(stats.median, 3).c_str());
 }
 
 tcu::TestCase::IterateResult StateChangeCallPerformanceCase::iterate(void)
 {
-    if (m_results.empty())
+    if (m_sampleNdx == 0)
         logTestCase();
 
-    if ((int)m_results.size() < m_iterationCount)
+    if (!m_benchmark->isFinished())
     {
         executeTest();
         GLU_EXPECT_NO_ERROR(m_renderCtx.getFunctions().getError(), "Unexpected error");
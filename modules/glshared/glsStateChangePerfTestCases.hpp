@@ -25,6 +25,8 @@
 
 #include "tcuDefs.hpp"
 #include "tcuTestCase.hpp"
+#include "tcuBenchmark.hpp"
+#include "deUniquePtr.hpp"
 
 namespace glu
 {
@@ -83,7 +85,7 @@ protected:
     glu::RenderContext &m_renderCtx;
 
     const DrawType m_drawType;
-    const int m_iterationCount;
+    const int m_iterationCount; //!< Maximum number of measured samples per series.
     const int m_callCount;
     const int m_triangleCount;
 
@@ -102,8 +104,10 @@ private:
 
     std::vector<uint16_t> m_indices;
 
-    std::vector<uint64_t> m_interleavedResults;
-    std::vector<uint64_t> m_batchedResults;
+    tcu::WallClockTimingSource m_timingSource;
+    de::MovePtr<tcu::BenchmarkEngine> m_interleavedBenchmark;
+    de::MovePtr<tcu::BenchmarkEngine> m_batchedBenchmark;
+    bool m_sampleInterleaved;
 };
 
 class StateChangeCallPerformanceCase : public tcu::TestCase
@@ -113,6 +117,9 @@ public:
                                    const char *description);
     ~StateChangeCallPerformanceCase(void);
 
+    void init(void);
+    void deinit(void);
+
     IterateResult iterate(void);
 
     virtual void execCalls(const glw::Functions &gl, int iterNdx, int callCount) = 0;
@@ -125,10 +132,12 @@ private:
 
     glu::RenderContext &m_renderCtx;
 
-    const int m_iterationCount;
-    const int m_callCount;
+    const int m_iterationCount; //!< Maximum number of measured samples.
+    const int m_callCount;      //!< Initial number of calls per sample.
 
-    std::vector<uint64_t> m_results;
+    de::MovePtr<tcu::TimingSource> m_timingSource;
+    de::MovePtr<tcu::BenchmarkEngine> m_benchmark;
+    int m_sampleNdx;
 };
 
 } // namespace gls
@@ -41,6 +41,7 @@
 #include "sglrContext.hpp"
 #include "sglrReferenceContext.hpp"
 #include "sglrGLContext.hpp"
+#include "sglrAsyncContext.hpp"
 
 #include "deMath.h"
 #include "deStringUtil.hpp"
@@ -1166,6 +1167,10 @@ void ContextArrayPack::render(Array::Primitive primitive, int firstVertex, int v
 
     m_ctx.deleteProgram(program);
     m_ctx.useProgram(0);
+}
+
+void ContextArrayPack::readSurface(void)
+{
     m_ctx.readPixels(m_screen, 0, 0, m_screen.getWidth(), m_screen.getHeight());
 }
 
@@ -1737,6 +1742,7 @@ VertexArrayTest::VertexArrayTest(tcu::TestContext &testCtx, glu::RenderContext &
     , m_renderCtx(renderCtx)
     , m_refBuffers(DE_NULL)
     , m_refContext(DE_NULL)
+    , m_asyncRefContext(DE_NULL)
     , m_glesContext(DE_NULL)
     , m_glArrayPack(DE_NULL)
     , m_rrArrayPack(DE_NULL)
@@ -1769,24 +1775,31 @@ void VertexArrayTest::init(void)
                                                      renderTargetWidth, renderTargetHeight);
     m_refContext = new sglr::ReferenceContext(limits, m_refBuffers->getColorbuffer(), m_refBuffers->getDepthbuffer(),
                                               m_refBuffers->getStencilbuffer());
+    m_asyncRefContext = new sglr::AsyncContext(*m_refContext);
 
     m_glArrayPack = new ContextArrayPack(m_renderCtx, *m_glesContext);
-    m_rrArrayPack = new ContextArrayPack(m_renderCtx, *m_refContext);
+    m_rrArrayPack = new ContextArrayPack(m_renderCtx, *m_asyncRefContext);
 }
 
 void VertexArrayTest::deinit(void)
 {
+    // Reference draws recorded before iterate() threw may still read programs and arrays owned by the pack.
+    if (m_asyncRefContext)
+        m_asyncRefContext->synchronizeNoThrow();
+
     delete m_glArrayPack;
     delete m_rrArrayPack;
+    delete m_asyncRefContext;
     delete m_refBuffers;
     delete m_refContext;
     delete m_glesContext;
 
-    m_glArrayPack = DE_NULL;
-    m_rrArrayPack = DE_NULL;
-    m_refBuffers  = DE_NULL;
-    m_refContext  = DE_NULL;
-    m_glesContext = DE_NULL;
+    m_glArrayPack     = DE_NULL;
+    m_rrArrayPack     = DE_NULL;
+    m_asyncRefContext = DE_NULL;
+    m_refBuffers      = DE_NULL;
+    m_refContext      = DE_NULL;
+    m_glesContext     = DE_NULL;
 }
 
 void VertexArrayTest::compare(void)
@@ -2132,11 +2145,13 @@ MultiVertexArrayTest::IterateResult MultiVertexArrayTest::iterate(void)
 
         try
         {
+            // Reference is issued first so that it renders while GL renders.
+            m_rrArrayPack->render(m_spec.primitive, m_spec.first, m_spec.drawCount * (int)primitiveSize, useVao,
+                                  coordScale, colorScale);
             m_glArrayPack->render(m_spec.primitive, m_spec.first, m_spec.drawCount * (int)primitiveSize, useVao,
                                   coordScale, colorScale);
+            m_glArrayPack->readSurface();
             m_testCtx.touchWatchdog();
-            m_rrArrayPack->render(m_spec.primitive, m_spec.first, m_spec.drawCount * (int)primitiveSize, useVao,
-                                  coordScale, colorScale);
         }
         catch (glu::Error &err)
         {
@@ -2159,6 +2174,10 @@ MultiVertexArrayTest::IterateResult MultiVertexArrayTest::iterate(void)
     }
     else if (m_iteration == 1)
     {
+        // Wait for reference rendering.
+        m_rrArrayPack->readSurface();
+        GLU_EXPECT_NO_ERROR(m_asyncRefContext->getError(), "Reference rendering");
+
         compare();
 
         if (m_isOk)
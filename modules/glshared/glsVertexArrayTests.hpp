@@ -41,6 +41,7 @@ namespace sglr
 
 class ReferenceContextBuffers;
 class ReferenceContext;
+class AsyncContext;
 class Context;
 
 } // namespace sglr
@@ -260,6 +261,7 @@ public:
     virtual void newArray(Array::Storage storage);
     virtual void render(Array::Primitive primitive, int firstVertex, int vertexCount, bool useVao, float coordScale,
                         float colorScale);
+    void readSurface(void);
 
     const tcu::Surface &getSurface(void) const
     {
@@ -771,6 +773,7 @@ protected:
 
     sglr::ReferenceContextBuffers *m_refBuffers;
     sglr::ReferenceContext *m_refContext;
+    sglr::AsyncContext *m_asyncRefContext; //!< Renders reference on a worker thread while GL renders.
     sglr::Context *m_glesContext;
 
     ContextArrayPack *m_glArrayPack;
@@ -39,7 +39,9 @@
 
 // deutil
 #include "deTimerTest.h"
+#include "deClock.h"
 #include "deCommandLine.h"
+#include "deFile.h"
 
 // debase
 #include "deInt32.h"
@@ -55,12 +57,14 @@
 #include "deRingBuffer.hpp"
 #include "deSharedPtr.hpp"
 #include "deThreadSafeRingBuffer.hpp"
+#include "deThread.hpp"
 #include "deUniquePtr.hpp"
 #include "deRandom.hpp"
 #include "deCommandLine.hpp"
 #include "deArrayBuffer.hpp"
 #include "deStringUtil.hpp"
 #include "deSpinBarrier.hpp"
+#include "deTaskScheduler.hpp"
 #include "deSTLUtil.hpp"
 #include "deAppendList.hpp"
 
@@ -149,6 +153,7 @@ public:
     {
         addChild(new SelfCheckCase(m_testCtx, "timer", "deTimer_selfTest()", deTimer_selfTest));
         addChild(new SelfCheckCase(m_testCtx, "command_line", "deCommandLine_selfTest()", deCommandLine_selfTest));
+        addChild(new SelfCheckCase(m_testCtx, "file", "deFile_selfTest()", deFile_selfTest));
     }
 };
 
@@ -169,6 +174,125 @@ public:
     }
 };
 
+namespace
+{
+
+class RingBufferProducer : public de::Thread
+{
+public:
+    RingBufferProducer(de::ThreadSafeRingBuffer<uint32_t> &buffer, int numMessages)
+        : m_buffer(buffer)
+        , m_numMessages(numMessages)
+    {
+    }
+
+    void run(void)
+    {
+        for (int ndx = 0; ndx < m_numMessages; ndx++)
+            m_buffer.pushFront((uint32_t)ndx);
+    }
+
+private:
+    de::ThreadSafeRingBuffer<uint32_t> &m_buffer;
+    const int m_numMessages;
+};
+
+class RingBufferConsumer : public de::Thread
+{
+public:
+    RingBufferConsumer(de::ThreadSafeRingBuffer<uint32_t> &buffer) : m_buffer(buffer)
+    {
+    }
+
+    void run(void)
+    {
+        while (m_buffer.popBack() != ~0u)
+            ;
+    }
+
+private:
+    de::ThreadSafeRingBuffer<uint32_t> &m_buffer;
+};
+
+} // namespace
+
+class RingBufferThroughputCase : public tcu::TestCase
+{
+public:
+    RingBufferThroughputCase(tcu::TestContext &testCtx, const char *name, int numThreads)
+        : tcu::TestCase(testCtx, name, "de::ThreadSafeRingBuffer throughput")
+        , m_numThreads(numThreads)
+    {
+    }
+
+    IterateResult iterate(void)
+    {
+        const int numMessages = 1 << 20;
+        const int bufferSize  = 1024;
+        de::ThreadSafeRingBuffer<uint32_t> buffer(bufferSize);
+        std::vector<de::SharedPtr<de::Thread>> threads;
+        uint64_t startTime;
+        uint64_t elapsedTime;
+
+        for (int ndx = 0; ndx < m_numThreads; ndx++)
+            threads.push_back(de::SharedPtr<de::Thread>(new RingBufferConsumer(buffer)));
+
+        for (int ndx = 0; ndx < m_numThreads; ndx++)
+            threads.push_back(de::SharedPtr<de::Thread>(new RingBufferProducer(buffer, numMessages / m_numThreads)));
+
+        startTime = deGetMicroseconds();
+
+        for (size_t ndx = 0; ndx < threads.size(); ndx++)
+            threads[ndx]->start();
+
+        for (int ndx = 0; ndx < m_numThreads; ndx++)
+            threads[m_numThreads + ndx]->join();
+
+        for (int ndx = 0; ndx < m_numThreads; ndx++)
+            buffer.pushFront(~0u);
+
+        for (int ndx = 0; ndx < m_numThreads; ndx++)
+            threads[ndx]->join();
+
+        elapsedTime = de::max<uint64_t>(deGetMicroseconds() - startTime, 1);
+
+        {
+            const float messagesPerSecond = (float)numMessages / ((float)elapsedTime / 1e6f);
+
+            m_testCtx.getLog() << TestLog::Message << m_numThreads << " producers and " << m_numThreads
+                               << " consumers passed " << numMessages << " messages through a buffer of "
+                               << bufferSize << " elements in " << elapsedTime << " us" << TestLog::EndMessage
+                               << TestLog::Float("Throughput", "Throughput", "Messages/s", QP_KEY_TAG_PERFORMANCE,
+                                                 messagesPerSecond);
+
+            m_testCtx.setTestResult(QP_TEST_RESULT_PASS, de::floatToString(messagesPerSecond, 0).c_str());
+        }
+
+        return STOP;
+    }
+
+private:
+    const int m_numThreads;
+};
+
+class RingBufferThroughputTests : public tcu::TestCaseGroup
+{
+public:
+    RingBufferThroughputTests(tcu::TestContext &testCtx)
+        : tcu::TestCaseGroup(testCtx, "thread_safe_ring_buffer_throughput", "de::ThreadSafeRingBuffer benchmarks")
+    {
+    }
+
+    void init(void)
+    {
+        static const int s_numThreads[] = {1, 4, 16, 64};
+
+        for (int ndx = 0; ndx < DE_LENGTH_OF_ARRAY(s_numThreads); ndx++)
+            addChild(new RingBufferThroughputCase(m_testCtx, (de::toString(s_numThreads[ndx]) + "_threads").c_str(),
+                                                  s_numThreads[ndx]));
+    }
+};
+
 class DecppTests : public tcu::TestCaseGroup
 {
 public:
@@ -185,6 +309,7 @@ public:
         addChild(new SelfCheckCase(m_testCtx, "shared_ptr", "de::SharedPtr_selfTest()", de::SharedPtr_selfTest));
         addChild(new SelfCheckCase(m_testCtx, "thread_safe_ring_buffer", "de::ThreadSafeRingBuffer_selfTest()",
                                    de::ThreadSafeRingBuffer_selfTest));
+        addChild(new RingBufferThroughputTests(m_testCtx));
         addChild(new SelfCheckCase(m_testCtx, "unique_ptr", "de::UniquePtr_selfTest()", de::UniquePtr_selfTest));
         addChild(new SelfCheckCase(m_testCtx, "random", "de::Random_selfTest()", de::Random_selfTest));
         addChild(new SelfCheckCase(m_testCtx, "commandline", "de::cmdline::selfTest()", de::cmdline::selfTest));
@@ -193,6 +318,8 @@ public:
         addChild(new SelfCheckCase(m_testCtx, "spin_barrier", "de::SpinBarrier_selfTest()", de::SpinBarrier_selfTest));
         addChild(new SelfCheckCase(m_testCtx, "stl_util", "de::STLUtil_selfTest()", de::STLUtil_selfTest));
         addChild(new SelfCheckCase(m_testCtx, "append_list", "de::AppendList_selfTest()", de::AppendList_selfTest));
+        addChild(new SelfCheckCase(m_testCtx, "task_scheduler", "de::TaskScheduler_selfTest()",
+                                   de::TaskScheduler_selfTest));
     }
 };
 
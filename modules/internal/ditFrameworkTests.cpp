@@ -28,16 +28,28 @@
 
 #include "tcuFloatFormat.hpp"
 #include "tcuEither.hpp"
+#include "tcuBitstreamUtil.hpp"
+#include "tcuRasterizationVerifier.hpp"
+#include "tcuReferenceCache.hpp"
 #include "tcuTestLog.hpp"
 #include "tcuCommandLine.hpp"
+#include "tcuTestHierarchyIterator.hpp"
+#include "tcuTestPackage.hpp"
+#include "tcuTestTreeManifest.hpp"
 
 #include "rrRenderer.hpp"
+#include "sglrAsyncContext.hpp"
+#include "sglrReferenceContext.hpp"
+#include "sglrShaderProgram.hpp"
+#include "glwEnums.hpp"
 #include "tcuTextureUtil.hpp"
 #include "tcuVectorUtil.hpp"
 #include "tcuFloat.hpp"
+#include "tcuBenchmark.hpp"
 
 #include "deRandom.hpp"
 #include "deArrayUtil.hpp"
+#include "deStringUtil.hpp"
 
 #include <stdexcept>
 #include <cmath>
@@ -485,6 +497,257 @@ public:
     }
 };
 
+class WalkCase : public tcu::TestCase
+{
+public:
+    WalkCase(tcu::TestContext &testCtx, const std::string &name) : tcu::TestCase(testCtx, name.c_str(), "")
+    {
+    }
+
+    IterateResult iterate(void)
+    {
+        DE_ASSERT(false);
+        return STOP;
+    }
+};
+
+//! Group with content depending only on the name. Extended hierarchy has an extra case in g1.sub1.
+class WalkGroup : public tcu::TestCaseGroup
+{
+public:
+    WalkGroup(tcu::TestContext &testCtx, const std::string &name, bool extended)
+        : tcu::TestCaseGroup(testCtx, name.c_str(), "")
+        , m_extended(extended)
+    {
+    }
+
+    void init(void)
+    {
+        for (int subgroupNdx = 0; subgroupNdx < 2; subgroupNdx++)
+        {
+            de::MovePtr<tcu::TestCaseGroup> subgroup(
+                new tcu::TestCaseGroup(m_testCtx, ("sub" + de::toString(subgroupNdx)).c_str(), ""));
+
+            for (int caseNdx = 0; caseNdx < 3; caseNdx++)
+                subgroup->addChild(new WalkCase(m_testCtx, "case" + de::toString(caseNdx)));
+
+            if (m_extended && m_name == "g1" && subgroupNdx == 1)
+                subgroup->addChild(new WalkCase(m_testCtx, "extra"));
+
+            addChild(subgroup.release());
+        }
+    }
+
+private:
+    const bool m_extended;
+};
+
+tcu::TestCaseGroup *createWalkGroup(tcu::TestContext &testCtx, const std::string &name)
+{
+    return new WalkGroup(testCtx, name, false);
+}
+
+tcu::TestCaseGroup *createExtendedWalkGroup(tcu::TestContext &testCtx, const std::string &name)
+{
+    return new WalkGroup(testCtx, name, true);
+}
+
+class WalkPackage : public tcu::TestPackage
+{
+public:
+    WalkPackage(tcu::TestContext &testCtx, bool deferred, bool extended)
+        : tcu::TestPackage(testCtx, "walk", "")
+        , m_deferred(deferred)
+        , m_extended(extended)
+    {
+    }
+
+    void init(void)
+    {
+        static const char *const groupNames[] = {"g0", "g1", "g2"};
+
+        tcu::DeferredTestCaseGroup::CreateFunc createGroup = m_extended ? createExtendedWalkGroup : createWalkGroup;
+
+        for (int groupNdx = 0; groupNdx < DE_LENGTH_OF_ARRAY(groupNames); groupNdx++)
+        {
+            if (m_deferred)
+                addRootChild(groupNames[groupNdx], DE_NULL, createGroup);
+            else
+                addChild(createGroup(m_testCtx, groupNames[groupNdx]));
+        }
+    }
+
+    tcu::TestCaseExecutor *createExecutor(void) const
+    {
+        return DE_NULL;
+    }
+
+private:
+    const bool m_deferred;
+    const bool m_extended;
+};
+
+class WalkInflater : public tcu::TestHierarchyInflater
+{
+public:
+    void enterTestPackage(tcu::TestPackage *testPackage, vector<tcu::TestNode *> &children)
+    {
+        testPackage->init();
+        testPackage->getChildren(children);
+    }
+
+    void leaveTestPackage(tcu::TestPackage *testPackage)
+    {
+        testPackage->deinit();
+    }
+
+    void enterGroupNode(tcu::TestCaseGroup *testGroup, vector<tcu::TestNode *> &children)
+    {
+        testGroup->init();
+        testGroup->getChildren(children);
+    }
+
+    void leaveGroupNode(tcu::TestCaseGroup *testGroup)
+    {
+        testGroup->deinit();
+    }
+};
+
+string getWalkEvent(bool enter, const string &path, tcu::TestNodeType nodeType)
+{
+    return string(enter ? "enter " : "leave ") + path + " " + de::toString((int)nodeType);
+}
+
+vector<string> walkHierarchy(tcu::TestPackageRoot &root, const tcu::CaseListFilter &caseListFilter,
+                             const tcu::TestTreeManifest *manifest, bool &manifestMismatched)
+{
+    WalkInflater inflater;
+    tcu::TestHierarchyIterator iter(root, inflater, caseListFilter, manifest);
+    vector<string> events;
+
+    for (; iter.getState() != tcu::TestHierarchyIterator::STATE_FINISHED; iter.next())
+        events.push_back(getWalkEvent(iter.getState() == tcu::TestHierarchyIterator::STATE_ENTER_NODE,
+                                      iter.getNodePath(), iter.getNode()->getNodeType()));
+
+    manifestMismatched = iter.isManifestMismatched();
+
+    return events;
+}
+
+vector<string> walkManifest(const tcu::TestTreeManifest &manifest, const tcu::CaseListFilter &caseListFilter)
+{
+    tcu::TestTreeManifestIterator iter(manifest, caseListFilter);
+    vector<string> events;
+
+    for (; iter.getState() != tcu::TestTreeManifestIterator::STATE_FINISHED; iter.next())
+        events.push_back(getWalkEvent(iter.getState() == tcu::TestTreeManifestIterator::STATE_ENTER_NODE,
+                                      iter.getNodePath(), iter.getNodeType()));
+
+    return events;
+}
+
+//! Compares walks over deferred groups and over the manifest against the walk over eagerly created groups.
+class TestHierarchyWalkCase : public tcu::TestCase
+{
+public:
+    enum ManifestSource
+    {
+        MANIFEST_SOURCE_SAME = 0, //!< Manifest is built from the walked hierarchy.
+        MANIFEST_SOURCE_SMALLER,  //!< Walked hierarchy has a case the manifest does not have.
+        MANIFEST_SOURCE_LARGER,   //!< Manifest has a case the walked hierarchy does not have.
+
+        MANIFEST_SOURCE_LAST
+    };
+
+    TestHierarchyWalkCase(tcu::TestContext &testCtx, const char *name, ManifestSource manifestSource)
+        : tcu::TestCase(testCtx, name, "")
+        , m_manifestSource(manifestSource)
+    {
+    }
+
+    IterateResult iterate(void)
+    {
+        static const char *const filters[][2] = {
+            {DE_NULL, DE_NULL},
+            {"--deqp-caselist=walk.g0.sub0.case1\nwalk.g2.sub1.case2", DE_NULL},
+            {"--deqp-caselist=walk.g1.sub0.case0\nwalk.g1.sub1.extra", DE_NULL},
+            {"--deqp-fraction=1,3", DE_NULL},
+            {"--deqp-caselist=walk.g0.sub0.case0\nwalk.g1.sub1.extra\nwalk.g2.sub1.case1", "--deqp-fraction=0,2"},
+        };
+        const bool walkedExtended   = m_manifestSource == MANIFEST_SOURCE_SMALLER;
+        const bool manifestExtended = m_manifestSource == MANIFEST_SOURCE_LARGER;
+        TestLog &log                = m_testCtx.getLog();
+        tcu::TestPackageRoot eagerRoot(m_testCtx, vector<tcu::TestNode *>(
+                                                      1, new WalkPackage(m_testCtx, false, walkedExtended)));
+        tcu::TestPackageRoot deferredRoot(m_testCtx, vector<tcu::TestNode *>(
+                                                         1, new WalkPackage(m_testCtx, true, walkedExtended)));
+        tcu::TestPackageRoot manifestRoot(m_testCtx, vector<tcu::TestNode *>(
+                                                         1, new WalkPackage(m_testCtx, true, manifestExtended)));
+        const de::UniquePtr<tcu::TestTreeManifest> manifest(
+            tcu::TestTreeManifest::build(manifestRoot, m_testCtx).release());
+        bool allOk = true;
+
+        for (int filterNdx = 0; filterNdx < DE_LENGTH_OF_ARRAY(filters); filterNdx++)
+        {
+            vector<const char *> argv(1, "deqp");
+            tcu::CommandLine cmdLine;
+            de::MovePtr<tcu::CaseListFilter> filter;
+            bool mismatched = false;
+
+            for (int argNdx = 0; argNdx < DE_LENGTH_OF_ARRAY(filters[filterNdx]); argNdx++)
+            {
+                if (filters[filterNdx][argNdx])
+                    argv.push_back(filters[filterNdx][argNdx]);
+            }
+
+            TCU_CHECK(cmdLine.parse((int)argv.size(), &argv[0]));
+            filter = cmdLine.createCaseListFilter(m_testCtx.getArchive());
+
+            {
+                const vector<string> eagerEvents    = walkHierarchy(eagerRoot, *filter, DE_NULL, mismatched);
+                const vector<string> deferredEvents = walkHierarchy(deferredRoot, *filter, DE_NULL, mismatched);
+                const vector<string> prunedEvents   = walkHierarchy(deferredRoot, *filter, manifest.get(), mismatched);
+                bool ok                             = deferredEvents == eagerEvents && prunedEvents == eagerEvents;
+
+                // Manifest iterator can not see nodes missing from the manifest.
+                if (m_manifestSource == MANIFEST_SOURCE_SAME)
+                    ok = ok && !mismatched && walkManifest(*manifest, *filter) == eagerEvents;
+
+                log << TestLog::Message << "Filter " << filterNdx << ": " << eagerEvents.size() / 2
+                    << " nodes, manifest " << (mismatched ? "mismatched" : "matched") << ", "
+                    << (ok ? "walks match" : "walks differ") << TestLog::EndMessage;
+
+                allOk = allOk && ok;
+            }
+        }
+
+        m_testCtx.setTestResult(allOk ? QP_TEST_RESULT_PASS : QP_TEST_RESULT_FAIL,
+                                allOk ? "Pass" : "Walks differ");
+        return STOP;
+    }
+
+private:
+    const ManifestSource m_manifestSource;
+};
+
+class TestHierarchyTests : public tcu::TestCaseGroup
+{
+public:
+    TestHierarchyTests(tcu::TestContext &testCtx)
+        : tcu::TestCaseGroup(testCtx, "test_hierarchy", "Test hierarchy traversal tests")
+    {
+    }
+
+    void init(void)
+    {
+        addChild(new TestHierarchyWalkCase(m_testCtx, "walk", TestHierarchyWalkCase::MANIFEST_SOURCE_SAME));
+        addChild(
+            new TestHierarchyWalkCase(m_testCtx, "walk_added_case", TestHierarchyWalkCase::MANIFEST_SOURCE_SMALLER));
+        addChild(
+            new TestHierarchyWalkCase(m_testCtx, "walk_removed_case", TestHierarchyWalkCase::MANIFEST_SOURCE_LARGER));
+    }
+};
+
 inline uint32_t ulpDiff(float a, float b)
 {
     const uint32_t ab = tcu::Float32(a).bits();
@@ -806,6 +1069,178 @@ protected:
     vector<SubCase>::const_iterator m_caseIter;
 };
 
+class PositionColorShader : public sglr::ShaderProgram
+{
+public:
+    PositionColorShader(void)
+        : sglr::ShaderProgram(sglr::pdec::ShaderProgramDeclaration()
+                              << sglr::pdec::VertexAttribute("a_position", rr::GENERICVECTYPE_FLOAT)
+                              << sglr::pdec::VertexAttribute("a_color", rr::GENERICVECTYPE_FLOAT)
+                              << sglr::pdec::VertexToFragmentVarying(rr::GENERICVECTYPE_FLOAT)
+                              << sglr::pdec::FragmentOutput(rr::GENERICVECTYPE_FLOAT)
+                              << sglr::pdec::VertexSource("") << sglr::pdec::FragmentSource(""))
+    {
+    }
+
+    void shadeVertices(const rr::VertexAttrib *inputs, rr::VertexPacket *const *packets, const int numPackets) const
+    {
+        for (int packetNdx = 0; packetNdx < numPackets; ++packetNdx)
+        {
+            rr::VertexPacket &packet = *packets[packetNdx];
+
+            packet.position   = rr::readVertexAttribFloat(inputs[0], packet.instanceNdx, packet.vertexNdx);
+            packet.outputs[0] = rr::readVertexAttribFloat(inputs[1], packet.instanceNdx, packet.vertexNdx);
+        }
+    }
+
+    void shadeFragments(rr::FragmentPacket *packets, const int numPackets,
+                        const rr::FragmentShadingContext &context) const
+    {
+        for (int packetNdx = 0; packetNdx < numPackets; ++packetNdx)
+        {
+            for (int fragNdx = 0; fragNdx < 4; ++fragNdx)
+                rr::writeFragmentOutput(context, packetNdx, fragNdx, 0,
+                                        rr::readVarying<float>(packets[packetNdx], context, 0, fragNdx));
+        }
+    }
+};
+
+class AsyncContextTest : public tcu::TestCase
+{
+public:
+    AsyncContextTest(tcu::TestContext &testCtx)
+        : tcu::TestCase(testCtx, "async_context", "Compare sglr::AsyncContext against direct ReferenceContext")
+    {
+    }
+
+    IterateResult iterate(void)
+    {
+        const int width  = 64;
+        const int height = 64;
+        const sglr::ReferenceContextLimits limits;
+        sglr::ReferenceContextBuffers directBuffers(tcu::PixelFormat(8, 8, 8, 8), 24, 8, width, height);
+        sglr::ReferenceContextBuffers asyncBuffers(tcu::PixelFormat(8, 8, 8, 8), 24, 8, width, height);
+        sglr::ReferenceContext directCtx(limits, directBuffers.getColorbuffer(), directBuffers.getDepthbuffer(),
+                                         directBuffers.getStencilbuffer());
+        sglr::ReferenceContext wrappedCtx(limits, asyncBuffers.getColorbuffer(), asyncBuffers.getDepthbuffer(),
+                                          asyncBuffers.getStencilbuffer());
+        PositionColorShader directProgram;
+        PositionColorShader asyncProgram;
+        vector<tcu::Vec4> vertices;
+        vector<uint16_t> indices;
+        tcu::Surface directResult(width, height);
+        tcu::Surface asyncResult(width, height);
+        uint32_t directError = GL_NO_ERROR;
+        uint32_t asyncError  = GL_NO_ERROR;
+        int numFailedPixels  = 0;
+
+        {
+            de::Random rnd(0x4a51);
+
+            // Interleaved position and color, depth and alpha vary so depth test and blending matter.
+            for (int vtxNdx = 0; vtxNdx < 3 * 32; vtxNdx++)
+            {
+                vertices.push_back(tcu::Vec4(rnd.getFloat(-1.2f, 1.2f), rnd.getFloat(-1.2f, 1.2f),
+                                             rnd.getFloat(-1.0f, 1.0f), 1.0f));
+                vertices.push_back(
+                    tcu::Vec4(rnd.getFloat(), rnd.getFloat(), rnd.getFloat(), rnd.getFloat(0.25f, 1.0f)));
+            }
+
+            for (int ndx = 0; ndx < 3 * 48; ndx++)
+                indices.push_back((uint16_t)rnd.getInt(0, (int)vertices.size() / 2 - 1));
+        }
+
+        render(directCtx, directProgram, vertices, indices, directResult, directError);
+
+        {
+            sglr::AsyncContext asyncCtx(wrappedCtx);
+
+            render(asyncCtx, asyncProgram, vertices, indices, asyncResult, asyncError);
+        }
+
+        for (int y = 0; y < height; y++)
+            for (int x = 0; x < width; x++)
+                if (directResult.getPixel(x, y) != asyncResult.getPixel(x, y))
+                    numFailedPixels += 1;
+
+        m_testCtx.getLog() << TestLog::Image("DirectResult", "ReferenceContext result", directResult)
+                           << TestLog::Image("AsyncResult", "AsyncContext result", asyncResult);
+
+        if (numFailedPixels != 0)
+        {
+            m_testCtx.getLog() << TestLog::Message << "FAIL: " << numFailedPixels << " pixels differ"
+                               << TestLog::EndMessage;
+            m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Results differ");
+        }
+        else if (directError != asyncError)
+        {
+            m_testCtx.getLog() << TestLog::Message << "FAIL: Got error " << asyncError << ", expected " << directError
+                               << TestLog::EndMessage;
+            m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Errors differ");
+        }
+        else
+            m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+
+        return STOP;
+    }
+
+private:
+    static void render(sglr::Context &ctx, sglr::ShaderProgram &shader, const vector<tcu::Vec4> &vertices,
+                       const vector<uint16_t> &indices, tcu::Surface &result, uint32_t &error)
+    {
+        const int stride       = (int)(2 * sizeof(tcu::Vec4));
+        const int numVertices  = (int)vertices.size() / 2;
+        const uint32_t program = ctx.createProgram(&shader);
+        const int32_t posLoc   = ctx.getAttribLocation(program, "a_position");
+        const int32_t colorLoc = ctx.getAttribLocation(program, "a_color");
+        uint32_t buffers[2];
+
+        ctx.genBuffers(2, buffers);
+        ctx.bindBuffer(GL_ARRAY_BUFFER, buffers[0]);
+        ctx.bufferData(GL_ARRAY_BUFFER, (intptr_t)(vertices.size() * sizeof(tcu::Vec4)), &vertices[0],
+                       GL_STATIC_DRAW);
+        ctx.bindBuffer(GL_ELEMENT_ARRAY_BUFFER, buffers[1]);
+        ctx.bufferData(GL_ELEMENT_ARRAY_BUFFER, (intptr_t)(indices.size() * sizeof(uint16_t)), &indices[0],
+                       GL_STATIC_DRAW);
+
+        ctx.viewport(0, 0, ctx.getWidth(), ctx.getHeight());
+        ctx.clearColor(0.125f, 0.25f, 0.5f, 1.0f);
+        ctx.clearDepthf(1.0f);
+        ctx.clear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        ctx.useProgram(program);
+
+        // Recorded draws sourcing buffer objects.
+        ctx.enableVertexAttribArray(posLoc);
+        ctx.enableVertexAttribArray(colorLoc);
+        ctx.vertexAttribPointer(posLoc, 4, GL_FLOAT, false, stride, DE_NULL);
+        ctx.vertexAttribPointer(colorLoc, 4, GL_FLOAT, false, stride, (const void *)sizeof(tcu::Vec4));
+        ctx.enable(GL_BLEND);
+        ctx.blendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+        ctx.drawArrays(GL_TRIANGLES, 0, numVertices / 2);
+        ctx.enable(GL_DEPTH_TEST);
+        ctx.depthFunc(GL_LESS);
+        ctx.drawElements(GL_TRIANGLES, (int)indices.size(), GL_UNSIGNED_SHORT, DE_NULL);
+
+        // Recorded call generating an error; getError() does not wait for it in AsyncContext.
+        ctx.enableVertexAttribArray(~0u);
+
+        // Draw from client memory, which AsyncContext executes synchronously.
+        ctx.bindBuffer(GL_ARRAY_BUFFER, 0);
+        ctx.vertexAttribPointer(posLoc, 4, GL_FLOAT, false, stride, &vertices[0]);
+        ctx.vertexAttribPointer(colorLoc, 4, GL_FLOAT, false, stride, &vertices[1]);
+        ctx.disable(GL_DEPTH_TEST);
+        ctx.drawArrays(GL_TRIANGLES, numVertices / 2, numVertices / 2);
+
+        // Waits for the recorded calls, after which their errors are visible.
+        ctx.readPixels(result, 0, 0, ctx.getWidth(), ctx.getHeight());
+        error = ctx.getError();
+
+        ctx.useProgram(0);
+        ctx.deleteBuffers(2, buffers);
+        ctx.deleteProgram(program);
+    }
+};
+
 class CommonFrameworkTests : public tcu::TestCaseGroup
 {
 public:
@@ -819,6 +1254,14 @@ public:
         addChild(
             new SelfCheckCase(m_testCtx, "float_format", "tcu::FloatFormat_selfTest()", tcu::FloatFormat_selfTest));
         addChild(new SelfCheckCase(m_testCtx, "either", "tcu::Either_selfTest()", tcu::Either_selfTest));
+        addChild(new SelfCheckCase(m_testCtx, "reference_cache", "tcu::ReferenceCache_selfTest()",
+                                   tcu::ReferenceCache_selfTest));
+        addChild(new SelfCheckCase(m_testCtx, "rasterization_verifier", "tcu::RasterizationVerifier_selfTest()",
+                                   tcu::RasterizationVerifier_selfTest));
+        addChild(new SelfCheckCase(m_testCtx, "bitstream_util", "tcu::BitstreamUtil_selfTest()",
+                                   tcu::BitstreamUtil_selfTest));
+        addChild(new SelfCheckCase(m_testCtx, "benchmark", "tcu::BenchmarkEngine_selfTest()",
+                                   tcu::BenchmarkEngine_selfTest));
     }
 };
 
@@ -833,6 +1276,7 @@ public:
     void init(void)
     {
         addChild(new ConstantInterpolationTest(m_testCtx));
+        addChild(new AsyncContextTest(m_testCtx));
     }
 };
 
@@ -851,6 +1295,7 @@ void FrameworkTests::init(void)
 {
     addChild(new CommonFrameworkTests(m_testCtx));
     addChild(new CaseListParserTests(m_testCtx));
+    addChild(new TestHierarchyTests(m_testCtx));
     addChild(new ReferenceRendererTests(m_testCtx));
     addChild(createTextureFormatTests(m_testCtx));
     addChild(createAstcTests(m_testCtx));
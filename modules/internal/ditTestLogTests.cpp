@@ -23,8 +23,14 @@
 
 #include "ditTestLogTests.hpp"
 #include "tcuTestLog.hpp"
+#include "qpXmlWriter.h"
+#include "deRandom.hpp"
+#include "deStringUtil.hpp"
 
+#include <cstdio>
 #include <limits>
+#include <string>
+#include <vector>
 
 namespace dit
 {
@@ -66,6 +72,262 @@ public:
     }
 };
 
+// Previous qpXmlWriter output, escaping and encoding one character at a time.
+class ReferenceXmlWriter
+{
+public:
+    ReferenceXmlWriter(void) : m_depth(0), m_prevIsStartElement(false)
+    {
+    }
+
+    void startElement(const char *name, int numAttribs, const qpXmlAttribute *attribs)
+    {
+        closePending();
+        m_out += getIndent(m_depth) + "<" + name;
+
+        for (int ndx = 0; ndx < numAttribs; ndx++)
+        {
+            m_out += std::string(" ") + attribs[ndx].name + "=\"";
+
+            if (attribs[ndx].type == QP_XML_ATTRIBUTE_STRING)
+                writeEscaped(attribs[ndx].stringValue);
+            else if (attribs[ndx].type == QP_XML_ATTRIBUTE_INT)
+                writeEscaped(de::toString(attribs[ndx].intValue).c_str());
+            else
+                writeEscaped(attribs[ndx].boolValue ? "True" : "False");
+
+            m_out += "\"";
+        }
+
+        m_depth += 1;
+        m_prevIsStartElement = true;
+    }
+
+    void endElement(const char *name)
+    {
+        m_depth -= 1;
+
+        if (m_prevIsStartElement)
+        {
+            m_out += " />\n";
+            m_prevIsStartElement = false;
+        }
+        else
+            m_out += std::string("</") + name + ">\n";
+    }
+
+    void writeString(const char *str)
+    {
+        if (m_prevIsStartElement)
+        {
+            m_out += ">";
+            m_prevIsStartElement = false;
+        }
+
+        writeEscaped(str);
+    }
+
+    void writeBase64(const uint8_t *data, size_t numBytes)
+    {
+        static const char s_base64Table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+        int numWritten                    = 0;
+
+        closePending();
+
+        for (size_t srcNdx = 0; srcNdx < numBytes; srcNdx += 3)
+        {
+            const size_t numRead = de::min<size_t>(3, numBytes - srcNdx);
+            const uint8_t s0     = data[srcNdx];
+            const uint8_t s1     = (numRead >= 2) ? data[srcNdx + 1] : 0;
+            const uint8_t s2     = (numRead >= 3) ? data[srcNdx + 2] : 0;
+
+            if (numWritten == 0)
+                m_out += getIndent(m_depth);
+
+            m_out += s_base64Table[s0 >> 2];
+            m_out += s_base64Table[((s0 & 0x3) << 4) | (s1 >> 4)];
+            m_out += (numRead < 2) ? '=' : s_base64Table[((s1 & 0xF) << 2) | (s2 >> 6)];
+            m_out += (numRead < 3) ? '=' : s_base64Table[s2 & 0x3F];
+
+            numWritten += 4;
+            if (numWritten >= 64)
+            {
+                m_out += "\n";
+                numWritten = 0;
+            }
+        }
+
+        if (numWritten > 0)
+            m_out += "\n";
+    }
+
+    void endDocument(void)
+    {
+        closePending();
+    }
+
+    const std::string &getOutput(void) const
+    {
+        return m_out;
+    }
+
+private:
+    static std::string getIndent(int depth)
+    {
+        return std::string((size_t)de::min(depth, 32), ' ');
+    }
+
+    void closePending(void)
+    {
+        if (m_prevIsStartElement)
+        {
+            m_out += ">\n";
+            m_prevIsStartElement = false;
+        }
+    }
+
+    void writeEscaped(const char *str)
+    {
+        static const char *const s_controlNames[] = {"",    "SOH", "STX", "ETX", "EOT", "ENQ", "ACK", "BEL",
+                                                     "BS",  "",    "",    "VT",  "FF",  "",    "SO",  "SI",
+                                                     "DLE", "DC1", "DC2", "DC3", "DC4", "NAK", "SYN", "ETB",
+                                                     "CAN", "EM",  "SUB", "ESC", "FS",  "GS",  "RS",  "US"};
+
+        for (const char *s = str; *s; s++)
+        {
+            const unsigned char c = (unsigned char)*s;
+
+            if (c == '<')
+                m_out += "&lt;";
+            else if (c == '>')
+                m_out += "&gt;";
+            else if (c == '&')
+                m_out += "&amp;";
+            else if (c == '\'')
+                m_out += "&apos;";
+            else if (c == '"')
+                m_out += "&quot;";
+            else if (c < 32 && c != '\t' && c != '\n' && c != '\r')
+                m_out += std::string("&lt;") + s_controlNames[c] + "&gt;";
+            else
+                m_out += (char)c;
+        }
+    }
+
+    std::string m_out;
+    int m_depth;
+    bool m_prevIsStartElement;
+};
+
+class XmlWriterOutputCase : public tcu::TestCase
+{
+public:
+    XmlWriterOutputCase(tcu::TestContext &testCtx)
+        : TestCase(testCtx, "xml_writer_output", "Compare XML writer output to per-character reference")
+    {
+    }
+
+    IterateResult iterate(void)
+    {
+        de::Random rnd(0x7a1c3);
+        FILE *file = tmpfile();
+        std::string output;
+        ReferenceXmlWriter reference;
+
+        if (!file)
+            throw tcu::ResourceError("Failed to create temporary file");
+
+        {
+            qpXmlWriter *const writer = qpXmlWriter_createFileWriter(file, false, false);
+
+            TCU_CHECK(writer && qpXmlWriter_startDocument(writer, false));
+
+            for (int elementNdx = 0; elementNdx < 200; elementNdx++)
+            {
+                const std::string name         = "Element" + de::toString(elementNdx);
+                const std::string attr         = generateString(rnd, elementNdx);
+                const std::string text         = generateString(rnd, elementNdx * 7);
+                const qpXmlAttribute attribs[] = {qpSetStringAttrib("Name", attr.c_str()),
+                                                  qpSetIntAttrib("Index", elementNdx * (rnd.getBool() ? 1 : -1)),
+                                                  qpSetBoolAttrib("Flag", rnd.getBool())};
+                std::vector<uint8_t> data((size_t)elementNdx + 1);
+
+                for (size_t ndx = 0; ndx < data.size(); ndx++)
+                    data[ndx] = rnd.getUint8();
+
+                TCU_CHECK(qpXmlWriter_startElement(writer, name.c_str(), DE_LENGTH_OF_ARRAY(attribs), attribs));
+                reference.startElement(name.c_str(), DE_LENGTH_OF_ARRAY(attribs), attribs);
+
+                if (elementNdx % 3 == 0)
+                {
+                    TCU_CHECK(qpXmlWriter_writeBase64(writer, data.data(), data.size()));
+                    reference.writeBase64(data.data(), data.size());
+                }
+                else if (elementNdx % 3 == 1)
+                {
+                    TCU_CHECK(qpXmlWriter_writeString(writer, text.c_str()));
+                    reference.writeString(text.c_str());
+                }
+
+                TCU_CHECK(qpXmlWriter_endElement(writer, name.c_str()));
+                reference.endElement(name.c_str());
+            }
+
+            TCU_CHECK(qpXmlWriter_endDocument(writer));
+            reference.endDocument();
+            qpXmlWriter_destroy(writer);
+        }
+
+        {
+            char buf[4096];
+            size_t numRead;
+
+            rewind(file);
+            while ((numRead = fread(buf, 1, sizeof(buf), file)) > 0)
+                output.append(buf, numRead);
+
+            fclose(file);
+        }
+
+        if (output == reference.getOutput())
+            m_testCtx.setTestResult(QP_TEST_RESULT_PASS, "Pass");
+        else
+        {
+            const std::string &expected = reference.getOutput();
+            size_t mismatchNdx          = 0;
+
+            while (mismatchNdx < output.size() && mismatchNdx < expected.size() &&
+                   output[mismatchNdx] == expected[mismatchNdx])
+                mismatchNdx++;
+
+            m_testCtx.getLog() << TestLog::Message << "Output differs from reference at byte " << mismatchNdx
+                               << " of " << output.size() << " (reference has " << expected.size() << " bytes)"
+                               << TestLog::EndMessage;
+            m_testCtx.setTestResult(QP_TEST_RESULT_FAIL, "Output differs from reference");
+        }
+
+        return STOP;
+    }
+
+private:
+    // Mix of plain runs and characters that must be escaped, including runs longer than old write buffer.
+    static std::string generateString(de::Random &rnd, int maxLength)
+    {
+        const int length = rnd.getInt(0, maxLength);
+        std::string str;
+
+        for (int ndx = 0; ndx < length; ndx++)
+        {
+            if (rnd.getFloat() < 0.8f)
+                str += (char)rnd.getInt('a', 'z');
+            else
+                str += (char)rnd.getInt(1, 255);
+        }
+
+        return str;
+    }
+};
+
 TestLogTests::TestLogTests(tcu::TestContext &testCtx) : TestCaseGroup(testCtx, "testlog", "Test Log Tests")
 {
 }
@@ -77,6 +339,7 @@ TestLogTests::~TestLogTests(void)
 void TestLogTests::init(void)
 {
     addChild(new BasicSampleListCase(m_testCtx));
+    addChild(new XmlWriterOutputCase(m_testCtx));
 }
 
 } // namespace dit
@@ -0,0 +1,217 @@
+/*-------------------------------------------------------------------------
+ * drawElements Internal Benchmark Module
+ * --------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Base class for framework microbenchmarks.
+ *//*--------------------------------------------------------------------*/
+
+#include "ditpBenchmarkCase.hpp"
+#include "tcuTestLog.hpp"
+#include "tcuCPUWarmup.hpp"
+
+#include "deClock.h"
+#include "deMath.h"
+#include "deStringUtil.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace ditp
+{
+
+using tcu::TestLog;
+using std::vector;
+
+namespace
+{
+
+enum
+{
+    WARMUP_DURATION_US        = 20000, //!< Minimum time spent running warm-up iterations.
+    MIN_WARMUP_ITERATIONS     = 2,
+    MIN_SAMPLE_DURATION_US    = 2000, //!< Samples are sized to take at least this long.
+    MAX_ITERATIONS_PER_SAMPLE = 1 << 20,
+    NUM_SAMPLES               = 25
+};
+
+struct Sample
+{
+    int numIterations;
+    uint64_t duration;
+};
+
+struct Statistics
+{
+    double minTime;
+    double medianTime;
+    double meanTime;
+    double maxTime;
+    double stdDevTime;
+};
+
+Statistics computePerIterationStatistics(const vector<Sample> &samples)
+{
+    vector<double> times(samples.size());
+    Statistics stats;
+    double variance = 0.0;
+
+    DE_ASSERT(!samples.empty());
+
+    for (size_t sampleNdx = 0; sampleNdx < samples.size(); sampleNdx++)
+        times[sampleNdx] = (double)samples[sampleNdx].duration / (double)samples[sampleNdx].numIterations;
+
+    std::sort(times.begin(), times.end());
+
+    stats.minTime    = times.front();
+    stats.maxTime    = times.back();
+    stats.medianTime = (times.size() % 2 == 1) ? times[times.size() / 2] :
+                                                  (times[times.size() / 2 - 1] + times[times.size() / 2]) / 2.0;
+    stats.meanTime   = 0.0;
+
+    for (size_t ndx = 0; ndx < times.size(); ndx++)
+        stats.meanTime += times[ndx];
+    stats.meanTime /= (double)times.size();
+
+    for (size_t ndx = 0; ndx < times.size(); ndx++)
+        variance += (times[ndx] - stats.meanTime) * (times[ndx] - stats.meanTime);
+    stats.stdDevTime = deSqrt((float)(variance / (double)times.size()));
+
+    return stats;
+}
+
+} // namespace
+
+BenchmarkCase::BenchmarkCase(tcu::TestContext &testCtx, const char *name, const char *description)
+    : tcu::TestCase(testCtx, tcu::NODETYPE_PERFORMANCE, name, description)
+{
+}
+
+BenchmarkCase::~BenchmarkCase(void)
+{
+}
+
+uint64_t BenchmarkCase::getWorkloadSize(void) const
+{
+    return 0;
+}
+
+std::string BenchmarkCase::getWorkloadUnit(void) const
+{
+    return "";
+}
+
+BenchmarkCase::IterateResult BenchmarkCase::iterate(void)
+{
+    TestLog &log               = m_testCtx.getLog();
+    const bool logWasSupressed = log.isSupressLogging();
+    vector<Sample> samples;
+    int numWarmupIterations = 0;
+    int iterationsPerSample = 1;
+
+    tcu::warmupCPU();
+
+    log.supressLogging(true);
+
+    try
+    {
+        // Warm up caches and lazily initialized state, and estimate time per iteration.
+        {
+            const uint64_t startTime = deGetMicroseconds();
+            uint64_t elapsed         = 0;
+
+            while (numWarmupIterations < MIN_WARMUP_ITERATIONS || elapsed < (uint64_t)WARMUP_DURATION_US)
+            {
+                runIteration();
+                numWarmupIterations += 1;
+                elapsed = deGetMicroseconds() - startTime;
+            }
+
+            {
+                const uint64_t timePerIteration = de::max<uint64_t>(1u, elapsed / (uint64_t)numWarmupIterations);
+
+                iterationsPerSample =
+                    (int)de::clamp<uint64_t>((uint64_t)MIN_SAMPLE_DURATION_US / timePerIteration + 1u, 1u,
+                                             (uint64_t)MAX_ITERATIONS_PER_SAMPLE);
+            }
+        }
+
+        for (int sampleNdx = 0; sampleNdx < NUM_SAMPLES; sampleNdx++)
+        {
+            const uint64_t startTime = deGetMicroseconds();
+            Sample sample;
+
+            for (int iterNdx = 0; iterNdx < iterationsPerSample; iterNdx++)
+                runIteration();
+
+            sample.numIterations = iterationsPerSample;
+            sample.duration      = deGetMicroseconds() - startTime;
+            samples.push_back(sample);
+
+            m_testCtx.touchWatchdog();
+        }
+    }
+    catch (...)
+    {
+        log.supressLogging(logWasSupressed);
+        throw;
+    }
+
+    log.supressLogging(logWasSupressed);
+
+    log << TestLog::Integer("WarmupIterations", "Number of warm-up iterations", "", QP_KEY_TAG_NONE,
+                            numWarmupIterations)
+        << TestLog::Integer("IterationsPerSample", "Number of iterations per sample", "", QP_KEY_TAG_NONE,
+                            iterationsPerSample);
+
+    log << TestLog::SampleList("Samples", "Benchmark samples") << TestLog::SampleInfo
+        << TestLog::ValueInfo("Iterations", "Number of iterations", "", QP_SAMPLE_VALUE_TAG_PREDICTOR)
+        << TestLog::ValueInfo("Duration", "Duration of sample", "us", QP_SAMPLE_VALUE_TAG_RESPONSE)
+        << TestLog::EndSampleInfo;
+
+    for (size_t sampleNdx = 0; sampleNdx < samples.size(); sampleNdx++)
+        log << TestLog::Sample << samples[sampleNdx].numIterations << (int64_t)samples[sampleNdx].duration
+            << TestLog::EndSample;
+
+    log << TestLog::EndSampleList;
+
+    {
+        const Statistics stats = computePerIterationStatistics(samples);
+
+        log << TestLog::Float("MinTime", "Minimum time per iteration", "us", QP_KEY_TAG_TIME, (float)stats.minTime)
+            << TestLog::Float("MedianTime", "Median time per iteration", "us", QP_KEY_TAG_TIME, (float)stats.medianTime)
+            << TestLog::Float("MeanTime", "Mean time per iteration", "us", QP_KEY_TAG_TIME, (float)stats.meanTime)
+            << TestLog::Float("MaxTime", "Maximum time per iteration", "us", QP_KEY_TAG_TIME, (float)stats.maxTime)
+            << TestLog::Float("StdDevTime", "Standard deviation of time per iteration", "us", QP_KEY_TAG_TIME,
+                              (float)stats.stdDevTime);
+
+        if (getWorkloadSize() != 0 && stats.medianTime > 0.0)
+        {
+            const double throughput = (double)getWorkloadSize() / (stats.medianTime / 1000000.0);
+
+            log << TestLog::Float("Throughput", "Median throughput", getWorkloadUnit() + " / s", QP_KEY_TAG_PERFORMANCE,
+                                  (float)throughput);
+        }
+
+        m_testCtx.setTestResult(QP_TEST_RESULT_PASS, de::floatToString((float)stats.medianTime, 3).c_str());
+    }
+
+    return STOP;
+}
+
+} // namespace ditp
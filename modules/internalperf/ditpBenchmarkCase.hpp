@@ -0,0 +1,69 @@
+#ifndef _DITPBENCHMARKCASE_HPP
+#define _DITPBENCHMARKCASE_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Internal Benchmark Module
+ * --------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Base class for framework microbenchmarks.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "tcuTestCase.hpp"
+
+#include <string>
+
+namespace ditp
+{
+
+/*--------------------------------------------------------------------*//*!
+ * \brief Microbenchmark case
+ *
+ * Benchmark cases allocate their inputs in init() and implement the
+ * measured workload in runIteration().
+ *
+ * iterate() warms up the CPU and the workload, calibrates the number of
+ * iterations per sample so that a single sample is long enough to be
+ * measured reliably and then collects a fixed number of samples. Samples
+ * are written to the log as a sample list, followed by per-iteration
+ * statistics. Median time per iteration is reported as the result value.
+ *
+ * Test log is suppressed while the workload runs.
+ *//*--------------------------------------------------------------------*/
+class BenchmarkCase : public tcu::TestCase
+{
+public:
+    BenchmarkCase(tcu::TestContext &testCtx, const char *name, const char *description);
+    virtual ~BenchmarkCase(void);
+
+    IterateResult iterate(void);
+
+protected:
+    //! Run single iteration of the measured workload.
+    virtual void runIteration(void) = 0;
+
+    //! Amount of work done by single iteration, or 0 if throughput is not meaningful.
+    virtual uint64_t getWorkloadSize(void) const;
+
+    //! Unit of workload size, e.g. "pixels".
+    virtual std::string getWorkloadUnit(void) const;
+};
+
+} // namespace ditp
+
+#endif // _DITPBENCHMARKCASE_HPP
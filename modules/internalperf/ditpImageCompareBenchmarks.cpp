@@ -0,0 +1,197 @@
+/*-------------------------------------------------------------------------
+ * drawElements Internal Benchmark Module
+ * --------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Image comparison benchmarks.
+ *//*--------------------------------------------------------------------*/
+
+#include "ditpImageCompareBenchmarks.hpp"
+#include "ditpBenchmarkCase.hpp"
+#include "tcuImageCompare.hpp"
+#include "tcuTexture.hpp"
+#include "tcuTextureUtil.hpp"
+#include "tcuTestLog.hpp"
+#include "tcuRGBA.hpp"
+#include "tcuVectorUtil.hpp"
+
+#include "deRandom.hpp"
+#include "deString.h"
+#include "deUniquePtr.hpp"
+#include "deStringUtil.hpp"
+
+namespace ditp
+{
+
+using namespace tcu;
+
+namespace
+{
+
+enum CompareType
+{
+    COMPARETYPE_FUZZY = 0,
+    COMPARETYPE_BITWISE,
+    COMPARETYPE_INT_THRESHOLD,
+    COMPARETYPE_FLOAT_THRESHOLD,
+    COMPARETYPE_INT_POSITION_DEVIATION,
+    COMPARETYPE_BILINEAR,
+
+    COMPARETYPE_LAST
+};
+
+class ImageCompareBenchmark : public BenchmarkCase
+{
+public:
+    ImageCompareBenchmark(TestContext &testCtx, const char *name, CompareType compareType, int size)
+        : BenchmarkCase(testCtx, name, "Image comparison of nearly matching images")
+        , m_compareType(compareType)
+        , m_size(size)
+        , m_compareResult(false)
+    {
+    }
+
+    void init(void)
+    {
+        const TextureFormat format(TextureFormat::RGBA, TextureFormat::UNORM_INT8);
+        de::Random rnd(deStringHash(getName()));
+
+        m_reference.setStorage(format, m_size, m_size);
+        m_result.setStorage(format, m_size, m_size);
+
+        fillWithComponentGradients(m_reference.getAccess(), Vec4(0.0f), Vec4(1.0f));
+
+        // Result differs from reference by at most one unit per channel, except for bitwise compare.
+        for (int y = 0; y < m_size; y++)
+        {
+            for (int x = 0; x < m_size; x++)
+            {
+                const IVec4 refPixel = m_reference.getAccess().getPixelInt(x, y);
+                const IVec4 noise    = m_compareType == COMPARETYPE_BITWISE ?
+                                           IVec4(0) :
+                                           IVec4(rnd.getInt(-1, 1), rnd.getInt(-1, 1), rnd.getInt(-1, 1), 0);
+
+                m_result.getAccess().setPixel(clamp(refPixel + noise, IVec4(0), IVec4(255)), x, y);
+            }
+        }
+    }
+
+    void deinit(void)
+    {
+        m_reference.setStorage(m_reference.getFormat(), 0, 0);
+        m_result.setStorage(m_result.getFormat(), 0, 0);
+    }
+
+protected:
+    void runIteration(void)
+    {
+        TestLog &log                        = m_testCtx.getLog();
+        const ConstPixelBufferAccess refAcc = m_reference.getAccess();
+        const ConstPixelBufferAccess resAcc = m_result.getAccess();
+
+        switch (m_compareType)
+        {
+        case COMPARETYPE_FUZZY:
+            m_compareResult = fuzzyCompare(log, "Compare", "", refAcc, resAcc, 0.05f, COMPARE_LOG_ON_ERROR);
+            break;
+
+        case COMPARETYPE_BITWISE:
+            m_compareResult = bitwiseCompare(log, "Compare", "", refAcc, resAcc, COMPARE_LOG_ON_ERROR);
+            break;
+
+        case COMPARETYPE_INT_THRESHOLD:
+            m_compareResult = intThresholdCompare(log, "Compare", "", refAcc, resAcc, UVec4(1), COMPARE_LOG_ON_ERROR);
+            break;
+
+        case COMPARETYPE_FLOAT_THRESHOLD:
+            m_compareResult =
+                floatThresholdCompare(log, "Compare", "", refAcc, resAcc, Vec4(0.01f), COMPARE_LOG_ON_ERROR);
+            break;
+
+        case COMPARETYPE_INT_POSITION_DEVIATION:
+            m_compareResult = intThresholdPositionDeviationCompare(log, "Compare", "", refAcc, resAcc, UVec4(1),
+                                                                   IVec3(1, 1, 0), false, COMPARE_LOG_ON_ERROR);
+            break;
+
+        case COMPARETYPE_BILINEAR:
+            m_compareResult =
+                bilinearCompare(log, "Compare", "", refAcc, resAcc, RGBA(1, 1, 1, 1), COMPARE_LOG_ON_ERROR);
+            break;
+
+        default:
+            DE_ASSERT(false);
+        }
+    }
+
+    uint64_t getWorkloadSize(void) const
+    {
+        return (uint64_t)m_size * m_size;
+    }
+
+    std::string getWorkloadUnit(void) const
+    {
+        return "pixels";
+    }
+
+private:
+    const CompareType m_compareType;
+    const int m_size;
+    TextureLevel m_reference;
+    TextureLevel m_result;
+    bool m_compareResult;
+};
+
+} // namespace
+
+tcu::TestCaseGroup *createImageCompareBenchmarks(tcu::TestContext &testCtx)
+{
+    static const struct
+    {
+        const char *name;
+        CompareType type;
+    } compareTypes[] = {
+        {"fuzzy", COMPARETYPE_FUZZY},
+        {"bitwise", COMPARETYPE_BITWISE},
+        {"int_threshold", COMPARETYPE_INT_THRESHOLD},
+        {"float_threshold", COMPARETYPE_FLOAT_THRESHOLD},
+        {"int_position_deviation", COMPARETYPE_INT_POSITION_DEVIATION},
+        {"bilinear", COMPARETYPE_BILINEAR},
+    };
+    static const int sizes[] = {64, 256, 1024};
+
+    de::MovePtr<TestCaseGroup> compareGroup(new TestCaseGroup(testCtx, "image_compare"));
+
+    for (int typeNdx = 0; typeNdx < DE_LENGTH_OF_ARRAY(compareTypes); typeNdx++)
+    {
+        de::MovePtr<TestCaseGroup> typeGroup(new TestCaseGroup(testCtx, compareTypes[typeNdx].name));
+
+        for (int sizeNdx = 0; sizeNdx < DE_LENGTH_OF_ARRAY(sizes); sizeNdx++)
+        {
+            const std::string name = de::toString(sizes[sizeNdx]) + "x" + de::toString(sizes[sizeNdx]);
+
+            typeGroup->addChild(
+                new ImageCompareBenchmark(testCtx, name.c_str(), compareTypes[typeNdx].type, sizes[sizeNdx]));
+        }
+
+        compareGroup->addChild(typeGroup.release());
+    }
+
+    return compareGroup.release();
+}
+
+} // namespace ditp
@@ -0,0 +1,232 @@
+/*-------------------------------------------------------------------------
+ * drawElements Internal Benchmark Module
+ * --------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Reference renderer benchmarks.
+ *//*--------------------------------------------------------------------*/
+
+#include "ditpRendererBenchmarks.hpp"
+#include "ditpBenchmarkCase.hpp"
+#include "tcuTexture.hpp"
+#include "tcuTextureUtil.hpp"
+
+#include "rrRenderer.hpp"
+#include "rrShaders.hpp"
+#include "rrMultisamplePixelBufferAccess.hpp"
+
+#include "deRandom.hpp"
+#include "deString.h"
+#include "deUniquePtr.hpp"
+
+#include <vector>
+
+namespace ditp
+{
+
+using namespace tcu;
+using std::vector;
+
+namespace
+{
+
+class ColorVertexShader : public rr::VertexShader
+{
+public:
+    ColorVertexShader(void) : rr::VertexShader(2, 1)
+    {
+        m_inputs[0].type  = rr::GENERICVECTYPE_FLOAT;
+        m_inputs[1].type  = rr::GENERICVECTYPE_FLOAT;
+        m_outputs[0].type = rr::GENERICVECTYPE_FLOAT;
+    }
+
+    void shadeVertices(const rr::VertexAttrib *inputs, rr::VertexPacket *const *packets, const int numPackets) const
+    {
+        for (int packetNdx = 0; packetNdx < numPackets; packetNdx++)
+        {
+            rr::VertexPacket &packet = *packets[packetNdx];
+
+            packet.position   = rr::readVertexAttribFloat(inputs[0], packet.instanceNdx, packet.vertexNdx);
+            packet.outputs[0] = rr::readVertexAttribFloat(inputs[1], packet.instanceNdx, packet.vertexNdx);
+        }
+    }
+};
+
+class ColorFragmentShader : public rr::FragmentShader
+{
+public:
+    ColorFragmentShader(void) : rr::FragmentShader(1, 1)
+    {
+        m_inputs[0].type  = rr::GENERICVECTYPE_FLOAT;
+        m_outputs[0].type = rr::GENERICVECTYPE_FLOAT;
+    }
+
+    void shadeFragments(rr::FragmentPacket *packets, const int numPackets,
+                        const rr::FragmentShadingContext &context) const
+    {
+        for (int packetNdx = 0; packetNdx < numPackets; packetNdx++)
+        {
+            for (int fragNdx = 0; fragNdx < rr::NUM_FRAGMENTS_PER_PACKET; fragNdx++)
+                rr::writeFragmentOutput(context, packetNdx, fragNdx, 0,
+                                        rr::readTriangleVarying<float>(packets[packetNdx], context, 0, fragNdx));
+        }
+    }
+};
+
+struct DrawParams
+{
+    int numTriangles;
+    float triangleSize; //!< Size of triangle in normalized device coordinates.
+    int numSamples;
+    bool depthTest;
+    bool blend;
+};
+
+class DrawBenchmark : public BenchmarkCase
+{
+public:
+    DrawBenchmark(TestContext &testCtx, const char *name, const DrawParams &params)
+        : BenchmarkCase(testCtx, name, "rr::Renderer::draw() with interpolated color")
+        , m_params(params)
+    {
+    }
+
+    void init(void)
+    {
+        de::Random rnd(deStringHash(getName()));
+
+        m_color.setStorage(TextureFormat(TextureFormat::RGBA, TextureFormat::UNORM_INT8), m_params.numSamples,
+                           RENDER_SIZE, RENDER_SIZE);
+        m_depthStencil.setStorage(TextureFormat(TextureFormat::DS, TextureFormat::UNSIGNED_INT_24_8),
+                                  m_params.numSamples, RENDER_SIZE, RENDER_SIZE);
+
+        m_positions.resize(m_params.numTriangles * 3);
+        m_colors.resize(m_params.numTriangles * 3);
+
+        for (int triNdx = 0; triNdx < m_params.numTriangles; triNdx++)
+        {
+            const float maxOffset = 1.0f - m_params.triangleSize * 0.5f;
+            const Vec2 center(rnd.getFloat(-maxOffset, maxOffset), rnd.getFloat(-maxOffset, maxOffset));
+            const float depth = rnd.getFloat(-1.0f, 1.0f);
+
+            for (int vtxNdx = 0; vtxNdx < 3; vtxNdx++)
+            {
+                const Vec2 offset(rnd.getFloat(-0.5f, 0.5f) * m_params.triangleSize,
+                                  rnd.getFloat(-0.5f, 0.5f) * m_params.triangleSize);
+
+                m_positions[triNdx * 3 + vtxNdx] = Vec4(center.x() + offset.x(), center.y() + offset.y(), depth, 1.0f);
+                m_colors[triNdx * 3 + vtxNdx] =
+                    Vec4(rnd.getFloat(), rnd.getFloat(), rnd.getFloat(), m_params.blend ? 0.5f : 1.0f);
+            }
+        }
+    }
+
+    void deinit(void)
+    {
+        m_color.setStorage(m_color.getFormat(), 0, 0, 0);
+        m_depthStencil.setStorage(m_depthStencil.getFormat(), 0, 0, 0);
+        m_positions.clear();
+        m_colors.clear();
+    }
+
+protected:
+    void runIteration(void)
+    {
+        const ColorVertexShader vertexShader;
+        const ColorFragmentShader fragmentShader;
+        const rr::Program program(&vertexShader, &fragmentShader);
+        const rr::MultisamplePixelBufferAccess colorAccess =
+            rr::MultisamplePixelBufferAccess::fromMultisampleAccess(m_color.getAccess());
+        const rr::MultisamplePixelBufferAccess dsAccess =
+            rr::MultisamplePixelBufferAccess::fromMultisampleAccess(m_depthStencil.getAccess());
+        const rr::RenderTarget renderTarget(colorAccess, dsAccess, dsAccess);
+        const rr::VertexAttrib vertexAttribs[] = {
+            rr::VertexAttrib(rr::VERTEXATTRIBTYPE_FLOAT, 4, 0, 0, &m_positions[0]),
+            rr::VertexAttrib(rr::VERTEXATTRIBTYPE_FLOAT, 4, 0, 0, &m_colors[0])};
+        const rr::ViewportState viewport(colorAccess);
+        rr::RenderState state(viewport, rr::RenderState::DEFAULT_SUBPIXEL_BITS);
+        const rr::PrimitiveList primitives(rr::PRIMITIVETYPE_TRIANGLES, m_params.numTriangles * 3, 0);
+        const rr::Renderer renderer;
+
+        state.fragOps.depthTestEnabled = m_params.depthTest;
+        state.fragOps.depthFunc        = rr::TESTFUNC_LESS;
+
+        if (m_params.blend)
+        {
+            state.fragOps.blendMode             = rr::BLENDMODE_STANDARD;
+            state.fragOps.blendRGBState.srcFunc = rr::BLENDFUNC_SRC_ALPHA;
+            state.fragOps.blendRGBState.dstFunc = rr::BLENDFUNC_ONE_MINUS_SRC_ALPHA;
+        }
+
+        clear(m_color.getAccess(), Vec4(0.0f, 0.0f, 0.0f, 1.0f));
+        clearDepth(m_depthStencil.getAccess(), 1.0f);
+
+        renderer.draw(rr::DrawCommand(state, renderTarget, program, DE_LENGTH_OF_ARRAY(vertexAttribs), vertexAttribs,
+                                      primitives));
+    }
+
+    uint64_t getWorkloadSize(void) const
+    {
+        return (uint64_t)m_params.numTriangles;
+    }
+
+    std::string getWorkloadUnit(void) const
+    {
+        return "triangles";
+    }
+
+private:
+    enum
+    {
+        RENDER_SIZE = 256
+    };
+
+    const DrawParams m_params;
+    TextureLevel m_color;
+    TextureLevel m_depthStencil;
+    vector<Vec4> m_positions;
+    vector<Vec4> m_colors;
+};
+
+} // namespace
+
+tcu::TestCaseGroup *createRendererBenchmarks(tcu::TestContext &testCtx)
+{
+    static const struct
+    {
+        const char *name;
+        DrawParams params;
+    } cases[] = {
+        {"large_triangles", {2, 2.0f, 1, false, false}},
+        {"large_triangles_blend", {2, 2.0f, 1, false, true}},
+        {"large_triangles_msaa4", {2, 2.0f, 4, false, false}},
+        {"medium_triangles_depth", {64, 1.0f, 1, true, false}},
+        {"small_triangles", {4096, 0.05f, 1, false, false}},
+        {"small_triangles_depth", {4096, 0.05f, 1, true, false}},
+        {"small_triangles_msaa4", {4096, 0.05f, 4, true, false}},
+    };
+
+    de::MovePtr<TestCaseGroup> rendererGroup(new TestCaseGroup(testCtx, "renderer"));
+
+    for (int caseNdx = 0; caseNdx < DE_LENGTH_OF_ARRAY(cases); caseNdx++)
+        rendererGroup->addChild(new DrawBenchmark(testCtx, cases[caseNdx].name, cases[caseNdx].params));
+
+    return rendererGroup.release();
+}
+
+} // namespace ditp
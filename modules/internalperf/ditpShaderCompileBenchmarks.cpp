@@ -0,0 +1,187 @@
+/*-------------------------------------------------------------------------
+ * drawElements Internal Benchmark Module
+ * --------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Shader compilation benchmarks.
+ *//*--------------------------------------------------------------------*/
+
+#include "ditpShaderCompileBenchmarks.hpp"
+#include "ditpBenchmarkCase.hpp"
+#include "vkShaderProgram.hpp"
+#include "vkShaderToSpirV.hpp"
+#include "gluShaderProgram.hpp"
+#include "gluShaderUtil.hpp"
+
+#include "deUniquePtr.hpp"
+
+#include <vector>
+
+namespace ditp
+{
+
+using namespace tcu;
+
+namespace
+{
+
+static const char *const s_simpleVertexSource = "#version 450\n"
+                                                "layout(location = 0) in highp vec4 a_position;\n"
+                                                "layout(location = 1) in highp vec4 a_color;\n"
+                                                "layout(location = 0) out highp vec4 v_color;\n"
+                                                "void main (void)\n"
+                                                "{\n"
+                                                "    gl_Position = a_position;\n"
+                                                "    v_color = a_color;\n"
+                                                "}\n";
+
+static const char *const s_simpleFragmentSource = "#version 450\n"
+                                                  "layout(location = 0) in highp vec4 v_color;\n"
+                                                  "layout(location = 0) out highp vec4 o_color;\n"
+                                                  "void main (void)\n"
+                                                  "{\n"
+                                                  "    o_color = v_color;\n"
+                                                  "}\n";
+
+static const char *const s_complexFragmentSource =
+    "#version 450\n"
+    "layout(location = 0) in highp vec3 v_normal;\n"
+    "layout(location = 1) in highp vec3 v_position;\n"
+    "layout(location = 2) in highp vec2 v_texCoord;\n"
+    "layout(location = 0) out highp vec4 o_color;\n"
+    "layout(set = 0, binding = 0) uniform sampler2D u_sampler;\n"
+    "struct Light\n"
+    "{\n"
+    "    highp vec4 position;\n"
+    "    highp vec4 color;\n"
+    "};\n"
+    "layout(set = 0, binding = 1, std140) uniform Lights\n"
+    "{\n"
+    "    Light lights[16];\n"
+    "    int numLights;\n"
+    "};\n"
+    "highp vec3 shade (Light light, highp vec3 normal, highp vec3 position)\n"
+    "{\n"
+    "    highp vec3 toLight = light.position.xyz - position;\n"
+    "    highp float dist = length(toLight);\n"
+    "    highp float diffuse = max(dot(normal, toLight / dist), 0.0);\n"
+    "    highp vec3 halfVec = normalize(toLight / dist - normalize(position));\n"
+    "    highp float specular = pow(max(dot(normal, halfVec), 0.0), 32.0);\n"
+    "    return light.color.rgb * (diffuse + specular) / (1.0 + dist * dist);\n"
+    "}\n"
+    "void main (void)\n"
+    "{\n"
+    "    highp vec3 normal = normalize(v_normal);\n"
+    "    highp vec3 color = vec3(0.0);\n"
+    "    for (int ndx = 0; ndx < numLights; ndx++)\n"
+    "        color += shade(lights[ndx], normal, v_position);\n"
+    "    highp vec4 albedo = texture(u_sampler, v_texCoord);\n"
+    "    for (int ndx = 1; ndx < 4; ndx++)\n"
+    "        albedo += textureLod(u_sampler, v_texCoord * float(ndx * 2), float(ndx));\n"
+    "    o_color = vec4(color * albedo.rgb * 0.25, albedo.a);\n"
+    "}\n";
+
+static const char *const s_computeSource = "#version 450\n"
+                                           "layout(local_size_x = 64) in;\n"
+                                           "layout(set = 0, binding = 0, std430) buffer Input\n"
+                                           "{\n"
+                                           "    highp uint inValues[];\n"
+                                           "};\n"
+                                           "layout(set = 0, binding = 1, std430) buffer Output\n"
+                                           "{\n"
+                                           "    highp uint outValues[];\n"
+                                           "};\n"
+                                           "shared highp uint s_values[64];\n"
+                                           "void main (void)\n"
+                                           "{\n"
+                                           "    highp uint lid = gl_LocalInvocationIndex;\n"
+                                           "    s_values[lid] = inValues[gl_GlobalInvocationID.x];\n"
+                                           "    barrier();\n"
+                                           "    for (highp uint stride = 32u; stride > 0u; stride >>= 1u)\n"
+                                           "    {\n"
+                                           "        if (lid < stride)\n"
+                                           "            s_values[lid] += s_values[lid + stride];\n"
+                                           "        barrier();\n"
+                                           "    }\n"
+                                           "    if (lid == 0u)\n"
+                                           "        outValues[gl_WorkGroupID.x] = s_values[0];\n"
+                                           "}\n";
+
+class GlslCompileBenchmark : public BenchmarkCase
+{
+public:
+    GlslCompileBenchmark(TestContext &testCtx, const char *name, glu::ShaderType shaderType, const char *source)
+        : BenchmarkCase(testCtx, name, "Compile GLSL shader to SPIR-V")
+        , m_shaderType(shaderType)
+        , m_source(source)
+    {
+    }
+
+    void init(void)
+    {
+        m_program = vk::GlslSource();
+        m_program.sources[m_shaderType].push_back(m_source);
+
+        // Compile once to check compiler availability; throws NotSupportedError without glslang.
+        {
+            glu::ShaderProgramInfo buildInfo;
+
+            if (!vk::compileGlslToSpirV(m_program, &m_binary, &buildInfo))
+                throw TestError("Failed to compile benchmark shader");
+        }
+    }
+
+    void deinit(void)
+    {
+        m_binary.clear();
+    }
+
+protected:
+    void runIteration(void)
+    {
+        glu::ShaderProgramInfo buildInfo;
+
+        m_binary.clear();
+        vk::compileGlslToSpirV(m_program, &m_binary, &buildInfo);
+    }
+
+private:
+    const glu::ShaderType m_shaderType;
+    const char *const m_source;
+    vk::GlslSource m_program;
+    std::vector<uint32_t> m_binary;
+};
+
+} // namespace
+
+tcu::TestCaseGroup *createShaderCompileBenchmarks(tcu::TestContext &testCtx)
+{
+    de::MovePtr<TestCaseGroup> compileGroup(new TestCaseGroup(testCtx, "shader_compile"));
+
+    compileGroup->addChild(
+        new GlslCompileBenchmark(testCtx, "simple_vertex", glu::SHADERTYPE_VERTEX, s_simpleVertexSource));
+    compileGroup->addChild(
+        new GlslCompileBenchmark(testCtx, "simple_fragment", glu::SHADERTYPE_FRAGMENT, s_simpleFragmentSource));
+    compileGroup->addChild(
+        new GlslCompileBenchmark(testCtx, "complex_fragment", glu::SHADERTYPE_FRAGMENT, s_complexFragmentSource));
+    compileGroup->addChild(new GlslCompileBenchmark(testCtx, "compute", glu::SHADERTYPE_COMPUTE, s_computeSource));
+
+    return compileGroup.release();
+}
+
+} // namespace ditp
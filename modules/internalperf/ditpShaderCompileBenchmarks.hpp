@@ -0,0 +1,36 @@
+#ifndef _DITPSHADERCOMPILEBENCHMARKS_HPP
+#define _DITPSHADERCOMPILEBENCHMARKS_HPP
+/*-------------------------------------------------------------------------
+ * drawElements Internal Benchmark Module
+ * --------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Shader compilation benchmarks.
+ *//*--------------------------------------------------------------------*/
+
+#include "tcuDefs.hpp"
+#include "tcuTestCase.hpp"
+
+namespace ditp
+{
+
+tcu::TestCaseGroup *createShaderCompileBenchmarks(tcu::TestContext &testCtx);
+
+} // namespace ditp
+
+#endif // _DITPSHADERCOMPILEBENCHMARKS_HPP
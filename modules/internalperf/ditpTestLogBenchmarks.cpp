@@ -0,0 +1,236 @@
+/*-------------------------------------------------------------------------
+ * drawElements Internal Benchmark Module
+ * --------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Test log writing and case list parsing benchmarks.
+ *//*--------------------------------------------------------------------*/
+
+#include "ditpTestLogBenchmarks.hpp"
+#include "ditpBenchmarkCase.hpp"
+#include "tcuTestLog.hpp"
+#include "tcuCommandLine.hpp"
+#include "tcuTexture.hpp"
+#include "tcuTextureUtil.hpp"
+
+#include "deFile.h"
+#include "deUniquePtr.hpp"
+#include "deStringUtil.hpp"
+
+#include <sstream>
+
+namespace ditp
+{
+
+using namespace tcu;
+using std::string;
+
+namespace
+{
+
+enum LogContent
+{
+    LOGCONTENT_IMAGE_BEST = 0,
+    LOGCONTENT_IMAGE_UNCOMPRESSED,
+    LOGCONTENT_MESSAGES,
+
+    LOGCONTENT_LAST
+};
+
+class LogWriteBenchmark : public BenchmarkCase
+{
+public:
+    LogWriteBenchmark(TestContext &testCtx, const char *name, LogContent content)
+        : BenchmarkCase(testCtx, name, "Write a test case into a separate log file")
+        , m_content(content)
+    {
+    }
+
+    void init(void)
+    {
+        // Written next to the main log so that the results reflect the same file system.
+        m_logFileName = string(m_testCtx.getCommandLine().getLogFileName()) + ".ditp.tmp";
+
+        m_image.setStorage(TextureFormat(TextureFormat::RGBA, TextureFormat::UNORM_INT8), IMAGE_SIZE, IMAGE_SIZE);
+        fillWithComponentGradients(m_image.getAccess(), Vec4(0.0f), Vec4(1.0f));
+
+        m_log = de::MovePtr<TestLog>(new TestLog(m_logFileName.c_str(), m_testCtx.getCommandLine().getLogFlags()));
+        m_log->writeSessionInfo();
+    }
+
+    void deinit(void)
+    {
+        m_log.clear();
+        m_image.setStorage(m_image.getFormat(), 0, 0);
+
+        if (!m_logFileName.empty() && deFileExists(m_logFileName.c_str()))
+            deDeleteFile(m_logFileName.c_str());
+    }
+
+protected:
+    void runIteration(void)
+    {
+        m_log->startCase("dE-IT-PERF.test_log.case", QP_TEST_CASE_TYPE_PERFORMANCE);
+
+        switch (m_content)
+        {
+        case LOGCONTENT_IMAGE_BEST:
+            m_log->writeImage("Result", "Result image", m_image.getAccess(), Vec4(1.0f), Vec4(0.0f),
+                              QP_IMAGE_COMPRESSION_MODE_BEST);
+            break;
+
+        case LOGCONTENT_IMAGE_UNCOMPRESSED:
+            m_log->writeImage("Result", "Result image", m_image.getAccess(), Vec4(1.0f), Vec4(0.0f),
+                              QP_IMAGE_COMPRESSION_MODE_NONE);
+            break;
+
+        case LOGCONTENT_MESSAGES:
+            for (int msgNdx = 0; msgNdx < NUM_MESSAGES; msgNdx++)
+                *m_log << TestLog::Message << "Message " << msgNdx << ": value = " << Vec4((float)msgNdx)
+                       << TestLog::EndMessage;
+            break;
+
+        default:
+            DE_ASSERT(false);
+        }
+
+        m_log->endCase(QP_TEST_RESULT_PASS, "Pass");
+    }
+
+private:
+    enum
+    {
+        IMAGE_SIZE   = 128,
+        NUM_MESSAGES = 100
+    };
+
+    const LogContent m_content;
+    string m_logFileName;
+    TextureLevel m_image;
+    de::MovePtr<TestLog> m_log;
+};
+
+class CaseListParseBenchmark : public BenchmarkCase
+{
+public:
+    CaseListParseBenchmark(TestContext &testCtx, const char *name, bool useTrie)
+        : BenchmarkCase(testCtx, name, "Parse and query --deqp-caselist")
+        , m_useTrie(useTrie)
+        , m_numMatches(0)
+    {
+    }
+
+    void init(void)
+    {
+        std::ostringstream caseList;
+
+        if (m_useTrie)
+        {
+            caseList << "{dEQP-VK{";
+            for (int groupNdx = 0; groupNdx < NUM_GROUPS; groupNdx++)
+            {
+                caseList << (groupNdx != 0 ? "," : "") << "group" << groupNdx << "{";
+                for (int subGroupNdx = 0; subGroupNdx < NUM_SUBGROUPS; subGroupNdx++)
+                {
+                    caseList << (subGroupNdx != 0 ? "," : "") << "subgroup" << subGroupNdx << "{";
+                    for (int caseNdx = 0; caseNdx < NUM_CASES; caseNdx++)
+                        caseList << (caseNdx != 0 ? "," : "") << "case" << caseNdx;
+                    caseList << "}";
+                }
+                caseList << "}";
+            }
+            caseList << "}}";
+        }
+        else
+        {
+            for (int groupNdx = 0; groupNdx < NUM_GROUPS; groupNdx++)
+                for (int subGroupNdx = 0; subGroupNdx < NUM_SUBGROUPS; subGroupNdx++)
+                    for (int caseNdx = 0; caseNdx < NUM_CASES; caseNdx++)
+                        caseList << "dEQP-VK.group" << groupNdx << ".subgroup" << subGroupNdx << ".case" << caseNdx
+                                 << "\n";
+        }
+
+        m_caseList = caseList.str();
+    }
+
+    void deinit(void)
+    {
+        m_caseList.clear();
+    }
+
+protected:
+    void runIteration(void)
+    {
+        const char *argv[] = {"deqp", "--deqp-caselist", m_caseList.c_str()};
+        CommandLine cmdLine;
+        de::MovePtr<CaseListFilter> caseListFilter;
+
+        if (!cmdLine.parse(DE_LENGTH_OF_ARRAY(argv), argv))
+            TCU_FAIL("Failed to parse command line");
+
+        caseListFilter = cmdLine.createCaseListFilter(m_testCtx.getArchive());
+
+        m_numMatches = 0;
+        for (int groupNdx = 0; groupNdx < NUM_GROUPS; groupNdx++)
+        {
+            const string casePath = "dEQP-VK.group" + de::toString(groupNdx) + ".subgroup0.case0";
+
+            if (caseListFilter->checkTestCaseName(casePath.c_str()))
+                m_numMatches += 1;
+        }
+    }
+
+    uint64_t getWorkloadSize(void) const
+    {
+        return (uint64_t)NUM_GROUPS * NUM_SUBGROUPS * NUM_CASES;
+    }
+
+    std::string getWorkloadUnit(void) const
+    {
+        return "cases";
+    }
+
+private:
+    enum
+    {
+        NUM_GROUPS    = 10,
+        NUM_SUBGROUPS = 10,
+        NUM_CASES     = 100
+    };
+
+    const bool m_useTrie;
+    string m_caseList;
+    int m_numMatches;
+};
+
+} // namespace
+
+tcu::TestCaseGroup *createTestLogBenchmarks(tcu::TestContext &testCtx)
+{
+    de::MovePtr<TestCaseGroup> logGroup(new TestCaseGroup(testCtx, "test_log"));
+
+    logGroup->addChild(new LogWriteBenchmark(testCtx, "image_best_compression", LOGCONTENT_IMAGE_BEST));
+    logGroup->addChild(new LogWriteBenchmark(testCtx, "image_uncompressed", LOGCONTENT_IMAGE_UNCOMPRESSED));
+    logGroup->addChild(new LogWriteBenchmark(testCtx, "messages", LOGCONTENT_MESSAGES));
+    logGroup->addChild(new CaseListParseBenchmark(testCtx, "case_list_trie", true));
+    logGroup->addChild(new CaseListParseBenchmark(testCtx, "case_list_plain", false));
+
+    return logGroup.release();
+}
+
+} // namespace ditp
@@ -0,0 +1,84 @@
+/*-------------------------------------------------------------------------
+ * drawElements Internal Benchmark Module
+ * --------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief drawElements Internal Benchmark Package
+ *//*--------------------------------------------------------------------*/
+
+#include "ditpTestPackage.hpp"
+#include "ditpTextureBenchmarks.hpp"
+#include "ditpImageCompareBenchmarks.hpp"
+#include "ditpRendererBenchmarks.hpp"
+#include "ditpShaderCompileBenchmarks.hpp"
+#include "ditpTestLogBenchmarks.hpp"
+
+namespace ditp
+{
+
+class TestCaseExecutor : public tcu::TestCaseExecutor
+{
+public:
+    TestCaseExecutor(void)
+    {
+    }
+
+    ~TestCaseExecutor(void)
+    {
+    }
+
+    void init(tcu::TestCase *testCase, const std::string &)
+    {
+        testCase->init();
+    }
+
+    void deinit(tcu::TestCase *testCase)
+    {
+        testCase->deinit();
+    }
+
+    tcu::TestNode::IterateResult iterate(tcu::TestCase *testCase)
+    {
+        return testCase->iterate();
+    }
+};
+
+TestPackage::TestPackage(tcu::TestContext &testCtx)
+    : tcu::TestPackage(testCtx, "dE-IT-PERF", "drawElements Internal Benchmarks")
+{
+}
+
+TestPackage::~TestPackage(void)
+{
+}
+
+void TestPackage::init(void)
+{
+    addChild(createTextureBenchmarks(m_testCtx));
+    addChild(createImageCompareBenchmarks(m_testCtx));
+    addChild(createRendererBenchmarks(m_testCtx));
+    addChild(createShaderCompileBenchmarks(m_testCtx));
+    addChild(createTestLogBenchmarks(m_testCtx));
+}
+
+tcu::TestCaseExecutor *TestPackage::createExecutor(void) const
+{
+    return new TestCaseExecutor();
+}
+
+} // namespace ditp
@@ -0,0 +1,408 @@
+/*-------------------------------------------------------------------------
+ * drawElements Internal Benchmark Module
+ * --------------------------------------
+ *
+ * Copyright (c) 2026 The Khronos Group Inc.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ *//*!
+ * \file
+ * \brief Texture access, lookup verification and decompression benchmarks.
+ *//*--------------------------------------------------------------------*/
+
+#include "ditpTextureBenchmarks.hpp"
+#include "ditpBenchmarkCase.hpp"
+#include "tcuTexture.hpp"
+#include "tcuTextureUtil.hpp"
+#include "tcuTexLookupVerifier.hpp"
+#include "tcuCompressedTexture.hpp"
+#include "tcuAstcUtil.hpp"
+
+#include "deRandom.hpp"
+#include "deString.h"
+#include "deUniquePtr.hpp"
+#include "deStringUtil.hpp"
+
+#include <vector>
+
+namespace ditp
+{
+
+using namespace tcu;
+using std::vector;
+
+namespace
+{
+
+enum
+{
+    IMAGE_SIZE  = 256,
+    NUM_LOOKUPS = 1024
+};
+
+void fillWithGradients(const PixelBufferAccess &access)
+{
+    fillWithComponentGradients(access, Vec4(0.0f), Vec4(1.0f));
+}
+
+class CopyBenchmark : public BenchmarkCase
+{
+public:
+    CopyBenchmark(TestContext &testCtx, const char *name, const TextureFormat &srcFormat,
+                  const TextureFormat &dstFormat)
+        : BenchmarkCase(testCtx, name, "tcu::copy() between formats")
+        , m_srcFormat(srcFormat)
+        , m_dstFormat(dstFormat)
+    {
+    }
+
+    void init(void)
+    {
+        m_src.setStorage(m_srcFormat, IMAGE_SIZE, IMAGE_SIZE);
+        m_dst.setStorage(m_dstFormat, IMAGE_SIZE, IMAGE_SIZE);
+        fillWithGradients(m_src.getAccess());
+    }
+
+    void deinit(void)
+    {
+        m_src.setStorage(m_srcFormat, 0, 0);
+        m_dst.setStorage(m_dstFormat, 0, 0);
+    }
+
+protected:
+    void runIteration(void)
+    {
+        copy(m_dst.getAccess(), m_src.getAccess());
+    }
+
+    uint64_t getWorkloadSize(void) const
+    {
+        return (uint64_t)IMAGE_SIZE * IMAGE_SIZE;
+    }
+
+    std::string getWorkloadUnit(void) const
+    {
+        return "pixels";
+    }
+
+private:
+    const TextureFormat m_srcFormat;
+    const TextureFormat m_dstFormat;
+    TextureLevel m_src;
+    TextureLevel m_dst;
+};
+
+class GetPixelBenchmark : public BenchmarkCase
+{
+public:
+    GetPixelBenchmark(TestContext &testCtx, const char *name, const TextureFormat &format)
+        : BenchmarkCase(testCtx, name, "ConstPixelBufferAccess::getPixel() over whole image")
+        , m_format(format)
+        , m_sum(0.0f)
+    {
+    }
+
+    void init(void)
+    {
+        m_image.setStorage(m_format, IMAGE_SIZE, IMAGE_SIZE);
+        fillWithGradients(m_image.getAccess());
+    }
+
+    void deinit(void)
+    {
+        m_image.setStorage(m_format, 0, 0);
+    }
+
+protected:
+    void runIteration(void)
+    {
+        const ConstPixelBufferAccess access = m_image.getAccess();
+        Vec4 sum(0.0f);
+
+        for (int y = 0; y < access.getHeight(); y++)
+            for (int x = 0; x < access.getWidth(); x++)
+                sum += access.getPixel(x, y);
+
+        // Keep result alive so that the loop is not optimized away.
+        m_sum = sum;
+    }
+
+    uint64_t getWorkloadSize(void) const
+    {
+        return (uint64_t)IMAGE_SIZE * IMAGE_SIZE;
+    }
+
+    std::string getWorkloadUnit(void) const
+    {
+        return "pixels";
+    }
+
+private:
+    const TextureFormat m_format;
+    TextureLevel m_image;
+    Vec4 m_sum;
+};
+
+class LookupVerifyBenchmark : public BenchmarkCase
+{
+public:
+    LookupVerifyBenchmark(TestContext &testCtx, const char *name, Sampler::FilterMode minFilter,
+                          Sampler::FilterMode magFilter)
+        : BenchmarkCase(testCtx, name, "tcu::isLookupResultValid() on 2D texture")
+        , m_sampler(Sampler::REPEAT_GL, Sampler::REPEAT_GL, Sampler::REPEAT_GL, minFilter, magFilter)
+        , m_numValid(0)
+    {
+    }
+
+    void init(void)
+    {
+        const int size = 64;
+        de::Random rnd(deStringHash(getName()));
+
+        m_texture = de::MovePtr<Texture2D>(
+            new Texture2D(TextureFormat(TextureFormat::RGBA, TextureFormat::UNORM_INT8), size, size));
+
+        for (int levelNdx = 0; levelNdx < m_texture->getNumLevels(); levelNdx++)
+        {
+            m_texture->allocLevel(levelNdx);
+            fillWithComponentGradients(m_texture->getLevel(levelNdx), Vec4(0.0f, 0.25f, 0.5f, 1.0f),
+                                       Vec4(1.0f, 0.75f, 0.0f, 0.5f));
+        }
+
+        m_precision.coordBits      = IVec3(20);
+        m_precision.uvwBits        = IVec3(7);
+        m_precision.colorThreshold = computeFixedPointThreshold(IVec4(7));
+
+        m_coords.resize(NUM_LOOKUPS);
+        m_lods.resize(NUM_LOOKUPS);
+        m_results.resize(NUM_LOOKUPS);
+
+        for (int lookupNdx = 0; lookupNdx < NUM_LOOKUPS; lookupNdx++)
+        {
+            m_coords[lookupNdx] = Vec2(rnd.getFloat(-0.5f, 1.5f), rnd.getFloat(-0.5f, 1.5f));
+            m_lods[lookupNdx]   = rnd.getFloat(-1.0f, (float)m_texture->getNumLevels());
+            m_results[lookupNdx] =
+                m_texture->sample(m_sampler, m_coords[lookupNdx].x(), m_coords[lookupNdx].y(), m_lods[lookupNdx]);
+        }
+    }
+
+    void deinit(void)
+    {
+        m_texture.clear();
+        m_coords.clear();
+        m_lods.clear();
+        m_results.clear();
+    }
+
+protected:
+    void runIteration(void)
+    {
+        const Texture2DView view = *m_texture;
+        int numValid             = 0;
+
+        for (int lookupNdx = 0; lookupNdx < NUM_LOOKUPS; lookupNdx++)
+        {
+            const Vec2 lodBounds(m_lods[lookupNdx] - 0.05f, m_lods[lookupNdx] + 0.05f);
+
+            if (isLookupResultValid(view, m_sampler, m_precision, m_coords[lookupNdx], lodBounds, m_results[lookupNdx]))
+                numValid += 1;
+        }
+
+        m_numValid = numValid;
+    }
+
+    uint64_t getWorkloadSize(void) const
+    {
+        return NUM_LOOKUPS;
+    }
+
+    std::string getWorkloadUnit(void) const
+    {
+        return "lookups";
+    }
+
+private:
+    const Sampler m_sampler;
+    de::MovePtr<Texture2D> m_texture;
+    LookupPrecision m_precision;
+    vector<Vec2> m_coords;
+    vector<float> m_lods;
+    vector<Vec4> m_results;
+    int m_numValid;
+};
+
+class DecompressBenchmark : public BenchmarkCase
+{
+public:
+    DecompressBenchmark(TestContext &testCtx, const char *name, CompressedTexFormat format)
+        : BenchmarkCase(testCtx, name, "CompressedTexture::decompress()")
+        , m_format(format)
+    {
+    }
+
+    void init(void)
+    {
+        m_compressed.setStorage(m_format, IMAGE_SIZE, IMAGE_SIZE);
+        m_decompressed.setStorage(getUncompressedFormat(m_format), IMAGE_SIZE, IMAGE_SIZE);
+
+        if (isAstcFormat(m_format))
+        {
+            const size_t numBlocks = (size_t)m_compressed.getDataSize() / astc::BLOCK_SIZE_BYTES;
+
+            astc::generateRandomValidBlocks((uint8_t *)m_compressed.getData(), numBlocks, m_format,
+                                            TexDecompressionParams::ASTCMODE_LDR, deStringHash(getName()));
+        }
+        else
+        {
+            de::Random rnd(deStringHash(getName()));
+            uint8_t *const data = (uint8_t *)m_compressed.getData();
+
+            for (int byteNdx = 0; byteNdx < m_compressed.getDataSize(); byteNdx++)
+                data[byteNdx] = rnd.getUint8();
+
+            // ETC1 does not define overflowing differential base colors, use individual mode only.
+            if (m_format == COMPRESSEDTEXFORMAT_ETC1_RGB8)
+            {
+                for (int blockNdx = 0; blockNdx < m_compressed.getDataSize() / 8; blockNdx++)
+                    data[blockNdx * 8 + 3] &= (uint8_t)~0x02u;
+            }
+        }
+    }
+
+    void deinit(void)
+    {
+        m_compressed.setStorage(m_format, 0, 0);
+        m_decompressed.setStorage(getUncompressedFormat(m_format), 0, 0);
+    }
+
+protected:
+    void runIteration(void)
+    {
+        m_compressed.decompress(m_decompressed.getAccess(),
+                                TexDecompressionParams(isAstcFormat(m_format) ? TexDecompressionParams::ASTCMODE_LDR :
+                                                                                TexDecompressionParams::ASTCMODE_LAST));
+    }
+
+    uint64_t getWorkloadSize(void) const
+    {
+        return (uint64_t)IMAGE_SIZE * IMAGE_SIZE;
+    }
+
+    std::string getWorkloadUnit(void) const
+    {
+        return "pixels";
+    }
+
+private:
+    const CompressedTexFormat m_format;
+    CompressedTexture m_compressed;
+    TextureLevel m_decompressed;
+};
+
+struct NamedFormat
+{
+    const char *name;
+    TextureFormat format;
+};
+
+const NamedFormat s_formats[] = {
+    {"rgba8", TextureFormat(TextureFormat::RGBA, TextureFormat::UNORM_INT8)},
+    {"rgb8", TextureFormat(TextureFormat::RGB, TextureFormat::UNORM_INT8)},
+    {"srgb8_alpha8", TextureFormat(TextureFormat::sRGBA, TextureFormat::UNORM_INT8)},
+    {"rgba8_snorm", TextureFormat(TextureFormat::RGBA, TextureFormat::SNORM_INT8)},
+    {"rgb10_a2", TextureFormat(TextureFormat::RGBA, TextureFormat::UNORM_INT_1010102_REV)},
+    {"r11f_g11f_b10f", TextureFormat(TextureFormat::RGB, TextureFormat::UNSIGNED_INT_11F_11F_10F_REV)},
+    {"rgba16f", TextureFormat(TextureFormat::RGBA, TextureFormat::HALF_FLOAT)},
+    {"rgba32f", TextureFormat(TextureFormat::RGBA, TextureFormat::FLOAT)},
+    {"r32f", TextureFormat(TextureFormat::R, TextureFormat::FLOAT)},
+};
+
+} // namespace
+
+tcu::TestCaseGroup *createTextureBenchmarks(tcu::TestContext &testCtx)
+{
+    de::MovePtr<TestCaseGroup> textureGroup(new TestCaseGroup(testCtx, "texture"));
+
+    {
+        const TextureFormat rgba8(TextureFormat::RGBA, TextureFormat::UNORM_INT8);
+        const TextureFormat rgba32f(TextureFormat::RGBA, TextureFormat::FLOAT);
+        de::MovePtr<TestCaseGroup> copyGroup(new TestCaseGroup(testCtx, "copy"));
+
+        for (int formatNdx = 0; formatNdx < DE_LENGTH_OF_ARRAY(s_formats); formatNdx++)
+        {
+            const NamedFormat &format = s_formats[formatNdx];
+
+            copyGroup->addChild(new CopyBenchmark(testCtx, (std::string(format.name) + "_to_rgba8").c_str(),
+                                                  format.format, rgba8));
+            copyGroup->addChild(new CopyBenchmark(testCtx, (std::string(format.name) + "_to_rgba32f").c_str(),
+                                                  format.format, rgba32f));
+        }
+
+        textureGroup->addChild(copyGroup.release());
+    }
+
+    {
+        de::MovePtr<TestCaseGroup> getPixelGroup(new TestCaseGroup(testCtx, "get_pixel"));
+
+        for (int formatNdx = 0; formatNdx < DE_LENGTH_OF_ARRAY(s_formats); formatNdx++)
+            getPixelGroup->addChild(
+                new GetPixelBenchmark(testCtx, s_formats[formatNdx].name, s_formats[formatNdx].format));
+
+        textureGroup->addChild(getPixelGroup.release());
+    }
+
+    {
+        de::MovePtr<TestCaseGroup> verifyGroup(new TestCaseGroup(testCtx, "lookup_verify"));
+
+        verifyGroup->addChild(new LookupVerifyBenchmark(testCtx, "nearest", Sampler::NEAREST, Sampler::NEAREST));
+        verifyGroup->addChild(new LookupVerifyBenchmark(testCtx, "linear", Sampler::LINEAR, Sampler::LINEAR));
+        verifyGroup->addChild(new LookupVerifyBenchmark(testCtx, "linear_mipmap_linear", Sampler::LINEAR_MIPMAP_LINEAR,
+                                                        Sampler::LINEAR));
+
+        textureGroup->addChild(verifyGroup.release());
+    }
+
+    {
+        static const struct
+        {
+            const char *name;
+            CompressedTexFormat format;
+        } compressedFormats[] = {
+            {"etc1_rgb8", COMPRESSEDTEXFORMAT_ETC1_RGB8},
+            {"etc2_rgb8", COMPRESSEDTEXFORMAT_ETC2_RGB8},
+            {"etc2_eac_rgba8", COMPRESSEDTEXFORMAT_ETC2_EAC_RGBA8},
+            {"eac_r11", COMPRESSEDTEXFORMAT_EAC_R11},
+            {"eac_rg11", COMPRESSEDTEXFORMAT_EAC_RG11},
+            {"astc_4x4", COMPRESSEDTEXFORMAT_ASTC_4x4_RGBA},
+            {"astc_8x8", COMPRESSEDTEXFORMAT_ASTC_8x8_RGBA},
+            {"astc_12x12", COMPRESSEDTEXFORMAT_ASTC_12x12_RGBA},
+            {"bc1_rgba", COMPRESSEDTEXFORMAT_BC1_RGBA_UNORM_BLOCK},
+            {"bc3", COMPRESSEDTEXFORMAT_BC3_UNORM_BLOCK},
+            {"bc5", COMPRESSEDTEXFORMAT_BC5_UNORM_BLOCK},
+            {"bc6h_ufloat", COMPRESSEDTEXFORMAT_BC6H_UFLOAT_BLOCK},
+            {"bc7", COMPRESSEDTEXFORMAT_BC7_UNORM_BLOCK},
+        };
+        de::MovePtr<TestCaseGroup> decompressGroup(new TestCaseGroup(testCtx, "decompress"));
+
+        for (int formatNdx = 0; formatNdx < DE_LENGTH_OF_ARRAY(compressedFormats); formatNdx++)
+            decompressGroup->addChild(new DecompressBenchmark(testCtx, compressedFormats[formatNdx].name,
+                                                              compressedFormats[formatNdx].format));
+
+        textureGroup->addChild(decompressGroup.release());
+    }
+
+    return textureGroup.release();
+}
+
+} // namespace ditp